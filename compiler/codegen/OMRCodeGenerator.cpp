@@ -1744,7 +1744,7 @@ void
 OMR::CodeGenerator::reserveCodeCache()
    {
    int32_t numReserved = 0;
-   int32_t compThreadID = 0;
+   int32_t compThreadID = self()->comp()->getCompThreadID();
 
    _codeCache = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved);
 
@@ -103,6 +103,7 @@
 #include "ras/ILValidationStrategies.hpp"
 #include "ras/ILValidator.hpp"
 #include "ras/IlVerifier.hpp"
+#include "runtime/CompiledBodyCache.hpp"
 #include "control/Recompilation.hpp"
 #include "runtime/CodeCacheExceptions.hpp"
 #include "ilgen/IlGen.hpp"
@@ -283,6 +284,7 @@ OMR::Compilation::Compilation(
    _scratchSpaceLimit(TR::Options::_scratchSpaceLimit),
    _cpuTimeAtStartOfCompilation(-1),
    _ilVerifier(NULL),
+   _compiledBodyCache(NULL),
    _gpuPtxList(m),
    _gpuKernelLineNumberList(m),
    _gpuPtxCount(0),
@@ -1046,6 +1048,24 @@ int32_t OMR::Compilation::compile()
          }
 #endif
 
+      // A body previously compiled from identical IL makes optimization and
+      // code generation unnecessary
+      //
+      uint64_t compiledBodyKey = 0;
+      bool cacheCompiledBody = _compiledBodyCache && _compiledBodyCache->computeKey(self(), compiledBodyKey);
+      if (cacheCompiledBody)
+         {
+         uint8_t *cachedEntry = _compiledBodyCache->load(self(), compiledBodyKey);
+         if (cachedEntry)
+            {
+            if (self()->getOutFile() != NULL && self()->getOption(TR_TraceAll))
+               traceMsg(self(), "<loaded cached body key=\"%016llx\" entry=\"%p\"/>\n", (unsigned long long)compiledBodyKey, cachedEntry);
+            _methodSymbol->setMethodAddress(cachedEntry);
+            if (printCodegenTime) compTime.stopTiming(self());
+            return COMPILATION_SUCCEEDED;
+            }
+         }
+
       if (_recompilationInfo)
          {
          _recompilationInfo->beforeOptimization();
@@ -1116,6 +1136,9 @@ int32_t OMR::Compilation::compile()
            codegenTime.stopTiming(self());
         }
 
+      if (cacheCompiledBody)
+         _compiledBodyCache->store(self(), compiledBodyKey);
+
       if (_recompilationInfo)
          _recompilationInfo->endOfCompilation();
 
@@ -1244,6 +1267,12 @@ int32_t OMR::Compilation::compile()
    return COMPILATION_SUCCEEDED;
    }
 
+bool
+OMR::Compilation::needsStaticRelocations()
+   {
+   return self()->getOption(TR_EmitRelocatableELFFile) || _compiledBodyCache != NULL;
+   }
+
 int64_t OMR::Compilation::getCpuTimeSpentInCompilation()
    {
    if (_cpuTimeAtStartOfCompilation >= 0) // negative values means no support for compCPU
@@ -95,6 +95,7 @@ namespace TR { class CodeGenerator; }
 namespace TR { class Compilation; }
 namespace TR { class IlGenRequest; }
 namespace TR { class IlVerifier; }
+namespace TR { class CompiledBodyCache; }
 namespace TR { class ILValidator; }
 namespace TR { class Instruction; }
 namespace TR { class KnownObjectTable; }
@@ -753,6 +754,16 @@ public:
 
    void setIlVerifier(TR::IlVerifier *ilVerifier) { _ilVerifier = ilVerifier; }
 
+   void setCompiledBodyCache(TR::CompiledBodyCache *cache) { _compiledBodyCache = cache; }
+   TR::CompiledBodyCache *getCompiledBodyCache() { return _compiledBodyCache; }
+
+   /**
+    * @brief Whether the code generator must describe the addresses it embeds in
+    *        the generated code with TR::StaticRelocations so the code can be
+    *        linked or reinstalled elsewhere.
+    */
+   bool needsStaticRelocations();
+
    typedef std::pair<const void * const, TR::DebugCounterBase *> DebugCounterEntry;
    typedef TR::typed_allocator<DebugCounterEntry, TR::Allocator> DebugCounterMapAllocator;
    typedef std::map<const void *, TR::DebugCounterBase *, std::less<const void *>, DebugCounterMapAllocator> DebugCounterMap;
@@ -1318,6 +1329,7 @@ private:
    int64_t                           _cpuTimeAtStartOfCompilation;
 
    TR::IlVerifier                    *_ilVerifier;
+   TR::CompiledBodyCache             *_compiledBodyCache;
 
    ListHeadAndTail<char*> _gpuPtxList;
    ListHeadAndTail<int32_t> _gpuKernelLineNumberList; //TODO: fix to get real line numbers
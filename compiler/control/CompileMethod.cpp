@@ -270,7 +270,8 @@ compileMethodFromDetails(
       OMR_VMThread *omrVMThread,
       TR::IlGeneratorMethodDetails & details,
       TR_Hotness hotness,
-      int32_t &rc)
+      int32_t &rc,
+      int32_t compThreadID)
    {
    uint64_t translationStartTime = TR::Compiler->vm.getUSecClock();
    OMR::FrontEnd &fe = OMR::FrontEnd::singleton();
@@ -328,7 +329,7 @@ compileMethodFromDetails(
    // FIXME: perhaps use stack memory instead
 
    TR_ASSERT(TR::comp() == NULL, "there seems to be a current TLS TR::Compilation object %p for this thread. At this point there should be no current TR::Compilation object", TR::comp());
-   TR::Compilation compiler(0, omrVMThread, &fe, &compilee, request, options, dispatchRegion, &trMemory, plan);
+   TR::Compilation compiler(compThreadID, omrVMThread, &fe, &compilee, request, options, dispatchRegion, &trMemory, plan);
    TR_ASSERT(TR::comp() == &compiler, "the TLS TR::Compilation object %p for this thread does not match the one %p just created.", TR::comp(), &compiler);
 
    try
@@ -342,6 +343,7 @@ compileMethodFromDetails(
          }
 
       compiler.setIlVerifier(details.getIlVerifier());
+      compiler.setCompiledBodyCache(fe.compiledBodyCache());
 
       if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseCompileStart))
          {
@@ -432,6 +432,7 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
    {"disableLoopReplicatorColdSideEntryCheck","I\tdisable cold side-entry check for replicating loops containing hot inner loops", SET_OPTION_BIT(TR_DisableLoopReplicatorColdSideEntryCheck), "P"},
    {"disableLoopStrider",                 "O\tdisable loop strider",                           TR::Options::disableOptimization, loopStrider, 0, "P"},
    {"disableLoopTransfer",                "O\tdisable the loop transfer part of loop versioner", SET_OPTION_BIT(TR_DisableLoopTransfer), "F"},
+   {"disableLoopVectorization",           "O\tdisable loop vectorization",                    TR::Options::disableOptimization, loopVectorization, 0, "P"},
    {"disableLoopVersioner",               "O\tdisable loop versioner",                         TR::Options::disableOptimization, loopVersioner, 0, "P"},
    {"disableMarkingOfHotFields",          "O\tdisable marking of Hot Fields",                  SET_OPTION_BIT(TR_DisableMarkingOfHotFields), "F"},
    {"disableMarshallingIntrinsics",       "O\tDisable packed decimal to binary marshalling and un-marshalling optimization. They will not be inlined.", SET_OPTION_BIT(TR_DisableMarshallingIntrinsics), "F"},
@@ -1003,6 +1004,10 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
 
    {"optFile=",           "O<filename>\tRead in 'Performing' statements from <filename> and perform those opts instead of the usual ones",
         TR::Options::setString,  offsetof(OMR::Options,_optFileName), 0, "P%s"},
+   {"optimizationNodeBudget=", "O<nnn>\tskip expensive optional optimizations once the method has more than <nnn> IL nodes",
+        TR::Options::set32BitNumeric, offsetof(OMR::Options, _optimizationNodeBudget), 0, "F%d"},
+   {"optimizationTimeBudget=", "O<nnn>\tskip expensive optional optimizations once the optimizer has run for more than <nnn> ms",
+        TR::Options::set32BitNumeric, offsetof(OMR::Options, _optimizationTimeBudget), 0, "F%d"},
    {"optLevel=cold",      "O\tcompile all methods at cold level",      TR::Options::set32BitValue, offsetof(OMR::Options, _optLevel), cold, "P"},
    {"optLevel=hot",       "O\tcompile all methods at hot level",       TR::Options::set32BitValue, offsetof(OMR::Options, _optLevel), hot, "P"},
    {"optLevel=noOpt",     "O\tcompile all methods at noOpt level",     TR::Options::set32BitValue, offsetof(OMR::Options, _optLevel), noOpt, "P"},
@@ -1017,6 +1022,7 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
    {"paranoidOptCheck",   "O\tcheck the trees and cfgs after every optimization phase", SET_OPTION_BIT(TR_EnableParanoidOptCheck), "F"},
    {"performLookaheadAtWarmCold", "O\tallow lookahead to be performed at cold and warm", SET_OPTION_BIT(TR_PerformLookaheadAtWarmCold), "F"},
    {"perfTool", "M\tenable PerfTool", SET_OPTION_BIT(TR_PerfTool), "F", NOT_IN_SUBSET },
+   {"persistentCodeCacheDir=", "M<dir>\tstore compiled bodies in dir and reuse them in later runs", TR::Options::setString, offsetof(OMR::Options,_persistentCodeCacheDir), 0, "P%s", NOT_IN_SUBSET},
    {"poisonDeadSlots",    "O\tpaints all dead slots with deadf00d", SET_OPTION_BIT(TR_PoisonDeadSlots), "F"},
    {"prepareForOSREvenIfThatDoesNothing",   "O\temit the call to prepareForOSR even if there is no slot sharing", SET_OPTION_BIT(TR_EnablePrepareForOSREvenIfThatDoesNothing), "F"},
    {"printAbsoluteTimestampInVerboseLog", "O\tPrint Absolute Timestamp in vlog", SET_OPTION_BIT(TR_PrintAbsoluteTimestampInVerboseLog), "F", NOT_IN_SUBSET},
@@ -1184,6 +1190,7 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
    {"traceLoopReduction",               "L\ttrace loop reduction",                         TR::Options::traceOptimization, loopReduction, 0, "P"},
    {"traceLoopReplicator",              "L\ttrace loop replicator",                        TR::Options::traceOptimization, loopReplicator, 0, "P"},
    {"traceLoopStrider",                 "L\ttrace loop strider",                           TR::Options::traceOptimization, loopStrider,   0, "P"},
+   {"traceLoopVectorization",           "L\ttrace loop vectorization",                    TR::Options::traceOptimization, loopVectorization, 0, "P"},
    {"traceLoopVersioner",               "L\ttrace loop versioner",                          TR::Options::traceOptimization, loopVersioner, 0, "P"},
    {"traceMarkingOfHotFields",          "M\ttrace marking of Hot Fields",                 SET_OPTION_BIT(TR_TraceMarkingOfHotFields), "F"},
    {"traceMethodHandleTransformer",     "L\ttrace MethodHandle transformer",               TR::Options::traceOptimization, methodHandleTransformer, 0, "P"},
@@ -4830,6 +4837,7 @@ char *OMR::Options::_verboseOptionNames[TR_NumVerboseOptions] =
    "JITServer",
    "aotcompression",
    "JITServerConns",
+   "optimizationCosts",
    };
 
 
@@ -1070,6 +1070,7 @@ enum TR_VerboseFlags
    TR_VerboseJITServer,
    TR_VerboseAOTCompression,
    TR_VerboseJITServerConns,
+   TR_VerboseOptimizationCosts,
    //If adding new options add an entry to _verboseOptionNames as well
    TR_NumVerboseOptions        // Must be the last one;
    };
@@ -1852,6 +1853,14 @@ public:
    void disableCHOpts(); // disable CHOpts, but also IPA and prex which depend on the chtable
 
    const char *getObjectFileName() { return _objectFileName; }
+   const char *getPersistentCodeCacheDir() { return _persistentCodeCacheDir; }
+
+/**   \brief Returns the IL node count above which expensive optional optimizations are skipped, or 0 for no limit
+ */
+   int32_t getOptimizationNodeBudget() { return _optimizationNodeBudget; }
+/**   \brief Returns the optimizer time in ms above which expensive optional optimizations are skipped, or 0 for no limit
+ */
+   int32_t getOptimizationTimeBudget() { return _optimizationTimeBudget; }
 
 protected:
    void  jitPreProcess();
@@ -2328,6 +2337,9 @@ protected:
    int32_t                     _loopyAsyncCheckInsertionMaxEntryFreq;
 
    char *                      _objectFileName; //Name of the relocatable ELF file *.o if one is to be generated
+   char *                      _persistentCodeCacheDir; //Directory holding compiled bodies reused across runs, if any
+   int32_t                     _optimizationNodeBudget; //IL node count above which skipWhenOverBudget opts are not run
+   int32_t                     _optimizationTimeBudget; //optimizer time in ms above which skipWhenOverBudget opts are not run
 
    }; // TR::Options
 
@@ -41,7 +41,8 @@
 #include "il/Node_inlines.hpp"
 
 TR::FECommon::FECommon()
-   : TR_FrontEnd()
+   : TR_FrontEnd(),
+     _compiledBodyCache(NULL)
    {}
 
 
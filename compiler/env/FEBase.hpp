@@ -32,6 +32,7 @@
 #include "env/CompilerEnv.hpp"
 
 class TR_ResolvedMethod;
+namespace TR { class CompiledBodyCache; }
 
 namespace TR
 {
@@ -59,6 +60,13 @@ class FECommon : public ::TR_FrontEnd
 
    // need this so z codegen can create a sym ref to compare to another sym ref it cannot possibly be equal to
    virtual uintptr_t getOffsetOfIndexableSizeField() { return -1; }
+
+   // optional store of compiled bodies consulted by every compilation; NULL if none
+   TR::CompiledBodyCache *compiledBodyCache() { return _compiledBodyCache; }
+   void setCompiledBodyCache(TR::CompiledBodyCache *cache) { _compiledBodyCache = cache; }
+
+   private:
+   TR::CompiledBodyCache *_compiledBodyCache;
    };
 
 template <class T> struct FETraits {};
@@ -65,6 +65,7 @@ const char * TR_VerboseLog::_vlogTable[] =
    "#AOTCOMPRESSION: ",
    "#BenefitInliner: ",
    "#FSD: ",
+   "#OPTCOST: ",
    };
 
 void TR_VerboseLog::writeLine(TR_VlogTag tag, const char *format, ...)
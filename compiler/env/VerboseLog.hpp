@@ -73,6 +73,7 @@ enum TR_VlogTag
    TR_Vlog_AOTCOMPRESSION,
    TR_Vlog_BI,       //(benefit inliner)
    TR_Vlog_FSD,
+   TR_Vlog_OPTCOST,  //(per-optimization compile-time cost)
    TR_Vlog_numTags
    };
 
@@ -122,7 +122,9 @@ OMR::MethodBuilder::MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineS
    _inlineSiteIndex(-1),
    _nextInlineSiteIndex(0),
    _returnBuilder(NULL),
-   _returnSymbolName(NULL)
+   _returnSymbolName(NULL),
+   _invocationCounter(NULL),
+   _invocationCounterTripFunction(NULL)
    {
    _definingLine[0] = '\0';
    }
@@ -155,7 +157,9 @@ OMR::MethodBuilder::MethodBuilder(TR::MethodBuilder *callerMB, TR::VirtualMachin
    _inlineSiteIndex(callerMB->getNextInlineSiteIndex()),
    _nextInlineSiteIndex(0),
    _returnBuilder(NULL),
-   _returnSymbolName(NULL)
+   _returnSymbolName(NULL),
+   _invocationCounter(NULL),
+   _invocationCounterTripFunction(NULL)
    {
    _definingLine[0] = '\0';
    initialize(callerMB->_details, callerMB->_methodSymbol, callerMB->_fe, callerMB->_symRefTab);
@@ -229,6 +233,25 @@ OMR::MethodBuilder::setupForBuildIL()
 
    // set up initial CFG
    cfg()->addEdge(_entryBlock, _currentBlock);
+
+   if (_invocationCounter != NULL)
+      generateInvocationCounter();
+   }
+
+void
+OMR::MethodBuilder::generateInvocationCounter()
+   {
+   TraceIL("[ %p ] counting invocations at %p, calling %s when the count reaches zero\n", this, _invocationCounter, _invocationCounterTripFunction);
+
+   // the count is not decremented atomically: a lost update only delays the trip slightly
+   TR::IlType *pInt32 = _types->PointerTo(Int32);
+   TR::IlValue *counter = ConstAddress(_invocationCounter);
+   TR::IlValue *count = Sub(LoadAt(pInt32, counter), ConstInt32(1));
+   StoreAt(counter, count);
+
+   TR::IlBuilder *trip = NULL;
+   IfThen(&trip, EqualTo(count, ConstInt32(0)));
+   trip->Call(_invocationCounterTripFunction, 1, trip->ConstAddress(_invocationCounter));
    }
 
 uint32_t
@@ -717,13 +740,18 @@ OMR::MethodBuilder::GetNextBytecodeFromWorklist()
    }
 
 int32_t
-OMR::MethodBuilder::Compile(void **entry)
+OMR::MethodBuilder::Compile(void **entry, int32_t compThreadID, TR_Hotness hotness)
    {
    TR::ResolvedMethod resolvedMethod(static_cast<TR::MethodBuilder *>(this));
    TR::IlGeneratorMethodDetails details(&resolvedMethod);
 
+   // symbols defined while building IL (including compiler generated temps whose
+   // names live in compilation memory) must not leak into a later compilation
+   SymbolTypeMap symbolTypes(_symbolTypes);
+   SlotToSymNameMap symbolNameFromSlot(_symbolNameFromSlot);
+
    int32_t rc=0;
-   *entry = (void *) compileMethodFromDetails(NULL, details, warm, rc);
+   *entry = (void *) compileMethodFromDetails(NULL, details, hotness, rc, compThreadID);
 
    // let TypeDictionary know to clear out sym refs used in this compilation so
    // no dangling pointers
@@ -733,8 +761,27 @@ OMR::MethodBuilder::Compile(void **entry)
    // clear out symrefs allocated in this compilation (no dangling pointers)
    // and reset _connectedTrees so MethodBuilder can be inlined if needed
    _symbols.clear();
+   _symbolTypes = symbolTypes;
+   _symbolNameFromSlot = symbolNameFromSlot;
    _connectedTrees = false;
 
+   // in case this MethodBuilder object is compiled again, forget the blocks
+   // and the bytecode builder lists allocated in this compilation
+   _currentBlock = NULL;
+   _currentBlockNumber = -1;
+   _numBlocks = 0;
+   _blocks = NULL;
+   _blocksAllocatedUpFront = false;
+   _count = -1;
+   _comesBack = true;
+   _allBytecodeBuilders = NULL;
+   _bytecodeWorklist = NULL;
+   _bytecodeHasBeenInWorklist = NULL;
+
+   // invocation counters are requested per compilation
+   _invocationCounter = NULL;
+   _invocationCounterTripFunction = NULL;
+
    return rc;
    }
 
@@ -25,6 +25,7 @@
 #include <map>
 #include <set>
 #include <fstream>
+#include "compile/CompilationTypes.hpp"
 #include "env/TRMemory.hpp"
 #include "ilgen/IlBuilder.hpp"
 #include "env/TypedAllocator.hpp"
@@ -144,7 +145,27 @@ class MethodBuilder : public TR::IlBuilder
                        int32_t          numParms,
                        TR::IlType     ** parmTypes);
 
-   int32_t Compile(void **entry);
+   /**
+    * @brief compile this MethodBuilder and return its entry point in entry
+    * @param compThreadID the compilation thread performing the compile, or 0 for the calling thread
+    * @param hotness the optimization level to compile at
+    * @returns the compilation return code (0 on success)
+    */
+   int32_t Compile(void **entry, int32_t compThreadID = 0, TR_Hotness hotness = warm);
+
+   /**
+    * @brief count invocations of the body produced by the next Compile() of this MethodBuilder
+    * @param counter the location decremented on every entry to the compiled body
+    * @param tripFunction name of a defined function, taking the address of counter, that is called
+    *        on the entry that brings counter to zero
+    * The counter applies to a single compilation: Compile() resets it, so a later
+    * recompilation of this MethodBuilder does not count invocations unless asked to again.
+    */
+   void setInvocationCounter(int32_t *counter, const char *tripFunction)
+      {
+      _invocationCounter = counter;
+      _invocationCounterTripFunction = tripFunction;
+      }
 
    /**
     * @brief will be called if a Call is issued to a function that has not yet been defined, provides a
@@ -296,6 +317,11 @@ class MethodBuilder : public TR::IlBuilder
     */
    const char * adjustNameForInlinedSite(const char *name);
 
+   /*
+    * @brief generates the invocation counter requested by setInvocationCounter() at the start of the method
+    */
+   void generateInvocationCounter();
+
    private:
    // We have MemoryManager as the first member of TypeDictionary, so that
    // it is the last one to get destroyed and all objects allocated using
@@ -388,6 +414,9 @@ class MethodBuilder : public TR::IlBuilder
    TR::IlBuilder             * _returnBuilder;
    const char                * _returnSymbolName;
 
+   int32_t                   * _invocationCounter;
+   const char                * _invocationCounterTripFunction;
+
 private:
    static ClientAllocator      _clientAllocator;
    static ImplGetter _getImpl;
@@ -0,0 +1,842 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "optimizer/LoopVectorizer.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include "codegen/CodeGenerator.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/TRMemory.hpp"
+#include "il/Block.hpp"
+#include "il/DataTypes.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/Cfg.hpp"
+#include "infra/CfgEdge.hpp"
+#include "infra/Checklist.hpp"
+#include "infra/List.hpp"
+#include "optimizer/InductionVariable.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "optimizer/Structure.hpp"
+
+// Upper bound on the number of runtime overlap checks in a vectorization guard
+#define MAX_OVERLAP_CHECKS 8
+
+TR_LoopVectorizer::TR_LoopVectorizer(TR::OptimizationManager *manager)
+   : TR::Optimization(manager)
+   {}
+
+bool
+TR_LoopVectorizer::shouldPerform()
+   {
+   if (comp()->getOption(TR_DisableAutoSIMD) || !cg()->getSupportsAutoSIMD())
+      {
+      if (trace())
+         traceMsg(comp(), "Auto SIMD is not supported -- returning from loop vectorization.\n");
+      return false;
+      }
+
+   if (!comp()->mayHaveLoops())
+      {
+      if (trace())
+         traceMsg(comp(), "Method does not have loops -- returning from loop vectorization.\n");
+      return false;
+      }
+
+   return true;
+   }
+
+int32_t
+TR_LoopVectorizer::perform()
+   {
+   TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+
+   if (trace())
+      comp()->dumpMethodTrees("Before loop vectorization");
+
+   // Candidates are analyzed while structure is still valid, then transformed
+   TR_ScratchList<LoopInfo> candidates(trMemory());
+   collectLoops(comp()->getFlowGraph()->getStructure(), candidates);
+
+   if (candidates.isEmpty())
+      return 0;
+
+   comp()->getFlowGraph()->setStructure(NULL);
+
+   ListIterator<LoopInfo> it(&candidates);
+   for (LoopInfo *li = it.getFirst(); li; li = it.getNext())
+      transformLoop(li);
+
+   optimizer()->setUseDefInfo(NULL);
+   optimizer()->setValueNumberInfo(NULL);
+   optimizer()->setAliasSetsAreValid(false);
+   requestOpt(OMR::inductionVariableAnalysis);
+
+   if (trace())
+      comp()->dumpMethodTrees("After loop vectorization");
+
+   return candidates.getSize();
+   }
+
+const char *
+TR_LoopVectorizer::optDetailString() const throw()
+   {
+   return "O^O LOOP VECTORIZER: ";
+   }
+
+void
+TR_LoopVectorizer::collectLoops(TR_Structure *str, TR_ScratchList<LoopInfo> &candidates)
+   {
+   TR_RegionStructure *region = str->asRegion();
+   if (region == NULL)
+      return;
+
+   TR_RegionStructure::Cursor it(*region);
+   for (TR_StructureSubGraphNode *node = it.getCurrent(); node; node = it.getNext())
+      collectLoops(node->getStructure(), candidates);
+
+   if (!region->isNaturalLoop())
+      return;
+
+   LoopInfo *li = new (trStackMemory()) LoopInfo(trMemory());
+   if (analyzeLoop(region, li)
+       && performTransformation(comp(), "%sVectorizing loop %d (block_%d) with %d lanes of %s\n", optDetailString(),
+             region->getNumber(), li->_loopBlock->getNumber(), li->_vectorLength, li->_elementType.toString()))
+      candidates.add(li);
+   }
+
+bool
+TR_LoopVectorizer::analyzeLoop(TR_RegionStructure *loop, LoopInfo *li)
+   {
+   if (loop->numSubNodes() != 1 || !loop->getEntry()->getStructure()->asBlock())
+      {
+      dumpOptDetails(comp(), "Loop %d is not a single block loop\n", loop->getNumber());
+      return false;
+      }
+
+   TR::Block *block = loop->getEntryBlock();
+   if (block->isCold()
+       || !block->getExceptionSuccessors().empty()
+       || !block->getExceptionPredecessors().empty())
+      {
+      dumpOptDetails(comp(), "Loop %d is cold or has exception edges\n", loop->getNumber());
+      return false;
+      }
+
+   TR_PrimaryInductionVariable *piv = loop->getPrimaryInductionVariable();
+   if (!piv
+       || piv->getBranchBlock() != block
+       || piv->getDeltaOnBackEdge() != 1
+       || piv->isUnsigned()
+       || piv->getSymRef()->getSymbol()->getDataType() != TR::Int32
+       || !piv->getSymRef()->getSymbol()->isAutoOrParm())
+      {
+      dumpOptDetails(comp(), "Loop %d does not count up by one\n", loop->getNumber());
+      return false;
+      }
+
+   li->_loopBlock = block;
+   li->_ivSymRef = piv->getSymRef();
+
+   // Entries into the loop are redirected to the vectorization guard, so each
+   // must reach the loop by falling through or by a single target branch
+   for (auto e = block->getPredecessors().begin(); e != block->getPredecessors().end(); ++e)
+      {
+      TR::Block *pred = toBlock((*e)->getFrom());
+      if (pred == block)
+         continue;
+
+      if (!pred->getEntry()
+          || pred->getLastRealTreeTop()->getNode()->getOpCode().isSwitch()
+          || pred->getLastRealTreeTop()->getNode()->getOpCode().isJumpWithMultipleTargets())
+         {
+         dumpOptDetails(comp(), "Loop %d has an entry that cannot be redirected\n", loop->getNumber());
+         return false;
+         }
+      }
+
+   TR::TreeTop *branchTree = block->getLastRealTreeTop();
+   TR::Node *branch = branchTree->getNode();
+   if (branch->getOpCodeValue() != TR::ificmplt
+       || branch->getBranchDestination() != block->getEntry())
+      {
+      dumpOptDetails(comp(), "Loop %d is not closed by ificmplt\n", loop->getNumber());
+      return false;
+      }
+
+   li->_exitBlock = block->getNextBlock();
+   if (!li->_exitBlock || !block->hasSuccessor(li->_exitBlock))
+      {
+      dumpOptDetails(comp(), "Loop %d does not exit by falling through\n", loop->getNumber());
+      return false;
+      }
+
+   TR::TreeTop *ivStoreTree = branchTree->getPrevTreeTop();
+   TR::Node *ivStore = ivStoreTree->getNode();
+   if (ivStore->getOpCodeValue() != TR::istore || ivStore->getSymbolReference() != li->_ivSymRef)
+      {
+      dumpOptDetails(comp(), "Loop %d does not increment its induction variable before the loop test\n", loop->getNumber());
+      return false;
+      }
+
+   // The simplifier may have turned iv + 1 into iv - -1
+   TR::Node *increment = ivStore->getFirstChild();
+   int32_t step = increment->getOpCodeValue() == TR::iadd ? 1 : -1;
+   if ((increment->getOpCodeValue() != TR::iadd && increment->getOpCodeValue() != TR::isub)
+       || !isInductionVariableLoad(li, increment->getFirstChild())
+       || increment->getSecondChild()->getOpCodeValue() != TR::iconst
+       || increment->getSecondChild()->getInt() != step)
+      {
+      dumpOptDetails(comp(), "Loop %d does not increment its induction variable by one\n", loop->getNumber());
+      return false;
+      }
+
+   li->_ivStoreTree = ivStoreTree;
+
+   // The loop test must see the incremented value: either the increment
+   // itself or a load that is first evaluated after the store
+   TR::Node *testedValue = branch->getFirstChild();
+   if (testedValue != increment
+       && (!isInductionVariableLoad(li, testedValue) || testedValue->getReferenceCount() != 1))
+      {
+      dumpOptDetails(comp(), "Loop %d does not test the incremented induction variable\n", loop->getNumber());
+      return false;
+      }
+
+   // Direct stores other than the induction variable update are reductions;
+   // their element type, or that of the array stores, drives the vector type
+   for (TR::TreeTop *tt = block->getFirstRealTreeTop(); tt != branchTree; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      if (node->getOpCode().isStoreDirect())
+         {
+         if (li->_storedSymRefs.find(node->getSymbolReference())
+             || (tt != ivStoreTree && !setElementType(li, node->getDataType())))
+            {
+            dumpOptDetails(comp(), "Loop %d has unsupported store n%dn\n", loop->getNumber(), node->getGlobalIndex());
+            return false;
+            }
+         li->_storedSymRefs.add(node->getSymbolReference());
+         }
+      else if (node->getOpCode().isStoreIndirect()
+               && node->getSymbol()->isArrayShadowSymbol()
+               && !setElementType(li, node->getDataType()))
+         {
+         dumpOptDetails(comp(), "Loop %d mixes element types\n", loop->getNumber());
+         return false;
+         }
+      }
+
+   if (li->_elementType == TR::NoType)
+      {
+      dumpOptDetails(comp(), "Loop %d has no array stores or reductions\n", loop->getNumber());
+      return false;
+      }
+
+   li->_bound = branch->getSecondChild();
+   if (li->_bound->getOpCodeValue() != TR::iconst
+       && !(li->_bound->getOpCodeValue() == TR::iload && isLoopInvariantLoad(li, li->_bound)))
+      {
+      dumpOptDetails(comp(), "Loop %d does not have an invariant bound\n", loop->getNumber());
+      return false;
+      }
+
+   TR::NodeChecklist vectorizable(comp());
+   for (TR::TreeTop *tt = block->getFirstRealTreeTop(); tt != ivStoreTree; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      if (node->getOpCodeValue() == TR::treetop)
+         {
+         TR::Node *child = node->getFirstChild();
+         if (!isScalarExpression(li, child) && !isVectorizable(li, child, vectorizable))
+            {
+            dumpOptDetails(comp(), "Loop %d anchors node n%dn that cannot be vectorized\n", loop->getNumber(), child->getGlobalIndex());
+            return false;
+            }
+         }
+      else if (node->getOpCode().isStoreIndirect() && node->getSymbol()->isArrayShadowSymbol())
+         {
+         if (!isArrayElementAddress(li, node->getFirstChild())
+             || !supportsVectorOpCode(li, TR::vstorei)
+             || !isVectorizable(li, node->getSecondChild(), vectorizable))
+            {
+            dumpOptDetails(comp(), "Loop %d has array store n%dn that cannot be vectorized\n", loop->getNumber(), node->getGlobalIndex());
+            return false;
+            }
+         li->_storeBases.add(node->getFirstChild()->getFirstChild());
+         }
+      else if (node->getOpCode().isStoreDirect())
+         {
+         if (!analyzeReduction(li, tt, vectorizable))
+            {
+            dumpOptDetails(comp(), "Loop %d has store n%dn that is not a sum reduction\n", loop->getNumber(), node->getGlobalIndex());
+            return false;
+            }
+         li->_reductionTrees.add(tt);
+         }
+      else
+         {
+         dumpOptDetails(comp(), "Loop %d has unsupported tree n%dn\n", loop->getNumber(), node->getGlobalIndex());
+         return false;
+         }
+      }
+
+   if (!collectOverlapPairs(li))
+      {
+      dumpOptDetails(comp(), "Loop %d accesses too many arrays to check for overlap\n", loop->getNumber());
+      return false;
+      }
+
+   return true;
+   }
+
+bool
+TR_LoopVectorizer::analyzeReduction(LoopInfo *li, TR::TreeTop *tree, TR::NodeChecklist &vectorizable)
+   {
+   TR::Node *store = tree->getNode();
+   TR::Node *sum = store->getFirstChild();
+
+   if (!store->getSymbol()->isAutoOrParm()
+       || !sum->getOpCode().isAdd()
+       || sum->getDataType() != li->_elementType
+       || sum->getReferenceCount() != 1)
+      return false;
+
+   // Vector lanes are summed in a different order than the scalar loop would
+   if (li->_elementType.isFloatingPoint() && !comp()->getOption(TR_IgnoreIEEERestrictions))
+      return false;
+
+   int32_t accumulatorIndex = -1;
+   for (int32_t i = 0; i < 2; i++)
+      {
+      TR::Node *child = sum->getChild(i);
+      if (child->getOpCode().isLoadVarDirect() && child->getSymbolReference() == store->getSymbolReference())
+         accumulatorIndex = i;
+      }
+
+   if (accumulatorIndex < 0 || sum->getChild(accumulatorIndex)->getReferenceCount() != 1)
+      return false;
+
+   return supportsVectorOpCode(li, TR::vsplats)
+      && supportsVectorOpCode(li, TR::vadd)
+      && supportsVectorOpCode(li, TR::vload)
+      && supportsVectorOpCode(li, TR::vstore)
+      && supportsVectorOpCode(li, TR::getvelem)
+      && isVectorizable(li, sum->getChild(1 - accumulatorIndex), vectorizable);
+   }
+
+bool
+TR_LoopVectorizer::setElementType(LoopInfo *li, TR::DataType type)
+   {
+   if (li->_elementType != TR::NoType)
+      return li->_elementType == type;
+
+   if (type != TR::Int8 && type != TR::Int16 && type != TR::Int32 && type != TR::Int64
+       && type != TR::Float && type != TR::Double)
+      return false;
+
+   li->_elementType = type;
+   li->_vectorLength = TR::DataType::getSize(type.scalarToVector()) / TR::DataType::getSize(type);
+   return true;
+   }
+
+bool
+TR_LoopVectorizer::isInductionVariableLoad(LoopInfo *li, TR::Node *node)
+   {
+   return node->getOpCodeValue() == TR::iload && node->getSymbolReference() == li->_ivSymRef;
+   }
+
+bool
+TR_LoopVectorizer::isLoopInvariantLoad(LoopInfo *li, TR::Node *node)
+   {
+   return node->getOpCode().isLoadVarDirect()
+      && node->getSymbol()->isAutoOrParm()
+      && !li->_storedSymRefs.find(node->getSymbolReference());
+   }
+
+/**
+ * Matches base + iv * elementSize, with the scale written as a multiply or
+ * a shift, and the index widened with i2l on 64-bit targets.
+ */
+bool
+TR_LoopVectorizer::isArrayElementAddress(LoopInfo *li, TR::Node *address)
+   {
+   bool is64Bit = comp()->target().is64Bit();
+   if (address->getOpCodeValue() != (is64Bit ? TR::aladd : TR::aiadd))
+      return false;
+
+   TR::Node *base = address->getFirstChild();
+   if (base->getDataType() != TR::Address || !isLoopInvariantLoad(li, base))
+      return false;
+
+   int32_t elementSize = TR::DataType::getSize(li->_elementType);
+   TR::Node *index = address->getSecondChild();
+   if (elementSize > 1)
+      {
+      if (index->getNumChildren() != 2 || !index->getSecondChild()->getOpCode().isLoadConst())
+         return false;
+
+      int64_t scale = index->getSecondChild()->get64bitIntegralValue();
+      if (index->getOpCodeValue() == (is64Bit ? TR::lmul : TR::imul))
+         {
+         if (scale != elementSize)
+            return false;
+         }
+      else if (index->getOpCodeValue() == (is64Bit ? TR::lshl : TR::ishl))
+         {
+         if (scale < 0 || scale > 3 || (1 << scale) != elementSize)
+            return false;
+         }
+      else
+         {
+         return false;
+         }
+
+      index = index->getFirstChild();
+      }
+
+   if (is64Bit)
+      {
+      if (index->getOpCodeValue() != TR::i2l)
+         return false;
+      index = index->getFirstChild();
+      }
+
+   return isInductionVariableLoad(li, index);
+   }
+
+/**
+ * Scalar expressions are address computations and loop invariant values
+ * that front ends anchor ahead of the array accesses that use them. They
+ * are duplicated as is into the vector loop.
+ */
+bool
+TR_LoopVectorizer::isScalarExpression(LoopInfo *li, TR::Node *node)
+   {
+   if (node->getOpCode().isLoadConst()
+       || isInductionVariableLoad(li, node)
+       || isLoopInvariantLoad(li, node)
+       || isArrayElementAddress(li, node))
+      return true;
+
+   switch (node->getOpCodeValue())
+      {
+      case TR::i2l:
+      case TR::imul:
+      case TR::ishl:
+      case TR::lmul:
+      case TR::lshl:
+         for (int32_t i = 0; i < node->getNumChildren(); i++)
+            {
+            if (!isScalarExpression(li, node->getChild(i)))
+               return false;
+            }
+         return true;
+      default:
+         return false;
+      }
+   }
+
+bool
+TR_LoopVectorizer::isVectorizable(LoopInfo *li, TR::Node *node, TR::NodeChecklist &vectorizable)
+   {
+   if (vectorizable.contains(node))
+      return true;
+
+   if (node->getDataType() != li->_elementType)
+      return false;
+
+   TR::ILOpCode &op = node->getOpCode();
+   if (op.isLoadConst() || isLoopInvariantLoad(li, node))
+      {
+      if (!supportsVectorOpCode(li, TR::vsplats))
+         return false;
+      }
+   else if (op.isLoadIndirect() && node->getSymbol()->isArrayShadowSymbol())
+      {
+      if (!isArrayElementAddress(li, node->getFirstChild()) || !supportsVectorOpCode(li, TR::vloadi))
+         return false;
+      li->_loadBases.add(node->getFirstChild()->getFirstChild());
+      }
+   else
+      {
+      TR::ILOpCodes vectorOp = TR::ILOpCode::convertScalarToVector(node->getOpCodeValue());
+      switch (vectorOp)
+         {
+         case TR::vadd:
+         case TR::vsub:
+         case TR::vmul:
+         case TR::vdiv:
+         case TR::vand:
+         case TR::vor:
+         case TR::vxor:
+         case TR::vneg:
+            break;
+         default:
+            return false;
+         }
+
+      if (!supportsVectorOpCode(li, vectorOp))
+         return false;
+
+      for (int32_t i = 0; i < node->getNumChildren(); i++)
+         {
+         if (!isVectorizable(li, node->getChild(i), vectorizable))
+            return false;
+         }
+      }
+
+   vectorizable.add(node);
+   return true;
+   }
+
+bool
+TR_LoopVectorizer::supportsVectorOpCode(LoopInfo *li, TR::ILOpCodes op)
+   {
+   return cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode(op), li->_elementType);
+   }
+
+/**
+ * Pairs every stored array base with every other array base the loop
+ * accesses. Bases loaded from the same symbol are the same array and are
+ * only ever accessed at the same index, so they need no check.
+ */
+bool
+TR_LoopVectorizer::collectOverlapPairs(LoopInfo *li)
+   {
+   int32_t numPairs = 0;
+   ListIterator<TR::Node> storeIt(&li->_storeBases);
+   for (TR::Node *store = storeIt.getFirst(); store; store = storeIt.getNext())
+      {
+      TR_ScratchList<TR::Node> *lists[] = { &li->_storeBases, &li->_loadBases };
+      for (int32_t l = 0; l < 2; l++)
+         {
+         ListIterator<TR::Node> otherIt(lists[l]);
+         for (TR::Node *other = otherIt.getFirst(); other; other = otherIt.getNext())
+            {
+            if (other->getSymbolReference() == store->getSymbolReference())
+               continue;
+
+            bool seen = false;
+            ListIterator<TR::Node> firstIt(&li->_overlapFirsts);
+            ListIterator<TR::Node> secondIt(&li->_overlapSeconds);
+            for (TR::Node *first = firstIt.getFirst(), *second = secondIt.getFirst();
+                 first && !seen;
+                 first = firstIt.getNext(), second = secondIt.getNext())
+               {
+               TR::SymbolReference *a = first->getSymbolReference();
+               TR::SymbolReference *b = second->getSymbolReference();
+               seen = (a == store->getSymbolReference() && b == other->getSymbolReference())
+                  || (b == store->getSymbolReference() && a == other->getSymbolReference());
+               }
+
+            if (seen)
+               continue;
+
+            if (++numPairs > MAX_OVERLAP_CHECKS)
+               return false;
+
+            li->_overlapFirsts.add(store);
+            li->_overlapSeconds.add(other);
+            }
+         }
+      }
+
+   return true;
+   }
+
+/**
+ * Builds, in front of the scalar loop:
+ *
+ *    guard:        vacc = 0 for each reduction
+ *                  if (iv + VL > bound || arrays overlap) goto loop
+ *    vector:       vector body; iv += VL
+ *                  if (iv <= bound - VL) goto vector
+ *    epilogue:     s += sum of the lanes of vacc for each reduction
+ *    residueTest:  if (iv >= bound) goto exit
+ *    loop:         original scalar loop, now only running the remainder
+ */
+void
+TR_LoopVectorizer::transformLoop(LoopInfo *li)
+   {
+   TR::CFG *cfg = comp()->getFlowGraph();
+   TR::Block *loopBlock = li->_loopBlock;
+   TR::Node *bbNode = loopBlock->getEntry()->getNode();
+   TR::DataType vectorType = li->_elementType.scalarToVector();
+   TR::SymbolReferenceTable *symRefTab = comp()->getSymRefTab();
+
+   li->_vectorShadow = symRefTab->findOrCreateArrayShadowSymbolRef(vectorType, NULL, TR::DataType::getSize(vectorType), comp()->fe());
+
+   TR::Block *guardBlock = createBlock(li);
+   TR::Block *vectorBlock = createBlock(li);
+   TR::Block *epilogueBlock = li->_reductionTrees.isEmpty() ? NULL : createBlock(li);
+   TR::Block *residueTestBlock = createBlock(li);
+
+   int32_t numReductions = li->_reductionTrees.getSize();
+   TR::SymbolReference **accumulators = (TR::SymbolReference **) trMemory()->allocateStackMemory(numReductions * sizeof(TR::SymbolReference *));
+
+   // Guard
+   for (int32_t r = 0; r < numReductions; r++)
+      {
+      accumulators[r] = symRefTab->createTemporary(comp()->getMethodSymbol(), vectorType);
+      TR::Node *zero = TR::Node::create(bbNode, TR::vsplats, 1, TR::Node::createConstZeroValue(bbNode, li->_elementType));
+      guardBlock->append(TR::TreeTop::create(comp(), TR::Node::createStore(bbNode, accumulators[r], zero)));
+      }
+
+   TR::Node *vectorEnd = TR::Node::create(bbNode, TR::ladd, 2,
+      TR::Node::create(bbNode, TR::i2l, 1, TR::Node::createLoad(bbNode, li->_ivSymRef)),
+      TR::Node::lconst(bbNode, li->_vectorLength));
+   TR::Node *bailOut = TR::Node::create(bbNode, TR::lcmpgt, 2, vectorEnd,
+      TR::Node::create(bbNode, TR::i2l, 1, li->_bound->duplicateTree()));
+
+   ListIterator<TR::Node> firstIt(&li->_overlapFirsts);
+   ListIterator<TR::Node> secondIt(&li->_overlapSeconds);
+   for (TR::Node *first = firstIt.getFirst(), *second = secondIt.getFirst();
+        first;
+        first = firstIt.getNext(), second = secondIt.getNext())
+      {
+      TR::Node *overlap = createOverlapTest(li, first->duplicateTree(), second->duplicateTree());
+      bailOut = TR::Node::create(bbNode, TR::ior, 2, bailOut, overlap);
+      }
+
+   guardBlock->append(TR::TreeTop::create(comp(),
+      TR::Node::createif(TR::ificmpne, bailOut, TR::Node::iconst(bbNode, 0), loopBlock->getEntry())));
+
+   // Vector loop
+   TR::Region &stackRegion = trMemory()->currentStackRegion();
+   NodeMap vectorNodes((std::less<TR::Node *>()), NodeMapAllocator(stackRegion));
+   NodeMap scalarNodes((std::less<TR::Node *>()), NodeMapAllocator(stackRegion));
+
+   int32_t reduction = 0;
+   for (TR::TreeTop *tt = loopBlock->getFirstRealTreeTop(); tt != li->_ivStoreTree; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      TR::Node *vectorTree = NULL;
+
+      if (node->getOpCodeValue() == TR::treetop)
+         {
+         TR::Node *child = node->getFirstChild();
+         child = isScalarExpression(li, child) ?
+            duplicateScalar(child, scalarNodes) :
+            vectorizeValue(li, child, vectorNodes, scalarNodes);
+         vectorTree = TR::Node::create(node, TR::treetop, 1, child);
+         }
+      else if (node->getOpCode().isStoreIndirect())
+         {
+         TR::Node *address = duplicateScalar(node->getFirstChild(), scalarNodes);
+         TR::Node *value = vectorizeValue(li, node->getSecondChild(), vectorNodes, scalarNodes);
+         vectorTree = TR::Node::createWithSymRef(TR::vstorei, 2, 2, address, value, li->_vectorShadow);
+         }
+      else
+         {
+         TR::Node *sum = node->getFirstChild();
+         TR::Node *addend = sum->getFirstChild();
+         if (addend->getOpCode().isLoadVarDirect() && addend->getSymbolReference() == node->getSymbolReference())
+            addend = sum->getSecondChild();
+
+         TR::Node *partial = TR::Node::create(sum, TR::vadd, 2,
+            TR::Node::createLoad(sum, accumulators[reduction]),
+            vectorizeValue(li, addend, vectorNodes, scalarNodes));
+         vectorTree = TR::Node::createStore(node, accumulators[reduction], partial);
+         reduction++;
+         }
+
+      vectorBlock->append(TR::TreeTop::create(comp(), vectorTree));
+      }
+
+   TR::Node *ivStep = TR::Node::create(bbNode, TR::iadd, 2,
+      TR::Node::createLoad(bbNode, li->_ivSymRef),
+      TR::Node::iconst(bbNode, li->_vectorLength));
+   vectorBlock->append(TR::TreeTop::create(comp(), TR::Node::createStore(bbNode, li->_ivSymRef, ivStep)));
+
+   TR::Node *lastVectorStart = TR::Node::create(bbNode, TR::isub, 2,
+      li->_bound->duplicateTree(),
+      TR::Node::iconst(bbNode, li->_vectorLength));
+   vectorBlock->append(TR::TreeTop::create(comp(),
+      TR::Node::createif(TR::ificmple, ivStep, lastVectorStart, vectorBlock->getEntry())));
+
+   // Reduction epilogue
+   if (epilogueBlock)
+      {
+      ListIterator<TR::TreeTop> reductionIt(&li->_reductionTrees);
+      reduction = 0;
+      for (TR::TreeTop *tt = reductionIt.getFirst(); tt; tt = reductionIt.getNext(), reduction++)
+         {
+         TR::Node *store = tt->getNode();
+         TR::Node *sum = store->getFirstChild();
+         TR::Node *accumulator = TR::Node::createLoad(sum, accumulators[reduction]);
+         TR::Node *total = TR::Node::createLoad(store, store->getSymbolReference());
+         for (int32_t lane = 0; lane < li->_vectorLength; lane++)
+            {
+            TR::Node *element = TR::Node::create(sum, TR::getvelem, 2, accumulator, TR::Node::iconst(sum, lane));
+            total = TR::Node::create(sum, sum->getOpCodeValue(), 2, total, element);
+            }
+         epilogueBlock->append(TR::TreeTop::create(comp(), TR::Node::createStore(store, store->getSymbolReference(), total)));
+         }
+      }
+
+   // Remainder test
+   residueTestBlock->append(TR::TreeTop::create(comp(),
+      TR::Node::createif(TR::ificmpge, TR::Node::createLoad(bbNode, li->_ivSymRef), li->_bound->duplicateTree(), li->_exitBlock->getEntry())));
+
+   // Lay the new blocks out in front of the scalar loop
+   TR::TreeTop *prevTree = loopBlock->getEntry()->getPrevTreeTop();
+   TR::Block *newBlocks[] = { guardBlock, vectorBlock, epilogueBlock, residueTestBlock };
+   for (size_t i = 0; i < sizeof(newBlocks) / sizeof(newBlocks[0]); i++)
+      {
+      if (newBlocks[i] == NULL)
+         continue;
+      prevTree->join(newBlocks[i]->getEntry());
+      prevTree = newBlocks[i]->getExit();
+      }
+   prevTree->join(loopBlock->getEntry());
+
+   TR::Block *afterVector = epilogueBlock ? epilogueBlock : residueTestBlock;
+   cfg->addEdge(guardBlock, vectorBlock);
+   cfg->addEdge(guardBlock, loopBlock);
+   cfg->addEdge(vectorBlock, vectorBlock);
+   cfg->addEdge(vectorBlock, afterVector);
+   if (epilogueBlock)
+      cfg->addEdge(epilogueBlock, residueTestBlock);
+   cfg->addEdge(residueTestBlock, li->_exitBlock);
+   cfg->addEdge(residueTestBlock, loopBlock);
+
+   // Redirect the entries of the scalar loop to the guard
+   TR_ScratchList<TR::Block> entries(trMemory());
+   for (auto e = loopBlock->getPredecessors().begin(); e != loopBlock->getPredecessors().end(); ++e)
+      {
+      TR::Block *pred = toBlock((*e)->getFrom());
+      if (pred != loopBlock && pred != residueTestBlock && pred != guardBlock)
+         entries.add(pred);
+      }
+
+   ListIterator<TR::Block> entryIt(&entries);
+   for (TR::Block *pred = entryIt.getFirst(); pred; pred = entryIt.getNext())
+      {
+      TR::Node *last = pred->getLastRealTreeTop()->getNode();
+      if (last->getOpCode().isBranch() && last->getBranchDestination() == loopBlock->getEntry())
+         last->setBranchDestination(guardBlock->getEntry());
+
+      if (!pred->hasSuccessor(guardBlock))
+         cfg->addEdge(pred, guardBlock);
+      cfg->removeEdge(pred, loopBlock);
+      }
+   }
+
+/**
+ * The guard tests that neither array starts strictly inside the vector
+ * accessed at the other, comparing the base addresses of the two arrays.
+ */
+TR::Node *
+TR_LoopVectorizer::createOverlapTest(LoopInfo *li, TR::Node *first, TR::Node *second)
+   {
+   bool is64Bit = comp()->target().is64Bit();
+   int32_t span = li->_vectorLength * TR::DataType::getSize(li->_elementType);
+   TR::ILOpCodes addOp = is64Bit ? TR::aladd : TR::aiadd;
+
+   TR::Node *firstEnd = TR::Node::create(first, addOp, 2, first,
+      is64Bit ? TR::Node::lconst(first, span) : TR::Node::iconst(first, span));
+   TR::Node *secondEnd = TR::Node::create(second, addOp, 2, second,
+      is64Bit ? TR::Node::lconst(second, span) : TR::Node::iconst(second, span));
+
+   TR::Node *secondInFirst = TR::Node::create(first, TR::iand, 2,
+      TR::Node::create(first, TR::acmpgt, 2, second, first),
+      TR::Node::create(first, TR::acmplt, 2, second, firstEnd));
+   TR::Node *firstInSecond = TR::Node::create(first, TR::iand, 2,
+      TR::Node::create(first, TR::acmpgt, 2, first, second),
+      TR::Node::create(first, TR::acmplt, 2, first, secondEnd));
+
+   return TR::Node::create(first, TR::ior, 2, secondInFirst, firstInSecond);
+   }
+
+/**
+ * Copies a scalar tree into the vector loop, commoning copies the same way
+ * the original nodes are commoned.
+ */
+TR::Node *
+TR_LoopVectorizer::duplicateScalar(TR::Node *node, NodeMap &scalarNodes)
+   {
+   NodeMap::iterator found = scalarNodes.find(node);
+   if (found != scalarNodes.end())
+      return found->second;
+
+   TR::Node *copy = TR::Node::copy(node);
+   copy->setReferenceCount(0);
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      copy->setAndIncChild(i, duplicateScalar(node->getChild(i), scalarNodes));
+
+   scalarNodes.insert(std::make_pair(node, copy));
+   return copy;
+   }
+
+TR::Node *
+TR_LoopVectorizer::vectorizeValue(LoopInfo *li, TR::Node *node, NodeMap &vectorNodes, NodeMap &scalarNodes)
+   {
+   NodeMap::iterator found = vectorNodes.find(node);
+   if (found != vectorNodes.end())
+      return found->second;
+
+   TR::Node *vectorNode = NULL;
+   if (node->getOpCode().isLoadConst() || isLoopInvariantLoad(li, node))
+      {
+      vectorNode = TR::Node::create(node, TR::vsplats, 1, duplicateScalar(node, scalarNodes));
+      }
+   else if (node->getOpCode().isLoadIndirect())
+      {
+      vectorNode = TR::Node::createWithSymRef(node, TR::vloadi, 1,
+         duplicateScalar(node->getFirstChild(), scalarNodes), li->_vectorShadow);
+      }
+   else
+      {
+      TR::ILOpCodes vectorOp = TR::ILOpCode::convertScalarToVector(node->getOpCodeValue());
+      TR::Node *first = vectorizeValue(li, node->getFirstChild(), vectorNodes, scalarNodes);
+      if (node->getNumChildren() == 1)
+         vectorNode = TR::Node::create(node, vectorOp, 1, first);
+      else
+         vectorNode = TR::Node::create(node, vectorOp, 2, first, vectorizeValue(li, node->getSecondChild(), vectorNodes, scalarNodes));
+      }
+
+   vectorNodes.insert(std::make_pair(node, vectorNode));
+   return vectorNode;
+   }
+
+TR::Block *
+TR_LoopVectorizer::createBlock(LoopInfo *li)
+   {
+   TR::Block *loopBlock = li->_loopBlock;
+   TR::Block *block = TR::Block::createEmptyBlock(loopBlock->getEntry()->getNode(), comp(), loopBlock->getFrequency(), loopBlock);
+   comp()->getFlowGraph()->addNode(block);
+   return block;
+   }
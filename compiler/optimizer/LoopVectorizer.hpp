@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef LOOPVECTORIZER_INCL
+#define LOOPVECTORIZER_INCL
+
+#include <map>
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "il/DataTypes.hpp"
+#include "infra/List.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+class TR_RegionStructure;
+class TR_Structure;
+namespace TR { class Block; }
+namespace TR { class Node; }
+namespace TR { class NodeChecklist; }
+namespace TR { class SymbolReference; }
+namespace TR { class TreeTop; }
+
+/**
+ * Loop vectorization turns single block counted loops over arrays into
+ * loops over the Vector* IL types.
+ *
+ * A candidate loop increments its primary induction variable by one, exits
+ * on a signed compare against a loop invariant bound, and consists only of
+ * element-wise array stores, sum reductions into locals and anchors of
+ * either. Every array access must be of the form base + iv * elementSize
+ * with a loop invariant base, and all accesses share one element type.
+ *
+ * The loop is left in place as the scalar remainder loop. In front of it a
+ * guard block checks that at least one full vector of iterations remains and
+ * that distinct arrays written by the loop do not overlap within a vector,
+ * and branches to the scalar loop otherwise. The vector loop processes
+ * 16 / elementSize iterations per trip; reductions accumulate into a vector
+ * temporary whose lanes are summed into the scalar local after the vector
+ * loop, before any remaining iterations run in the scalar loop.
+ *
+ * Every vector opcode is checked with
+ * TR::CodeGenerator::getSupportsOpCodeForAutoSIMD before a loop is
+ * transformed. Floating point reductions reassociate the sum and are only
+ * vectorized under ignoreIEEE.
+ */
+class TR_LoopVectorizer : public TR::Optimization
+   {
+   public:
+   TR_LoopVectorizer(TR::OptimizationManager *manager);
+   static TR::Optimization *create(TR::OptimizationManager *manager)
+      {
+      return new (manager->allocator()) TR_LoopVectorizer(manager);
+      }
+
+   virtual bool    shouldPerform();
+   virtual int32_t perform();
+   virtual const char * optDetailString() const throw();
+
+   private:
+
+   struct LoopInfo
+      {
+      TR_ALLOC(TR_Memory::LoopTransformer)
+
+      LoopInfo(TR_Memory *m)
+         : _loopBlock(NULL), _exitBlock(NULL), _ivSymRef(NULL), _bound(NULL),
+           _ivStoreTree(NULL), _elementType(TR::NoType), _vectorLength(0),
+           _vectorShadow(NULL), _storedSymRefs(m), _storeBases(m), _loadBases(m),
+           _reductionTrees(m), _overlapFirsts(m), _overlapSeconds(m)
+         {}
+
+      TR::Block *_loopBlock;
+      TR::Block *_exitBlock;
+      TR::SymbolReference *_ivSymRef;
+      TR::Node *_bound;
+      TR::TreeTop *_ivStoreTree;
+      TR::DataType _elementType;
+      int32_t _vectorLength;
+      TR::SymbolReference *_vectorShadow;
+
+      TR_ScratchList<TR::SymbolReference> _storedSymRefs;
+      TR_ScratchList<TR::Node> _storeBases;
+      TR_ScratchList<TR::Node> _loadBases;
+      TR_ScratchList<TR::TreeTop> _reductionTrees;
+
+      // Pairs of array bases that must not overlap within one vector
+      TR_ScratchList<TR::Node> _overlapFirsts;
+      TR_ScratchList<TR::Node> _overlapSeconds;
+      };
+
+   typedef TR::typed_allocator<std::pair<TR::Node * const, TR::Node *>, TR::Region &> NodeMapAllocator;
+   typedef std::map<TR::Node *, TR::Node *, std::less<TR::Node *>, NodeMapAllocator> NodeMap;
+
+   void collectLoops(TR_Structure *str, TR_ScratchList<LoopInfo> &candidates);
+   bool analyzeLoop(TR_RegionStructure *loop, LoopInfo *li);
+   bool analyzeReduction(LoopInfo *li, TR::TreeTop *tree, TR::NodeChecklist &vectorizable);
+   bool setElementType(LoopInfo *li, TR::DataType type);
+   bool isInductionVariableLoad(LoopInfo *li, TR::Node *node);
+   bool isLoopInvariantLoad(LoopInfo *li, TR::Node *node);
+   bool isArrayElementAddress(LoopInfo *li, TR::Node *address);
+   bool isScalarExpression(LoopInfo *li, TR::Node *node);
+   bool isVectorizable(LoopInfo *li, TR::Node *node, TR::NodeChecklist &vectorizable);
+   bool supportsVectorOpCode(LoopInfo *li, TR::ILOpCodes op);
+   bool collectOverlapPairs(LoopInfo *li);
+
+   void transformLoop(LoopInfo *li);
+   TR::Node *createOverlapTest(LoopInfo *li, TR::Node *first, TR::Node *second);
+   TR::Node *duplicateScalar(TR::Node *node, NodeMap &scalarNodes);
+   TR::Node *vectorizeValue(LoopInfo *li, TR::Node *node, NodeMap &vectorNodes, NodeMap &scalarNodes);
+   TR::Block *createBlock(LoopInfo *li);
+   };
+
+#endif
@@ -86,7 +86,7 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
          _flags.set(requiresStructure | checkStructure | dumpStructure | requiresAccurateNodeCount);
          break;
       case OMR::loopVersioner:
-         _flags.set(requiresStructure | checkStructure | dumpStructure);
+         _flags.set(requiresStructure | checkStructure | dumpStructure | skipWhenOverBudget);
          if (self()->comp()->getMethodHotness() >= hot)
             _flags.set(requiresLocalsUseDefInfo | doesNotRequireLoadsAsDefs | requiresLocalsValueNumbering);
          break;
@@ -101,7 +101,7 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
                     requiresLocalsUseDefInfo | requiresLocalsValueNumbering);
          break;
       case OMR::partialRedundancyElimination:
-         _flags.set(requiresStructure | canAddSymbolReference);
+         _flags.set(requiresStructure | canAddSymbolReference | skipWhenOverBudget);
          break;
       case OMR::globalCopyPropagation:
          _flags.set(requiresStructure | requiresLocalsUseDefInfo | doesNotRequireLoadsAsDefs);
@@ -127,7 +127,7 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
          _flags.set(verifyTrees | verifyBlocks | checkTheCFG);
          break;
       case OMR::generalLoopUnroller:
-         _flags.set(requiresStructure | checkStructure | dumpStructure);
+         _flags.set(requiresStructure | checkStructure | dumpStructure | skipWhenOverBudget);
          break;
       case OMR::redundantAsyncCheckRemoval:
          _flags.set(requiresStructure);
@@ -204,6 +204,9 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
       case OMR::redundantInductionVarElimination:
          _flags.set(requiresStructure | checkStructure | dumpStructure);
          break;
+      case OMR::loopVectorization:
+         _flags.set(requiresStructure | checkStructure | dumpStructure);
+         break;
       case OMR::trivialBlockExtension:
          self()->setSupportsIlGenOptLevel(true);
          _flags.set(doesNotRequireAliasSets);
@@ -157,6 +157,7 @@ class OMR_EXTENSIBLE OptimizationManager
       maintainsUseDefInfo                  = 0x00400000,
       requiresAccurateNodeCount            = 0x00800000,
       doNotSetFrequencies                  = 0x01000000,
+      skipWhenOverBudget                   = 0x02000000, // optional and expensive; skipped once the compile-time budget is exceeded
       dummyLastEnum
       };
 
@@ -187,6 +188,7 @@ class OMR_EXTENSIBLE OptimizationManager
    bool getCannotOmitTrivialDefs()       { return _flags.testAny(cannotOmitTrivialDefs); }
    bool getMaintainsUseDefInfo()         { return _flags.testAny(maintainsUseDefInfo); }
    bool getDoNotSetFrequencies()         { return _flags.testAny(doNotSetFrequencies); }
+   bool getSkipWhenOverBudget()          { return _flags.testAny(skipWhenOverBudget); }
 
    void setRequiresStructure(bool b)           { _flags.set(requiresStructure, b); }
    void setRequiresGlobalsUseDefInfo(bool b)   { _flags.set(requiresGlobalsUseDefInfo, b); }
@@ -212,6 +214,7 @@ class OMR_EXTENSIBLE OptimizationManager
    void setCannotOmitTrivialDefs(bool b)       { _flags.set(cannotOmitTrivialDefs, b); }
    void setMaintainsUseDefInfo(bool b)         { _flags.set(maintainsUseDefInfo, b); }
    void setDoNotSetFrequencies(bool b)         { _flags.set(doNotSetFrequencies, b); }
+   void setSkipWhenOverBudget(bool b)          { _flags.set(skipWhenOverBudget, b); }
 
    protected:
 
@@ -44,6 +44,7 @@
 #include "env/PersistentInfo.hpp"
 #include "env/StackMemoryRegion.hpp"
 #include "env/TRMemory.hpp"
+#include "env/VerboseLog.hpp"
 #include "env/jittypes.h"
 #include "il/Block.hpp"
 #include "il/DataTypes.hpp"
@@ -90,6 +91,7 @@
 #include "optimizer/LoopCanonicalizer.hpp"
 #include "optimizer/LoopReducer.hpp"
 #include "optimizer/LoopReplicator.hpp"
+#include "optimizer/LoopVectorizer.hpp"
 #include "optimizer/LoopVersioner.hpp"
 #include "optimizer/OrderBlocks.hpp"
 #include "optimizer/RedundantAsyncCheckRemoval.hpp"
@@ -600,6 +602,8 @@ static const OptimizationStrategy omrHotStrategyOpts[] =
    { OMR::inductionVariableAnalysis,                         },
    { OMR::loopSpecializerGroup,                              },
    { OMR::inductionVariableAnalysis,                         },
+   { OMR::loopVectorization,        OMR::IfLoops             }, // vectorize counted array loops
+   { OMR::inductionVariableAnalysis, OMR::IfEnabled          }, // vectorized loops need their induction variables rediscovered
    { OMR::generalLoopUnroller,                               }, // unroll Loops
    { OMR::blockSplitter,            OMR::MarkLastRun         },
    { OMR::blockManipulationGroup                             },
@@ -720,7 +724,9 @@ OMR::Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *metho
      _successorBitsGRA(NULL),
      _stackedOptimizer(false),
      _firstTimeStructureIsBuilt(true),
-     _disableLoopOptsThatCanCreateLoops(false)
+     _disableLoopOptsThatCanCreateLoops(false),
+     _optimizationStartTime(0),
+     _optimizationCosts(NULL)
    {
    // zero opts table
    memset(_opts, 0, sizeof(_opts));
@@ -800,6 +806,8 @@ OMR::Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *metho
       new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopReducer::create, OMR::loopReduction);
    _opts[OMR::loopReplicator] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopReplicator::create, OMR::loopReplicator);
+   _opts[OMR::loopVectorization] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopVectorizer::create, OMR::loopVectorization);
    _opts[OMR::profiledNodeVersioning] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR_ProfiledNodeVersioning::create, OMR::profiledNodeVersioning);
    _opts[OMR::redundantAsyncCheckRemoval] =
@@ -1035,6 +1043,10 @@ void OMR::Optimizer::optimize()
    _stackedOptimizer  =  (self() != stackedOptimizer);
    comp()->setOptimizer(self());
 
+   _optimizationStartTime = TR::Compiler->vm.getUSecClock();
+   if (!isIlGenOpt() && comp()->isOutermostMethod() && TR::Options::getVerboseOption(TR_VerboseOptimizationCosts))
+      _optimizationCosts = new (trStackMemory()) TR::vector<OptimizationCost, TR::Region&>(comp()->trMemory()->currentStackRegion());
+
    if (comp()->getOption(TR_TraceOptDetails))
       {
       if (comp()->isOutermostMethod())
@@ -1148,6 +1160,12 @@ void OMR::Optimizer::optimize()
 
    dumpPostOptTrees();
 
+   if (_optimizationCosts)
+      {
+      reportOptimizationCosts();
+      _optimizationCosts = NULL;
+      }
+
    if (comp()->getOption(TR_TraceOpts))
       {
       if (comp()->isOutermostMethod())
@@ -1164,6 +1182,70 @@ void OMR::Optimizer::optimize()
    _stackedOptimizer = false;
    }
 
+bool OMR::Optimizer::isOverCompileTimeBudget()
+   {
+   if (isIlGenOpt())
+      return false;
+
+   int32_t timeBudget = comp()->getOptions()->getOptimizationTimeBudget();
+   if (timeBudget > 0 &&
+       TR::Compiler->vm.getUSecClock() - _optimizationStartTime > static_cast<uint64_t>(timeBudget) * 1000)
+      return true;
+
+   int32_t nodeBudget = comp()->getOptions()->getOptimizationNodeBudget();
+   if (nodeBudget > 0 &&
+       getMethodSymbol()->generateAccurateNodeCount() > static_cast<ncount_t>(nodeBudget))
+      return true;
+
+   return false;
+   }
+
+void OMR::Optimizer::addOptimizationCost(OMR::Optimizations optNum, int32_t optIndex, uint64_t usec,
+                                         ncount_t nodesBefore, ncount_t nodesAfter, size_t bytesAllocated, bool skipped)
+   {
+   OptimizationCost cost;
+   cost._optNum = optNum;
+   cost._optIndex = optIndex;
+   cost._usec = usec;
+   cost._nodesBefore = nodesBefore;
+   cost._nodesAfter = nodesAfter;
+   cost._bytesAllocated = bytesAllocated;
+   cost._skipped = skipped;
+   _optimizationCosts->push_back(cost);
+   }
+
+// Emit one line per optimization pass followed by a summary line, all as
+// key=value pairs so the verbose log can be post-processed by tools.
+//
+void OMR::Optimizer::reportOptimizationCosts()
+   {
+   const char *hotnessName = comp()->getHotnessName(comp()->getMethodHotness());
+   uint64_t totalUsec = 0;
+   size_t totalBytes = 0;
+   int32_t numSkipped = 0;
+
+   TR_VerboseLog::CriticalSection vlogLock;
+   for (size_t i = 0; i < _optimizationCosts->size(); ++i)
+      {
+      OptimizationCost &cost = (*_optimizationCosts)[i];
+      TR_VerboseLog::writeLine(TR_Vlog_OPTCOST, "method=%s hotness=%s index=%d opt=%s usec=%llu nodesBefore=%u nodesAfter=%u bytes=%llu skipped=%d",
+                               comp()->signature(), hotnessName, cost._optIndex, getOptimizationName(cost._optNum),
+                               static_cast<unsigned long long>(cost._usec), cost._nodesBefore, cost._nodesAfter,
+                               static_cast<unsigned long long>(cost._bytesAllocated), cost._skipped ? 1 : 0);
+      totalUsec += cost._usec;
+      totalBytes += cost._bytesAllocated;
+      if (cost._skipped)
+         ++numSkipped;
+      }
+
+   TR_VerboseLog::writeLine(TR_Vlog_OPTCOST, "method=%s hotness=%s total usec=%llu optimizerUsec=%llu nodes=%u bytes=%llu passes=%d skipped=%d",
+                            comp()->signature(), hotnessName, static_cast<unsigned long long>(totalUsec),
+                            static_cast<unsigned long long>(TR::Compiler->vm.getUSecClock() - _optimizationStartTime),
+                            getMethodSymbol()->generateAccurateNodeCount(),
+                            static_cast<unsigned long long>(totalBytes),
+                            static_cast<int32_t>(_optimizationCosts->size()) - numSkipped, numSkipped);
+   }
+
 void OMR::Optimizer::dumpPostOptTrees()
    {
    // do nothing for IlGen optimizer
@@ -1678,6 +1760,17 @@ int32_t OMR::Optimizer::performOptimization(const OptimizationStrategy *optimiza
       if (regex && TR::SimpleRegex::match(regex, manager->name()))
          return 0;
 
+      if (!mustBeDone && manager->getSkipWhenOverBudget() && isOverCompileTimeBudget())
+         {
+         dumpOptDetails(comp(), "%s skipped: compile-time budget exceeded\n", manager->name());
+         if (_optimizationCosts)
+            {
+            ncount_t nodeCount = getMethodSymbol()->generateAccurateNodeCount();
+            addOptimizationCost(optNum, optIndex, 0, nodeCount, nodeCount, 0, true);
+            }
+         return 0;
+         }
+
       // actually doing optimization
       regex = comp()->getOptions()->getBreakOnOpts();
       if (regex && TR::SimpleRegex::match(regex, optIndex))
@@ -1692,6 +1785,17 @@ int32_t OMR::Optimizer::performOptimization(const OptimizationStrategy *optimiza
          return 0;
          }
 
+      // The cost of an opt includes the analyses it requires below
+      ncount_t costNodesBefore = 0;
+      size_t costBytesBefore = 0;
+      uint64_t costStartTime = 0;
+      if (_optimizationCosts)
+         {
+         costNodesBefore = getMethodSymbol()->generateAccurateNodeCount();
+         costBytesBefore = comp()->trMemory()->heapMemoryRegion().bytesAllocated();
+         costStartTime = TR::Compiler->vm.getUSecClock();
+         }
+
       if (comp()->getOption(TR_TraceOptDetails))
          {
          if (comp()->isOutermostMethod())
@@ -2123,6 +2227,13 @@ int32_t OMR::Optimizer::performOptimization(const OptimizationStrategy *optimiza
       if (comp()->getFlowGraph()->getMightHaveUnreachableBlocks())
          comp()->getFlowGraph()->removeUnreachableBlocks();
 
+      if (_optimizationCosts)
+         {
+         uint64_t costUsec = TR::Compiler->vm.getUSecClock() - costStartTime;
+         size_t costBytes = comp()->trMemory()->heapMemoryRegion().bytesAllocated() - costBytesBefore;
+         addOptimizationCost(optNum, optIndex, costUsec, costNodesBefore, getMethodSymbol()->generateAccurateNodeCount(), costBytes, false);
+         }
+
 
 #ifdef OPT_TIMING
       if (doTiming)
@@ -40,6 +40,7 @@ namespace OMR { typedef OMR::Optimizer OptimizerConnector; }
 #include "il/TreeTop_inlines.hpp"
 #include "infra/Assert.hpp"
 #include "infra/List.hpp"
+#include "infra/vector.hpp"
 #include "optimizer/Optimizations.hpp"
 #include "optimizer/OptimizationStrategies.hpp"
 
@@ -350,6 +351,26 @@ class Optimizer
 
    void dumpStrategy(const OptimizationStrategy *);
 
+   /**
+    * Cost of a single optimization pass, gathered when
+    * verbose={optimizationCosts} is set.  A pass that was not run because the
+    * compile-time budget had been exceeded is recorded with _skipped set.
+    */
+   struct OptimizationCost
+      {
+      OMR::Optimizations _optNum;
+      int32_t _optIndex;
+      uint64_t _usec;
+      ncount_t _nodesBefore;
+      ncount_t _nodesAfter;
+      size_t _bytesAllocated;
+      bool _skipped;
+      };
+
+   bool isOverCompileTimeBudget();
+   void addOptimizationCost(OMR::Optimizations optNum, int32_t optIndex, uint64_t usec, ncount_t nodesBefore, ncount_t nodesAfter, size_t bytesAllocated, bool skipped);
+   void reportOptimizationCosts();
+
 
    TR::Compilation *            _compilation;
    TR_Memory *                   _trMemory;
@@ -404,6 +425,9 @@ class Optimizer
    bool                          _firstTimeStructureIsBuilt;
    bool                          _disableLoopOptsThatCanCreateLoops;
 
+   uint64_t                      _optimizationStartTime; // usec
+   TR::vector<OptimizationCost, TR::Region&> * _optimizationCosts; // NULL unless costs are being reported
+
    TR_BitVector *                _seenBlocksGRA; // used during the GRA as a global
    TR_BitVector *                _resetExitsGRA; // used during the GRA as a global
    TR_BitVector *                _successorBitsGRA; // used during the GRA as a global
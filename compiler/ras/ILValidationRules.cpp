@@ -443,7 +443,8 @@ void TR::ValidateChildTypes::validate(TR::Node *node)
       /* Validate child types. */
       for (auto i = 0; i < actChildCount; ++i)
          {
-         auto childOpcode = node->getChild(i)->getOpCode();
+         TR::Node *childNode = node->getChild(i);
+         auto childOpcode = childNode->getOpCode();
          if (childOpcode.getOpCodeValue() != TR::GlRegDeps)
             {
             /**
@@ -453,14 +454,16 @@ void TR::ValidateChildTypes::validate(TR::Node *node)
              */
             if (opcode.isStoreReg() && childOpcode.getOpCodeValue() == TR::PassThrough)
                {
-               TR::Node *childNode = node->getChild(i);
                while (childNode->getOpCodeValue() == TR::PassThrough)
                   childNode = childNode->getFirstChild();
                childOpcode = childNode->getOpCode();
                }
 
             const auto expChildType = opcode.expectedChildType(i);
-            const auto actChildType = childOpcode.getDataType().getDataType();
+            /* Typeless opcodes such as getvelem take their type from their own children. */
+            const auto actChildType = (expChildType < TR::NumTypes && childOpcode.hasNoDataType()) ?
+                                       childNode->getDataType().getDataType() :
+                                       childOpcode.getDataType().getDataType();
             const auto expChildTypeName = (expChildType >= TR::NumTypes) ?
                                            "UnspecifiedChildType" :
                                            TR::DataType::getName(expChildType);
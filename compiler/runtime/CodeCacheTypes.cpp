@@ -21,6 +21,7 @@
 
 #include "runtime/CodeCacheTypes.hpp"
 #include "runtime/CodeCacheManager.hpp"
+#include "env/jittypes.h"
 
 namespace OMR
 {
@@ -185,4 +186,53 @@ CodeCacheHashTable::remove(CodeCacheHashEntry *entry)
    return false;
    }
 
+
+
+// Add a code cache range to the index
+//
+bool
+CodeCacheRangeIndex::add(TR::RawAllocator allocator, uint8_t *base, uint8_t *top, TR::CodeCache *codeCache)
+   {
+   RangeArray *oldRanges = _ranges;
+   int32_t oldCount = oldRanges ? oldRanges->_count : 0;
+
+   RangeArray *newRanges = static_cast<RangeArray *>(allocator.allocate(sizeof(RangeArray) + oldCount * sizeof(Range), std::nothrow));
+   if (!newRanges)
+      return false;
+
+   int32_t i = 0;
+   for (; i < oldCount && oldRanges->_ranges[i]._base < base; i++)
+      newRanges->_ranges[i] = oldRanges->_ranges[i];
+
+   newRanges->_ranges[i]._base = base;
+   newRanges->_ranges[i]._top = top;
+   newRanges->_ranges[i]._codeCache = codeCache;
+
+   for (; i < oldCount; i++)
+      newRanges->_ranges[i + 1] = oldRanges->_ranges[i];
+
+   newRanges->_count = oldCount + 1;
+   newRanges->_superseded = oldRanges;
+
+   FLUSH_MEMORY(true);  // Insure the new copy is globally visible before publishing it
+   _ranges = newRanges;
+   return true;
+   }
+
+
+// Free every copy of the ranges
+//
+void
+CodeCacheRangeIndex::destroy(TR::RawAllocator allocator)
+   {
+   RangeArray *ranges = _ranges;
+   _ranges = NULL;
+   while (ranges)
+      {
+      RangeArray *superseded = ranges->_superseded;
+      allocator.deallocate(ranges);
+      ranges = superseded;
+      }
+   }
+
 }
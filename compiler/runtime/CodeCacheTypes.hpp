@@ -34,6 +34,7 @@
 #include <stdio.h>
 #endif /* CODECACHE_DEBUG */
 
+#include "env/RawAllocator.hpp"
 #include "runtime/MethodExceptionData.hpp"
 
 /*
@@ -46,6 +47,7 @@
 #endif
 
 class TR_OpaqueMethodBlock;
+namespace TR { class CodeCache; }
 namespace TR { class CodeCacheManager; }
 
 namespace OMR
@@ -138,6 +140,93 @@ public:
    };
 
 
+/**
+ * @brief Address ranges of the managed code caches, sorted by base address, so
+ *        that the code cache containing an address is found by binary search.
+ *
+ * @details
+ *    Lookups take no lock.  Each add() publishes a new sorted copy of the ranges
+ *    with a single pointer store, so a reader sees either the old or the new copy
+ *    and never a partially updated one.  Superseded copies may still be in use by
+ *    a reader, and code caches are never unmanaged while the runtime is up, so they
+ *    are only chained together and released by destroy().  Updates must be
+ *    serialized by the caller.
+ */
+class CodeCacheRangeIndex
+   {
+public:
+   CodeCacheRangeIndex() : _ranges(NULL) { }
+
+   /**
+    * @brief Index the range [base, top] as belonging to the given code cache
+    *
+    * @return true if the range was added; false if a new copy of the ranges
+    *         could not be allocated, in which case the index is unchanged
+    */
+   bool add(TR::RawAllocator allocator, uint8_t *base, uint8_t *top, TR::CodeCache *codeCache);
+
+   /**
+    * @brief Find the code cache whose range encompasses the given address
+    *
+    * @return the code cache, or NULL if no indexed range contains the address
+    */
+   TR::CodeCache *find(void *address)
+      {
+      RangeArray *ranges = _ranges;
+      if (!ranges)
+         return NULL;
+
+      // find the last range based at or below the address
+      uint8_t *pc = static_cast<uint8_t *>(address);
+      int32_t low = 0;
+      int32_t high = ranges->_count;
+      while (low < high)
+         {
+         int32_t mid = static_cast<int32_t>(static_cast<uint32_t>(low + high) >> 1);
+         if (ranges->_ranges[mid]._base <= pc)
+            low = mid + 1;
+         else
+            high = mid;
+         }
+
+      if (low == 0 || pc > ranges->_ranges[low - 1]._top)
+         return NULL;
+      return ranges->_ranges[low - 1]._codeCache;
+      }
+
+   /**
+    * @brief Number of indexed ranges
+    */
+   int32_t size()
+      {
+      RangeArray *ranges = _ranges;
+      return ranges ? ranges->_count : 0;
+      }
+
+   /**
+    * @brief Release the current and all superseded copies of the ranges
+    */
+   void destroy(TR::RawAllocator allocator);
+
+private:
+   struct Range
+      {
+      uint8_t       *_base;
+      uint8_t       *_top;        /*!< inclusive */
+      TR::CodeCache *_codeCache;
+      };
+
+   struct RangeArray
+      {
+      RangeArray *_superseded;   /*!< the copy this one replaced */
+      int32_t     _count;
+      Range       _ranges[1];
+      };
+
+   RangeArray * volatile _ranges;
+   };
+
+
 struct CodeCacheTempTrampolineSyncBlock
    {
    CodeCacheHashEntry              **_hashEntryArray;  /*!< a list of hash entries representing trampolines to be synchronized */
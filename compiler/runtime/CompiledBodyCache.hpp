@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#ifndef CompiledBodyCache_hpp
+#define CompiledBodyCache_hpp
+
+#include <stdint.h>
+
+namespace TR { class Compilation; }
+
+namespace TR {
+
+/**
+ * A store of previously compiled method bodies that a compilation consults
+ * once IL generation has finished. A hit skips optimization and code
+ * generation entirely.
+ */
+class CompiledBodyCache
+   {
+   public:
+   /**
+    * Compute the key identifying the body that the freshly generated IL of
+    * comp will compile to.
+    *
+    * @return false if the method cannot be cached, in which case neither
+    * load() nor store() is called for this compilation.
+    */
+   virtual bool computeKey(TR::Compilation *comp, uint64_t &key) = 0;
+
+   /**
+    * Install the body stored under key into the code cache reserved by
+    * comp's code generator, applying its relocations.
+    *
+    * @return the entry point of the installed body, or NULL on a miss.
+    */
+   virtual uint8_t *load(TR::Compilation *comp, uint64_t key) = 0;
+
+   /**
+    * Record the body just generated for comp under key.
+    */
+   virtual void store(TR::Compilation *comp, uint64_t key) = 0;
+   };
+
+}
+
+#endif
@@ -233,6 +233,7 @@ OMR::CodeCacheManager::destroy()
       self()->freeMemory(codeCache);
       codeCache = nextCache;
       }
+   _codeCacheRangeIndex.destroy(_rawAllocator);
 
    if (self()->usingRepository())
       {
@@ -279,6 +280,10 @@ OMR::CodeCacheManager::addCodeCache(TR::CodeCache *codeCache)
    {
    CacheListCriticalSection updateCacheList(self());
 
+   /* index its range for findCodeCacheFromPC; a cache the index fails to
+      take is still found there by falling back to a walk of the list */
+   _codeCacheRangeIndex.add(_rawAllocator, codeCache->getCodeBase(), codeCache->getHelperTop(), codeCache);
+
    /* add it to the linked list */
    codeCache->linkTo(_codeCacheList._head);
    FLUSH_MEMORY(true);  // Insure codeCache contents are globally visible before adding it to the list!
@@ -468,6 +473,10 @@ OMR::CodeCacheManager::performSizeAdjustments(size_t &warmCodeSize,
 TR::CodeCache *
 OMR::CodeCacheManager::findCodeCacheFromPC(void *inCacheAddress)
    {
+   /* the index covers every code cache unless it failed to grow at some point */
+   if (_codeCacheRangeIndex.size() == _curNumberOfCodeCaches)
+      return _codeCacheRangeIndex.find(inCacheAddress);
+
    TR::CodeCache *codeCache = self()->getFirstCodeCache();
    if (!codeCache)
       return NULL;
@@ -330,6 +330,7 @@ protected:
    TR::CodeCacheConfig            _config;
    TR::CodeCache                 *_lastCache;                         /*!< last code cache round robined through */
    CodeCacheList                  _codeCacheList;                     /*!< list of allocated code caches */
+   CodeCacheRangeIndex            _codeCacheRangeIndex;               /*!< address ranges of the code caches in _codeCacheList */
    int32_t                        _curNumberOfCodeCaches;
 
    // The following 3 fields are for implementation of code cache consolidation
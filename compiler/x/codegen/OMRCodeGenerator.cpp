@@ -1015,11 +1015,14 @@ OMR::X86::CodeGenerator::getSupportsOpCodeForAutoSIMD(TR::ILOpCode opcode, TR::D
          else
             return false;
       case TR::vneg:
-         return false;
+         if (dt == TR::Int8 || dt == TR::Int16 || dt == TR::Int32 || dt == TR::Int64 || dt == TR::Float || dt == TR::Double)
+            return true;
+         else
+            return false;
       case TR::vxor:
       case TR::vor:
       case TR::vand:
-         if (dt == TR::Int32 || dt == TR::Int64)
+         if (dt == TR::Int8 || dt == TR::Int16 || dt == TR::Int32 || dt == TR::Int64)
             return true;
          else
             return false;
@@ -1027,6 +1030,10 @@ OMR::X86::CodeGenerator::getSupportsOpCodeForAutoSIMD(TR::ILOpCode opcode, TR::D
       case TR::vloadi:
       case TR::vstore:
       case TR::vstorei:
+         if (dt == TR::Int8 || dt == TR::Int16 || dt == TR::Int32 || dt == TR::Int64 || dt == TR::Float || dt == TR::Double)
+            return true;
+         else
+            return false;
       case TR::vsplats:
          if (dt == TR::Int32 || dt == TR::Int64 || dt == TR::Float || dt == TR::Double)
             return true;
@@ -1039,15 +1046,14 @@ OMR::X86::CodeGenerator::getSupportsOpCodeForAutoSIMD(TR::ILOpCode opcode, TR::D
        * The getvelem case was changed to disable the use of getvelem on 32 bit x86.
        * This code will be reenabled as part of Issue 2035 which tracks the progress of fixing the GRA bug.
        * GRA does not work with vector registers on 64 bit either.
-       * getvelem is now being disabled on 64 bit for the same reasons as 32 bit.
-       * This code will be reenabled as part of Issue 2280
+       * getvelem is only reported as supported while vector registers are not
+       * globally allocated, which keeps reductions clear of that bug until
+       * Issue 2280 is resolved.
        */
       case TR::getvelem:
-#if 0
-         if (self()->comp()->target().is64Bit() && (dt == TR::Int32 || dt == TR::Int64 || dt == TR::Float || dt == TR::Double))
+         if (!self()->hasGlobalVRF() && self()->comp()->target().is64Bit() && (dt == TR::Int32 || dt == TR::Int64 || dt == TR::Float || dt == TR::Double))
             return true;
          else
-#endif //closes the if 0
             return false;
       default:
          return false;
@@ -20,6 +20,7 @@
  *******************************************************************************/
 
 #include "codegen/CodeGenerator.hpp"
+#include "codegen/ConstantDataSnippet.hpp"
 #include "codegen/MemoryReference.hpp"
 #include "codegen/RegisterPair.hpp"
 #include "codegen/TreeEvaluator.hpp"
@@ -329,3 +330,88 @@ TR::Register* OMR::X86::TreeEvaluator::SIMDgetvelemEvaluator(TR::Node* node, TR:
    return resReg;
    }
 
+
+TR::Register* OMR::X86::TreeEvaluator::SIMDnegEvaluator(TR::Node* node, TR::CodeGenerator* cg)
+   {
+   static uint8_t MASK_VFNEG[] =
+      {
+      0x00, 0x00, 0x00, 0x80,
+      0x00, 0x00, 0x00, 0x80,
+      0x00, 0x00, 0x00, 0x80,
+      0x00, 0x00, 0x00, 0x80,
+      };
+   static uint8_t MASK_VDNEG[] =
+      {
+      0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x80,
+      0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x80,
+      };
+
+   TR::Node* childNode = node->getFirstChild();
+   TR::Register* childReg = cg->evaluate(childNode);
+   TR::Register* resultReg = cg->allocateRegister(TR_VRF);
+
+   TR::InstOpCode::Mnemonic subOpCode = TR::InstOpCode::bad;
+   switch (node->getDataType())
+      {
+      case TR::VectorInt8:
+         subOpCode = TR::InstOpCode::PSUBBRegReg;
+         break;
+      case TR::VectorInt16:
+         subOpCode = TR::InstOpCode::PSUBWRegReg;
+         break;
+      case TR::VectorInt32:
+         subOpCode = TR::InstOpCode::PSUBDRegReg;
+         break;
+      case TR::VectorInt64:
+         subOpCode = TR::InstOpCode::PSUBQRegReg;
+         break;
+      case TR::VectorFloat:
+      case TR::VectorDouble:
+         break;
+      default:
+         TR_ASSERT(false, "unsupported vector type %s in SIMDnegEvaluator.\n", node->getDataType().toString());
+         break;
+      }
+
+   if (subOpCode != TR::InstOpCode::bad)
+      {
+      // integral lanes are negated as 0 - x
+      generateRegRegInstruction(TR::InstOpCode::PXORRegReg, node, resultReg, resultReg, cg);
+      generateRegRegInstruction(subOpCode, node, resultReg, childReg, cg);
+      }
+   else
+      {
+      // floating point lanes only have their sign bit flipped, so that -(0.0) is -0.0
+      uint8_t* mask = (TR::VectorFloat == node->getDataType()) ? MASK_VFNEG : MASK_VDNEG;
+      generateRegRegInstruction(TR::InstOpCode::MOVDQURegReg, node, resultReg, childReg, cg);
+      generateRegMemInstruction(TR::InstOpCode::PXORRegMem, node, resultReg, generateX86MemoryReference(cg->findOrCreate16ByteConstant(node, mask), cg), cg);
+      }
+
+   node->setRegister(resultReg);
+   cg->decReferenceCount(childNode);
+   return resultReg;
+   }
+
+TR::Register* OMR::X86::TreeEvaluator::SIMDnotEvaluator(TR::Node* node, TR::CodeGenerator* cg)
+   {
+   static uint8_t MASK_VNOT[] =
+      {
+      0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff,
+      };
+
+   TR::Node* childNode = node->getFirstChild();
+   TR::Register* childReg = cg->evaluate(childNode);
+   TR::Register* resultReg = cg->allocateRegister(TR_VRF);
+
+   generateRegRegInstruction(TR::InstOpCode::MOVDQURegReg, node, resultReg, childReg, cg);
+   generateRegMemInstruction(TR::InstOpCode::PXORRegMem, node, resultReg, generateX86MemoryReference(cg->findOrCreate16ByteConstant(node, MASK_VNOT), cg), cg);
+
+   node->setRegister(resultReg);
+   cg->decReferenceCount(childNode);
+   return resultReg;
+   }
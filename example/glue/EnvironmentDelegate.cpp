@@ -27,6 +27,9 @@
 #include "EnvironmentStandard.hpp"
 #include "EnvironmentDelegate.hpp"
 #include "GCExtensionsBase.hpp"
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+#include "Scavenger.hpp"
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 #include "SublistFragment.hpp"
 
 OMR_VMThread *
@@ -160,3 +163,17 @@ MM_EnvironmentDelegate::assumeExclusiveVMAccess(uintptr_t exclusiveCount)
 {
 	_env->getOmrVMThread()->exclusiveCount = exclusiveCount;
 }
+
+void
+MM_EnvironmentDelegate::forceOutOfLineVMAccess()
+{
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/* Mutator threads in the example VM never go through an out-of-line VM access path. The caller holds
+	 * exclusive VM access, so switch the thread to the new Concurrent Scavenger state right away.
+	 */
+	MM_GCExtensionsBase *extensions = _env->getExtensions();
+	if (extensions->isConcurrentScavengerEnabled()) {
+		extensions->scavenger->switchConcurrentForThread(_env);
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+}
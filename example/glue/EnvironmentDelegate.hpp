@@ -233,7 +233,11 @@ public:
 
 	void reacquireCriticalHeapAccess(uintptr_t data) {}
 
-	void forceOutOfLineVMAccess() {}
+	/**
+	 * Make the thread take the out-of-line path the next time it acquires or releases VM access, so that
+	 * it picks up a Concurrent Scavenger cycle transition.
+	 */
+	void forceOutOfLineVMAccess();
 
 #if defined (OMR_GC_THREAD_LOCAL_HEAP)
 	/**
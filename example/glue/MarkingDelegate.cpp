@@ -23,9 +23,13 @@
 #include "omrhashtable.h"
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 #include "MarkingScheme.hpp"
 #include "omrExampleVM.hpp"
 #include "OMRVMThreadListIterator.hpp"
+#include "SublistIterator.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
 
 #include "MarkingDelegate.hpp"
 
@@ -68,4 +72,22 @@ MM_MarkingDelegate::mainCleanupAfterGC(MM_EnvironmentBase *env)
 		}
 		objEntry = (ObjectEntry *)hashTableNextDo(&state);
 	}
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->scavengerEnabled) {
+		/* Unmarked objects are about to be swept, their memory must not be scanned as remembered by the next scavenge */
+		MM_SublistPuddle *puddle = NULL;
+		GC_SublistIterator remSetIterator(&extensions->rememberedSet);
+		while (NULL != (puddle = remSetIterator.nextList())) {
+			GC_SublistSlotIterator remSetSlotIterator(puddle);
+			omrobjectptr_t *slotPtr = NULL;
+			while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+				if ((NULL != *slotPtr) && !_markingScheme->isMarked(*slotPtr)) {
+					remSetSlotIterator.removeSlot();
+				}
+			}
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 }
@@ -67,6 +67,21 @@ public:
 	 */
 	virtual void tearDown(MM_GCExtensionsBase *extensions) {}
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/**
+	 * Determine the size an object occupied before it was copied, given the address of its copy. Objects in
+	 * this model do not grow when moved, so this is the consumed size of the copy.
+	 *
+	 * @param[in] objectPtr points to the copy of a strictly forwarded object
+	 * @return the total size of the original object, in bytes, including padding bytes
+	 */
+	MMINLINE uintptr_t
+	getConsumedSizeInBytesWithHeaderBeforeMove(omrobjectptr_t objectPtr)
+	{
+		return getConsumedSizeInBytesWithHeader(objectPtr);
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
 	/**
 	 * Constructor.
 	 */
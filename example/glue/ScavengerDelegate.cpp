@@ -222,4 +222,43 @@ MM_ScavengerDelegate::fixupDestroyedSlot(MM_EnvironmentBase *env, MM_ForwardedHe
 }
 #endif /* defined (OMR_GC_COMPRESSED_POINTERS) */
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+void
+MM_ScavengerDelegate::switchConcurrentForThread(MM_EnvironmentBase *env)
+{
+	/* Point the software read barrier range check at evacuate space for the duration of the cycle (see StandardReadBarrier.hpp) */
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+	if (_extensions->isConcurrentScavengerInProgress()) {
+		omrVMThread->readBarrierRangeCheckBase = _extensions->scavenger->getEvacuateBase();
+		omrVMThread->readBarrierRangeCheckTop = _extensions->scavenger->getEvacuateTop();
+	} else {
+		omrVMThread->readBarrierRangeCheckBase = (void *)UINTPTR_MAX;
+		omrVMThread->readBarrierRangeCheckTop = NULL;
+	}
+}
+
+void
+MM_ScavengerDelegate::fixupIndirectObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	/* This method must be implemented if an object may hold any object references that are live but not reachable
+	 * by traversing the reference graph from the root set or remembered set. In that case, this method should update
+	 * each such slot that points at a forwarded object to point at the copy.
+	 */
+}
+
+void
+MM_ScavengerDelegate::signalThreadsToFlushCaches(MM_EnvironmentBase *env)
+{
+	/* The example VM has no async events to deliver to mutator threads. It runs with exhaustive termination
+	 * disabled (see MM_StartupManagerImpl::createConfiguration()), so this is never called.
+	 */
+}
+
+void
+MM_ScavengerDelegate::cancelSignalToFlushCaches(MM_EnvironmentBase *env)
+{
+	/* Nothing was signalled (see signalThreadsToFlushCaches()) */
+}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
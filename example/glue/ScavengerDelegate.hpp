@@ -242,6 +242,16 @@ public:
 	 * Fixup should update slots to point to the forwarded version of the object and/or remove self forwarded bit in the object itself.
 	 */
 	void fixupIndirectObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+	/**
+	 * Ask mutator threads to release their copy caches so that the concurrent phase can tell whether all scan work is done.
+	 * @param[in] env The environment for the calling thread.
+	 */
+	void signalThreadsToFlushCaches(MM_EnvironmentBase *env);
+	/**
+	 * Withdraw a request made by signalThreadsToFlushCaches() once the concurrent phase is over.
+	 * @param[in] env The environment for the calling thread.
+	 */
+	void cancelSignalToFlushCaches(MM_EnvironmentBase *env);
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 	bool initialize(MM_EnvironmentBase* env) { return true; }
@@ -90,6 +90,16 @@ MM_StartupManagerImpl::createConfiguration(MM_EnvironmentBase *env)
 #endif /* OMR_GC_SEGREGATED_HEAP */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	if (ext->scavengerEnabled) {
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		/* The example VM has no hardware guarded loads, so a requested Concurrent Scavenger runs with the
+		 * software read barrier (see StandardReadBarrier.hpp). There is no async event to make mutators
+		 * flush their copy caches either, so the concurrent phase ends once GC threads run out of work and
+		 * objects copied by mutators are scanned in the final STW phase.
+		 */
+		ext->concurrentScavenger = ext->concurrentScavengerForced;
+		ext->softwareRangeCheckReadBarrier = ext->concurrentScavenger;
+		ext->concurrentScavengeExhaustiveTermination = false;
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 		return MM_ConfigurationGenerational::newInstance(env);
 	} else
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,176 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "runtime/CodeCacheTypes.hpp"
+
+namespace {
+
+const uintptr_t FIRST_CACHE_BASE = 0x10000000;
+const uintptr_t CACHE_STRIDE = 0x100000;
+const uintptr_t CACHE_SIZE = 0x80000;
+
+/**
+ * Stand-in for a TR::CodeCache on the manager's list, so the index can be
+ * compared against the list walk it replaces.
+ */
+struct FakeCodeCache
+   {
+   uint8_t *_base;
+   uint8_t *_top;
+   FakeCodeCache *_next;
+   };
+
+uint8_t *address(uintptr_t value) { return reinterpret_cast<uint8_t *>(value); }
+
+TR::CodeCache *asCodeCache(FakeCodeCache *cache) { return reinterpret_cast<TR::CodeCache *>(cache); }
+
+/**
+ * Builds `count` disjoint code cache ranges, adding them to both the index and a
+ * newest-first list in a shuffled order, as caches carved from different
+ * segments arrive.
+ */
+class CodeCacheRangeIndexTest : public ::testing::Test
+   {
+   protected:
+
+   void populate(int32_t count)
+      {
+      _caches.resize(count);
+      std::vector<int32_t> order(count);
+      for (int32_t i = 0; i < count; i++)
+         {
+         _caches[i]._base = address(FIRST_CACHE_BASE + i * CACHE_STRIDE);
+         _caches[i]._top = _caches[i]._base + CACHE_SIZE - 1;
+         order[i] = i;
+         }
+      std::shuffle(order.begin(), order.end(), _random);
+
+      _head = NULL;
+      for (int32_t i = 0; i < count; i++)
+         {
+         FakeCodeCache *cache = &_caches[order[i]];
+         ASSERT_TRUE(_index.add(_allocator, cache->_base, cache->_top, asCodeCache(cache)));
+         cache->_next = _head;
+         _head = cache;
+         }
+      }
+
+   TR::CodeCache *walk(void *pc)
+      {
+      for (FakeCodeCache *cache = _head; cache; cache = cache->_next)
+         {
+         if (static_cast<uint8_t *>(pc) >= cache->_base && static_cast<uint8_t *>(pc) <= cache->_top)
+            return asCodeCache(cache);
+         }
+      return NULL;
+      }
+
+   virtual void TearDown()
+      {
+      _index.destroy(_allocator);
+      }
+
+   TR::RawAllocator _allocator;
+   OMR::CodeCacheRangeIndex _index;
+   std::vector<FakeCodeCache> _caches;
+   FakeCodeCache *_head;
+   std::mt19937 _random;
+   };
+
+TEST_F(CodeCacheRangeIndexTest, testEmpty)
+   {
+   ASSERT_EQ(0, _index.size());
+   ASSERT_TRUE(NULL == _index.find(address(FIRST_CACHE_BASE)));
+   }
+
+TEST_F(CodeCacheRangeIndexTest, testRangeBoundaries)
+   {
+   populate(37);
+   ASSERT_EQ(37, _index.size());
+
+   for (size_t i = 0; i < _caches.size(); i++)
+      {
+      FakeCodeCache *cache = &_caches[i];
+      ASSERT_EQ(asCodeCache(cache), _index.find(cache->_base));
+      ASSERT_EQ(asCodeCache(cache), _index.find(cache->_base + CACHE_SIZE / 2));
+      ASSERT_EQ(asCodeCache(cache), _index.find(cache->_top));
+      ASSERT_TRUE(NULL == _index.find(cache->_top + 1));
+      ASSERT_TRUE(NULL == _index.find(cache->_base - 1));
+      }
+
+   ASSERT_TRUE(NULL == _index.find(address(0)));
+   ASSERT_TRUE(NULL == _index.find(address(UINTPTR_MAX)));
+   }
+
+/**
+ * Lookup latency of the index against the list walk as the number of code
+ * caches grows. Timings are reported, not asserted on; the test only checks
+ * that both lookups agree.
+ */
+class CodeCacheRangeIndexLatencyTest : public CodeCacheRangeIndexTest,
+                                       public ::testing::WithParamInterface<int32_t>
+   {
+   };
+
+TEST_P(CodeCacheRangeIndexLatencyTest, testLookupLatency)
+   {
+   const int32_t count = GetParam();
+   const int32_t lookups = 1 << 18;
+   populate(count);
+
+   // mostly PCs inside a cache, as seen by stack walks, with some misses in the gaps
+   std::uniform_int_distribution<uintptr_t> offset(0, count * CACHE_STRIDE - 1);
+   std::vector<void *> pcs(lookups);
+   for (int32_t i = 0; i < lookups; i++)
+      pcs[i] = address(FIRST_CACHE_BASE + offset(_random));
+
+   for (int32_t i = 0; i < lookups; i += 97)
+      ASSERT_EQ(walk(pcs[i]), _index.find(pcs[i]));
+
+   uintptr_t sink = 0;
+   std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+   for (int32_t i = 0; i < lookups; i++)
+      sink += reinterpret_cast<uintptr_t>(walk(pcs[i]));
+   std::chrono::steady_clock::time_point walkEnd = std::chrono::steady_clock::now();
+   for (int32_t i = 0; i < lookups; i++)
+      sink -= reinterpret_cast<uintptr_t>(_index.find(pcs[i]));
+   std::chrono::steady_clock::time_point indexEnd = std::chrono::steady_clock::now();
+
+   ASSERT_EQ(static_cast<uintptr_t>(0), sink);
+
+   double walkNanos = std::chrono::duration<double, std::nano>(walkEnd - start).count() / lookups;
+   double indexNanos = std::chrono::duration<double, std::nano>(indexEnd - walkEnd).count() / lookups;
+   std::cout << "code caches: " << count
+             << "  list walk: " << walkNanos << " ns/lookup"
+             << "  range index: " << indexNanos << " ns/lookup" << std::endl;
+   RecordProperty("listWalkNanosPerLookup", static_cast<int>(walkNanos));
+   RecordProperty("rangeIndexNanosPerLookup", static_cast<int>(indexNanos));
+   }
+
+INSTANTIATE_TEST_CASE_P(CodeCacheCounts, CodeCacheRangeIndexLatencyTest, ::testing::Values(1, 4, 16, 64, 256, 1024));
+
+}
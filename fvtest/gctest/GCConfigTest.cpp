@@ -22,10 +22,15 @@
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
+#include "mmomrhook.h"
 #include "ObjectAllocationModel.hpp"
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
 #include "omrgc.h"
+#include "ParallelDispatcher.hpp"
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+#include "Scavenger.hpp"
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
 #include "VerboseWriterChain.hpp"
@@ -43,21 +48,53 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/workStealing_GC_config.xml"
+                        , "fvtest/gctest/configuration/workPacketCache_GC_config.xml"
+                        , "fvtest/gctest/configuration/treeBarrier_GC_config.xml"
+                        , "fvtest/gctest/configuration/indexedFreeList_GC_config.xml"
+                        , "fvtest/gctest/configuration/allocationSampling_GC_config.xml"
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
 #endif
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK) && defined(OMR_GC_REALTIME)
+                        , "fvtest/gctest/configuration/satb_GC_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/partialCompact_GC_config.xml"
+#endif
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+                        , "fvtest/gctest/configuration/gcOnIdle_GC_config.xml"
+#endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/numaScavengerCopy_GC_config.xml"
+                        , "fvtest/gctest/configuration/parallelHeapIterate_GC_config.xml"
+                        , "fvtest/gctest/configuration/rememberedSetOverflow_GC_config.xml"
+                        , "fvtest/gctest/configuration/treeBarrierScavenge_GC_config.xml"
+                        , "fvtest/gctest/configuration/adaptiveTLHSizing_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
                         , "fvtest/gctest/configuration/gencon_GC_backout_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_CONCURRENT_SWEEP)
+                        , "fvtest/gctest/configuration/lazySweepScavenge_GC_config.xml"
+#endif
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+                        , "fvtest/gctest/configuration/concurrentScavenger_GC_config.xml"
 #endif
                         };
 
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
-								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+								, "perftest/gctest/configuration/scavenger_pause_stw.xml"
+#endif
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+								, "perftest/gctest/configuration/scavenger_pause_concurrent.xml"
+#endif
+								};
 void
 GCConfigTest::SetUp()
 {
@@ -116,6 +153,10 @@ GCConfigTest::SetUp()
 	verboseManager->enableVerboseGC();
 	verboseManager->setInitializedTime(omrtime_hires_clock());
 
+	/* count allocation samples, reported only if the configuration sets allocationSamplingInterval */
+	J9HookInterface **mmOmrHooks = J9_HOOK_INTERFACE(env->getExtensions()->omrHookInterface);
+	(*mmOmrHooks)->J9HookRegisterWithCallSite(mmOmrHooks, J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE, allocationSampleHook, OMR_GET_CALLSITE(), (void *)this);
+
 	/* Initialize root table */
 	exampleVM->rootTable = hashTableNew(
 			exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
@@ -145,6 +186,11 @@ GCConfigTest::TearDown()
 		exampleVM->objectTable = NULL;
 	}
 
+	if (NULL != env) {
+		J9HookInterface **mmOmrHooks = J9_HOOK_INTERFACE(env->getExtensions()->omrHookInterface);
+		(*mmOmrHooks)->J9HookUnregister(mmOmrHooks, J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE, allocationSampleHook, (void *)this);
+	}
+
 	/* close verboseManager and clean up verbose files */
 	if (NULL != verboseManager) {
 		verboseManager->closeStreams(env);
@@ -309,6 +355,9 @@ GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
 	MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
 			MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+	/* the test thread holds no unrooted references between allocations, so concurrent mark may use this one
+	 * as the safe point at which it activates its write barrier */
+	noGc->getAllocateDescription()->setThreadIsAtSafePoint(true);
 	objEntry.objPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
 
 	if (NULL == objEntry.objPtr) {
@@ -688,8 +737,10 @@ GCConfigTest::removeObjectFromParentSlot(const char *name, ObjectEntry *parentEn
 
 	while (currentSlot < endSlot) {
 		GC_SlotObject slotObject(exampleVM->_omrVM, currentSlot);
-		if (objEntry->objPtr == slotObject.readReferenceFromSlot()) {
+		if (objEntry->objPtr == standardReadBarrierLoad(exampleVM->_omrVMThread, currentSlot)) {
 			gcTestEnv->log(LEVEL_VERBOSE, "Remove object %s(%p[0x%llx]) from parent %s(%p[0x%llx]) slot %p.\n", name, objEntry->objPtr, objEntry->objPtr->header.raw(), parentEntry->name, parentEntry->objPtr, parentEntry->objPtr->header.raw(), slotObject.readAddressFromSlot());
+			/* clearing a reference creates no new one, only the pre-store barrier applies */
+			standardWriteBarrierPre(exampleVM->_omrVMThread, currentSlot);
 			slotObject.writeReferenceToSlot(NULL);
 			rt = 0;
 			break;
@@ -906,6 +957,31 @@ done:
 	return rt;
 }
 
+void
+GCConfigTest::allocationSampleHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	((GCConfigTest *)userData)->allocationSampleCount += 1;
+}
+
+int32_t
+GCConfigTest::verifyAllocationSamples(pugi::xpath_node_set allocationSamples)
+{
+	int32_t rt = 0;
+	for (pugi::xpath_node_set::const_iterator it = allocationSamples.begin(); it != allocationSamples.end(); ++it) {
+		const char *minimumStr = it->node().attribute("minimum").value();
+		if (0 == strcmp(minimumStr, "")) {
+			minimumStr = "1";
+		}
+		uintptr_t minimum = (uintptr_t)atoi(minimumStr);
+		gcTestEnv->log("Allocation samples reported: %zu (expected at least %zu)\n", allocationSampleCount, minimum);
+		if (allocationSampleCount < minimum) {
+			gcTestEnv->log(LEVEL_ERROR, "*FAILED* Only %zu allocation samples were reported, expected at least %zu.\n", allocationSampleCount, minimum);
+			rt = 1;
+		}
+	}
+	return rt;
+}
+
 int32_t
 GCConfigTest::parseGarbagePolicy(pugi::xml_node node)
 {
@@ -953,6 +1029,216 @@ done:
 	return rt;
 }
 
+/**
+ * Per-thread totals gathered by iterateHeap().
+ */
+struct HeapIterationTotals {
+	uintptr_t objectCount;
+	uintptr_t objectBytes;
+	uintptr_t threadCount;
+	uintptr_t reportingThreadCount;
+};
+
+static void *
+heapIterationThreadStart(OMR_VMThread *omrVMThread, void *userData)
+{
+	OMRPORT_ACCESS_FROM_OMRVMTHREAD(omrVMThread);
+	HeapIterationTotals *threadTotals = (HeapIterationTotals *)omrmem_allocate_memory(sizeof(HeapIterationTotals), OMRMEM_CATEGORY_MM);
+	if (NULL != threadTotals) {
+		threadTotals->objectCount = 0;
+		threadTotals->objectBytes = 0;
+		threadTotals->threadCount = 1;
+		threadTotals->reportingThreadCount = 0;
+	}
+	return threadTotals;
+}
+
+static void
+heapIterationObjectDo(OMR_VMThread *omrVMThread, omrobjectptr_t object, void *threadData)
+{
+	HeapIterationTotals *threadTotals = (HeapIterationTotals *)threadData;
+	if (NULL != threadTotals) {
+		MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVMThread->_vm);
+		threadTotals->objectCount += 1;
+		threadTotals->objectBytes += extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+	}
+	/* give the other workers a chance to claim sections on machines with fewer CPUs than GC threads */
+	omrthread_yield();
+}
+
+static void
+heapIterationThreadMerge(OMR_VMThread *omrVMThread, void *threadData, void *userData)
+{
+	OMRPORT_ACCESS_FROM_OMRVMTHREAD(omrVMThread);
+	HeapIterationTotals *threadTotals = (HeapIterationTotals *)threadData;
+	HeapIterationTotals *totals = (HeapIterationTotals *)userData;
+	if (NULL == threadTotals) {
+		/* a worker that could not allocate its totals is reported as a missing thread */
+		return;
+	}
+	totals->objectCount += threadTotals->objectCount;
+	totals->objectBytes += threadTotals->objectBytes;
+	totals->threadCount += threadTotals->threadCount;
+	if (0 != threadTotals->objectCount) {
+		totals->reportingThreadCount += 1;
+	}
+	omrmem_free_memory(threadTotals);
+}
+
+int32_t
+GCConfigTest::iterateHeap(uintptr_t iterateFlags, uintptr_t *objectCount, uintptr_t *objectBytes, uintptr_t *reportingThreadCount)
+{
+	OMR_GC_HeapIteratorCallbacks callbacks = { heapIterationThreadStart, heapIterationObjectDo, heapIterationThreadMerge };
+	HeapIterationTotals totals = { 0, 0, 0, 0 };
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(exampleVM->_omrVM);
+	uintptr_t maximumThreadCount = OMR_ARE_ANY_BITS_SET(iterateFlags, OMR_GC_HEAP_ITERATE_SINGLE_THREADED) ? 1 : extensions->dispatcher->threadCount();
+
+	int32_t rt = (int32_t)OMR_GC_IterateHeap(exampleVM->_omrVMThread, &callbacks, &totals, iterateFlags);
+	if (OMR_ERROR_NONE != rt) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_IterateHeap with error code %d.\n", __FILE__, __LINE__, rt);
+	} else if ((0 == totals.threadCount) || (maximumThreadCount < totals.threadCount)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Heap iteration merged %zu threads, expected 1 to %zu.\n", __FILE__, __LINE__, totals.threadCount, maximumThreadCount);
+		rt = 1;
+	} else {
+		gcTestEnv->log("Heap iteration merged the totals of %zu threads, %zu of which reported objects\n", totals.threadCount, totals.reportingThreadCount);
+		*objectCount = totals.objectCount;
+		*objectBytes = totals.objectBytes;
+		*reportingThreadCount = totals.reportingThreadCount;
+	}
+	return rt;
+}
+
+int32_t
+GCConfigTest::verifyHeapIteration(pugi::xml_node node)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	int32_t rt = 0;
+	uintptr_t iterateFlags = 0;
+	uintptr_t parallelCount = 0;
+	uintptr_t parallelBytes = 0;
+	uintptr_t serialCount = 0;
+	uintptr_t serialBytes = 0;
+	uintptr_t reportingThreadCount = 0;
+	uintptr_t serialReportingThreadCount = 0;
+	uintptr_t minimumReportingThreadCount = (uintptr_t)node.attribute("minimumReportingThreads").as_int(1);
+
+	if (0 == strcmp(node.attribute("liveObjectsOnly").value(), "true")) {
+		iterateFlags |= OMR_GC_HEAP_ITERATE_LIVE_OBJECTS_ONLY;
+	}
+
+	int64_t startTime = omrtime_current_time_millis();
+	rt = iterateHeap(iterateFlags, &parallelCount, &parallelBytes, &reportingThreadCount);
+	OMRGCTEST_CHECK_RT(rt);
+	gcTestEnv->log("Parallel heap iteration found %zu objects (%zu bytes) in %lld ms\n", parallelCount, parallelBytes, (omrtime_current_time_millis() - startTime));
+
+	startTime = omrtime_current_time_millis();
+	rt = iterateHeap(iterateFlags | OMR_GC_HEAP_ITERATE_SINGLE_THREADED, &serialCount, &serialBytes, &serialReportingThreadCount);
+	OMRGCTEST_CHECK_RT(rt);
+	gcTestEnv->log("Single threaded heap iteration found %zu objects (%zu bytes) in %lld ms\n", serialCount, serialBytes, (omrtime_current_time_millis() - startTime));
+
+	if ((parallelCount != serialCount) || (parallelBytes != serialBytes)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Parallel and single threaded heap iterations disagree.\n", __FILE__, __LINE__);
+		rt = 1;
+	} else if (0 == parallelCount) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Heap iteration found no objects.\n", __FILE__, __LINE__);
+		rt = 1;
+	} else if (reportingThreadCount < minimumReportingThreadCount) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Parallel heap iteration found objects on %zu threads, expected at least %zu.\n", __FILE__, __LINE__, reportingThreadCount, minimumReportingThreadCount);
+		rt = 1;
+	}
+
+done:
+	return rt;
+}
+
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+/**
+ * Read barrier range seen by a thread attached by verifyThreadAttach().
+ */
+struct AttachedThreadRange {
+	OMR_VM *omrVM;
+	omr_error_t rc;
+	void *readBarrierRangeCheckBase;
+	void *readBarrierRangeCheckTop;
+};
+
+static int J9THREAD_PROC
+attachedThreadMain(void *entryArg)
+{
+	AttachedThreadRange *range = (AttachedThreadRange *)entryArg;
+	OMR_VMThread *omrVMThread = NULL;
+
+	range->rc = OMR_Thread_Init(range->omrVM, NULL, &omrVMThread, "OMRAttachTestThread");
+	if (OMR_ERROR_NONE == range->rc) {
+		range->readBarrierRangeCheckBase = omrVMThread->readBarrierRangeCheckBase;
+		range->readBarrierRangeCheckTop = omrVMThread->readBarrierRangeCheckTop;
+		range->rc = OMR_Thread_Free(omrVMThread);
+	}
+	return 0;
+}
+
+int32_t
+GCConfigTest::verifyThreadAttach(pugi::xml_node node)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	int32_t rt = 0;
+
+	if (!extensions->isConcurrentScavengerEnabled()) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d attachThread requires concurrentScavenger.\n", __FILE__, __LINE__);
+		return 1;
+	}
+
+	/* allocate unreferenced objects until an allocation failure starts a Concurrent Scavenge cycle, which then stays
+	 * in progress until the next allocation failure */
+	uintptr_t allocatedBytes = 0;
+	const uintptr_t objectSize = 256;
+	uintptr_t allocationLimit = 2 * extensions->heap->getMemorySize();
+	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+	while (!extensions->isConcurrentScavengerInProgress() && (allocatedBytes < allocationLimit)) {
+		MM_ObjectAllocationModel *allocationModel = new(objectAllocationModelSpace)
+				MM_ObjectAllocationModel(env, objectSize, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false));
+		if (NULL == OMR_GC_AllocateObject(exampleVM->_omrVMThread, allocationModel)) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to allocate garbage of size 0x%zx.\n", __FILE__, __LINE__, objectSize);
+			return 1;
+		}
+		allocatedBytes += objectSize;
+	}
+	if (!extensions->isConcurrentScavengerInProgress()) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d No Concurrent Scavenge cycle started after allocating %zu bytes.\n", __FILE__, __LINE__, allocatedBytes);
+		return 1;
+	}
+
+	AttachedThreadRange range = { exampleVM->_omrVM, OMR_ERROR_NONE, NULL, NULL };
+	omrthread_t thread = NULL;
+	omrthread_attr_t attr = NULL;
+	if ((J9THREAD_SUCCESS != omrthread_attr_init(&attr))
+		|| (J9THREAD_SUCCESS != omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))
+		|| (J9THREAD_SUCCESS != omrthread_create_ex(&thread, &attr, 0, attachedThreadMain, &range))
+		|| (J9THREAD_SUCCESS != omrthread_join(thread))
+	) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to run the attaching thread.\n", __FILE__, __LINE__);
+		rt = 1;
+	} else if (OMR_ERROR_NONE != range.rc) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to attach a thread during a Concurrent Scavenge, rc=%d.\n", __FILE__, __LINE__, range.rc);
+		rt = 1;
+	} else if ((extensions->scavenger->getEvacuateBase() != range.readBarrierRangeCheckBase)
+		|| (extensions->scavenger->getEvacuateTop() != range.readBarrierRangeCheckTop)
+	) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d A thread attached during a Concurrent Scavenge checks [%p, %p) in its read barrier, expected evacuate space [%p, %p).\n",
+				__FILE__, __LINE__, range.readBarrierRangeCheckBase, range.readBarrierRangeCheckTop, extensions->scavenger->getEvacuateBase(), extensions->scavenger->getEvacuateTop());
+		rt = 1;
+	} else {
+		gcTestEnv->log("A thread attached during a Concurrent Scavenge checks evacuate space [%p, %p) in its read barrier\n", range.readBarrierRangeCheckBase, range.readBarrierRangeCheckTop);
+	}
+	if (NULL != attr) {
+		omrthread_attr_destroy(&attr);
+	}
+
+	return rt;
+}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+
 int32_t
 GCConfigTest::triggerOperation(pugi::xml_node node)
 {
@@ -973,6 +1259,16 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "heapIterate")) {
+			gcTestEnv->log("Invoking heap iteration...\n");
+			rt = verifyHeapIteration(node);
+			OMRGCTEST_CHECK_RT(rt);
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		} else if (0 == strcmp(node.name(), "attachThread")) {
+			gcTestEnv->log("Attaching a thread during a Concurrent Scavenge...\n");
+			rt = verifyThreadAttach(node);
+			OMRGCTEST_CHECK_RT(rt);
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 		}
 	}
 done:
@@ -1046,6 +1342,8 @@ TEST_P(GCConfigTest, test)
 			pugi::xpath_node_set verboseGCs = configChild.select_nodes(verboseNodeSet);
 			rt = verifyVerboseGC(verboseGCs);
 			ASSERT_EQ(0, rt) << "Failed in verbose GC verification.";
+			rt = verifyAllocationSamples(configChild.select_nodes("allocationSamples"));
+			ASSERT_EQ(0, rt) << "Failed in allocation sample verification.";
 			gcTestEnv->log("[ Verification Successful ]\n\n");
 		} else if (0 == strcmp(configChild.name(), "operation")) {
 			gcTestEnv->log("\n++++++++++++++++++++++++++++Operation+++++++++++++++++++++++++++\n");
@@ -29,6 +29,7 @@
 #include "ObjectAllocationInterface.hpp"
 #include "ObjectModel.hpp"
 #include "pugixml.hpp"
+#include "StandardReadBarrier.hpp"
 #include "StartupManagerTestExample.hpp"
 #include "VerboseManager.hpp"
 
@@ -87,6 +88,8 @@ protected:
 	char *verboseFile;
 	uintptr_t numOfFiles;
 
+	uintptr_t allocationSampleCount; /**< allocations reported through J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE */
+
 	/*
 	 * Function members
 	 */
@@ -108,7 +111,14 @@ protected:
 	void printFile(const char *name);
 #endif
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
+	int32_t verifyAllocationSamples(pugi::xpath_node_set allocationSamples);
+	static void allocationSampleHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
 	int32_t parseGarbagePolicy(pugi::xml_node node);
+	int32_t iterateHeap(uintptr_t iterateFlags, uintptr_t *objectCount, uintptr_t *objectBytes, uintptr_t *reportingThreadCount);
+	int32_t verifyHeapIteration(pugi::xml_node node);
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	int32_t verifyThreadAttach(pugi::xml_node node);
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 	int32_t triggerOperation(pugi::xml_node node);
 	int32_t iniXMLStr(const char *configStyle);
 
@@ -126,6 +136,9 @@ protected:
 	 *
 	 * Also, for these reasons, use of GC_ObjectIterator in mutator (GCConfigTest) code is strongly
 	 * discouraged.
+	 *
+	 * The objectTable is only fixed up at the end of a scavenge, so while a Concurrent Scavenge is in
+	 * progress find() loads objPtr through the read barrier to get the current copy of the object.
 	 */
 
 	ObjectEntry *
@@ -133,7 +146,11 @@ protected:
 	{
 		ObjectEntry searchEntry;
 		searchEntry.name = name;
-		return (ObjectEntry *)hashTableFind(exampleVM->objectTable, &searchEntry);
+		ObjectEntry *foundEntry = (ObjectEntry *)hashTableFind(exampleVM->objectTable, &searchEntry);
+		if (NULL != foundEntry) {
+			standardReadBarrierLoadRoot(exampleVM->_omrVMThread, &foundEntry->objPtr);
+		}
+		return foundEntry;
 	}
 
 	ObjectEntry *
@@ -159,6 +176,7 @@ public:
 		, verboseManager(NULL)
 		, verboseFile(NULL)
 		, numOfFiles(0)
+		, allocationSampleCount(0)
 	{
 		gp.namePrefix = NULL;
 		gp.percentage = 0.0f;
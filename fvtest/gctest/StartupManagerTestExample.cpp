@@ -83,7 +83,28 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
+				} else if (0 == strcmp(attr.name(), "workStealing")) {
+					extensions->workStealing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "lockFreePacketLists")) {
+					extensions->lockFreePacketLists = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "workPacketCache")) {
+					extensions->workPacketCache = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "treeBarrier")) {
+					extensions->treeBarrier = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "treeBarrierSpinCount")) {
+					extensions->treeBarrierSpinCount = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "indexedFreeList")) {
+					extensions->indexedFreeList = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveTLHSizing")) {
+					extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhRefreshTargetInterval")) {
+					extensions->tlhRefreshTargetInterval = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "numaAwareScavengerCopy")) {
+					extensions->scavengerNUMAAwareCopy = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodeCount")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -101,11 +122,90 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentScavenger")) {
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+					extensions->concurrentScavengerForced = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentScavenger=true ignored, requires OMR_GC_CONCURRENT_SCAVENGER (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER)*/
+				} else if (0 == strcmp(attr.name(), "snapshotAtTheBeginningBarrier")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK) && defined(OMR_GC_REALTIME)
+					extensions->configurationOptions._forceOptionWriteBarrierSATB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: snapshotAtTheBeginningBarrier=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK and OMR_GC_REALTIME (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) && defined(OMR_GC_REALTIME) */
+				} else if (0 == strcmp(attr.name(), "satbBufferSize")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK) && defined(OMR_GC_REALTIME)
+					extensions->satbBufferSize = atoi(attr.value());
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: satbBufferSize ignored, requires OMR_GC_MODRON_CONCURRENT_MARK and OMR_GC_REALTIME (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) && defined(OMR_GC_REALTIME) */
+				} else if (0 == strcmp(attr.name(), "concurrentSweep")) {
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+					extensions->concurrentSweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+					extensions->configurationOptions._forceOptionConcurrentSweep = extensions->concurrentSweep;
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentSweep=true ignored, requires OMR_GC_CONCURRENT_SWEEP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP)*/
+				} else if (0 == strcmp(attr.name(), "gcOnIdle")) {
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+					extensions->gcOnIdle = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: gcOnIdle=true ignored, requires OMR_GC_IDLE_HEAP_MANAGER (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+				} else if (0 == strcmp(attr.name(), "deferFreePageRelease")) {
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+					extensions->deferFreePageRelease = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: deferFreePageRelease=true ignored, requires OMR_GC_IDLE_HEAP_MANAGER (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+				} else if (0 == strcmp(attr.name(), "allocationSamplingInterval")) {
+					/* takes the same size suffixes as -Xgc:allocationSamplingInterval= */
+					char samplingOption[64];
+					OMRPORT_ACCESS_FROM_OMRVM(extensions->getOmrVM());
+					omrstr_printf(samplingOption, sizeof(samplingOption), "-Xgc:allocationSamplingInterval=%s", attr.value());
+					if (!handleOption(extensions, samplingOption)) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Invalid allocationSamplingInterval: %s\n", attr.value());
+						result = false;
+					}
+				} else if (0 == strcmp(attr.name(), "markingPrefetchDepth")) {
+					extensions->markingPrefetchDepth = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+					extensions->compactOnGlobalGC = (0 == j9_cmdla_stricmp(attr.value(), "true")) ? 1 : 0;
+					extensions->noCompactOnGlobalGC = (0 == extensions->compactOnGlobalGC) ? 1 : 0;
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: compactOnGlobalGC=true ignored, requires OMR_GC_MODRON_COMPACTION (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+				} else if (0 == strcmp(attr.name(), "partialCompactionPercent")) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+					extensions->partialCompactionPercent = atoi(attr.value());
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: partialCompactionPercent ignored, requires OMR_GC_MODRON_COMPACTION (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "recordRememberedSetOverflow")) {
+					extensions->scavengerRecordRememberedSetOverflow = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "rememberedSetMaxSize")) {
+					/* in bytes regardless of sizeUnit, as a remembered set small enough to overflow is far below any unit */
+					extensions->rememberedSet.setMaxSize(atoi(attr.value()));
+				} else if (0 == strcmp(attr.name(), "scavengerScanOrdering")) {
+					if (0 == j9_cmdla_stricmp(attr.value(), "breadthFirst")) {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "dynamicBreadthFirst")) {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "depthFirst")) {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DEPTH_FIRST;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "hierarchical")) {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL;
+					} else {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized scavenger scan ordering (expected breadthFirst, dynamicBreadthFirst, depthFirst or hierarchical): %s\n", attr.value());
+						result = false;
+					}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
@@ -0,0 +1,337 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+#include "omrcfg.h"
+
+#include "FreeEntryIndex.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "LargeObjectAllocateStats.hpp"
+
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+/*
+ * The index only touches the header and links at the start of each entry, so entries are laid out in small
+ * fixed size cells and claim sizes far larger than the cell. This keeps the address order of the free list
+ * while reaching the tree threshold without a large buffer.
+ */
+const uintptr_t CELL_SLOTS = 8;
+const uintptr_t CELL_COUNT = 1024;
+const uintptr_t MINIMUM_FREE_ENTRY_SIZE = 64;
+const uintptr_t LARGEST_SHIFT = 24; /**< entry sizes range up to 32MB, well past the tree threshold */
+const uintptr_t ITERATIONS = 20000;
+const bool COMPRESSED = false;
+
+/**
+ * xorshift generator, seeded so that failures can be reproduced.
+ */
+class Random
+{
+private:
+	uint64_t _state;
+
+public:
+	uint64_t
+	next()
+	{
+		_state ^= _state << 13;
+		_state ^= _state >> 7;
+		_state ^= _state << 17;
+		return _state;
+	}
+
+	/** @return a value in [0, bound) */
+	uintptr_t
+	below(uintptr_t bound)
+	{
+		return (uintptr_t)(next() % bound);
+	}
+
+	Random(uint64_t seed)
+		: _state(seed)
+	{
+	}
+};
+
+/**
+ * An address ordered free list over a set of cells, with a scalar reference for every index query.
+ */
+class FreeList
+{
+public:
+	uintptr_t *_cells;
+	bool _free[CELL_COUNT];
+	MM_HeapLinkedFreeHeader *_head;
+	MM_FreeEntryIndex _index;
+
+	MM_HeapLinkedFreeHeader *
+	entry(uintptr_t cell)
+	{
+		return (MM_HeapLinkedFreeHeader *)(_cells + (cell * CELL_SLOTS));
+	}
+
+	/**
+	 * @return the free entry preceding cell on the list, or NULL
+	 */
+	MM_HeapLinkedFreeHeader *
+	findPrevious(uintptr_t cell)
+	{
+		while (0 != cell) {
+			cell -= 1;
+			if (_free[cell]) {
+				return entry(cell);
+			}
+		}
+		return NULL;
+	}
+
+	/**
+	 * Link a free entry of the given size at cell, without indexing it.
+	 */
+	void
+	link(uintptr_t cell, uintptr_t size, MM_HeapLinkedFreeHeader **previous, MM_HeapLinkedFreeHeader **next)
+	{
+		MM_HeapLinkedFreeHeader *freeEntry = entry(cell);
+		*previous = findPrevious(cell);
+		*next = (NULL == *previous) ? _head : (*previous)->getNext(COMPRESSED);
+		freeEntry->setSize(size);
+		freeEntry->setNext(*next, COMPRESSED);
+		if (NULL == *previous) {
+			_head = freeEntry;
+		} else {
+			(*previous)->setNext(freeEntry, COMPRESSED);
+		}
+		_free[cell] = true;
+	}
+
+	/**
+	 * Unlink an indexed free entry from both the index and the list, as an allocate would.
+	 */
+	void
+	unlink(uintptr_t cell)
+	{
+		MM_HeapLinkedFreeHeader *freeEntry = entry(cell);
+		MM_HeapLinkedFreeHeader *previous = _index.getListPrevious(freeEntry);
+		MM_HeapLinkedFreeHeader *next = freeEntry->getNext(COMPRESSED);
+		_index.remove(freeEntry);
+		if (NULL == previous) {
+			_head = next;
+		} else {
+			previous->setNext(next, COMPRESSED);
+		}
+		_index.setListPrevious(next, previous);
+		_free[cell] = false;
+	}
+
+	uintptr_t
+	cellOf(MM_HeapLinkedFreeHeader *freeEntry)
+	{
+		return ((uintptr_t *)freeEntry - _cells) / CELL_SLOTS;
+	}
+
+	/**
+	 * @return the smallest free entry of at least size bytes (lowest address among equal sizes) whose size
+	 * is at least minimumSize, or NULL
+	 */
+	MM_HeapLinkedFreeHeader *
+	findBestFit(uintptr_t size, uintptr_t minimumSize)
+	{
+		MM_HeapLinkedFreeHeader *bestFit = NULL;
+		for (uintptr_t cell = 0; cell < CELL_COUNT; cell++) {
+			if (_free[cell]) {
+				uintptr_t entrySize = entry(cell)->getSize();
+				if ((entrySize >= size) && (entrySize >= minimumSize) && ((NULL == bestFit) || (entrySize < bestFit->getSize()))) {
+					bestFit = entry(cell);
+				}
+			}
+		}
+		return bestFit;
+	}
+
+	FreeList()
+		: _cells(new uintptr_t[CELL_COUNT * CELL_SLOTS])
+		, _head(NULL)
+	{
+		for (uintptr_t cell = 0; cell < CELL_COUNT; cell++) {
+			_free[cell] = false;
+		}
+	}
+
+	~FreeList()
+	{
+		delete[] _cells;
+	}
+};
+
+uintptr_t
+randomSize(Random *random)
+{
+	uintptr_t shift = 6 + random->below(LARGEST_SHIFT - 6 + 1);
+	uintptr_t size = ((uintptr_t)1 << shift) + random->below((uintptr_t)1 << shift);
+	return size & ~(sizeof(uintptr_t) - 1);
+}
+
+/**
+ * Check that every free entry records its list predecessor and that the largest entry is reported.
+ */
+void
+verifyIndex(FreeList *list, const char *when, uintptr_t iteration)
+{
+	MM_HeapLinkedFreeHeader *previous = NULL;
+	uintptr_t largestSize = 0;
+	for (MM_HeapLinkedFreeHeader *freeEntry = list->_head; NULL != freeEntry; freeEntry = freeEntry->getNext(COMPRESSED)) {
+		ASSERT_EQ(previous, list->_index.getListPrevious(freeEntry)) << when << " iteration " << iteration;
+		largestSize = OMR_MAX(largestSize, freeEntry->getSize());
+		previous = freeEntry;
+	}
+	ASSERT_EQ(largestSize, list->_index.getLargestEntrySize()) << when << " iteration " << iteration;
+}
+
+} /* namespace */
+
+TEST(TestFreeEntryIndex, rejectsEntriesTooSmallForLinks)
+{
+	MM_FreeEntryIndex index;
+	ASSERT_FALSE(index.initialize(NULL, sizeof(MM_HeapLinkedFreeHeader)));
+	ASSERT_TRUE(index.initialize(NULL, MINIMUM_FREE_ENTRY_SIZE));
+	ASSERT_FALSE(index.isValid());
+}
+
+TEST(TestFreeEntryIndex, lookupOutcomes)
+{
+	FreeList list;
+	MM_HeapLinkedFreeHeader *previous = NULL;
+	MM_HeapLinkedFreeHeader *next = NULL;
+	MM_LargeObjectAllocateStats::FreeEntryIndexLookup lookup = MM_LargeObjectAllocateStats::freeEntryIndexLookupCount;
+
+	ASSERT_TRUE(list._index.initialize(NULL, MINIMUM_FREE_ENTRY_SIZE));
+	/* four bins per power of two from 64 bytes; the two largest entries go to the tree */
+	list.link(0, 72, &previous, &next);
+	list.link(1, 200, &previous, &next);
+	list.link(2, 8 * 1024 * 1024, &previous, &next);
+	list.link(3, 6 * 1024 * 1024, &previous, &next);
+	list._index.build(list._head, COMPRESSED);
+	ASSERT_TRUE(list._index.isValid());
+	verifyIndex(&list, "build", 0);
+
+	ASSERT_EQ(list.entry(0), list._index.findFit(64, lookup));
+	ASSERT_EQ(MM_LargeObjectAllocateStats::freeEntryIndexBinHit, lookup);
+	ASSERT_EQ(list.entry(1), list._index.findFit(100, lookup));
+	ASSERT_EQ(MM_LargeObjectAllocateStats::freeEntryIndexLargerBinHit, lookup);
+	ASSERT_EQ(list.entry(3), list._index.findFit(300, lookup));
+	ASSERT_EQ(MM_LargeObjectAllocateStats::freeEntryIndexTreeHit, lookup);
+	ASSERT_EQ(list.entry(3), list._index.findFit(5 * 1024 * 1024, lookup));
+	ASSERT_EQ(MM_LargeObjectAllocateStats::freeEntryIndexTreeHit, lookup);
+	ASSERT_EQ(list.entry(2), list._index.findFit(7 * 1024 * 1024, lookup));
+	ASSERT_EQ(MM_LargeObjectAllocateStats::freeEntryIndexTreeHit, lookup);
+	ASSERT_TRUE(NULL == list._index.findFit(9 * 1024 * 1024, lookup));
+	ASSERT_EQ(MM_LargeObjectAllocateStats::freeEntryIndexMiss, lookup);
+
+	/* with only the 72 byte entry left, a 70 byte request must walk the bin shared with smaller sizes */
+	list.unlink(1);
+	list.unlink(2);
+	list.unlink(3);
+	verifyIndex(&list, "unlink", 0);
+	ASSERT_EQ(list.entry(0), list._index.findFit(70, lookup));
+	ASSERT_EQ(MM_LargeObjectAllocateStats::freeEntryIndexBinWalkHit, lookup);
+	ASSERT_TRUE(NULL == list._index.findFit(76, lookup));
+	ASSERT_EQ(MM_LargeObjectAllocateStats::freeEntryIndexMiss, lookup);
+
+	list.unlink(0);
+	ASSERT_TRUE(NULL == list._head);
+	ASSERT_EQ((uintptr_t)0, list._index.getLargestEntrySize());
+}
+
+TEST(TestFreeEntryIndex, randomAllocateAndFree)
+{
+	const uint64_t seed = 0x2545F4914F6CDD1DULL;
+	FreeList list;
+	Random random(seed);
+	MM_HeapLinkedFreeHeader *previous = NULL;
+	MM_HeapLinkedFreeHeader *next = NULL;
+	MM_LargeObjectAllocateStats::FreeEntryIndexLookup lookup = MM_LargeObjectAllocateStats::freeEntryIndexLookupCount;
+	uintptr_t lookups[MM_LargeObjectAllocateStats::freeEntryIndexLookupCount + 1] = {0};
+
+	ASSERT_TRUE(list._index.initialize(NULL, MINIMUM_FREE_ENTRY_SIZE));
+	for (uintptr_t cell = 0; cell < CELL_COUNT; cell += 2) {
+		list.link(cell, randomSize(&random), &previous, &next);
+	}
+	list._index.build(list._head, COMPRESSED);
+	verifyIndex(&list, "build", 0);
+
+	/* the smallest entry the tree holds: any request at least this large is a best fit lookup */
+	uintptr_t treeThreshold = MINIMUM_FREE_ENTRY_SIZE << (MM_FreeEntryIndex::BIN_COUNT >> MM_FreeEntryIndex::SUB_BIN_SHIFT);
+
+	for (uintptr_t iteration = 0; iteration < ITERATIONS; iteration++) {
+		uintptr_t cell = random.below(CELL_COUNT);
+		if (!list._free[cell] && (0 != random.below(2))) {
+			/* free: link a new entry in address order */
+			list.link(cell, randomSize(&random), &previous, &next);
+			list._index.insert(list.entry(cell), previous, next);
+		} else {
+			/* allocate: the index must find a fit whenever the list holds one */
+			uintptr_t size = randomSize(&random);
+			MM_HeapLinkedFreeHeader *bestFit = list.findBestFit(size, 0);
+			MM_HeapLinkedFreeHeader *found = list._index.findFit(size, lookup);
+			lookups[lookup] += 1;
+			if (NULL == found) {
+				ASSERT_TRUE(NULL == bestFit) << "missed a fit for " << size << " seed " << seed << " iteration " << iteration;
+				ASSERT_EQ(MM_LargeObjectAllocateStats::freeEntryIndexMiss, lookup);
+			} else {
+				uintptr_t foundCell = list.cellOf(found);
+				ASSERT_TRUE(list._free[foundCell]) << "seed " << seed << " iteration " << iteration;
+				ASSERT_LE(size, found->getSize()) << "seed " << seed << " iteration " << iteration;
+				if (MM_LargeObjectAllocateStats::freeEntryIndexTreeHit == lookup) {
+					ASSERT_EQ(list.findBestFit(size, treeThreshold), found) << "tree fit for " << size << " seed " << seed << " iteration " << iteration;
+				} else {
+					ASSERT_GT(treeThreshold, found->getSize()) << "seed " << seed << " iteration " << iteration;
+				}
+				if (size >= treeThreshold) {
+					ASSERT_EQ(bestFit, found) << "best fit for " << size << " seed " << seed << " iteration " << iteration;
+				}
+
+				uintptr_t remainder = found->getSize() - size;
+				list.unlink(foundCell);
+				if ((remainder >= MINIMUM_FREE_ENTRY_SIZE) && (0 != random.below(2))) {
+					/* split: the remainder goes back on the list and into the index */
+					list.link(foundCell, remainder & ~(sizeof(uintptr_t) - 1), &previous, &next);
+					list._index.insert(list.entry(foundCell), previous, next);
+				}
+			}
+		}
+
+		if (0 == (iteration % 64)) {
+			verifyIndex(&list, "update", iteration);
+		}
+		if (0 == (iteration % 1024)) {
+			list._index.build(list._head, COMPRESSED);
+			verifyIndex(&list, "rebuild", iteration);
+		}
+	}
+
+	/* every outcome must have been exercised */
+	for (uintptr_t i = 0; i < MM_LargeObjectAllocateStats::freeEntryIndexLookupCount; i++) {
+		ASSERT_LT((uintptr_t)0, lookups[i]) << "lookup outcome " << i << " never seen";
+	}
+}
@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "HeapMapKernels.hpp"
+
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+const uintptr_t SLOT_COUNT = 48 * 1024; /**< large enough for fills over the streaming threshold */
+const uintptr_t GUARD_SLOTS = 8;
+const uintptr_t GUARD_VALUE = 0xDEADBEEF;
+const uintptr_t ITERATIONS = 400;
+
+/**
+ * xorshift generator, seeded so that failures can be reproduced.
+ */
+class Random
+{
+private:
+	uint64_t _state;
+
+public:
+	uint64_t
+	next()
+	{
+		_state ^= _state << 13;
+		_state ^= _state >> 7;
+		_state ^= _state << 17;
+		return _state;
+	}
+
+	/** @return a value in [0, bound) */
+	uintptr_t
+	below(uintptr_t bound)
+	{
+		return (uintptr_t)(next() % bound);
+	}
+
+	Random(uint64_t seed)
+		: _state(seed)
+	{
+	}
+};
+
+/**
+ * Pick a range with a random misalignment, mostly short (to exercise the alignment prologue and scalar tail)
+ * and sometimes longer than the streaming threshold.
+ */
+void
+randomRange(Random *random, uintptr_t *base, uintptr_t *top)
+{
+	uintptr_t maxLength = (0 == random->below(4)) ? SLOT_COUNT : 64;
+	*base = random->below(SLOT_COUNT);
+	*top = *base + random->below(OMR_MIN(maxLength, SLOT_COUNT - *base) + 1);
+}
+
+uintptr_t
+randomSlotValue(Random *random)
+{
+	switch (random->below(3)) {
+	case 0:
+		return 0;
+	case 1:
+		return UDATA_MAX;
+	default:
+		return (uintptr_t)random->next();
+	}
+}
+
+/**
+ * Compare the kernels bound at level against the scalar reference on random ranges of random maps.
+ */
+void
+compareWithScalar(MM_HeapMapKernels::KernelLevel level, uint64_t seed)
+{
+	MM_HeapMapKernels reference;
+	MM_HeapMapKernels kernels;
+	ASSERT_TRUE(reference.bindKernelLevel(gcTestEnv->portLib, MM_HeapMapKernels::KERNEL_LEVEL_SCALAR));
+	if (!kernels.bindKernelLevel(gcTestEnv->portLib, level)) {
+		gcTestEnv->log("Kernel level %d is not supported by this processor, skipped\n", (int)level);
+		return;
+	}
+	ASSERT_EQ(level, kernels.getKernelLevel());
+
+	uintptr_t *expectedMap = new uintptr_t[SLOT_COUNT + (2 * GUARD_SLOTS)];
+	uintptr_t *actualMap = new uintptr_t[SLOT_COUNT + (2 * GUARD_SLOTS)];
+	uintptr_t *expected = expectedMap + GUARD_SLOTS;
+	uintptr_t *actual = actualMap + GUARD_SLOTS;
+	Random random(seed);
+
+	for (uintptr_t i = 0; i < (SLOT_COUNT + (2 * GUARD_SLOTS)); i++) {
+		expectedMap[i] = GUARD_VALUE;
+		actualMap[i] = GUARD_VALUE;
+	}
+
+	for (uintptr_t iteration = 0; iteration < ITERATIONS; iteration++) {
+		/* sparse map: mostly empty with a few set slots, so that searches cross whole vectors */
+		for (uintptr_t i = 0; i < SLOT_COUNT; i++) {
+			uintptr_t value = (0 == random.below(2048)) ? ((uintptr_t)1 << random.below(sizeof(uintptr_t) * 8)) : 0;
+			expected[i] = value;
+			actual[i] = value;
+		}
+
+		uintptr_t base = 0;
+		uintptr_t top = 0;
+		randomRange(&random, &base, &top);
+		ASSERT_EQ(reference.findNonZeroSlot(expected + base, expected + top) - expected, kernels.findNonZeroSlot(actual + base, actual + top) - actual)
+			<< "findNonZeroSlot [" << base << ", " << top << ") seed " << seed << " iteration " << iteration;
+		ASSERT_EQ(reference.isZero(expected + base, expected + top), kernels.isZero(actual + base, actual + top))
+			<< "isZero [" << base << ", " << top << ") seed " << seed << " iteration " << iteration;
+
+		uintptr_t slotValue = randomSlotValue(&random);
+		randomRange(&random, &base, &top);
+		reference.fillSlots(expected + base, expected + top, slotValue);
+		kernels.fillSlots(actual + base, actual + top, slotValue);
+		for (uintptr_t i = 0; i < (SLOT_COUNT + (2 * GUARD_SLOTS)); i++) {
+			ASSERT_EQ(expectedMap[i], actualMap[i])
+				<< "fillSlots [" << base << ", " << top << ") value " << slotValue << " differs at slot " << ((intptr_t)i - (intptr_t)GUARD_SLOTS)
+				<< " seed " << seed << " iteration " << iteration;
+		}
+
+		/* the range just filled must now be found (or not) consistently with its value */
+		ASSERT_EQ(reference.findNonZeroSlot(expected + base, expected + top) - expected, kernels.findNonZeroSlot(actual + base, actual + top) - actual)
+			<< "findNonZeroSlot after fill [" << base << ", " << top << ") seed " << seed << " iteration " << iteration;
+	}
+
+	delete[] expectedMap;
+	delete[] actualMap;
+}
+
+} /* namespace */
+
+TEST(TestHeapMapKernels, scalarMatchesDefinition)
+{
+	MM_HeapMapKernels kernels;
+	uintptr_t map[64];
+
+	ASSERT_TRUE(kernels.bindKernelLevel(gcTestEnv->portLib, MM_HeapMapKernels::KERNEL_LEVEL_SCALAR));
+	for (uintptr_t i = 0; i < 64; i++) {
+		map[i] = 0;
+	}
+	ASSERT_EQ(map + 64, kernels.findNonZeroSlot(map, map + 64));
+	ASSERT_TRUE(kernels.isZero(map, map + 64));
+
+	map[37] = 4;
+	ASSERT_EQ(map + 37, kernels.findNonZeroSlot(map, map + 64));
+	ASSERT_EQ(map + 37, kernels.findNonZeroSlot(map + 37, map + 64));
+	ASSERT_EQ(map + 37, kernels.findNonZeroSlot(map, map + 37));
+	ASSERT_FALSE(kernels.isZero(map + 30, map + 40));
+
+	kernels.fillSlots(map + 3, map + 10, 7);
+	for (uintptr_t i = 0; i < 64; i++) {
+		uintptr_t expected = ((3 <= i) && (i < 10)) ? 7 : ((37 == i) ? 4 : 0);
+		ASSERT_EQ(expected, map[i]) << "slot " << i;
+	}
+}
+
+TEST(TestHeapMapKernels, sse41MatchesScalar)
+{
+	compareWithScalar(MM_HeapMapKernels::KERNEL_LEVEL_SSE4_1, 0x9E3779B97F4A7C15ULL);
+}
+
+TEST(TestHeapMapKernels, avx2MatchesScalar)
+{
+	compareWithScalar(MM_HeapMapKernels::KERNEL_LEVEL_AVX2, 0xD1B54A32D192ED03ULL);
+}
@@ -0,0 +1,415 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionManagerTarok.hpp"
+#include "LockFreeFreeHeapRegionList.hpp"
+#include "LockFreeHeapRegionQueue.hpp"
+#include "omrgc.h"
+#include "StartupManagerTestExample.hpp"
+
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+const char *CONFIG_FILE = "fvtest/gctest/configuration/test_system_gc.xml";
+const uintptr_t REGION_SIZE = 64 * 1024;
+const uintptr_t REGION_COUNT = 16;
+/* the descriptors only record their range, so the heap they describe is never mapped */
+const uintptr_t FAKE_HEAP_BASE = 1024 * REGION_SIZE;
+const uintptr_t THREAD_COUNT = 8;
+const uintptr_t ITERATIONS = 200000;
+const uintptr_t LIST_COUNT = 2;
+
+/**
+ * xorshift generator, seeded per thread so that each thread mixes operations differently.
+ */
+class Random
+{
+private:
+	uint64_t _state;
+
+public:
+	uint64_t
+	next()
+	{
+		_state ^= _state << 13;
+		_state ^= _state >> 7;
+		_state ^= _state << 17;
+		return _state;
+	}
+
+	/** @return a value in [0, bound) */
+	uintptr_t
+	below(uintptr_t bound)
+	{
+		return (uintptr_t)(next() % bound);
+	}
+
+	Random(uint64_t seed)
+		: _state(seed)
+	{
+	}
+};
+
+/**
+ * State shared by the threads of one stress run. A thread claims every region it takes off a list
+ * before putting it back; a region that is already claimed was handed to two threads at once, which
+ * is what an ABA on the list head would do.
+ */
+struct StressState
+{
+	MM_HeapRegionManager *regionManager;
+	MM_LockFreeHeapRegionQueue *queues[LIST_COUNT];
+	MM_LockFreeFreeHeapRegionList *lists[LIST_COUNT];
+	volatile uintptr_t claimed[REGION_COUNT];
+	volatile uintptr_t duplicateClaims;
+	volatile uintptr_t dirtyLinks;
+	volatile uintptr_t threadsStarted;
+	uint64_t seed;
+};
+
+struct WorkerArgs
+{
+	StressState *state;
+	uint64_t seed;
+};
+
+bool
+claim(StressState *state, MM_HeapRegionDescriptorSegregated *region)
+{
+	uintptr_t index = state->regionManager->mapDescriptorToRegionTableIndex(region);
+	if (0 != MM_AtomicOperations::lockCompareExchange(&state->claimed[index], 0, 1)) {
+		MM_AtomicOperations::add(&state->duplicateClaims, 1);
+		return false;
+	}
+	return true;
+}
+
+void
+release(StressState *state, MM_HeapRegionDescriptorSegregated *region)
+{
+	uintptr_t index = state->regionManager->mapDescriptorToRegionTableIndex(region);
+	MM_AtomicOperations::set(&state->claimed[index], 0);
+}
+
+/**
+ * Claim a region taken off a list on its own, and check that it was unlinked.
+ */
+bool
+claimSingle(StressState *state, MM_HeapRegionDescriptorSegregated *region)
+{
+	if ((NULL != region->getNext()) || (NULL != region->getPrev())) {
+		MM_AtomicOperations::add(&state->dirtyLinks, 1);
+	}
+	return claim(state, region);
+}
+
+/**
+ * Claim every region of a chain taken off a list, and unlink them so that they can be put back one by one.
+ * @return the number of regions in the chain
+ */
+uintptr_t
+claimChain(StressState *state, MM_HeapRegionDescriptorSegregated *chain, MM_HeapRegionDescriptorSegregated **regions)
+{
+	uintptr_t count = 0;
+	while (NULL != chain) {
+		MM_HeapRegionDescriptorSegregated *next = chain->getNext();
+		chain->setNext(NULL);
+		if (claim(state, chain)) {
+			regions[count] = chain;
+			count += 1;
+		}
+		chain = next;
+	}
+	return count;
+}
+
+/**
+ * Wait until every thread has started, so that the operations of all threads overlap.
+ */
+void
+startTogether(StressState *state)
+{
+	MM_AtomicOperations::add(&state->threadsStarted, 1);
+	while (THREAD_COUNT > state->threadsStarted) {
+		MM_AtomicOperations::yieldCPU();
+	}
+}
+
+int J9THREAD_PROC
+queueWorker(void *entryArg)
+{
+	WorkerArgs *args = (WorkerArgs *)entryArg;
+	StressState *state = args->state;
+	Random random(args->seed);
+	MM_HeapRegionDescriptorSegregated *regions[REGION_COUNT];
+
+	startTogether(state);
+	for (uintptr_t i = 0; i < ITERATIONS; i++) {
+		MM_LockFreeHeapRegionQueue *queue = state->queues[random.below(LIST_COUNT)];
+		MM_LockFreeHeapRegionQueue *other = state->queues[random.below(LIST_COUNT)];
+		uintptr_t operation = random.below(16);
+		if (operation < 14) {
+			MM_HeapRegionDescriptorSegregated *region = queue->dequeue();
+			if ((NULL != region) && claimSingle(state, region)) {
+				release(state, region);
+				other->enqueue(region);
+			}
+		} else if (operation < 15) {
+			/* move the whole queue at once, as the region pool does between its lists */
+			other->enqueue(queue);
+		} else {
+			uintptr_t count = 0;
+			count = claimChain(state, queue->dequeueAll(&count), regions);
+			for (uintptr_t j = 0; j < count; j++) {
+				release(state, regions[j]);
+				other->enqueue(regions[j]);
+			}
+		}
+	}
+	return 0;
+}
+
+int J9THREAD_PROC
+listWorker(void *entryArg)
+{
+	WorkerArgs *args = (WorkerArgs *)entryArg;
+	StressState *state = args->state;
+	Random random(args->seed);
+	MM_HeapRegionDescriptorSegregated *regions[REGION_COUNT];
+
+	startTogether(state);
+	for (uintptr_t i = 0; i < ITERATIONS; i++) {
+		MM_LockFreeFreeHeapRegionList *list = state->lists[random.below(LIST_COUNT)];
+		MM_LockFreeFreeHeapRegionList *other = state->lists[random.below(LIST_COUNT)];
+		uintptr_t operation = random.below(16);
+		if (operation < 14) {
+			MM_HeapRegionDescriptorSegregated *region = list->pop();
+			if ((NULL != region) && claimSingle(state, region)) {
+				release(state, region);
+				other->push(region);
+			}
+		} else if (operation < 15) {
+			other->push(list);
+		} else {
+			uintptr_t count = 0;
+			count = claimChain(state, list->popAll(&count), regions);
+			for (uintptr_t j = 0; j < count; j++) {
+				release(state, regions[j]);
+				other->push(regions[j]);
+			}
+		}
+	}
+	return 0;
+}
+
+} /* namespace */
+
+class TestLockFreeRegionQueue : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_HeapRegionManager *regionManager;
+	StressState state;
+
+	virtual void
+	SetUp()
+	{
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, CONFIG_FILE);
+		omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "SetUp(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+		rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "SetUp(): OMR_Thread_Init failed, rc=" << rc;
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+
+		/* a table of segregated region descriptors, as the segregated configuration creates it */
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		uintptr_t descriptorSize = sizeof(MM_HeapRegionDescriptorSegregated) + sizeof(uintptr_t *) * extensions->arrayletsPerRegion;
+		regionManager = MM_HeapRegionManagerTarok::newInstance(env, REGION_SIZE, descriptorSize, MM_HeapRegionDescriptorSegregated::initializer, MM_HeapRegionDescriptorSegregated::destructor);
+		ASSERT_TRUE(NULL != regionManager);
+		ASSERT_TRUE(regionManager->setContiguousHeapRange(env, (void *)FAKE_HEAP_BASE, (void *)(FAKE_HEAP_BASE + (REGION_COUNT * REGION_SIZE))));
+
+		memset(&state, 0, sizeof(state));
+		state.regionManager = regionManager;
+
+		/* the lists map regions through the region manager of the extensions when they are initialized */
+		MM_HeapRegionManager *heapRegionManager = extensions->heapRegionManager;
+		extensions->heapRegionManager = regionManager;
+		for (uintptr_t i = 0; i < LIST_COUNT; i++) {
+			state.queues[i] = MM_LockFreeHeapRegionQueue::newInstance(env, MM_HeapRegionList::HRL_KIND_AVAILABLE);
+			state.lists[i] = MM_LockFreeFreeHeapRegionList::newInstance(env, MM_HeapRegionList::HRL_KIND_FREE);
+		}
+		extensions->heapRegionManager = heapRegionManager;
+		for (uintptr_t i = 0; i < LIST_COUNT; i++) {
+			ASSERT_TRUE(NULL != state.queues[i]);
+			ASSERT_TRUE(NULL != state.lists[i]);
+		}
+	}
+
+	virtual void
+	TearDown()
+	{
+		for (uintptr_t i = 0; i < LIST_COUNT; i++) {
+			if (NULL != state.queues[i]) {
+				state.queues[i]->kill(env);
+			}
+			if (NULL != state.lists[i]) {
+				state.lists[i]->kill(env);
+			}
+		}
+		if (NULL != regionManager) {
+			regionManager->destroyRegionTable(env);
+			regionManager->kill(env);
+		}
+
+		omr_error_t rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+		exampleVM->_omrVMThread = NULL;
+	}
+
+	MM_HeapRegionDescriptorSegregated *
+	region(uintptr_t index)
+	{
+		return (MM_HeapRegionDescriptorSegregated *)regionManager->physicalTableDescriptorForIndex(index);
+	}
+
+	/**
+	 * Run THREAD_COUNT threads of entryProc to completion.
+	 */
+	void
+	runWorkers(omrthread_entrypoint_t entryProc)
+	{
+		omrthread_t threads[THREAD_COUNT];
+		WorkerArgs args[THREAD_COUNT];
+		omrthread_attr_t attr = NULL;
+
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+		for (uintptr_t i = 0; i < THREAD_COUNT; i++) {
+			args[i].state = &state;
+			args[i].seed = 0x9E3779B97F4A7C15ULL * (i + 1);
+			ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&threads[i], &attr, 0, entryProc, &args[i]));
+		}
+		for (uintptr_t i = 0; i < THREAD_COUNT; i++) {
+			ASSERT_EQ(J9THREAD_SUCCESS, omrthread_join(threads[i]));
+		}
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+	}
+
+	/**
+	 * Check that the regions taken off the lists once the threads are done are exactly the regions of the table.
+	 */
+	void
+	expectEveryRegionOnce(MM_HeapRegionDescriptorSegregated **regions, uintptr_t count)
+	{
+		bool seen[REGION_COUNT];
+		memset(seen, 0, sizeof(seen));
+
+		EXPECT_EQ(REGION_COUNT, count) << "regions were lost or duplicated";
+		for (uintptr_t i = 0; i < count; i++) {
+			uintptr_t index = regionManager->mapDescriptorToRegionTableIndex(regions[i]);
+			ASSERT_GT(REGION_COUNT, index);
+			EXPECT_FALSE(seen[index]) << "region " << index << " is on the lists twice";
+			seen[index] = true;
+		}
+		EXPECT_EQ((uintptr_t)0, state.duplicateClaims) << "a region was handed to two threads at once";
+		EXPECT_EQ((uintptr_t)0, state.dirtyLinks) << "a region was handed out still linked";
+	}
+
+	TestLockFreeRegionQueue()
+		: ::testing::Test()
+		, exampleVM(&(gcTestEnv->exampleVM))
+		, env(NULL)
+		, regionManager(NULL)
+	{
+		memset(&state, 0, sizeof(state));
+	}
+};
+
+TEST_F(TestLockFreeRegionQueue, concurrentEnqueueDequeue)
+{
+	for (uintptr_t i = 0; i < REGION_COUNT; i++) {
+		state.queues[i % LIST_COUNT]->enqueue(region(i));
+	}
+
+	runWorkers(queueWorker);
+
+	uintptr_t total = 0;
+	for (uintptr_t i = 0; i < LIST_COUNT; i++) {
+		total += state.queues[i]->getTotalRegions();
+	}
+	EXPECT_EQ(REGION_COUNT, total) << "the queue lengths do not match the regions they hold";
+
+	MM_HeapRegionDescriptorSegregated *regions[REGION_COUNT * 2];
+	uintptr_t count = 0;
+	for (uintptr_t i = 0; i < LIST_COUNT; i++) {
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		while ((count < (REGION_COUNT * 2)) && (NULL != (region = state.queues[i]->dequeue()))) {
+			regions[count] = region;
+			count += 1;
+		}
+		EXPECT_TRUE(state.queues[i]->isEmpty());
+		EXPECT_EQ((uintptr_t)0, state.queues[i]->getTotalRegions());
+	}
+	expectEveryRegionOnce(regions, count);
+}
+
+TEST_F(TestLockFreeRegionQueue, concurrentPushPop)
+{
+	for (uintptr_t i = 0; i < REGION_COUNT; i++) {
+		state.lists[i % LIST_COUNT]->push(region(i));
+	}
+
+	runWorkers(listWorker);
+
+	uintptr_t total = 0;
+	for (uintptr_t i = 0; i < LIST_COUNT; i++) {
+		total += state.lists[i]->getTotalRegions();
+	}
+	EXPECT_EQ(REGION_COUNT, total) << "the list lengths do not match the regions they hold";
+
+	MM_HeapRegionDescriptorSegregated *regions[REGION_COUNT * 2];
+	uintptr_t count = 0;
+	for (uintptr_t i = 0; i < LIST_COUNT; i++) {
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		while ((count < (REGION_COUNT * 2)) && (NULL != (region = state.lists[i]->pop()))) {
+			regions[count] = region;
+			count += 1;
+		}
+		EXPECT_EQ((uintptr_t)0, state.lists[i]->getTotalRegions());
+	}
+	expectEveryRegionOnce(regions, count);
+}
+
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
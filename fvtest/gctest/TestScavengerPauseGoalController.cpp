@@ -0,0 +1,202 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrgcconsts.h"
+
+#include "ScavengerPauseGoalController.hpp"
+
+#include <gtest/gtest.h>
+
+typedef MM_ScavengerPauseGoalController::Sample Sample;
+
+namespace {
+
+const uintptr_t MB = 1024 * 1024;
+const uintptr_t ALIGNMENT = 512 * 1024;
+
+/*
+ * Scavenges recorded from gcFunctionalTest runs of scavenger_GC_config.xml (3MB new space, fixed) with
+ * -Xgc:scavengerPauseGoal=2: {pause us, new space size, flipped bytes, tenured bytes, tenure age}.
+ */
+const Sample fixedNurserySamples[] = {
+	{2801, 3145728, 1519432, 0, 6},
+	{1823, 3145728, 1570760, 0, 5},
+	{2849, 3145728, 51328, 1519432, 5},
+	{1962, 3145728, 1466712, 51328, 4},
+	{1776, 3145728, 1566952, 0, 4},
+	{2080, 3145728, 105848, 1466712, 4},
+	{1919, 3145728, 1413384, 100240, 3},
+	{1844, 3145728, 1563744, 0, 3},
+	{2075, 3145728, 157176, 1413384, 3},
+	{1797, 3145728, 1368872, 150360, 2},
+	{1812, 3145728, 1553720, 6816, 2},
+	{2116, 3145728, 210504, 1362056, 2},
+	{4702, 3145728, 1361568, 210504, 1},
+	{5043, 3145728, 184960, 1361568, 1},
+};
+
+/*
+ * Scavenges recorded from gencon_GC_config.xml with new space allowed to grow from 3MB to 8MB and
+ * -Xgc:scavengerPauseGoal=4.
+ */
+const Sample growingNurserySamples[] = {
+	{2422, 3145728, 1519432, 0, 6},
+	{1457, 3145728, 1570760, 0, 6},
+	{4413, 5636096, 1257416, 1519432, 7},
+	{4662, 5636096, 2293512, 1005592, 6},
+	{3253, 5636096, 1597440, 1206088, 5},
+	{4036, 5636096, 1748592, 1036096, 5},
+};
+
+struct ReplayResult {
+	uintptr_t recordedMisses; /**< recorded scavenges which went over the goal */
+	uintptr_t controlledMisses; /**< scavenges predicted to go over the goal at the recommended size */
+};
+
+/**
+ * Feed recorded scavenges through the controller one at a time. Each recommendation is judged against
+ * the survival and copy rates the next recorded scavenge actually measured, which is the pause that
+ * scavenge would have taken had new space been sized as recommended.
+ */
+ReplayResult
+replay(MM_ScavengerPauseGoalController *controller, const Sample *samples, uintptr_t count, uintptr_t minimumSize, uintptr_t maximumSize)
+{
+	ReplayResult result = {0, 0};
+
+	for (uintptr_t i = 0; i < count; i++) {
+		controller->update(&samples[i]);
+
+		uintptr_t recommendedSize = controller->getRecommendedNurserySize();
+		uintptr_t recommendedTenureAge = controller->getRecommendedTenureAge();
+		EXPECT_LE(minimumSize, recommendedSize);
+		EXPECT_GE(maximumSize, recommendedSize);
+		EXPECT_EQ((uintptr_t)0, recommendedSize % ALIGNMENT);
+		EXPECT_LE(recommendedSize, samples[i].nurserySize * 2);
+		EXPECT_GE(recommendedSize, samples[i].nurserySize / 2 - ALIGNMENT);
+		EXPECT_LE((uintptr_t)OBJECT_HEADER_AGE_MIN, recommendedTenureAge);
+		EXPECT_GE((uintptr_t)OBJECT_HEADER_AGE_MAX, recommendedTenureAge);
+
+		if ((i + 1) < count) {
+			const Sample *next = &samples[i + 1];
+			double copiedBytes = (double)(next->flipBytes + next->tenureBytes);
+			double survivalRate = copiedBytes / (double)next->nurserySize;
+			double copyRate = copiedBytes / (double)next->pauseTime;
+			double pauseTime = (survivalRate * (double)recommendedSize) / copyRate;
+			if (next->pauseTime > controller->getPauseGoal()) {
+				result.recordedMisses += 1;
+			}
+			if (pauseTime > (double)controller->getPauseGoal()) {
+				result.controlledMisses += 1;
+			}
+		}
+	}
+
+	return result;
+}
+
+}
+
+TEST(TestScavengerPauseGoalController, replayFixedNursery)
+{
+	MM_ScavengerPauseGoalController controller;
+	controller.initialize(2000, 1 * MB, 8 * MB, ALIGNMENT);
+
+	ReplayResult result = replay(&controller, fixedNurserySamples, sizeof(fixedNurserySamples) / sizeof(Sample), 1 * MB, 8 * MB);
+	EXPECT_LT(result.controlledMisses, result.recordedMisses);
+
+	/* the last scavenges spent most of their time tenuring, so the tenure age has bottomed out */
+	EXPECT_EQ((uintptr_t)OBJECT_HEADER_AGE_MIN, controller.getRecommendedTenureAge());
+}
+
+TEST(TestScavengerPauseGoalController, replayGrowingNursery)
+{
+	MM_ScavengerPauseGoalController controller;
+	controller.initialize(4000, 1 * MB, 8 * MB, ALIGNMENT);
+
+	ReplayResult result = replay(&controller, growingNurserySamples, sizeof(growingNurserySamples) / sizeof(Sample), 1 * MB, 8 * MB);
+	EXPECT_LE(result.controlledMisses, result.recordedMisses);
+
+	/* the same scavenges against a tighter goal */
+	controller.initialize(2000, 1 * MB, 8 * MB, ALIGNMENT);
+	result = replay(&controller, growingNurserySamples, sizeof(growingNurserySamples) / sizeof(Sample), 1 * MB, 8 * MB);
+	EXPECT_LT(result.controlledMisses, result.recordedMisses);
+}
+
+/*
+ * Close the loop on a workload where a fixed fraction of new space survives and is copied at a fixed
+ * rate: new space should settle at a size which meets the goal and then stay there.
+ */
+TEST(TestScavengerPauseGoalController, convergesOnSteadyWorkload)
+{
+	const uint64_t pauseGoal = 10000;
+	const double survivalRate = 0.3;
+	const double copyRate = 1000.0;
+
+	MM_ScavengerPauseGoalController controller;
+	controller.initialize(pauseGoal, 4 * MB, 256 * MB, ALIGNMENT);
+
+	uintptr_t nurserySize = 128 * MB;
+	uintptr_t previousSize = 0;
+	for (uintptr_t cycle = 0; cycle < 20; cycle++) {
+		Sample sample;
+		sample.nurserySize = nurserySize;
+		sample.flipBytes = (uintptr_t)(survivalRate * (double)nurserySize);
+		sample.tenureBytes = 0;
+		sample.pauseTime = (uint64_t)((double)sample.flipBytes / copyRate);
+		sample.tenureAge = 10;
+		controller.update(&sample);
+
+		previousSize = nurserySize;
+		nurserySize = controller.getRecommendedNurserySize();
+	}
+
+	EXPECT_EQ(previousSize, nurserySize);
+	EXPECT_GE(pauseGoal, (uint64_t)((survivalRate * (double)nurserySize) / copyRate));
+	EXPECT_LE(pauseGoal / 2, (uint64_t)((survivalRate * (double)nurserySize) / copyRate));
+	EXPECT_GE(pauseGoal, controller.predictPauseTime(nurserySize));
+}
+
+TEST(TestScavengerPauseGoalController, adjustsTenureAge)
+{
+	MM_ScavengerPauseGoalController controller;
+	controller.initialize(1000, 1 * MB, 8 * MB, ALIGNMENT);
+
+	/* over the goal while flipping the same survivors: tenure sooner */
+	Sample flipping = {3000, 4 * MB, 3 * MB, 256 * 1024, 7};
+	controller.update(&flipping);
+	EXPECT_EQ((uintptr_t)6, controller.getRecommendedTenureAge());
+
+	/* over the goal while tenuring: flipping less would not help */
+	controller.initialize(1000, 1 * MB, 8 * MB, ALIGNMENT);
+	Sample tenuring = {3000, 4 * MB, 256 * 1024, 3 * MB, 7};
+	controller.update(&tenuring);
+	EXPECT_EQ((uintptr_t)7, controller.getRecommendedTenureAge());
+
+	/* well within the goal: keep objects longer */
+	controller.initialize(1000, 1 * MB, 8 * MB, ALIGNMENT);
+	Sample quick = {200, 4 * MB, 128 * 1024, 0, OBJECT_HEADER_AGE_MAX};
+	controller.update(&quick);
+	EXPECT_EQ((uintptr_t)OBJECT_HEADER_AGE_MAX, controller.getRecommendedTenureAge());
+	quick.tenureAge = 7;
+	controller.update(&quick);
+	EXPECT_EQ((uintptr_t)8, controller.getRecommendedTenureAge());
+}
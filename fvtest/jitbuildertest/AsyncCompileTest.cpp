@@ -0,0 +1,248 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <thread>
+#include <vector>
+
+struct Counter
+   {
+   int32_t count;
+   int32_t step;
+   };
+
+// Returns x * multiplier + multiplier, with the multiplier baked into the compiled body
+struct ScaleBuilder : public OMR::JitBuilder::MethodBuilder
+   {
+   ScaleBuilder(OMR::JitBuilder::TypeDictionary *types, int32_t multiplier)
+      : OMR::JitBuilder::MethodBuilder(types), _multiplier(multiplier)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+      DefineName("ScaleBuilder");
+      DefineParameter("x", Int32);
+      DefineReturnType(Int32);
+      }
+
+   bool buildIL()
+      {
+      Return(
+         Add(
+            Mul(
+               Load("x"),
+               ConstInt32(_multiplier)),
+            ConstInt32(_multiplier)));
+      return true;
+      }
+
+   int32_t _multiplier;
+   };
+
+DEFINE_TYPES(CounterTypeDictionary)
+   {
+   DEFINE_STRUCT(Counter);
+   DEFINE_FIELD(Counter, count, Int32);
+   DEFINE_FIELD(Counter, step, Int32);
+   CLOSE_STRUCT(Counter);
+   }
+
+// Advances counter->count by counter->step and returns the new count
+DEFINE_BUILDER( AdvanceCounterBuilder,
+                Int32,
+                PARAM("counter", PointerTo(LookupStruct("Counter"))) )
+   {
+   StoreIndirect("Counter", "count", Load("counter"),
+      Add(
+         LoadIndirect("Counter", "count", Load("counter")),
+         LoadIndirect("Counter", "step", Load("counter"))));
+   Return(LoadIndirect("Counter", "count", Load("counter")));
+   return true;
+   }
+
+class AsyncCompileTest : public JitBuilderTest
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      JitBuilderTest::SetUpTestCase();
+      ASSERT_TRUE(startCompilationThreads(4)) << "Failed to start the compilation threads.";
+      }
+   };
+
+typedef int32_t (ScaleFunction)(int32_t);
+typedef int32_t (AdvanceCounterFunction)(Counter *);
+
+TEST_F(AsyncCompileTest, StartThreadsTwiceFails)
+   {
+   ASSERT_FALSE(startCompilationThreads(2));
+   }
+
+TEST_F(AsyncCompileTest, SeparateTypeDictionaries)
+   {
+   const int32_t numBuilders = 32;
+   std::vector<OMR::JitBuilder::TypeDictionary *> types;
+   std::vector<ScaleBuilder *> builders;
+   for (int32_t i = 0; i < numBuilders; i++)
+      {
+      types.push_back(new OMR::JitBuilder::TypeDictionary());
+      builders.push_back(new ScaleBuilder(types[i], i + 1));
+      }
+
+   for (int32_t i = 0; i < numBuilders; i++)
+      ASSERT_TRUE(compileMethodBuilderAsync(builders[i]));
+
+   for (int32_t i = 0; i < numBuilders; i++)
+      {
+      void *entry = NULL;
+      ASSERT_EQ(0, waitForMethodBuilder(builders[i], &entry)) << "Compilation of builder " << i << " failed";
+      ASSERT_TRUE(NULL != entry);
+      ScaleFunction *scale = (ScaleFunction *)entry;
+      ASSERT_EQ(10 * (i + 1) + (i + 1), scale(10));
+      }
+
+   for (int32_t i = 0; i < numBuilders; i++)
+      {
+      delete builders[i];
+      delete types[i];
+      }
+   }
+
+TEST_F(AsyncCompileTest, SharedTypeDictionary)
+   {
+   const int32_t numBuilders = 8;
+   CounterTypeDictionary types;
+   std::vector<AdvanceCounterBuilder *> builders;
+   for (int32_t i = 0; i < numBuilders; i++)
+      builders.push_back(new AdvanceCounterBuilder(&types));
+
+   for (int32_t i = 0; i < numBuilders; i++)
+      ASSERT_TRUE(compileMethodBuilderAsync(builders[i]));
+
+   // wait in reverse order so results are collected out of submission order
+   for (int32_t i = numBuilders - 1; i >= 0; i--)
+      {
+      void *entry = NULL;
+      ASSERT_EQ(0, waitForMethodBuilder(builders[i], &entry)) << "Compilation of builder " << i << " failed";
+      ASSERT_TRUE(NULL != entry);
+
+      Counter counter;
+      counter.count = i;
+      counter.step = 3;
+      AdvanceCounterFunction *advance = (AdvanceCounterFunction *)entry;
+      ASSERT_EQ(i + 3, advance(&counter));
+      ASSERT_EQ(i + 3, counter.count);
+      }
+
+   for (int32_t i = 0; i < numBuilders; i++)
+      delete builders[i];
+   }
+
+// Checks that entry advances a Counter by its step
+static void
+checkAdvanceCounter(void *entry, int32_t start)
+   {
+   ASSERT_TRUE(NULL != entry);
+
+   Counter counter;
+   counter.count = start;
+   counter.step = 5;
+   AdvanceCounterFunction *advance = (AdvanceCounterFunction *)entry;
+   ASSERT_EQ(start + 5, advance(&counter));
+   ASSERT_EQ(start + 5, counter.count);
+   }
+
+TEST_F(AsyncCompileTest, SynchronousCompilesShareTypeDictionary)
+   {
+   const int32_t numAsyncBuilders = 8;
+   const int32_t numSyncThreads = 2;
+   const int32_t numSyncBuildersPerThread = 4;
+   CounterTypeDictionary types;
+
+   std::vector<AdvanceCounterBuilder *> asyncBuilders;
+   for (int32_t i = 0; i < numAsyncBuilders; i++)
+      asyncBuilders.push_back(new AdvanceCounterBuilder(&types));
+   std::vector<AdvanceCounterBuilder *> syncBuilders;
+   for (int32_t i = 0; i < numSyncThreads * numSyncBuildersPerThread; i++)
+      syncBuilders.push_back(new AdvanceCounterBuilder(&types));
+
+   for (int32_t i = 0; i < numAsyncBuilders; i++)
+      ASSERT_TRUE(compileMethodBuilderAsync(asyncBuilders[i]));
+
+   // application threads compile with the same TypeDictionary while the
+   // requests above are still being compiled on the compilation threads
+   std::vector<void *> syncEntries(syncBuilders.size(), NULL);
+   std::vector<int32_t> syncResults(syncBuilders.size(), -1);
+   std::vector<std::thread> syncThreads;
+   for (int32_t t = 0; t < numSyncThreads; t++)
+      {
+      syncThreads.push_back(std::thread([&, t]()
+         {
+         for (int32_t b = t * numSyncBuildersPerThread; b < (t + 1) * numSyncBuildersPerThread; b++)
+            syncResults[b] = compileMethodBuilder(syncBuilders[b], &syncEntries[b]);
+         }));
+      }
+   for (auto it = syncThreads.begin(); it != syncThreads.end(); ++it)
+      it->join();
+
+   for (size_t i = 0; i < syncBuilders.size(); i++)
+      {
+      ASSERT_EQ(0, syncResults[i]) << "Synchronous compilation of builder " << i << " failed";
+      checkAdvanceCounter(syncEntries[i], (int32_t)i);
+      }
+
+   for (int32_t i = 0; i < numAsyncBuilders; i++)
+      {
+      void *entry = NULL;
+      ASSERT_EQ(0, waitForMethodBuilder(asyncBuilders[i], &entry)) << "Compilation of builder " << i << " failed";
+      checkAdvanceCounter(entry, i);
+      }
+
+   for (size_t i = 0; i < asyncBuilders.size(); i++)
+      delete asyncBuilders[i];
+   for (size_t i = 0; i < syncBuilders.size(); i++)
+      delete syncBuilders[i];
+   }
+
+TEST_F(AsyncCompileTest, DuplicateRequestFails)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   ScaleBuilder builder(&types, 2);
+
+   ASSERT_TRUE(compileMethodBuilderAsync(&builder));
+   ASSERT_FALSE(compileMethodBuilderAsync(&builder));
+
+   void *entry = NULL;
+   ASSERT_EQ(0, waitForMethodBuilder(&builder, &entry));
+   ASSERT_EQ(8, ((ScaleFunction *)entry)(3));
+   }
+
+TEST_F(AsyncCompileTest, WaitWithoutRequestFails)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   ScaleBuilder builder(&types, 2);
+
+   void *entry = NULL;
+   ASSERT_NE(0, waitForMethodBuilder(&builder, &entry));
+   ASSERT_EQ(NULL, entry);
+   }
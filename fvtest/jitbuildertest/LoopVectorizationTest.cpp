@@ -0,0 +1,374 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+DEFINE_BUILDER(Int32ArrayAdd,
+               NoType,
+               PARAM("a", PointerTo(Int32)),
+               PARAM("b", PointerTo(Int32)),
+               PARAM("c", PointerTo(Int32)),
+               PARAM("length", Int32))
+   {
+   OMR::JitBuilder::IlType *pInt32 = PointerTo(Int32);
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp("i", &loop,
+      ConstInt32(0),
+      Load("length"),
+      ConstInt32(1));
+
+   loop->StoreAt(
+      loop->IndexAt(pInt32, loop->Load("c"), loop->Load("i")),
+      loop->Add(
+         loop->LoadAt(pInt32, loop->IndexAt(pInt32, loop->Load("a"), loop->Load("i"))),
+         loop->LoadAt(pInt32, loop->IndexAt(pInt32, loop->Load("b"), loop->Load("i")))));
+
+   Return();
+   return true;
+   }
+
+DEFINE_BUILDER(Int32ArraySum,
+               Int32,
+               PARAM("a", PointerTo(Int32)),
+               PARAM("length", Int32))
+   {
+   OMR::JitBuilder::IlType *pInt32 = PointerTo(Int32);
+   Store("sum", ConstInt32(0));
+
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp("i", &loop,
+      ConstInt32(0),
+      Load("length"),
+      ConstInt32(1));
+
+   loop->Store("sum",
+      loop->Add(
+         loop->Load("sum"),
+         loop->LoadAt(pInt32, loop->IndexAt(pInt32, loop->Load("a"), loop->Load("i")))));
+
+   Return(Load("sum"));
+   return true;
+   }
+
+DEFINE_BUILDER(Int64ArrayCopy,
+               NoType,
+               PARAM("from", PointerTo(Int64)),
+               PARAM("to", PointerTo(Int64)),
+               PARAM("length", Int32))
+   {
+   OMR::JitBuilder::IlType *pInt64 = PointerTo(Int64);
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp("i", &loop,
+      ConstInt32(0),
+      Load("length"),
+      ConstInt32(1));
+
+   loop->StoreAt(
+      loop->IndexAt(pInt64, loop->Load("to"), loop->Load("i")),
+      loop->LoadAt(pInt64, loop->IndexAt(pInt64, loop->Load("from"), loop->Load("i"))));
+
+   Return();
+   return true;
+   }
+
+DEFINE_BUILDER(DoubleArrayScale,
+               NoType,
+               PARAM("a", PointerTo(Double)),
+               PARAM("scale", Double),
+               PARAM("length", Int32))
+   {
+   OMR::JitBuilder::IlType *pDouble = PointerTo(Double);
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp("i", &loop,
+      ConstInt32(0),
+      Load("length"),
+      ConstInt32(1));
+
+   loop->StoreAt(
+      loop->IndexAt(pDouble, loop->Load("a"), loop->Load("i")),
+      loop->Mul(
+         loop->LoadAt(pDouble, loop->IndexAt(pDouble, loop->Load("a"), loop->Load("i"))),
+         loop->Load("scale")));
+
+   Return();
+   return true;
+   }
+
+DEFINE_BUILDER(DoubleArraySum,
+               Double,
+               PARAM("a", PointerTo(Double)),
+               PARAM("length", Int32))
+   {
+   OMR::JitBuilder::IlType *pDouble = PointerTo(Double);
+   Store("sum", ConstDouble(0.0));
+
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp("i", &loop,
+      ConstInt32(0),
+      Load("length"),
+      ConstInt32(1));
+
+   loop->Store("sum",
+      loop->Add(
+         loop->Load("sum"),
+         loop->LoadAt(pDouble, loop->IndexAt(pDouble, loop->Load("a"), loop->Load("i")))));
+
+   Return(Load("sum"));
+   return true;
+   }
+
+// Each test starts its own JIT so that it can read back the vectorizer's
+// decisions from the log, which is only complete once the JIT is shut down
+class LoopVectorizationTest : public ::testing::Test
+   {
+   public:
+
+   LoopVectorizationTest() : _jitStarted(false) {}
+
+   virtual void SetUp()
+      {
+      char logTemplate[] = "/tmp/jbvectorlogXXXXXX";
+      int fd = mkstemp(logTemplate);
+      ASSERT_NE(-1, fd);
+      close(fd);
+      _log = logTemplate;
+      }
+
+   virtual void TearDown()
+      {
+      if (_jitStarted)
+         shutdownJit();
+      remove(_log.c_str());
+      }
+
+   void startJit(const char *extraOptions = NULL)
+      {
+      std::string options("-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,traceLoopVectorization,optDetails");
+      if (extraOptions != NULL)
+         options = options + "," + extraOptions;
+      options = options + ",log=" + _log;
+      ASSERT_TRUE(initializeJitWithOptions(const_cast<char *>(options.c_str()))) << "Failed to initialize the JIT.";
+      _jitStarted = true;
+      }
+
+   // Shuts the JIT down and reports whether a loop was vectorized in any of the compilations
+   bool loopWasVectorized()
+      {
+      if (_jitStarted)
+         {
+         shutdownJit();
+         _jitStarted = false;
+         }
+      std::ifstream log(_log.c_str());
+      std::stringstream contents;
+      contents << log.rdbuf();
+      return contents.str().find("O^O LOOP VECTORIZER: Vectorizing loop") != std::string::npos;
+      }
+
+   private:
+   std::string _log;
+   bool _jitStarted;
+   };
+
+// Lengths around the vector lengths of every element type, so that loops
+// with no vector iterations, only vector iterations, and a scalar remainder
+// are all exercised
+static const int32_t lengths[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 100, 1023 };
+
+typedef void (*Int32ArrayAddFunction)(int32_t *, int32_t *, int32_t *, int32_t);
+TEST_F(LoopVectorizationTest, Int32ArrayAdd)
+   {
+   Int32ArrayAddFunction arrayAdd;
+   startJit();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, Int32ArrayAdd, arrayAdd);
+
+   for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+      {
+      int32_t length = lengths[l];
+      std::vector<int32_t> a(length + 1), b(length + 1), c(length + 1, -1);
+      for (int32_t i = 0; i < length; i++)
+         {
+         a[i] = i * 3 - 7;
+         b[i] = INT32_MAX - i;
+         }
+
+      arrayAdd(&a[0], &b[0], &c[0], length);
+
+      for (int32_t i = 0; i < length; i++)
+         ASSERT_EQ((int32_t)((uint32_t)a[i] + (uint32_t)b[i]), c[i]) << "length " << length << " index " << i;
+      ASSERT_EQ(-1, c[length]) << "store past the end for length " << length;
+      }
+
+   EXPECT_TRUE(loopWasVectorized());
+   }
+
+TEST_F(LoopVectorizationTest, Int32ArrayAddOverlapping)
+   {
+   Int32ArrayAddFunction arrayAdd;
+   startJit();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, Int32ArrayAdd, arrayAdd);
+
+   // c starts one element after a, so each iteration reads the previous
+   // iteration's result and the loop must not be run a vector at a time
+   const int32_t length = 37;
+   std::vector<int32_t> data(length + 1), b(length);
+   data[0] = 1;
+   for (int32_t i = 0; i < length; i++)
+      b[i] = i;
+
+   arrayAdd(&data[0], &b[0], &data[1], length);
+
+   int32_t expected = 1;
+   for (int32_t i = 0; i < length; i++)
+      {
+      expected += i;
+      ASSERT_EQ(expected, data[i + 1]) << "index " << i;
+      }
+
+   EXPECT_TRUE(loopWasVectorized());
+   }
+
+typedef int32_t (*Int32ArraySumFunction)(int32_t *, int32_t);
+TEST_F(LoopVectorizationTest, Int32ArraySum)
+   {
+   Int32ArraySumFunction arraySum;
+   startJit();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, Int32ArraySum, arraySum);
+
+   for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+      {
+      int32_t length = lengths[l];
+      std::vector<int32_t> a(length + 1);
+      int32_t expected = 0;
+      for (int32_t i = 0; i < length; i++)
+         {
+         a[i] = i * i - 50;
+         expected += a[i];
+         }
+
+      ASSERT_EQ(expected, arraySum(&a[0], length)) << "length " << length;
+      }
+
+   EXPECT_TRUE(loopWasVectorized());
+   }
+
+typedef void (*Int64ArrayCopyFunction)(int64_t *, int64_t *, int32_t);
+TEST_F(LoopVectorizationTest, Int64ArrayCopy)
+   {
+   Int64ArrayCopyFunction arrayCopy;
+   startJit();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, Int64ArrayCopy, arrayCopy);
+
+   for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+      {
+      int32_t length = lengths[l];
+      std::vector<int64_t> from(length + 1), to(length + 1, 0);
+      for (int32_t i = 0; i < length; i++)
+         from[i] = ((int64_t)i << 33) | i;
+
+      arrayCopy(&from[0], &to[0], length);
+
+      for (int32_t i = 0; i < length; i++)
+         ASSERT_EQ(from[i], to[i]) << "length " << length << " index " << i;
+      ASSERT_EQ(0, to[length]) << "store past the end for length " << length;
+      }
+
+   EXPECT_TRUE(loopWasVectorized());
+   }
+
+typedef void (*DoubleArrayScaleFunction)(double *, double, int32_t);
+TEST_F(LoopVectorizationTest, DoubleArrayScale)
+   {
+   DoubleArrayScaleFunction arrayScale;
+   startJit();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, DoubleArrayScale, arrayScale);
+
+   for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+      {
+      int32_t length = lengths[l];
+      std::vector<double> a(length + 1, -1.0);
+      for (int32_t i = 0; i < length; i++)
+         a[i] = i + 0.25;
+
+      arrayScale(&a[0], 1.5, length);
+
+      for (int32_t i = 0; i < length; i++)
+         ASSERT_EQ((i + 0.25) * 1.5, a[i]) << "length " << length << " index " << i;
+      ASSERT_EQ(-1.0, a[length]) << "store past the end for length " << length;
+      }
+
+   EXPECT_TRUE(loopWasVectorized());
+   }
+
+typedef double (*DoubleArraySumFunction)(double *, int32_t);
+
+// Checks a compiled DoubleArraySum against a scalar sum at every test length
+static void
+checkDoubleArraySum(DoubleArraySumFunction arraySum)
+   {
+   for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+      {
+      int32_t length = lengths[l];
+      std::vector<double> a(length + 1);
+      double expected = 0.0;
+      for (int32_t i = 0; i < length; i++)
+         {
+         // Small integers sum exactly in any order
+         a[i] = i % 13;
+         expected += a[i];
+         }
+
+      ASSERT_EQ(expected, arraySum(&a[0], length)) << "length " << length;
+      }
+   }
+
+// A vector reduction adds the elements in a different order than the loop,
+// which is only allowed when IEEE restrictions are ignored
+TEST_F(LoopVectorizationTest, DoubleArraySum)
+   {
+   DoubleArraySumFunction arraySum;
+   startJit("ignoreIEEE");
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, DoubleArraySum, arraySum);
+
+   checkDoubleArraySum(arraySum);
+
+   EXPECT_TRUE(loopWasVectorized());
+   }
+
+TEST_F(LoopVectorizationTest, DoubleArraySumStrictIEEE)
+   {
+   DoubleArraySumFunction arraySum;
+   startJit();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, DoubleArraySum, arraySum);
+
+   checkDoubleArraySum(arraySum);
+
+   EXPECT_FALSE(loopWasVectorized());
+   }
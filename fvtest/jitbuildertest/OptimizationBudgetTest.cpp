@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+DEFINE_BUILDER(BudgetInt32ArraySum,
+               Int32,
+               PARAM("a", PointerTo(Int32)),
+               PARAM("length", Int32))
+   {
+   OMR::JitBuilder::IlType *pInt32 = PointerTo(Int32);
+   Store("sum", ConstInt32(0));
+
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp("i", &loop,
+      ConstInt32(0),
+      Load("length"),
+      ConstInt32(1));
+
+   loop->Store("sum",
+      loop->Add(
+         loop->Load("sum"),
+         loop->LoadAt(pInt32, loop->IndexAt(pInt32, loop->Load("a"), loop->Load("i")))));
+
+   Return(Load("sum"));
+   return true;
+   }
+
+// Each test starts its own JIT so that it can read back which optimizations
+// were skipped from the log, which is only complete once the JIT is shut down
+class OptimizationBudgetTest : public ::testing::Test
+   {
+   public:
+
+   OptimizationBudgetTest() : _jitStarted(false) {}
+
+   virtual void SetUp()
+      {
+      char logTemplate[] = "/tmp/jbbudgetlogXXXXXX";
+      int fd = mkstemp(logTemplate);
+      ASSERT_NE(-1, fd);
+      close(fd);
+      _log = logTemplate;
+      }
+
+   virtual void TearDown()
+      {
+      if (_jitStarted)
+         shutdownJit();
+      remove(_log.c_str());
+      }
+
+   void startJit(const char *extraOptions = NULL)
+      {
+      std::string options("-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,optDetails");
+      if (extraOptions != NULL)
+         options = options + "," + extraOptions;
+      options = options + ",log=" + _log;
+      ASSERT_TRUE(initializeJitWithOptions(const_cast<char *>(options.c_str()))) << "Failed to initialize the JIT.";
+      _jitStarted = true;
+      }
+
+   // Shuts the JIT down and reports whether the named optimization was
+   // skipped for exceeding the compile-time budget in any of the compilations
+   bool optimizationWasSkipped(const char *name)
+      {
+      if (_jitStarted)
+         {
+         shutdownJit();
+         _jitStarted = false;
+         }
+      std::ifstream log(_log.c_str());
+      std::stringstream contents;
+      contents << log.rdbuf();
+      std::string message = std::string(name) + " skipped: compile-time budget exceeded";
+      return contents.str().find(message) != std::string::npos;
+      }
+
+   private:
+   std::string _log;
+   bool _jitStarted;
+   };
+
+typedef int32_t (*BudgetInt32ArraySumFunction)(int32_t *, int32_t);
+
+// Checks a compiled BudgetInt32ArraySum against a scalar sum at lengths
+// around the unroll factors
+static void
+checkInt32ArraySum(BudgetInt32ArraySumFunction arraySum)
+   {
+   static const int32_t lengths[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 100, 1023 };
+   for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+      {
+      int32_t length = lengths[l];
+      std::vector<int32_t> a(length + 1);
+      int32_t expected = 0;
+      for (int32_t i = 0; i < length; i++)
+         {
+         a[i] = i * i - 50;
+         expected += a[i];
+         }
+
+      ASSERT_EQ(expected, arraySum(&a[0], length)) << "length " << length;
+      }
+   }
+
+TEST_F(OptimizationBudgetTest, NoBudget)
+   {
+   BudgetInt32ArraySumFunction arraySum;
+   startJit();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, BudgetInt32ArraySum, arraySum);
+
+   checkInt32ArraySum(arraySum);
+
+   EXPECT_FALSE(optimizationWasSkipped("generalLoopUnroller"));
+   }
+
+TEST_F(OptimizationBudgetTest, LargeNodeBudget)
+   {
+   BudgetInt32ArraySumFunction arraySum;
+   startJit("optimizationNodeBudget=1000000");
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, BudgetInt32ArraySum, arraySum);
+
+   checkInt32ArraySum(arraySum);
+
+   EXPECT_FALSE(optimizationWasSkipped("generalLoopUnroller"));
+   }
+
+// Any method is larger than a budget of one node, so every optional
+// expensive optimization in the strategy is skipped, while the rest of the
+// strategy still has to produce correct code
+TEST_F(OptimizationBudgetTest, SmallNodeBudget)
+   {
+   BudgetInt32ArraySumFunction arraySum;
+   startJit("optimizationNodeBudget=1");
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, BudgetInt32ArraySum, arraySum);
+
+   checkInt32ArraySum(arraySum);
+
+   EXPECT_TRUE(optimizationWasSkipped("generalLoopUnroller"));
+   }
@@ -0,0 +1,253 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+static int32_t
+doubleIt(int32_t val)
+   {
+   #define DOUBLE_IT_LINE LINETOSTR(__LINE__)
+   return 2 * val;
+   }
+
+static int32_t
+tripleIt(int32_t val)
+   {
+   #define TRIPLE_IT_LINE LINETOSTR(__LINE__)
+   return 3 * val;
+   }
+
+// Returns scale(x) + 1 where scale is bound to a different native function in
+// different runs, so a reloaded body is only correct if its call was relocated
+class ScaleAndIncrementBuilder : public OMR::JitBuilder::MethodBuilder
+   {
+   public:
+   ScaleAndIncrementBuilder(OMR::JitBuilder::TypeDictionary *types, void *scale)
+      : OMR::JitBuilder::MethodBuilder(types)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+      DefineName("ScaleAndIncrement");
+      DefineParameter("x", Int32);
+      DefineReturnType(Int32);
+      DefineFunction((char *)"scale",
+                     (char *)__FILE__,
+                     (char *)DOUBLE_IT_LINE,
+                     scale,
+                     Int32,
+                     1,
+                     Int32);
+      }
+
+   bool buildIL()
+      {
+      Return(
+         Add(
+            Call("scale", 1, Load("x")),
+            ConstInt32(1)));
+      return true;
+      }
+   };
+
+typedef int32_t (ScaleAndIncrementFunction)(int32_t);
+
+class PersistentCodeCacheTest : public ::testing::Test
+   {
+   public:
+
+   virtual void SetUp()
+      {
+      char dirTemplate[] = "/tmp/jbcodecacheXXXXXX";
+      ASSERT_TRUE(NULL != mkdtemp(dirTemplate));
+      _dir = dirTemplate;
+      _options = std::string("-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,persistentCodeCacheDir=") + _dir;
+      }
+
+   virtual void TearDown()
+      {
+      std::vector<std::string> files = cachedBodies();
+      for (auto it = files.begin(); it != files.end(); ++it)
+         remove(it->c_str());
+      rmdir(_dir.c_str());
+      }
+
+   // Simulates one run of a program: start the JIT, compile the builder, stop the JIT
+   int32_t compileAndCall(void *scale, int32_t x)
+      {
+      EXPECT_TRUE(initializeJitWithOptions(const_cast<char *>(_options.c_str())));
+
+      OMR::JitBuilder::TypeDictionary types;
+      ScaleAndIncrementBuilder builder(&types, scale);
+      void *entry = NULL;
+      int32_t rc = compileMethodBuilder(&builder, &entry);
+      EXPECT_EQ(0, rc) << "Compilation failed";
+      int32_t result = (rc == 0 && entry != NULL) ? ((ScaleAndIncrementFunction *)entry)(x) : -1;
+
+      shutdownJit();
+      return result;
+      }
+
+   std::vector<std::string> cachedBodies()
+      {
+      std::vector<std::string> files;
+      DIR *dir = opendir(_dir.c_str());
+      if (dir == NULL)
+         return files;
+      for (struct dirent *entry = readdir(dir); entry != NULL; entry = readdir(dir))
+         {
+         if (entry->d_name[0] != '.')
+            files.push_back(_dir + "/" + entry->d_name);
+         }
+      closedir(dir);
+      return files;
+      }
+
+   std::vector<char> readBody(const std::string &file)
+      {
+      std::vector<char> contents;
+      FILE *f = fopen(file.c_str(), "rb");
+      if (f == NULL)
+         return contents;
+      char buffer[256];
+      for (size_t n = fread(buffer, 1, sizeof(buffer), f); n > 0; n = fread(buffer, 1, sizeof(buffer), f))
+         contents.insert(contents.end(), buffer, buffer + n);
+      fclose(f);
+      return contents;
+      }
+
+   // Overwrites file in place, so a later replacement by the cache shows up as a new inode
+   void writeBody(const std::string &file, const std::vector<char> &contents, size_t size)
+      {
+      FILE *f = fopen(file.c_str(), "r+b");
+      ASSERT_TRUE(NULL != f);
+      ASSERT_EQ(size, fwrite(&contents[0], 1, size, f));
+      fclose(f);
+      ASSERT_EQ(0, truncate(file.c_str(), static_cast<off_t>(size)));
+      }
+
+   ino_t inodeOf(const std::string &file)
+      {
+      struct stat info;
+      return stat(file.c_str(), &info) == 0 ? info.st_ino : 0;
+      }
+
+   std::string _dir;
+   std::string _options;
+   };
+
+TEST_F(PersistentCodeCacheTest, BodyIsStoredAndReloaded)
+   {
+   ASSERT_EQ(21, compileAndCall((void *)&doubleIt, 10));
+
+   std::vector<std::string> files = cachedBodies();
+   ASSERT_EQ(1u, files.size()) << "Expected exactly one cached body";
+   ino_t storedInode = inodeOf(files[0]);
+
+   // a hit installs the stored body and does not write the file again
+   ASSERT_EQ(21, compileAndCall((void *)&doubleIt, 10));
+   files = cachedBodies();
+   ASSERT_EQ(1u, files.size());
+   ASSERT_EQ(storedInode, inodeOf(files[0])) << "Cached body was recompiled instead of reloaded";
+   }
+
+TEST_F(PersistentCodeCacheTest, CallTargetsAreRelocated)
+   {
+   ASSERT_EQ(21, compileAndCall((void *)&doubleIt, 10));
+   std::vector<std::string> files = cachedBodies();
+   ASSERT_EQ(1u, files.size());
+   ino_t storedInode = inodeOf(files[0]);
+
+   // same IL and the same function name, but "scale" now lives elsewhere
+   ASSERT_EQ(31, compileAndCall((void *)&tripleIt, 10));
+   files = cachedBodies();
+   ASSERT_EQ(1u, files.size());
+   ASSERT_EQ(storedInode, inodeOf(files[0]));
+   }
+
+TEST_F(PersistentCodeCacheTest, CorruptBodyIsRecompiled)
+   {
+   ASSERT_EQ(21, compileAndCall((void *)&doubleIt, 10));
+   std::vector<std::string> files = cachedBodies();
+   ASSERT_EQ(1u, files.size());
+
+   FILE *file = fopen(files[0].c_str(), "wb");
+   ASSERT_TRUE(NULL != file);
+   fputs("garbage", file);
+   fclose(file);
+
+   ASSERT_EQ(21, compileAndCall((void *)&doubleIt, 10));
+
+   struct stat info;
+   ASSERT_EQ(0, stat(files[0].c_str(), &info));
+   ASSERT_LT(7, info.st_size) << "Corrupt body was not replaced";
+   }
+
+TEST_F(PersistentCodeCacheTest, TruncatedBodyIsRecompiled)
+   {
+   ASSERT_EQ(21, compileAndCall((void *)&doubleIt, 10));
+   std::vector<std::string> files = cachedBodies();
+   ASSERT_EQ(1u, files.size());
+   std::vector<char> body = readBody(files[0]);
+   ASSERT_LT(16u, body.size());
+
+   // cut into the header, the code, the relocations and the checksum
+   size_t lengths[] = { 1, 16, body.size() / 2, body.size() - 12, body.size() - 1 };
+   for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+      {
+      writeBody(files[0], body, lengths[l]);
+      ino_t truncatedInode = inodeOf(files[0]);
+
+      ASSERT_EQ(21, compileAndCall((void *)&doubleIt, 10)) << "truncated to " << lengths[l] << " bytes";
+      ASSERT_NE(truncatedInode, inodeOf(files[0])) << "Body truncated to " << lengths[l] << " bytes was not recompiled";
+      ASSERT_EQ(body.size(), readBody(files[0]).size());
+      }
+   }
+
+TEST_F(PersistentCodeCacheTest, EveryCorruptByteIsDetected)
+   {
+   ASSERT_EQ(21, compileAndCall((void *)&doubleIt, 10));
+   std::vector<std::string> files = cachedBodies();
+   ASSERT_EQ(1u, files.size());
+   std::vector<char> body = readBody(files[0]);
+
+   // a single changed byte anywhere, including the code size, the entry
+   // offset and the relocation offsets, must keep the body from being installed
+   for (size_t i = 0; i < body.size(); i++)
+      {
+      std::vector<char> corrupt(body);
+      corrupt[i] ^= 0x40;
+      writeBody(files[0], corrupt, corrupt.size());
+      ino_t corruptInode = inodeOf(files[0]);
+
+      ASSERT_EQ(21, compileAndCall((void *)&doubleIt, 10)) << "byte " << i << " corrupted";
+      ASSERT_NE(corruptInode, inodeOf(files[0])) << "Body with byte " << i << " corrupted was not recompiled";
+      }
+   }
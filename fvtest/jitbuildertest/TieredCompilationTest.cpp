@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+// Returns the sum of 0..n-1
+DEFINE_BUILDER( SumBuilder,
+                Int32,
+                PARAM("n", Int32) )
+   {
+   Store("sum", ConstInt32(0));
+
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp("i", &loop, ConstInt32(0), Load("n"), ConstInt32(1));
+   loop->Store("sum",
+   loop->   Add(
+   loop->      Load("sum"),
+   loop->      Load("i")));
+
+   Return(Load("sum"));
+   return true;
+   }
+
+// Returns the nth Fibonacci number, recursively
+DEFINE_BUILDER( FibBuilder,
+                Int32,
+                PARAM("n", Int32) )
+   {
+   OMR::JitBuilder::IlBuilder *baseCase = NULL;
+   IfThen(&baseCase, LessThan(Load("n"), ConstInt32(2)));
+   baseCase->Return(
+   baseCase->   Load("n"));
+
+   Return(
+      Add(
+         Call("FibBuilder", 1, Sub(Load("n"), ConstInt32(1))),
+         Call("FibBuilder", 1, Sub(Load("n"), ConstInt32(2)))));
+   return true;
+   }
+
+typedef int32_t (SumFunction)(int32_t);
+typedef int32_t (FibFunction)(int32_t);
+
+class TieredCompilationTest : public JitBuilderTest {};
+
+TEST_F(TieredCompilationTest, HotBodyReplacesColdBody)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   SumBuilder builder(&types);
+
+   void *entry = NULL;
+   ASSERT_EQ(0, compileMethodBuilderTiered(&builder, 10, &entry));
+   ASSERT_TRUE(NULL != entry);
+   SumFunction *sum = (SumFunction *)entry;
+
+   for (int32_t i = 0; i < 9; i++)
+      ASSERT_EQ(i * (i - 1) / 2, sum(i));
+   ASSERT_FALSE(waitForTieredRecompilation(&builder)) << "Recompiled before the invocation count was reached";
+
+   // the tenth invocation requests the hot compile
+   ASSERT_EQ(45, sum(10));
+   ASSERT_TRUE(waitForTieredRecompilation(&builder)) << "Hot recompilation failed";
+
+   // callers keep using the same entry point
+   for (int32_t i = 0; i < 100; i++)
+      ASSERT_EQ(i * (i - 1) / 2, sum(i));
+   }
+
+TEST_F(TieredCompilationTest, RecursiveMethod)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   FibBuilder builder(&types);
+
+   void *entry = NULL;
+   ASSERT_EQ(0, compileMethodBuilderTiered(&builder, 50, &entry));
+   FibFunction *fib = (FibFunction *)entry;
+
+   // recursive calls from the cold body trip the counter part way through
+   ASSERT_EQ(610, fib(15));
+   ASSERT_TRUE(waitForTieredRecompilation(&builder)) << "Hot recompilation failed";
+   ASSERT_EQ(6765, fib(20));
+   }
+
+TEST_F(TieredCompilationTest, CompileWhileRecompiling)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   SumBuilder tiered(&types);
+
+   void *entry = NULL;
+   ASSERT_EQ(0, compileMethodBuilderTiered(&tiered, 1, &entry));
+   ASSERT_EQ(10, ((SumFunction *)entry)(5));
+
+   // shares the TypeDictionary with the hot compile that was just requested
+   SumBuilder other(&types);
+   void *otherEntry = NULL;
+   ASSERT_EQ(0, compileMethodBuilder(&other, &otherEntry));
+   ASSERT_EQ(15, ((SumFunction *)otherEntry)(6));
+
+   ASSERT_TRUE(waitForTieredRecompilation(&tiered)) << "Hot recompilation failed";
+   ASSERT_EQ(21, ((SumFunction *)entry)(7));
+   }
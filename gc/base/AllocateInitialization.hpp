@@ -224,6 +224,11 @@ public:
 					MM_AtomicOperations::writeBarrier();
 					/* reflect the current OMR flags in the object header back into allocate description */
 					_allocateDescription.setObjectFlags((uint32_t)objectModel->getObjectFlags(objectPtr));
+					/* count the allocation against the sampling interval of the thread (-Xgc:allocationSamplingInterval=) */
+					uintptr_t allocatedBytes = _allocateDescription.getContiguousBytes();
+					if (env->_objectAllocationInterface->shouldSampleAllocation(env, allocatedBytes)) {
+						env->_objectAllocationInterface->reportAllocationSample(env, objectPtr, _allocationCategory, allocatedBytes);
+					}
 #if defined(OMR_GC_ALLOCATION_TAX)
 					/* if concurrent mark is enabled thread might have to pay tax - must save/restore allocated object in case of GC */
 					env->saveObjects(objectPtr);
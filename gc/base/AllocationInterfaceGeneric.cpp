@@ -63,7 +63,7 @@ MM_AllocationInterfaceGeneric::kill(MM_EnvironmentBase *env)
 bool
 MM_AllocationInterfaceGeneric::initialize(MM_EnvironmentBase *env)
 {
-	return true;
+	return initializeAllocationSampling(env);
 }
 
 /**
@@ -72,7 +72,7 @@ MM_AllocationInterfaceGeneric::initialize(MM_EnvironmentBase *env)
 void
 MM_AllocationInterfaceGeneric::tearDown(MM_EnvironmentBase *env)
 {
-
+	tearDownAllocationSampling(env);
 }
 
 void*
@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 #include "AllocateDescription.hpp"
+#include "AllocationSampleStats.hpp"
 #include "Collector.hpp"
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
@@ -232,6 +233,29 @@ MM_Collector::preCollect(MM_EnvironmentBase* env, MM_MemorySubSpace* subSpace, M
 		}
 	}
 
+	/* Report the allocation samples taken since the last collection */
+	if (0 != extensions->allocationSamplingInterval) {
+		if (NULL == extensions->allocationSampleStats) {
+			extensions->allocationSampleStats = MM_AllocationSampleStats::newInstance(env);
+		}
+		if (NULL != extensions->allocationSampleStats) {
+			MM_AllocationSampleStats *aggregateSampleStats = extensions->allocationSampleStats;
+			OMR_VMThread *omrVMThread = NULL;
+
+			GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+			while (NULL != (omrVMThread = threadListIterator.nextOMRVMThread())) {
+				MM_EnvironmentBase *threadEnv = MM_EnvironmentBase::getEnvironment(omrVMThread);
+				MM_AllocationSampleStats *sampleStats = threadEnv->_objectAllocationInterface->getAllocationSampleStats();
+				if (NULL != sampleStats) {
+					aggregateSampleStats->merge(sampleStats);
+					sampleStats->clear();
+				}
+			}
+			aggregateSampleStats->traceStats(env);
+			aggregateSampleStats->clear();
+		}
+	}
+
 	_bytesRequested = (allocDescription ? allocDescription->getBytesRequested() : 0);
 
 	internalPreCollect(env, subSpace, allocDescription, gcCode);
@@ -456,6 +456,8 @@ MM_Configuration::initializeGCParameters(MM_EnvironmentBase* env)
 
 	Assert_MM_true(0 < extensions->gcThreadCount);
 
+	extensions->heapMapKernels.initialize(env, extensions->scalarHeapMapKernels);
+
 	/* initialize packet lock splitting factor */
 	if (0 == extensions->packetListSplit) {
 		extensions->packetListSplit = (extensions->gcThreadCount - 1) / 8  +  1;
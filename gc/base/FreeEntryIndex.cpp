@@ -0,0 +1,273 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#include "FreeEntryIndex.hpp"
+
+#include "EnvironmentBase.hpp"
+
+bool
+MM_FreeEntryIndex::initialize(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize)
+{
+	if (minimumFreeEntrySize < (sizeof(MM_HeapLinkedFreeHeader) + sizeof(Links))) {
+		return false;
+	}
+
+	_minimumShift = floorLog2(minimumFreeEntrySize);
+	if ((_minimumShift + (BIN_COUNT >> SUB_BIN_SHIFT)) >= J9BITS_BITS_IN_SLOT) {
+		return false;
+	}
+	_treeThreshold = getBinMinimumSize(BIN_COUNT);
+	_valid = false;
+
+	return true;
+}
+
+void
+MM_FreeEntryIndex::build(MM_HeapLinkedFreeHeader *freeListHead, bool compressed)
+{
+	for (uintptr_t i = 0; i < BIN_COUNT; i++) {
+		_bins[i] = NULL;
+	}
+	_nonEmptyBins = 0;
+	_treeRoot = NULL;
+
+	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
+	MM_HeapLinkedFreeHeader *currentFreeEntry = freeListHead;
+	while (NULL != currentFreeEntry) {
+		insert(currentFreeEntry, previousFreeEntry, NULL);
+		previousFreeEntry = currentFreeEntry;
+		currentFreeEntry = currentFreeEntry->getNext(compressed);
+	}
+
+	_valid = true;
+}
+
+MM_HeapLinkedFreeHeader *
+MM_FreeEntryIndex::findFit(uintptr_t size, MM_LargeObjectAllocateStats::FreeEntryIndexLookup &lookup)
+{
+	MM_HeapLinkedFreeHeader *entry = NULL;
+
+	if (size < _treeThreshold) {
+		/* requests below the smallest bin are satisfied by any entry */
+		uintptr_t sizeBin = (size < ((uintptr_t)1 << _minimumShift)) ? 0 : getBinIndex(size);
+		/* every entry in a bin whose lower bound covers the request fits; the request's own bin may hold smaller entries */
+		uintptr_t firstFittingBin = (getBinMinimumSize(sizeBin) >= size) ? sizeBin : (sizeBin + 1);
+		uintptr_t candidateBins = 0;
+		if (firstFittingBin < BIN_COUNT) {
+			candidateBins = _nonEmptyBins & ~(((uintptr_t)1 << firstFittingBin) - 1);
+		}
+
+		if (0 != candidateBins) {
+			uintptr_t bin = MM_Bits::leadingZeroes(candidateBins);
+			lookup = (bin == sizeBin) ? MM_LargeObjectAllocateStats::freeEntryIndexBinHit : MM_LargeObjectAllocateStats::freeEntryIndexLargerBinHit;
+			return _bins[bin];
+		}
+
+		entry = findTreeFit(size);
+		if (NULL != entry) {
+			lookup = MM_LargeObjectAllocateStats::freeEntryIndexTreeHit;
+			return entry;
+		}
+
+		if (firstFittingBin != sizeBin) {
+			/* last resort before failing: the request's own bin may still hold a large enough entry */
+			entry = _bins[sizeBin];
+			while ((NULL != entry) && (entry->getSize() < size)) {
+				entry = links(entry)->binNext;
+			}
+			if (NULL != entry) {
+				lookup = MM_LargeObjectAllocateStats::freeEntryIndexBinWalkHit;
+				return entry;
+			}
+		}
+	} else {
+		entry = findTreeFit(size);
+		if (NULL != entry) {
+			lookup = MM_LargeObjectAllocateStats::freeEntryIndexTreeHit;
+			return entry;
+		}
+	}
+
+	lookup = MM_LargeObjectAllocateStats::freeEntryIndexMiss;
+	return NULL;
+}
+
+uintptr_t
+MM_FreeEntryIndex::getLargestEntrySize()
+{
+	uintptr_t largestSize = 0;
+
+	if (NULL != _treeRoot) {
+		MM_HeapLinkedFreeHeader *entry = _treeRoot;
+		while (NULL != links(entry)->treeRight) {
+			entry = links(entry)->treeRight;
+		}
+		largestSize = entry->getSize();
+	} else if (0 != _nonEmptyBins) {
+		uintptr_t bin = (J9BITS_BITS_IN_SLOT - 1) - MM_Bits::trailingZeroes(_nonEmptyBins);
+		for (MM_HeapLinkedFreeHeader *entry = _bins[bin]; NULL != entry; entry = links(entry)->binNext) {
+			if (entry->getSize() > largestSize) {
+				largestSize = entry->getSize();
+			}
+		}
+	}
+
+	return largestSize;
+}
+
+void
+MM_FreeEntryIndex::insertBin(MM_HeapLinkedFreeHeader *entry, uintptr_t size)
+{
+	uintptr_t bin = getBinIndex(size);
+	MM_HeapLinkedFreeHeader *head = _bins[bin];
+
+	links(entry)->binPrevious = NULL;
+	links(entry)->binNext = head;
+	if (NULL != head) {
+		links(head)->binPrevious = entry;
+	}
+	_bins[bin] = entry;
+	_nonEmptyBins |= ((uintptr_t)1 << bin);
+}
+
+void
+MM_FreeEntryIndex::removeBin(MM_HeapLinkedFreeHeader *entry, uintptr_t size)
+{
+	uintptr_t bin = getBinIndex(size);
+	MM_HeapLinkedFreeHeader *binPrevious = links(entry)->binPrevious;
+	MM_HeapLinkedFreeHeader *binNext = links(entry)->binNext;
+
+	if (NULL != binNext) {
+		links(binNext)->binPrevious = binPrevious;
+	}
+	if (NULL != binPrevious) {
+		links(binPrevious)->binNext = binNext;
+	} else {
+		_bins[bin] = binNext;
+		if (NULL == binNext) {
+			_nonEmptyBins &= ~((uintptr_t)1 << bin);
+		}
+	}
+}
+
+void
+MM_FreeEntryIndex::replaceTreeChild(MM_HeapLinkedFreeHeader *parent, MM_HeapLinkedFreeHeader *child, MM_HeapLinkedFreeHeader *replacement)
+{
+	if (NULL == parent) {
+		_treeRoot = replacement;
+	} else if (child == links(parent)->binNext) {
+		links(parent)->binNext = replacement;
+	} else {
+		links(parent)->treeRight = replacement;
+	}
+}
+
+void
+MM_FreeEntryIndex::rotateTreeUp(MM_HeapLinkedFreeHeader *entry)
+{
+	Links *entryLinks = links(entry);
+	MM_HeapLinkedFreeHeader *parent = entryLinks->binPrevious;
+	Links *parentLinks = links(parent);
+	MM_HeapLinkedFreeHeader *grandParent = parentLinks->binPrevious;
+
+	if (entry == parentLinks->binNext) {
+		/* entry is the left child: its right subtree becomes the parent's left subtree */
+		parentLinks->binNext = entryLinks->treeRight;
+		if (NULL != entryLinks->treeRight) {
+			links(entryLinks->treeRight)->binPrevious = parent;
+		}
+		entryLinks->treeRight = parent;
+	} else {
+		parentLinks->treeRight = entryLinks->binNext;
+		if (NULL != entryLinks->binNext) {
+			links(entryLinks->binNext)->binPrevious = parent;
+		}
+		entryLinks->binNext = parent;
+	}
+	parentLinks->binPrevious = entry;
+	entryLinks->binPrevious = grandParent;
+	replaceTreeChild(grandParent, parent, entry);
+}
+
+void
+MM_FreeEntryIndex::insertTree(MM_HeapLinkedFreeHeader *entry)
+{
+	MM_HeapLinkedFreeHeader *parent = NULL;
+	MM_HeapLinkedFreeHeader **link = &_treeRoot;
+
+	while (NULL != *link) {
+		parent = *link;
+		link = isTreeLess(entry, parent) ? &links(parent)->binNext : &links(parent)->treeRight;
+	}
+	*link = entry;
+	links(entry)->binPrevious = parent;
+	links(entry)->binNext = NULL;
+	links(entry)->treeRight = NULL;
+
+	uintptr_t priority = getTreePriority(entry);
+	while ((NULL != links(entry)->binPrevious) && (priority > getTreePriority(links(entry)->binPrevious))) {
+		rotateTreeUp(entry);
+	}
+}
+
+void
+MM_FreeEntryIndex::removeTree(MM_HeapLinkedFreeHeader *entry)
+{
+	Links *entryLinks = links(entry);
+
+	/* rotate the entry down until it has at most one child, then splice it out */
+	while ((NULL != entryLinks->binNext) && (NULL != entryLinks->treeRight)) {
+		MM_HeapLinkedFreeHeader *left = entryLinks->binNext;
+		MM_HeapLinkedFreeHeader *right = entryLinks->treeRight;
+		rotateTreeUp((getTreePriority(left) > getTreePriority(right)) ? left : right);
+	}
+
+	MM_HeapLinkedFreeHeader *child = (NULL != entryLinks->binNext) ? entryLinks->binNext : entryLinks->treeRight;
+	if (NULL != child) {
+		links(child)->binPrevious = entryLinks->binPrevious;
+	}
+	replaceTreeChild(entryLinks->binPrevious, entry, child);
+}
+
+MM_HeapLinkedFreeHeader *
+MM_FreeEntryIndex::findTreeFit(uintptr_t size)
+{
+	MM_HeapLinkedFreeHeader *bestFit = NULL;
+	MM_HeapLinkedFreeHeader *entry = _treeRoot;
+
+	/* smallest entry of at least size bytes, lowest address among equal sizes */
+	while (NULL != entry) {
+		if (entry->getSize() >= size) {
+			bestFit = entry;
+			entry = links(entry)->binNext;
+		} else {
+			entry = links(entry)->treeRight;
+		}
+	}
+
+	return bestFit;
+}
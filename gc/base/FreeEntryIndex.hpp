@@ -0,0 +1,230 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(FREEENTRYINDEX_HPP_)
+#define FREEENTRYINDEX_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "Bits.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "LargeObjectAllocateStats.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Size indexed view of an address ordered free list.
+ * Entries smaller than the tree threshold are kept in segregated size-class bins (four bins per power of two,
+ * with a bitmap of non-empty bins); larger entries are kept in a treap keyed on (size, address).
+ * The links live in the body of each free entry, just past its MM_HeapLinkedFreeHeader, so the index needs no
+ * storage of its own. Each entry also records its predecessor on the address ordered list, so an entry found
+ * through the index can be unlinked from the list without walking it.
+ *
+ * The index does not observe the free list: the owning pool must report every change to the list, or invalidate
+ * the index and rebuild it before the next lookup.
+ * @ingroup GC_Base_Core
+ */
+class MM_FreeEntryIndex
+{
+	/*
+	 * Data members
+	 */
+public:
+	enum {
+		SUB_BIN_SHIFT = 2, /**< log2 of the number of bins per power of two */
+		BIN_COUNT = J9BITS_BITS_IN_SLOT /**< one bit of _nonEmptyBins per bin */
+	};
+
+private:
+	/**
+	 * Links stored in the body of an indexed free entry.
+	 * Tree entries reuse binPrevious as the parent link and binNext as the left child link.
+	 */
+	struct Links {
+		MM_HeapLinkedFreeHeader *listPrevious; /**< previous entry on the address ordered free list, or NULL for the head */
+		MM_HeapLinkedFreeHeader *binPrevious; /**< previous entry in the bin (parent in the tree) */
+		MM_HeapLinkedFreeHeader *binNext; /**< next entry in the bin (left child in the tree) */
+		MM_HeapLinkedFreeHeader *treeRight; /**< right child in the tree */
+	};
+
+	MM_HeapLinkedFreeHeader *_bins[BIN_COUNT]; /**< heads of the size-class bins */
+	uintptr_t _nonEmptyBins; /**< bit i is set if _bins[i] is not empty */
+	MM_HeapLinkedFreeHeader *_treeRoot; /**< root of the treap of entries of at least _treeThreshold bytes */
+	uintptr_t _minimumShift; /**< floor(log2) of the smallest entry the owning pool keeps on its free list */
+	uintptr_t _treeThreshold; /**< entries of at least this size are kept in the tree rather than a bin */
+	bool _valid; /**< true if the index reflects the current free list */
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE static Links *links(MM_HeapLinkedFreeHeader *entry) { return (Links *)(entry + 1); }
+
+	MMINLINE static uintptr_t
+	floorLog2(uintptr_t size)
+	{
+		return (J9BITS_BITS_IN_SLOT - 1) - MM_Bits::trailingZeroes(size);
+	}
+
+	/**
+	 * @return the bin holding entries of the given size (entries in bin i are never smaller than getBinMinimumSize(i))
+	 */
+	MMINLINE uintptr_t
+	getBinIndex(uintptr_t size)
+	{
+		uintptr_t shift = floorLog2(size);
+		uintptr_t subBin = (size >> (shift - SUB_BIN_SHIFT)) & ((1 << SUB_BIN_SHIFT) - 1);
+		return ((shift - _minimumShift) << SUB_BIN_SHIFT) + subBin;
+	}
+
+	MMINLINE uintptr_t
+	getBinMinimumSize(uintptr_t binIndex)
+	{
+		uintptr_t shift = _minimumShift + (binIndex >> SUB_BIN_SHIFT);
+		uintptr_t subBin = binIndex & ((1 << SUB_BIN_SHIFT) - 1);
+		return ((uintptr_t)1 << shift) + (subBin << (shift - SUB_BIN_SHIFT));
+	}
+
+	/**
+	 * @return true if entry orders before other in the tree
+	 */
+	MMINLINE static bool
+	isTreeLess(MM_HeapLinkedFreeHeader *entry, MM_HeapLinkedFreeHeader *other)
+	{
+		uintptr_t entrySize = entry->getSize();
+		uintptr_t otherSize = other->getSize();
+		return (entrySize < otherSize) || ((entrySize == otherSize) && (entry < other));
+	}
+
+	/**
+	 * Treap priority, derived from the entry address so the tree shape does not depend on insertion order.
+	 */
+	MMINLINE static uintptr_t
+	getTreePriority(MM_HeapLinkedFreeHeader *entry)
+	{
+		return ((uintptr_t)entry >> 4) * (uintptr_t)2654435761U;
+	}
+
+	void insertBin(MM_HeapLinkedFreeHeader *entry, uintptr_t size);
+	void removeBin(MM_HeapLinkedFreeHeader *entry, uintptr_t size);
+	void insertTree(MM_HeapLinkedFreeHeader *entry);
+	void removeTree(MM_HeapLinkedFreeHeader *entry);
+	void replaceTreeChild(MM_HeapLinkedFreeHeader *parent, MM_HeapLinkedFreeHeader *child, MM_HeapLinkedFreeHeader *replacement);
+	void rotateTreeUp(MM_HeapLinkedFreeHeader *entry);
+	MM_HeapLinkedFreeHeader *findTreeFit(uintptr_t size);
+
+public:
+	/**
+	 * Prepare the index for a pool whose free entries are never smaller than minimumFreeEntrySize.
+	 * @return false if such entries are too small to hold the index links
+	 */
+	bool initialize(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize);
+
+	/**
+	 * Index every entry of an address ordered free list, discarding the previous contents of the index.
+	 */
+	void build(MM_HeapLinkedFreeHeader *freeListHead, bool compressed);
+
+	MMINLINE bool isValid() { return _valid; }
+	MMINLINE void invalidate() { _valid = false; }
+
+	/**
+	 * Find a free entry of at least size bytes. The entry stays indexed until remove() is called.
+	 * @param[out] lookup how the lookup was resolved, for the allocation profile
+	 * @return a fitting entry, or NULL if no indexed entry is large enough
+	 */
+	MM_HeapLinkedFreeHeader *findFit(uintptr_t size, MM_LargeObjectAllocateStats::FreeEntryIndexLookup &lookup);
+
+	/**
+	 * @return the size of the largest indexed entry, or 0 if the index is empty
+	 */
+	uintptr_t getLargestEntrySize();
+
+	/**
+	 * @return the entry preceding an indexed entry on the address ordered free list
+	 */
+	MMINLINE MM_HeapLinkedFreeHeader *getListPrevious(MM_HeapLinkedFreeHeader *entry) { return links(entry)->listPrevious; }
+
+	/**
+	 * Record that entry now follows previous on the free list.
+	 * @param entry an indexed entry, or NULL (end of list)
+	 */
+	MMINLINE void
+	setListPrevious(MM_HeapLinkedFreeHeader *entry, MM_HeapLinkedFreeHeader *previous)
+	{
+		if (NULL != entry) {
+			links(entry)->listPrevious = previous;
+		}
+	}
+
+	/**
+	 * Index an entry that has been linked onto the free list between previous and next.
+	 */
+	MMINLINE void
+	insert(MM_HeapLinkedFreeHeader *entry, MM_HeapLinkedFreeHeader *previous, MM_HeapLinkedFreeHeader *next)
+	{
+		uintptr_t size = entry->getSize();
+		links(entry)->listPrevious = previous;
+		setListPrevious(next, entry);
+		if (size < _treeThreshold) {
+			insertBin(entry, size);
+		} else {
+			insertTree(entry);
+		}
+	}
+
+	/**
+	 * Remove an entry from the size index. The caller must still fix the list predecessor of the entry that follows it.
+	 * Must be called before the header of the entry is overwritten.
+	 */
+	MMINLINE void
+	remove(MM_HeapLinkedFreeHeader *entry)
+	{
+		uintptr_t size = entry->getSize();
+		if (size < _treeThreshold) {
+			removeBin(entry, size);
+		} else {
+			removeTree(entry);
+		}
+	}
+
+	MM_FreeEntryIndex()
+		: _nonEmptyBins(0)
+		, _treeRoot(NULL)
+		, _minimumShift(0)
+		, _treeThreshold(0)
+		, _valid(false)
+	{
+		for (uintptr_t i = 0; i < BIN_COUNT; i++) {
+			_bins[i] = NULL;
+		}
+	}
+};
+
+#endif /* FREEENTRYINDEX_HPP_ */
@@ -0,0 +1,348 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+
+#include "omrport.h"
+#include "omrutil.h"
+#include "ModronAssertions.h"
+
+#include "FreePageReleaser.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "MemoryPool.hpp"
+#include "ParallelDispatcher.hpp"
+
+extern "C" {
+
+/**
+ * Helper function used by J9_SORT to order free page ranges by pool, then by address.
+ */
+static int
+compareFreePageRangeFunc(const void *element1, const void *element2)
+{
+	const MM_FreePageRange *range1 = (const MM_FreePageRange *)element1;
+	const MM_FreePageRange *range2 = (const MM_FreePageRange *)element2;
+
+	if (range1->memoryPool != range2->memoryPool) {
+		return ((uintptr_t)range1->memoryPool < (uintptr_t)range2->memoryPool) ? -1 : 1;
+	}
+	if (range1->base != range2->base) {
+		return ((uintptr_t)range1->base < (uintptr_t)range2->base) ? -1 : 1;
+	}
+	return 0;
+}
+
+static uintptr_t
+releaser_thread_proc2(OMRPortLibrary* portLib, void *info)
+{
+	((MM_FreePageReleaser *)info)->releaserThreadEntryPoint();
+	return 0;
+}
+
+static int J9THREAD_PROC
+releaser_thread_proc(void *info)
+{
+	MM_GCExtensionsBase *extensions = ((MM_FreePageReleaser *)info)->getExtensions();
+	OMR_VM *omrVM = extensions->getOmrVM();
+	OMRPORT_ACCESS_FROM_OMRVM(omrVM);
+	uintptr_t rc = 0;
+	omrsig_protect(releaser_thread_proc2, info,
+			extensions->dispatcher->getSignalHandler(), omrVM,
+		OMRPORT_SIG_FLAG_SIGALLSYNC | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+	return 0;
+}
+
+} /* extern "C" */
+
+MM_FreePageReleaser *
+MM_FreePageReleaser::newInstance(MM_EnvironmentBase *env)
+{
+	MM_FreePageReleaser *releaser = (MM_FreePageReleaser *)env->getForge()->allocate(sizeof(MM_FreePageReleaser), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != releaser) {
+		new(releaser) MM_FreePageReleaser(env);
+		if (!releaser->initialize(env)) {
+			releaser->kill(env);
+			releaser = NULL;
+		}
+	}
+	return releaser;
+}
+
+void
+MM_FreePageReleaser::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+MM_FreePageReleaser::MM_FreePageReleaser(MM_EnvironmentBase *env)
+	: MM_BaseVirtual()
+	, _extensions(env->getExtensions())
+	, _monitor(NULL)
+	, _state(STATE_ERROR)
+	, _queue(NULL)
+	, _queueCount(0)
+	, _batch(NULL)
+{
+	_typeId = __FUNCTION__;
+}
+
+bool
+MM_FreePageReleaser::initialize(MM_EnvironmentBase *env)
+{
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_FreePageReleaser::_monitor")) {
+		return false;
+	}
+
+	uintptr_t queueSize = sizeof(MM_FreePageRange) * QUEUE_CAPACITY;
+	_queue = (MM_FreePageRange *)env->getForge()->allocate(queueSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	_batch = (MM_FreePageRange *)env->getForge()->allocate(queueSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+
+	return (NULL != _queue) && (NULL != _batch);
+}
+
+void
+MM_FreePageReleaser::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _batch) {
+		env->getForge()->free(_batch);
+		_batch = NULL;
+	}
+	if (NULL != _queue) {
+		env->getForge()->free(_queue);
+		_queue = NULL;
+	}
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+bool
+MM_FreePageReleaser::startup()
+{
+	bool success = false;
+
+	/* hold the monitor over start-up so that the thread can not report its state before we wait for it */
+	omrthread_monitor_enter(_monitor);
+	_state = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		releaser_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _state) {
+			omrthread_monitor_wait(_monitor);
+		}
+		success = (STATE_ERROR != _state);
+	} else {
+		_state = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return success;
+}
+
+void
+MM_FreePageReleaser::shutdown()
+{
+	omrthread_monitor_enter(_monitor);
+	if (STATE_ERROR != _state) {
+		/* whatever is still queued stays committed */
+		_queueCount = 0;
+		while (STATE_TERMINATED != _state) {
+			_state = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify(_monitor);
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+bool
+MM_FreePageReleaser::queueRange(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, void *base, void *top)
+{
+	bool queued = false;
+
+	omrthread_monitor_enter(_monitor);
+	if ((STATE_WAITING == _state) || (STATE_RELEASING == _state)) {
+		if (_queueCount < QUEUE_CAPACITY) {
+			MM_FreePageRange *range = &_queue[_queueCount];
+			range->memoryPool = memoryPool;
+			range->base = base;
+			range->top = top;
+			_queueCount += 1;
+			queued = true;
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return queued;
+}
+
+void
+MM_FreePageReleaser::releaseQueuedRanges(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	if ((0 != _queueCount) && (STATE_WAITING == _state)) {
+		omrthread_monitor_notify(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+uintptr_t
+MM_FreePageReleaser::coalesceBatch(uintptr_t count)
+{
+	J9_SORT(_batch, count, sizeof(MM_FreePageRange), compareFreePageRangeFunc);
+
+	uintptr_t last = 0;
+	for (uintptr_t i = 1; i < count; i++) {
+		MM_FreePageRange *range = &_batch[i];
+		MM_FreePageRange *lastRange = &_batch[last];
+		if ((range->memoryPool == lastRange->memoryPool) && ((uintptr_t)range->base <= (uintptr_t)lastRange->top)) {
+			/* the same memory may be queued twice if the heap went idle twice before the thread got to it */
+			if ((uintptr_t)range->top > (uintptr_t)lastRange->top) {
+				lastRange->top = range->top;
+			}
+		} else {
+			last += 1;
+			_batch[last] = *range;
+		}
+	}
+
+	return (0 == count) ? 0 : (last + 1);
+}
+
+void
+MM_FreePageReleaser::releaseBatch(MM_EnvironmentBase *env, uintptr_t count, MM_FreePageReleaseStats *stats)
+{
+	for (uintptr_t i = 0; i < count; i++) {
+		stats->_queuedBytes += (uintptr_t)_batch[i].top - (uintptr_t)_batch[i].base;
+	}
+
+	uintptr_t start = 0;
+	while (start < count) {
+		if (env->isExclusiveAccessRequestWaiting()) {
+			/* let the collection run; the pools re-check every range against their free lists, so nothing is stale */
+			env->releaseVMAccess();
+			env->acquireVMAccess();
+		}
+
+		MM_MemoryPool *memoryPool = _batch[start].memoryPool;
+		uintptr_t end = start + 1;
+		while ((end < count) && (end - start < RANGES_PER_BATCH) && (memoryPool == _batch[end].memoryPool)) {
+			end += 1;
+		}
+		memoryPool->releaseQueuedFreePages(env, &_batch[start], end - start, stats);
+		start = end;
+	}
+
+	stats->_cancelledBytes = stats->_queuedBytes - stats->_releasedBytes;
+}
+
+void
+MM_FreePageReleaser::releaserThreadEntryPoint()
+{
+	OMR_VMThread *omrVMThread = MM_EnvironmentBase::attachVMThread(_extensions->getOmrVM(), "GC Free Page Releaser", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+	if (NULL == omrVMThread) {
+		/* we failed to attach so notify the creating thread that we should fail to start up */
+		omrthread_monitor_enter(_monitor);
+		_state = STATE_ERROR;
+		omrthread_monitor_notify(_monitor);
+		omrthread_exit(_monitor);
+	} else {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+		omrthread_monitor_enter(_monitor);
+		_state = STATE_WAITING;
+		omrthread_monitor_notify(_monitor);
+		while (STATE_TERMINATION_REQUESTED != _state) {
+			if (0 == _queueCount) {
+				omrthread_monitor_wait(_monitor);
+			} else {
+				/* take the whole queue, so that idle collections can queue more while this batch is released */
+				MM_FreePageRange *batch = _queue;
+				_queue = _batch;
+				_batch = batch;
+				uintptr_t count = _queueCount;
+				_queueCount = 0;
+				_state = STATE_RELEASING;
+				omrthread_monitor_exit(_monitor);
+
+				uint64_t startTime = omrtime_hires_clock();
+				MM_FreePageReleaseStats stats;
+				stats.clear();
+				count = coalesceBatch(count);
+				env->acquireVMAccess();
+				releaseBatch(env, count, &stats);
+				env->releaseVMAccess();
+				uint64_t endTime = omrtime_hires_clock();
+				reportFreePagesReleased(env, &stats, omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+
+				omrthread_monitor_enter(_monitor);
+				if (STATE_RELEASING == _state) {
+					_state = STATE_WAITING;
+				}
+			}
+		}
+		_state = STATE_TERMINATED;
+		omrthread_monitor_notify(_monitor);
+		MM_EnvironmentBase::detachVMThread(_extensions->getOmrVM(), omrVMThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+		omrthread_exit(_monitor);
+	}
+}
+
+void
+MM_FreePageReleaser::reportFreePagesReleased(MM_EnvironmentBase *env, MM_FreePageReleaseStats *stats, uint64_t timeTaken)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	Trc_MM_FreePageReleaser_released(env->getLanguageVMThread(), stats->_queuedBytes, stats->_releasedBytes, stats->_cancelledBytes, stats->_decommitCount);
+
+	TRIGGER_J9HOOK_MM_PRIVATE_FREE_PAGES_RELEASED(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_FREE_PAGES_RELEASED,
+		stats->_queuedBytes,
+		stats->_releasedBytes,
+		stats->_cancelledBytes,
+		stats->_decommitCount,
+		timeTaken);
+}
+
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(FREEPAGERELEASER_HPP_)
+#define FREEPAGERELEASER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrthread.h"
+#include "modronbase.h"
+#include "modronopt.h"
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+class MM_MemoryPool;
+
+/**
+ * A range of free memory queued to be released back to the OS.
+ * @ingroup GC_Base_Core
+ */
+struct MM_FreePageRange {
+	MM_MemoryPool *memoryPool; /**< the pool whose free list held the range when it was queued */
+	void *base; /**< page aligned base of the range */
+	void *top; /**< page aligned top (exclusive) of the range */
+};
+
+/**
+ * Counters for one pass of the releaser over its queue.
+ * @ingroup GC_Base_Core
+ */
+struct MM_FreePageReleaseStats {
+	uintptr_t _queuedBytes; /**< bytes queued, once overlapping ranges are merged */
+	uintptr_t _releasedBytes; /**< bytes returned to the OS */
+	uintptr_t _cancelledBytes; /**< queued bytes not released, because they had been reallocated or were kept to leave huge pages intact */
+	uintptr_t _decommitCount; /**< number of decommit requests (one madvise each on Linux) made to the OS */
+
+	void clear()
+	{
+		_queuedBytes = 0;
+		_releasedBytes = 0;
+		_cancelledBytes = 0;
+		_decommitCount = 0;
+	}
+};
+
+/**
+ * Returns free heap pages to the OS from a background thread.
+ * Free ranges found when the heap is shrunk on idle are queued rather than decommitted in place. The background thread
+ * sorts and coalesces the queue, then hands the ranges to their pools in small batches: each pool checks, under its
+ * own lock, which part of each range is still free and decommits only that, so a range that was reallocated in the
+ * meantime is cancelled rather than released. The thread holds VM access while it works and gives it up whenever
+ * exclusive access is requested, so it never runs concurrently with a collection.
+ * @ingroup GC_Base_Core
+ */
+class MM_FreePageReleaser : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+	enum {
+		QUEUE_CAPACITY = 1024, /**< ranges that can be queued before release falls back to decommitting in place */
+		RANGES_PER_BATCH = 32 /**< ranges released per acquisition of a pool's lock */
+	};
+
+private:
+	typedef enum ReleaserState {
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_WAITING,
+		STATE_RELEASING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED
+	} ReleaserState;
+
+	MM_GCExtensionsBase *_extensions;
+	omrthread_monitor_t _monitor; /**< protects _queue, _queueCount and _state */
+	volatile ReleaserState _state;
+	MM_FreePageRange *_queue; /**< ranges waiting to be released */
+	uintptr_t _queueCount;
+	MM_FreePageRange *_batch; /**< ranges taken from the queue by the background thread */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_FreePageReleaser *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the background thread.
+	 * @return true if the thread started and is waiting for work
+	 */
+	bool startup();
+
+	/**
+	 * Stop the background thread, dropping anything still queued.
+	 */
+	void shutdown();
+
+	/**
+	 * Queue a range of free memory to be released. The range is not touched until releaseQueuedRanges() is called.
+	 * @param memoryPool the pool whose free list holds the range
+	 * @param base page aligned base of the range
+	 * @param top page aligned top of the range
+	 * @return true if the range was queued, false if the queue is full and the caller should release it itself
+	 */
+	bool queueRange(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, void *base, void *top);
+
+	/**
+	 * Wake the background thread to release everything queued so far.
+	 */
+	void releaseQueuedRanges(MM_EnvironmentBase *env);
+
+	/**
+	 * Background thread entry point.
+	 */
+	void releaserThreadEntryPoint();
+
+	MMINLINE MM_GCExtensionsBase *getExtensions() { return _extensions; }
+
+	MM_FreePageReleaser(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	/**
+	 * Sort the batch by pool and address and merge ranges that touch or overlap.
+	 * @return the number of ranges left in the batch
+	 */
+	uintptr_t coalesceBatch(uintptr_t count);
+
+	/**
+	 * Release the ranges in the batch, yielding VM access between batches if a collection is waiting.
+	 * @note The calling thread holds VM access.
+	 */
+	void releaseBatch(MM_EnvironmentBase *env, uintptr_t count, MM_FreePageReleaseStats *stats);
+
+	void reportFreePagesReleased(MM_EnvironmentBase *env, MM_FreePageReleaseStats *stats, uint64_t timeTaken);
+};
+
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
+#endif /* FREEPAGERELEASER_HPP_ */
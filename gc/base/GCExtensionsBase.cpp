@@ -28,6 +28,7 @@
 #include "omrmemcategories.h"
 #include "modronbase.h"
 
+#include "AllocationSampleStats.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -246,6 +247,11 @@ MM_GCExtensionsBase::tearDown(MM_EnvironmentBase* env)
 		collectorLanguageInterface = NULL;
 	}
 
+	if (NULL != allocationSampleStats) {
+		allocationSampleStats->kill(env);
+		allocationSampleStats = NULL;
+	}
+
 	if (NULL != environments) {
 		pool_kill(environments);
 		environments = NULL;
@@ -32,11 +32,13 @@
 
 #include "AllocationStats.hpp"
 #include "ArrayObjectModel.hpp"
+#include "AtomicOperations.hpp"
 #include "BaseVirtual.hpp"
 #include "ExcessiveGCStats.hpp"
 #include "Forge.hpp"
 #include "GlobalGCStats.hpp"
 #include "GlobalVLHGCStats.hpp"
+#include "HeapMapKernels.hpp"
 #include "LargeObjectAllocateStats.hpp"
 #include "MemoryHandle.hpp"
 #include "MixedObjectModel.hpp"
@@ -47,6 +49,7 @@
 #include "ScavengerStats.hpp"
 #include "SublistPool.hpp"
 
+class MM_AllocationSampleStats;
 class MM_CardTable;
 class MM_ClassLoaderRememberedSet;
 class MM_CollectorLanguageInterface;
@@ -54,6 +57,7 @@ class MM_CompactGroupPersistentStats;
 class MM_CompressedCardTable;
 class MM_Configuration;
 class MM_EnvironmentBase;
+class MM_FreePageReleaser;
 class MM_FrequentObjectsStats;
 class MM_GlobalAllocationManager;
 class MM_GlobalCollector;
@@ -74,6 +78,7 @@ class MM_RememberedSetCardBucket;
 class MM_RememberedSetSATB;
 #endif /* defined(OMR_GC_REALTIME) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
+class MM_RSOverflowMap;
 class MM_Scavenger;
 #endif /* OMR_GC_MODRON_SCAVENGER */
 class MM_SizeClasses;
@@ -123,6 +128,12 @@ enum BackOutState {
 	backOutStarted			/* Backout started */
 };
 
+enum RememberedSetOverflowState {
+	rememberedSetOverflowCleared,		/* Remembered set lists hold every remembered object */
+	rememberedSetOverflowRecorded,		/* Remembered objects missing from the lists are recorded in the remembered set overflow map */
+	rememberedSetOverflowUnrecorded		/* Any tenured object may be remembered */
+};
+
 /* Note:  These should be templates if DDR ever supports them (JAZZ 40487) */
 class MM_UserSpecifiedParameterUDATA {
 	/* Data Members */
@@ -213,7 +224,7 @@ private:
 	void* _guaranteedNurseryStart; /**< lowest address guaranteed to be in the nursery */
 	void* _guaranteedNurseryEnd; /**< highest address guaranteed to be in the nursery */
 
-	bool _isRememberedSetInOverflow;
+	volatile uintptr_t _rememberedSetOverflowState; /**< one of RememberedSetOverflowState */
 
 	volatile BackOutState _backOutState; /**< set if a thread is unable to copy an object due to lack of free space in both Survivor and Tenure */
 	volatile bool _concurrentGlobalGCInProgress; /**< set to true if concurrent Global GC is in progress */
@@ -294,6 +305,7 @@ public:
 #endif /* OMR_GC_MODRON_SCAVENGER */
 #if defined(OMR_GC_REALTIME)
 	MM_RememberedSetSATB* sATBBarrierRememberedSet; /**< The snapshot at the beginning barrier remembered set used for the write barrier */
+	uintptr_t satbBufferSize; /**< Number of slots a thread fills in its SATB barrier buffer before publishing it, 0 to use the whole work packet */
 #endif /* defined(OMR_GC_REALTIME) */
 	ModronLnrlOptions lnrlOptions;
 
@@ -317,6 +329,9 @@ public:
 	uintptr_t frequentObjectAllocationSamplingRate; /**< # bytes to sample / # bytes allocated */
 	MM_FrequentObjectsStats* frequentObjectsStats;
 	uint32_t frequentObjectAllocationSamplingDepth; /**< # of frequent objects we'd like to report */
+	uintptr_t allocationSamplingInterval; /**< Mean number of bytes allocated by a thread between allocation samples, 0 if sampling is disabled */
+	uintptr_t allocationSamplingTopK; /**< # of most frequently sampled types reported at each collection */
+	MM_AllocationSampleStats *allocationSampleStats; /**< Samples of all threads merged at each collection */
 
 	uint32_t estimateFragmentation; /**< Enable estimate fragmentation, NO_ESTIMATE_FRAGMENTATION, LOCALGC_ESTIMATE_FRAGMENTATION, GLOBALGC_ESTIMATE_FRAGMENTATION(default) */
 	bool processLargeAllocateStats; /**< Enable process LargeObjectAllocateStats */
@@ -345,6 +360,8 @@ public:
 	uintptr_t tlhMaximumSize;
 	uintptr_t tlhInitialSize;
 	uintptr_t tlhIncrementSize;
+	bool tlhAdaptiveSizing; /**< if true, each TLH refresh is sized from the thread's recent allocation rate rather than grown by tlhIncrementSize */
+	uintptr_t tlhRefreshTargetInterval; /**< with tlhAdaptiveSizing, the time (in microseconds) a TLH should last at the thread's allocation rate */
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 
@@ -356,6 +373,7 @@ public:
 	uintptr_t splitFreeListSplitAmount;
 	uintptr_t splitFreeListNumberChunksPrepared; /**< Used in MPSAOL postProcess. Shared for all MPSAOLs. Do not overwrite during postProcess for any MPSAOL. */
 	bool enableHybridMemoryPool;
+	bool indexedFreeList; /**< if true, address ordered tenure pools index their free entries by size after each sweep or compact */
 
 	bool largeObjectArea;
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
@@ -404,6 +422,15 @@ public:
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool workStealing; /**< if true, tasks which support it hand off work through per-worker work stealing deques instead of the shared lists */
+	uintptr_t workStealingDequeSize; /**< number of entries in each per-worker work stealing deque (power of two) */
+	bool lockFreePacketLists; /**< if true, the work packet lists are lock free stacks instead of lock protected lists */
+	bool workPacketCache; /**< if true, tasks which support it keep an empty and a full work packet in each thread's work stack */
+	bool treeBarrier; /**< if true, tasks which support it synchronize their threads on a combining tree barrier instead of a monitor */
+	uintptr_t treeBarrierSpinCount; /**< number of spin iterations a thread waiting on the tree barrier makes before parking */
+	uintptr_t markingPrefetchDepth; /**< number of referents the mark loop queues (and prefetches) ahead of marking them, 0 to disable */
+	MM_HeapMapKernels heapMapKernels; /**< bulk heap map operations bound to the widest implementation the processor supports */
+	bool scalarHeapMapKernels; /**< if true, heapMapKernels uses the portable implementation regardless of processor support */
 
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
@@ -469,8 +496,10 @@ public:
 		OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST,
 		OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST,
 		OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL,
+		OMR_GC_SCAVENGER_SCANORDERING_DEPTH_FIRST,
 	};
 	ScavengerScanOrdering scavengerScanOrdering; /**< scan ordering in Scavenger */
+	uintptr_t scavengerDepthFirstCopyDepth; /**< maximum number of descendants the depthFirst scan ordering copies behind each copied object */
 	/* Start of options relating to dynamicBreadthFirstScanOrdering */
 	uintptr_t gcCountBetweenHotFieldSort;
 	uintptr_t gcCountBetweenHotFieldSortMax;
@@ -498,6 +527,9 @@ public:
 	bool scvTenureStrategyHistory; /**< Flag for enabling the History scavenger tenure strategy. */
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
+	bool scavengerRecordRememberedSetOverflow; /**< if true, objects which do not fit in the remembered set are recorded in rememberedSetOverflowMap instead of forcing a tenure space walk */
+	MM_RSOverflowMap *rememberedSetOverflowMap; /**< owned by the scavenger, NULL unless scavengerRecordRememberedSetOverflow is set */
+	bool scavengerNUMAAwareCopy; /**< if true, nursery memory is bound to NUMA nodes in interleaved granules when committed and each scavenger worker carves its survivor copy caches from the granules of its node */
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool softwareRangeCheckReadBarrier; /**< enable software read barrier instead of hardware guarded loads when running with CS */
@@ -538,6 +570,7 @@ public:
 	double dnssMaximumContraction;
 	double dnssMinimumExpansion;
 	double dnssMinimumContraction;
+	uintptr_t scavengerPauseGoal; /**< target scavenge pause in milliseconds which new space is sized for instead of the scavenge time ratio, 0 if not set */
 	bool enableSplitHeap; /**< true if we are using gencon with -Xgc:splitheap (we will fail to boostrap if we can't allocate both ranges) */
 	double aliasInhibitingThresholdPercentage; /**< percentage of threads that can be blocked before copy cache aliasing is inhibited (set through aliasInhibitingThresholdPercentage=) */
 
@@ -581,6 +614,7 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	uintptr_t partialCompactionPercent; /**< Percentage of the heap, most fragmented granules first, that a compaction moves objects within (0 compacts the whole heap) */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -674,6 +708,8 @@ public:
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SizeClasses* defaultSizeClasses;
+	bool lockFreeRegionQueues; /**< if true, the available and single free region lists are linked with compare and swap rather than under a lock */
+	uintptr_t regionCacheSize; /**< number of available regions an allocation context takes from the region pool per refill (0 to take one at a time) */
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
@@ -854,6 +890,9 @@ public:
 	bool gcOnIdle; /**< Enables releasing free heap pages if true while systemGarbageCollect invoked with IDLE GC code, default is false */
 	bool compactOnIdle; /**< Forces compaction if global GC executed while VM Runtime State set to IDLE, default is false */
 	float gcOnIdleCompactThreshold; /**< Enables compaction when fragmented memory and dark matter exceed this limit. The larger this number, the more memory can be fragmented before compact is triggered **/
+	bool deferFreePageRelease; /**< Queue the free pages released on idle and return them to the OS from a background thread, default is false */
+	uintptr_t freePageReleaseAlignment; /**< Free pages released in the background are trimmed to this alignment when large enough, so transparent huge pages are not split, default is 2MB */
+	MM_FreePageReleaser *freePageReleaser; /**< Background releaser of free pages, if deferFreePageRelease is set */
 #endif
 
 #if defined(OMR_VALGRIND_MEMCHECK)
@@ -1112,9 +1151,20 @@ public:
 		*end = _guaranteedNurseryEnd;
 	}
 
-	MMINLINE bool isRememberedSetInOverflowState() { return _isRememberedSetInOverflow; }
-	MMINLINE void setRememberedSetOverflowState() { _isRememberedSetInOverflow = true; }
-	MMINLINE void clearRememberedSetOverflowState() { _isRememberedSetInOverflow = false; }
+	MMINLINE bool isRememberedSetInOverflowState() { return rememberedSetOverflowCleared != _rememberedSetOverflowState; }
+	MMINLINE bool isRememberedSetOverflowRecorded() { return rememberedSetOverflowRecorded == _rememberedSetOverflowState; }
+	MMINLINE void setRememberedSetOverflowState() { _rememberedSetOverflowState = rememberedSetOverflowUnrecorded; }
+	MMINLINE void clearRememberedSetOverflowState() { _rememberedSetOverflowState = rememberedSetOverflowCleared; }
+
+	/**
+	 * Enter the recorded overflow state, unless the remembered set is already overflowed.
+	 * Callers must have recorded the object they failed to add in rememberedSetOverflowMap.
+	 */
+	MMINLINE void
+	setRememberedSetOverflowStateRecorded()
+	{
+		MM_AtomicOperations::lockCompareExchange(&_rememberedSetOverflowState, rememberedSetOverflowCleared, rememberedSetOverflowRecorded);
+	}
 
 	MMINLINE void setScavengerBackOutState(BackOutState backOutState) { _backOutState = backOutState; }
 	MMINLINE BackOutState getScavengerBackOutState() { return _backOutState; }
@@ -1379,7 +1429,7 @@ public:
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		, _guaranteedNurseryStart(NULL)
 		, _guaranteedNurseryEnd(NULL)
-		, _isRememberedSetInOverflow(false)
+		, _rememberedSetOverflowState(rememberedSetOverflowCleared)
 		, _backOutState(backOutFlagCleared)
 		, _concurrentGlobalGCInProgress(false)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -1443,6 +1493,7 @@ public:
 #endif /* OMR_GC_MODRON_SCAVENGER */
 #if defined(OMR_GC_REALTIME)
 		, sATBBarrierRememberedSet(NULL)
+		, satbBufferSize(0)
 #endif /* defined(OMR_GC_REALTIME) */
 		, heapBaseForBarrierRange0(NULL)
 		, heapSizeForBarrierRange0(0)
@@ -1458,6 +1509,9 @@ public:
 		, frequentObjectAllocationSamplingRate(100)
 		, frequentObjectsStats(NULL)
 		, frequentObjectAllocationSamplingDepth(0)
+		, allocationSamplingInterval(0) /* disabled by default */
+		, allocationSamplingTopK(16)
+		, allocationSampleStats(NULL)
 		, estimateFragmentation(GLOBALGC_ESTIMATE_FRAGMENTATION)
 		, processLargeAllocateStats(true) /* turn on processLargeAllocateStats by default */
 		, largeObjectAllocationProfilingThreshold(512)
@@ -1479,6 +1533,8 @@ public:
 		, tlhMaximumSize(131072)
 		, tlhInitialSize(2048)
 		, tlhIncrementSize(4096)
+		, tlhAdaptiveSizing(false)
+		, tlhRefreshTargetInterval(1000)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
 		, allocationStats()
@@ -1488,6 +1544,7 @@ public:
 		, splitFreeListSplitAmount(0)
 		, splitFreeListNumberChunksPrepared(0)
 		, enableHybridMemoryPool(false)
+		, indexedFreeList(false)
 		, largeObjectArea(false)
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 		, largeObjectMinimumSize(64 * 1024)
@@ -1522,6 +1579,15 @@ public:
 		, useGCStartupHints(true)
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
+		, workStealing(false)
+		, workStealingDequeSize(64)
+		, lockFreePacketLists(false)
+		, workPacketCache(false)
+		, treeBarrier(false)
+		, treeBarrierSpinCount(256)
+		, markingPrefetchDepth(0)
+		, heapMapKernels()
+		, scalarHeapMapKernels(false)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
@@ -1571,6 +1637,7 @@ public:
 		, dispatcherHybridNotifyThreadBound(16)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_NONE)
+		, scavengerDepthFirstCopyDepth(8)
 		/* Start of options relating to dynamicBreadthFirstScanOrdering */
 		, gcCountBetweenHotFieldSort(1)
 		, gcCountBetweenHotFieldSortMax(6)
@@ -1599,6 +1666,9 @@ public:
 		, scvTenureStrategyHistory(true)
 		, scavengerEnabled(false)
 		, scavengerRsoScanUnsafe(false)
+		, scavengerRecordRememberedSetOverflow(false)
+		, rememberedSetOverflowMap(NULL)
+		, scavengerNUMAAwareCopy(false)
 		, cacheListSplit(0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, softwareRangeCheckReadBarrier(false)
@@ -1637,6 +1707,7 @@ public:
 		, dnssMaximumContraction(0.5)
 		, dnssMinimumExpansion(0.0)
 		, dnssMinimumContraction(0.0)
+		, scavengerPauseGoal(0)
 		, enableSplitHeap(false)
 		, aliasInhibitingThresholdPercentage(0.20)
 		, adaptiveGCThreading(true)
@@ -1665,6 +1736,7 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, partialCompactionPercent(0)
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1735,6 +1807,8 @@ public:
 #endif /* defined(OMR_GC_REALTIME) || defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		, defaultSizeClasses(NULL)
+		, lockFreeRegionQueues(false)
+		, regionCacheSize(0)
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
 		, heapRegionStateTable(NULL)
@@ -1866,6 +1940,9 @@ public:
 		, gcOnIdle(false)
 		, compactOnIdle(false)
 		, gcOnIdleCompactThreshold((float)0.10)
+		, deferFreePageRelease(false)
+		, freePageReleaseAlignment(2 * 1024 * 1024)
+		, freePageReleaser(NULL)
 #endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 #if defined(OMR_VALGRIND_MEMCHECK)
 		, valgrindMempoolAddr(0)
@@ -71,6 +71,12 @@ public:
 
 	virtual void yield(MM_EnvironmentBase *env) {};
 
+	/**
+	 * Complete any work left over from the last global collection that a local collection must not overlap.
+	 * Called by the local collector, with exclusive access, before it sets up a collection.
+	 */
+	virtual void completeWorkBeforeLocalCollection(MM_EnvironmentBase *env) {};
+
 	/**
  	 * Perform any collector-specific initialization.
  	 * @return TRUE if startup completes OK, FALSE otherwise
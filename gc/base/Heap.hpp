@@ -127,6 +127,13 @@ public:
 
 	virtual bool commitMemory(void *address, uintptr_t size) = 0;
 	virtual bool decommitMemory(void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress) = 0;
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	/**
+	 * Decommit free pages that the OS only needs to reclaim once it is short of memory.
+	 * Heaps that cannot defer the release decommit the range immediately.
+	 */
+	virtual bool decommitMemoryLazily(void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress) { return decommitMemory(address, size, lowValidAddress, highValidAddress); }
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
 	void mergeHeapStats(MM_HeapStats *heapStats, uintptr_t includeMemoryType);
 	void mergeHeapStats(MM_HeapStats *heapStats);
@@ -265,11 +265,7 @@ MM_HeapMap::setBitsInRange(MM_EnvironmentBase *env, void *lowAddress, void *high
 	
 	bytesToSet= (topIndex - baseIndex) * sizeof(uintptr_t);
 		
-	if (clear) {
-		OMRZeroMemory((void *)&(_heapMapBits[baseIndex]), bytesToSet);
-	} else {
-		memset(&(_heapMapBits[baseIndex]), 0xFF, bytesToSet);
-	}
+	_extensions->heapMapKernels.fillSlots(&(_heapMapBits[baseIndex]), &(_heapMapBits[topIndex]), clear ? 0 : UDATA_MAX);
 		
 	return bytesToSet;
 }
@@ -284,7 +280,6 @@ bool
 MM_HeapMap::checkBitsForRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region)
 {
 	uintptr_t baseIndex, topIndex;
-	uintptr_t bytesToCheck;
 
 	void *lowAddress = region->getLowAddress();
 	void *highAddress = region->getHighAddress();
@@ -305,14 +300,5 @@ MM_HeapMap::checkBitsForRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor
 	topIndex = _extensions->heap->calculateOffsetFromHeapBase(highAddress);
 	topIndex >>= _heapMapIndexShift;
 
-	bytesToCheck= (topIndex - baseIndex) * sizeof(uintptr_t);
-
-	uint8_t *markMapBytes = (uint8_t *)(&_heapMapBits[baseIndex]);
-	for (uintptr_t i = 0; i < bytesToCheck; i++) {
-		if (0 != markMapBytes[i]) {
-			return false;
-		}
-	}
-
-	return true;
+	return _extensions->heapMapKernels.isZero(&(_heapMapBits[baseIndex]), &(_heapMapBits[topIndex]));
 }
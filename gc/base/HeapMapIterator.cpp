@@ -131,6 +131,17 @@ MM_HeapMapIterator::nextObject()
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
 			_heapMapSlotValue = *_heapMapSlotCurrent;
+			if (J9MODRON_HMI_SLOT_EMPTY == _heapMapSlotValue) {
+				/* Skip the whole run of empty map slots at once rather than one loop iteration per slot */
+				uintptr_t heapSlotsRemaining = _heapChunkTop - _heapSlotCurrent;
+				uintptr_t *heapMapSlotTop = _heapMapSlotCurrent + ((heapSlotsRemaining + J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT - 1) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT);
+				uintptr_t *heapMapSlotNonEmpty = _extensions->heapMapKernels.findNonZeroSlot(_heapMapSlotCurrent + 1, heapMapSlotTop);
+				_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (heapMapSlotNonEmpty - _heapMapSlotCurrent);
+				_heapMapSlotCurrent = heapMapSlotNonEmpty;
+				if(_heapSlotCurrent < _heapChunkTop) {
+					_heapMapSlotValue = *_heapMapSlotCurrent;
+				}
+			}
 		}
 	}
 
@@ -0,0 +1,271 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrutil.h"
+
+#include <string.h>
+
+#include "HeapMapKernels.hpp"
+
+#include "EnvironmentBase.hpp"
+
+/* The vector kernels are compiled with per function target attributes so the rest of the GC keeps its baseline ISA */
+#if defined(OMR_ARCH_X86) && defined(__GNUC__)
+#define OMR_HEAPMAPKERNELS_X86
+#include <immintrin.h>
+#endif /* defined(OMR_ARCH_X86) && defined(__GNUC__) */
+
+/**
+ * Fills of at least this many bytes bypass the cache. A cleared mark map range is not read again until
+ * marking touches it sparsely, so pulling the whole range through the cache only evicts useful data.
+ */
+#define OMR_HEAPMAPKERNELS_STREAMING_THRESHOLD ((uintptr_t)256 * 1024)
+
+static uintptr_t *
+findNonZeroSlotScalar(uintptr_t *slotCurrent, uintptr_t *slotTop)
+{
+	while ((slotCurrent < slotTop) && (0 == *slotCurrent)) {
+		slotCurrent += 1;
+	}
+	return slotCurrent;
+}
+
+static void
+fillSlotsScalar(uintptr_t *slotBase, uintptr_t *slotTop, uintptr_t slotValue)
+{
+	if (0 == slotValue) {
+		OMRZeroMemory((void *)slotBase, (uintptr_t)slotTop - (uintptr_t)slotBase);
+	} else if (UDATA_MAX == slotValue) {
+		memset((void *)slotBase, 0xFF, (uintptr_t)slotTop - (uintptr_t)slotBase);
+	} else {
+		for (uintptr_t *slot = slotBase; slot < slotTop; slot++) {
+			*slot = slotValue;
+		}
+	}
+}
+
+#if defined(OMR_HEAPMAPKERNELS_X86)
+
+/**
+ * Advance slotCurrent one slot at a time until it is aligned to alignment bytes or a non-zero slot is found.
+ * @return true if a non-zero slot was found (slotCurrent then points at it)
+ */
+static MMINLINE bool
+alignToVector(uintptr_t * &slotCurrent, uintptr_t *slotTop, uintptr_t alignment)
+{
+	while ((slotCurrent < slotTop) && (0 != ((uintptr_t)slotCurrent & (alignment - 1)))) {
+		if (0 != *slotCurrent) {
+			return true;
+		}
+		slotCurrent += 1;
+	}
+	return false;
+}
+
+static MMINLINE __m128i
+broadcast128(uintptr_t slotValue)
+{
+#if defined(OMR_ENV_DATA64)
+	return _mm_set1_epi64x((long long)slotValue);
+#else /* OMR_ENV_DATA64 */
+	return _mm_set1_epi32((int)slotValue);
+#endif /* OMR_ENV_DATA64 */
+}
+
+__attribute__((target("sse4.1")))
+static uintptr_t *
+findNonZeroSlotSSE41(uintptr_t *slotCurrent, uintptr_t *slotTop)
+{
+	if (alignToVector(slotCurrent, slotTop, sizeof(__m128i))) {
+		return slotCurrent;
+	}
+
+	/* Test two vectors per iteration; a hit is resolved to the exact slot by the scalar tail */
+	while (((uintptr_t)slotTop - (uintptr_t)slotCurrent) >= (2 * sizeof(__m128i))) {
+		__m128i low = _mm_load_si128((__m128i *)slotCurrent);
+		__m128i high = _mm_load_si128((__m128i *)slotCurrent + 1);
+		__m128i any = _mm_or_si128(low, high);
+		if (!_mm_testz_si128(any, any)) {
+			break;
+		}
+		slotCurrent += (2 * sizeof(__m128i)) / sizeof(uintptr_t);
+	}
+
+	return findNonZeroSlotScalar(slotCurrent, slotTop);
+}
+
+__attribute__((target("sse4.1")))
+static void
+fillSlotsSSE41(uintptr_t *slotBase, uintptr_t *slotTop, uintptr_t slotValue)
+{
+	if (((uintptr_t)slotTop - (uintptr_t)slotBase) < OMR_HEAPMAPKERNELS_STREAMING_THRESHOLD) {
+		fillSlotsScalar(slotBase, slotTop, slotValue);
+		return;
+	}
+
+	uintptr_t *slotCurrent = slotBase;
+	while (0 != ((uintptr_t)slotCurrent & (sizeof(__m128i) - 1))) {
+		*slotCurrent = slotValue;
+		slotCurrent += 1;
+	}
+
+	__m128i value = broadcast128(slotValue);
+	uintptr_t *vectorTop = (uintptr_t *)((uintptr_t)slotTop & ~(uintptr_t)(sizeof(__m128i) - 1));
+	while (slotCurrent < vectorTop) {
+		_mm_stream_si128((__m128i *)slotCurrent, value);
+		slotCurrent += sizeof(__m128i) / sizeof(uintptr_t);
+	}
+	/* non-temporal stores are weakly ordered; make them visible before the range is handed to other threads */
+	_mm_sfence();
+
+	while (slotCurrent < slotTop) {
+		*slotCurrent = slotValue;
+		slotCurrent += 1;
+	}
+}
+
+__attribute__((target("avx2")))
+static uintptr_t *
+findNonZeroSlotAVX2(uintptr_t *slotCurrent, uintptr_t *slotTop)
+{
+	if (alignToVector(slotCurrent, slotTop, sizeof(__m256i))) {
+		return slotCurrent;
+	}
+
+	/* Test two vectors (a full cache line) per iteration; a hit is resolved to the exact slot by the scalar tail */
+	while (((uintptr_t)slotTop - (uintptr_t)slotCurrent) >= (2 * sizeof(__m256i))) {
+		__m256i low = _mm256_load_si256((__m256i *)slotCurrent);
+		__m256i high = _mm256_load_si256((__m256i *)slotCurrent + 1);
+		__m256i any = _mm256_or_si256(low, high);
+		if (!_mm256_testz_si256(any, any)) {
+			break;
+		}
+		slotCurrent += (2 * sizeof(__m256i)) / sizeof(uintptr_t);
+	}
+
+	return findNonZeroSlotScalar(slotCurrent, slotTop);
+}
+
+__attribute__((target("avx2")))
+static void
+fillSlotsAVX2(uintptr_t *slotBase, uintptr_t *slotTop, uintptr_t slotValue)
+{
+	if (((uintptr_t)slotTop - (uintptr_t)slotBase) < OMR_HEAPMAPKERNELS_STREAMING_THRESHOLD) {
+		fillSlotsScalar(slotBase, slotTop, slotValue);
+		return;
+	}
+
+	uintptr_t *slotCurrent = slotBase;
+	while (0 != ((uintptr_t)slotCurrent & (sizeof(__m256i) - 1))) {
+		*slotCurrent = slotValue;
+		slotCurrent += 1;
+	}
+
+#if defined(OMR_ENV_DATA64)
+	__m256i value = _mm256_set1_epi64x((long long)slotValue);
+#else /* OMR_ENV_DATA64 */
+	__m256i value = _mm256_set1_epi32((int)slotValue);
+#endif /* OMR_ENV_DATA64 */
+	uintptr_t *vectorTop = (uintptr_t *)((uintptr_t)slotTop & ~(uintptr_t)(sizeof(__m256i) - 1));
+	while (slotCurrent < vectorTop) {
+		_mm256_stream_si256((__m256i *)slotCurrent, value);
+		slotCurrent += sizeof(__m256i) / sizeof(uintptr_t);
+	}
+	/* non-temporal stores are weakly ordered; make them visible before the range is handed to other threads */
+	_mm_sfence();
+
+	while (slotCurrent < slotTop) {
+		*slotCurrent = slotValue;
+		slotCurrent += 1;
+	}
+}
+
+#endif /* defined(OMR_HEAPMAPKERNELS_X86) */
+
+MM_HeapMapKernels::MM_HeapMapKernels()
+	: _findNonZeroSlot(findNonZeroSlotScalar)
+	, _fillSlots(fillSlotsScalar)
+	, _kernelLevel(KERNEL_LEVEL_SCALAR)
+{
+}
+
+void
+MM_HeapMapKernels::initialize(MM_EnvironmentBase *env, bool forceScalar)
+{
+	OMRPortLibrary *portLibrary = env->getPortLibrary();
+
+	bindKernelLevel(portLibrary, KERNEL_LEVEL_SCALAR);
+	if (!forceScalar) {
+		if (!bindKernelLevel(portLibrary, KERNEL_LEVEL_AVX2)) {
+			bindKernelLevel(portLibrary, KERNEL_LEVEL_SSE4_1);
+		}
+	}
+}
+
+bool
+MM_HeapMapKernels::bindKernelLevel(OMRPortLibrary *portLibrary, KernelLevel level)
+{
+	bool result = false;
+
+	if (KERNEL_LEVEL_SCALAR == level) {
+		_findNonZeroSlot = findNonZeroSlotScalar;
+		_fillSlots = fillSlotsScalar;
+		result = true;
+	}
+#if defined(OMR_HEAPMAPKERNELS_X86)
+	else {
+		OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+		OMRProcessorDesc processorDescription;
+		if (0 == omrsysinfo_get_processor_description(&processorDescription)) {
+			if (KERNEL_LEVEL_AVX2 == level) {
+				/* AVX2 also needs the OS to preserve the upper halves of the ymm registers */
+				if (omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_AVX2)
+					&& omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_AVX)
+					&& omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_OSXSAVE)
+				) {
+					_findNonZeroSlot = findNonZeroSlotAVX2;
+					_fillSlots = fillSlotsAVX2;
+					result = true;
+				}
+			} else if (KERNEL_LEVEL_SSE4_1 == level) {
+				if (omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_SSE4_1)) {
+					_findNonZeroSlot = findNonZeroSlotSSE41;
+					_fillSlots = fillSlotsSSE41;
+					result = true;
+				}
+			}
+		}
+	}
+#endif /* defined(OMR_HEAPMAPKERNELS_X86) */
+
+	if (result) {
+		_kernelLevel = level;
+	}
+	return result;
+}
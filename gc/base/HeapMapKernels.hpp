@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(HEAPMAPKERNELS_HPP_)
+#define HEAPMAPKERNELS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+#include "omrport.h"
+
+class MM_EnvironmentBase;
+
+/**
+ * Bulk operations over runs of heap map slots (mark map clearing, range setting and empty slot skipping).
+ * Each operation is bound once at startup to the widest implementation the processor supports, so callers
+ * pay one indirect call per run rather than one test per slot.
+ * @ingroup GC_Base_Core
+ */
+class MM_HeapMapKernels
+{
+	/*
+	 * Data members
+	 */
+public:
+	enum KernelLevel {
+		KERNEL_LEVEL_SCALAR = 0, /**< portable word at a time implementation */
+		KERNEL_LEVEL_SSE4_1, /**< 128 bit vectors, ptest to detect non-zero vectors */
+		KERNEL_LEVEL_AVX2 /**< 256 bit vectors */
+	};
+
+private:
+	uintptr_t *(*_findNonZeroSlot)(uintptr_t *slotCurrent, uintptr_t *slotTop);
+	void (*_fillSlots)(uintptr_t *slotBase, uintptr_t *slotTop, uintptr_t slotValue);
+	KernelLevel _kernelLevel; /**< implementation currently bound to the operations */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Bind the operations to the widest implementation supported by the processor.
+	 * @param forceScalar[in] if true, bind the portable implementation regardless of processor support
+	 */
+	void initialize(MM_EnvironmentBase *env, bool forceScalar);
+
+	/**
+	 * Bind the operations to the implementation for the given level.
+	 * @param portLibrary[in] used to query processor support
+	 * @param level[in] the implementation to bind
+	 * @return true if bound, false (leaving the current binding in place) if the processor does not support level
+	 */
+	bool bindKernelLevel(OMRPortLibrary *portLibrary, KernelLevel level);
+
+	MMINLINE KernelLevel getKernelLevel() { return _kernelLevel; }
+
+	/**
+	 * Find the first non-zero slot in [slotCurrent, slotTop).
+	 * @return address of the first non-zero slot, or slotTop if every slot in the range is zero
+	 */
+	MMINLINE uintptr_t *
+	findNonZeroSlot(uintptr_t *slotCurrent, uintptr_t *slotTop)
+	{
+		return _findNonZeroSlot(slotCurrent, slotTop);
+	}
+
+	/**
+	 * @return true if every slot in [slotBase, slotTop) is zero
+	 */
+	MMINLINE bool
+	isZero(uintptr_t *slotBase, uintptr_t *slotTop)
+	{
+		return slotTop == _findNonZeroSlot(slotBase, slotTop);
+	}
+
+	/**
+	 * Store slotValue into every slot in [slotBase, slotTop). Large ranges are written with
+	 * non-temporal stores, so callers must not rely on the range being cache resident afterwards.
+	 */
+	MMINLINE void
+	fillSlots(uintptr_t *slotBase, uintptr_t *slotTop, uintptr_t slotValue)
+	{
+		_fillSlots(slotBase, slotTop, slotValue);
+	}
+
+	MM_HeapMapKernels();
+};
+
+#endif /* HEAPMAPKERNELS_HPP_ */
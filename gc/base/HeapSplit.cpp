@@ -294,6 +294,30 @@ MM_HeapSplit::decommitMemory(void *address, uintptr_t size, void *lowValidAddres
 	return success;
 }
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+/**
+ * Decommit the address range from physical memory, leaving the OS free to reclaim it lazily.
+ * @return true if successful, false otherwise.
+ */
+bool
+MM_HeapSplit::decommitMemoryLazily(void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress)
+{
+	bool success = false;
+
+	if (_lowExtent->getHeapBase() == address) {
+		Assert_MM_true(_lowExtent->getMaximumPhysicalRange() == size);
+		success = _lowExtent->decommitMemoryLazily(address, size, lowValidAddress, highValidAddress);
+	} else if (_highExtent->getHeapBase() == address) {
+		Assert_MM_true(_highExtent->getMaximumPhysicalRange() == size);
+		success = _highExtent->decommitMemoryLazily(address, size, lowValidAddress, highValidAddress);
+	} else {
+		/* This is neither range so fail */
+		Assert_MM_true(false);
+	}
+	return success;
+}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 
 /**
  * Calculate the offset of an address from the base of the heap.
@@ -342,6 +342,20 @@ MM_HeapVirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowVal
 	return memoryManager->decommitMemory(&_vmemHandle, address, size, lowValidAddress, highValidAddress);
 }
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+/**
+ * Decommit the address range from physical memory, leaving the OS free to reclaim it lazily.
+ * @return true if successful, false otherwise.
+ */
+bool
+MM_HeapVirtualMemory::decommitMemoryLazily(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress)
+{
+	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
+	MM_MemoryManager* memoryManager = extensions->memoryManager;
+	return memoryManager->decommitMemoryLazily(&_vmemHandle, address, size, lowValidAddress, highValidAddress);
+}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 /**
  * Calculate the offset of an address from the base of the heap.
  * @param The address which require the offset for.
@@ -102,7 +102,8 @@ MM_MarkMap::initializeMarkMap(MM_EnvironmentBase *env)
 						- heapMapClearIndex;
 
 					/* And clear the mark map */
-					OMRZeroMemory((void *) (((uintptr_t)_heapMapBits) + heapMapClearIndex), heapMapClearSize);
+					uintptr_t *heapMapClearBase = (uintptr_t *)(((uintptr_t)_heapMapBits) + heapMapClearIndex);
+					_extensions->heapMapKernels.fillSlots(heapMapClearBase, (uintptr_t *)(((uintptr_t)heapMapClearBase) + heapMapClearSize), 0);
 				}
 
 				/* Move to the next address range in the segment */
@@ -96,6 +96,8 @@ MM_MarkingScheme::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	_prefetchDepth = OMR_MIN(_extensions->markingPrefetchDepth, MARKING_PREFETCH_DEPTH_MAX);
+
 	return _delegate.initialize(env, this);
 
 error_no_memory:
@@ -306,12 +308,88 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 #endif /* OMR_GC_LEAF_BITS */
 			fixupForwardedSlot(slotObject);
 
-			inlineMarkObjectNoCheck(env, slotObject->readReferenceFromSlot(), isLeafSlot);
+			omrobjectptr_t referent = slotObject->readReferenceFromSlot();
+			rememberCompactReference(objectPtr, referent);
+			inlineMarkObjectNoCheck(env, referent, isLeafSlot);
+		}
+	}
+	return sizeToDo;
+}
+
+/**
+ * Private internal. Called exclusively from completeScanWithPrefetch();
+ */
+uintptr_t
+MM_MarkingScheme::scanObjectWithPrefetch(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, PrefetchQueue *queue)
+{
+	uintptr_t sizeToDo = UDATA_MAX;
+	GC_ObjectScannerState objectScannerState;
+	GC_ObjectScanner *objectScanner = _delegate.getObjectScanner(env, objectPtr, &objectScannerState, SCAN_REASON_PACKET, &sizeToDo);
+	if (NULL != objectScanner) {
+		bool isLeafSlot = false;
+		GC_SlotObject *slotObject;
+#if defined(OMR_GC_LEAF_BITS)
+		while (NULL != (slotObject = objectScanner->getNextSlot(&isLeafSlot))) {
+#else /* OMR_GC_LEAF_BITS */
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+#endif /* OMR_GC_LEAF_BITS */
+			fixupForwardedSlot(slotObject);
+
+			omrobjectptr_t referent = slotObject->readReferenceFromSlot();
+			rememberCompactReference(objectPtr, referent);
+			queueMarkObject(env, queue, referent, isLeafSlot);
 		}
 	}
 	return sizeToDo;
 }
 
+void
+MM_MarkingScheme::drainPrefetchQueue(MM_EnvironmentBase *env, PrefetchQueue *queue)
+{
+	uintptr_t index = queue->_head;
+	for (uintptr_t i = 0; i < queue->_count; i++) {
+		inlineMarkObjectNoCheck(env, queue->_objects[index], queue->_leafTypes[index]);
+		index += 1;
+		if (index == _prefetchDepth) {
+			index = 0;
+		}
+	}
+	queue->_head = 0;
+	queue->_count = 0;
+}
+
+/**
+ * Scan until there are no more work packets to be processed, keeping up to _prefetchDepth referents queued
+ * so that their mark map words and headers are in cache by the time they are marked.
+ * The queue is carried from one object to the next and is only drained once the work stack has run dry, which
+ * must happen before blocking for more work: a thread waiting for work must not be holding any.
+ */
+void
+MM_MarkingScheme::completeScanWithPrefetch(MM_EnvironmentBase *env)
+{
+	PrefetchQueue queue;
+	queue._head = 0;
+	queue._count = 0;
+
+	do {
+		while (true) {
+			omrobjectptr_t objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env);
+			if (NULL == objectPtr) {
+				if (0 != queue._count) {
+					/* marking the queued referents may push more work */
+					drainPrefetchQueue(env, &queue);
+					continue;
+				}
+				objectPtr = (omrobjectptr_t)env->_workStack.pop(env);
+				if (NULL == objectPtr) {
+					break;
+				}
+			}
+			env->_markStats._bytesScanned += scanObjectWithPrefetch(env, objectPtr, &queue);
+			env->_markStats._objectsScanned += 1;
+		}
+	} while (_workPackets->handleWorkPacketOverflow(env));
+}
 
 /**
  * Scan until there are no more work packets to be processed.
@@ -321,6 +399,11 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 void
 MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 {
+	if (0 != _prefetchDepth) {
+		completeScanWithPrefetch(env);
+		return;
+	}
+
 	do {
 		omrobjectptr_t objectPtr = NULL;
 		while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
@@ -29,6 +29,9 @@
 
 #include "BaseVirtual.hpp"
 
+#if defined(OMR_GC_MODRON_COMPACTION)
+#include "CompactRememberedSet.hpp"
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "MarkingDelegate.hpp"
@@ -38,6 +41,9 @@
 #include "ObjectScannerState.hpp"
 #include "WorkStack.hpp"
 
+/* Maximum number of referents completeScan() may queue ahead of marking them (see -Xgc:markingPrefetchDepth=) */
+#define MARKING_PREFETCH_DEPTH_MAX 16
+
 /**
  * @todo Provide class documentation
  */
@@ -48,6 +54,18 @@ class MM_MarkingScheme : public MM_BaseVirtual
 	 */
 private:
 	OMR_VM *_omrVM;
+	uintptr_t _prefetchDepth; /**< Number of referents queued ahead of marking by completeScan(), 0 if prefetching is disabled */
+
+	/**
+	 * Referents found by completeScan() which are waiting to be marked. The mark map word and the header of each referent
+	 * are prefetched when it is queued, and it is marked once _prefetchDepth younger referents have been queued behind it.
+	 */
+	struct PrefetchQueue {
+		omrobjectptr_t _objects[MARKING_PREFETCH_DEPTH_MAX];
+		bool _leafTypes[MARKING_PREFETCH_DEPTH_MAX];
+		uintptr_t _head; /**< Index of the oldest queued referent */
+		uintptr_t _count; /**< Number of queued referents */
+	};
 
 protected:
 	MM_GCExtensionsBase *_extensions;
@@ -56,6 +74,9 @@ protected:
 	MM_WorkPackets *_workPackets;
 	void *_heapBase;
 	void *_heapTop;
+#if defined(OMR_GC_MODRON_COMPACTION)
+	MM_CompactRememberedSet *_compactRememberedSet; /**< Remembers the objects referring into the candidates of a partial compaction, NULL if they are not being remembered */
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
 public:
 
@@ -76,6 +97,57 @@ private:
 	 */
 	MMINLINE uintptr_t scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
 
+	/**
+	 * Private internal. Called exclusively from completeScanWithPrefetch(), queues the referents instead of marking them.
+	 */
+	MMINLINE uintptr_t scanObjectWithPrefetch(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, PrefetchQueue *queue);
+
+	/**
+	 * Version of completeScan() used when -Xgc:markingPrefetchDepth= is set.
+	 */
+	void completeScanWithPrefetch(MM_EnvironmentBase *env);
+
+	/**
+	 * Mark every referent still queued, oldest first, and leave the queue empty.
+	 */
+	void drainPrefetchQueue(MM_EnvironmentBase *env, PrefetchQueue *queue);
+
+	/**
+	 * Issue prefetches for the mark map word of an object, which is about to be updated,
+	 * and for its header, which is read when the object is scanned.
+	 */
+	MMINLINE void
+	prefetchForMark(omrobjectptr_t objectPtr)
+	{
+#if defined(__GNUC__)
+		__builtin_prefetch(_markMap->getSlotPtrForAddress(objectPtr), 1);
+		__builtin_prefetch(objectPtr, 0);
+#endif /* defined(__GNUC__) */
+	}
+
+	/**
+	 * Queue a referent to be marked. If the queue is full the oldest referent is marked to make room.
+	 */
+	MMINLINE void
+	queueMarkObject(MM_EnvironmentBase *env, PrefetchQueue *queue, omrobjectptr_t objectPtr, bool leafType)
+	{
+		prefetchForMark(objectPtr);
+
+		if (queue->_count < _prefetchDepth) {
+			/* the queue is only ever partially filled after being drained, so _head is 0 */
+			queue->_objects[queue->_count] = objectPtr;
+			queue->_leafTypes[queue->_count] = leafType;
+			queue->_count += 1;
+		} else {
+			uintptr_t oldest = queue->_head;
+			inlineMarkObjectNoCheck(env, queue->_objects[oldest], queue->_leafTypes[oldest]);
+			queue->_objects[oldest] = objectPtr;
+			queue->_leafTypes[oldest] = leafType;
+			oldest += 1;
+			queue->_head = (oldest == _prefetchDepth) ? 0 : oldest;
+		}
+	}
+
 	MM_WorkPackets *createWorkPackets(MM_EnvironmentBase *env);
 
 protected:
@@ -244,7 +316,9 @@ public:
 				fixupForwardedSlot(slotObject);
 
 				/* with concurrentMark mutator may NULL the slot so must fetch and check here */
-				inlineMarkObject(env, slotObject->readReferenceFromSlot(), isLeafSlot);
+				omrobjectptr_t referent = slotObject->readReferenceFromSlot();
+				rememberCompactReference(objectPtr, referent);
+				inlineMarkObject(env, referent, isLeafSlot);
 			}
 		}
 
@@ -259,6 +333,34 @@ public:
 		return sizeToDo;
 	}
 
+	/**
+	 * Report a reference scanned while marking, so that the object holding it is remembered if the reference
+	 * points into the candidates of a partial compaction. Delegates which mark through reference slots
+	 * without scanObject(), or leave slots unscanned which are not cleared, must report those slots here.
+	 *
+	 * @param[in] objectPtr the object holding the reference
+	 * @param[in] referent the object referred to, may be NULL
+	 */
+	MMINLINE void
+	rememberCompactReference(omrobjectptr_t objectPtr, omrobjectptr_t referent)
+	{
+#if defined(OMR_GC_MODRON_COMPACTION)
+		if (NULL != _compactRememberedSet) {
+			_compactRememberedSet->rememberReference(objectPtr, referent);
+		}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+	}
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/**
+	 * Start or stop remembering the objects referring into the candidates of a partial compaction.
+	 * Must only be called between marks.
+	 *
+	 * @param[in] compactRememberedSet where to remember the objects, or NULL to stop remembering them
+	 */
+	void setCompactRememberedSet(MM_CompactRememberedSet *compactRememberedSet) { _compactRememberedSet = compactRememberedSet; }
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+
 	MM_MarkingDelegate *getMarkingDelegate() { return &_delegate; }
 
 	MM_MarkMap *getMarkMap() { return _markMap; }
@@ -303,12 +405,16 @@ public:
 	MM_MarkingScheme(MM_EnvironmentBase *env)
 		: MM_BaseVirtual()
 		, _omrVM(env->getOmrVM())
+		, _prefetchDepth(0)
 		, _extensions(env->getExtensions())
 		, _delegate()
 		, _markMap(NULL)
 		, _workPackets(NULL)
 		, _heapBase(NULL)
 		, _heapTop(NULL)
+#if defined(OMR_GC_MODRON_COMPACTION)
+		, _compactRememberedSet(NULL)
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -605,6 +605,17 @@ MM_MemoryManager::decommitMemory(MM_MemoryHandle* handle, void* address, uintptr
 	return memory->decommitMemory(address, size, lowValidAddress, highValidAddress);
 }
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+bool
+MM_MemoryManager::decommitMemoryLazily(MM_MemoryHandle* handle, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress)
+{
+	Assert_MM_true(NULL != handle);
+	MM_VirtualMemory* memory = handle->getVirtualMemory();
+	Assert_MM_true(NULL != memory);
+	return memory->decommitMemoryLazily(address, size, lowValidAddress, highValidAddress);
+}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 bool
 MM_MemoryManager::isLargePage(MM_EnvironmentBase* env, uintptr_t pageSize)
 {
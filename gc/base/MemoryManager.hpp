@@ -234,6 +234,21 @@ public:
 	 */
 	bool decommitMemory(MM_MemoryHandle* handle, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	/**
+	 * Decommit memory for range for specified virtual memory instance, allowing the OS to reclaim
+	 * the pages only once it is short of memory (see OMRPORT_VMEM_MEMORY_MODE_DECOMMIT_LAZILY)
+	 *
+	 * @param pointer to memory handle
+	 * @param address start address of memory should be decommited
+	 * @param size size of memory should be decommited
+	 * @param lowValidAddress
+	 * @param highValidAddress
+	 * @return true if succeed
+	 */
+	bool decommitMemoryLazily(MM_MemoryHandle* handle, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 #if defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER)
 	/*
 	 * Set the NUMA affinity for the specified range within the receiver.
@@ -519,4 +519,11 @@ MM_MemoryPool::releaseFreeMemoryPages(MM_EnvironmentBase* env)
         Assert_MM_unreachable();
 	return 0;
 }
+
+void
+MM_MemoryPool::releaseQueuedFreePages(MM_EnvironmentBase* env, MM_FreePageRange *ranges, uintptr_t count, MM_FreePageReleaseStats *stats)
+{
+	/* Only pools which queue ranges from releaseFreeMemoryPages() are asked to release them */
+	Assert_MM_unreachable();
+}
 #endif
@@ -37,6 +37,8 @@
 
 class MM_HeapLinkedFreeHeader;
 class MM_AllocateDescription;
+struct MM_FreePageRange;
+struct MM_FreePageReleaseStats;
 class MM_HeapRegionDescriptor;
 class MM_LargeObjectAllocateStats;
 class MM_SweepPoolManager;
@@ -423,6 +425,14 @@ public:
 	 * @return bytes of free memory in the pool released/decommited back to OS
 	 */
 	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+
+	/**
+	 * Release the parts of ranges queued by releaseFreeMemoryPages() that are still free back to the OS.
+	 * @param ranges ranges queued by this pool, sorted by address and disjoint
+	 * @param count number of ranges
+	 * @param stats counters updated with the bytes released and the decommit calls made
+	 */
+	virtual void releaseQueuedFreePages(MM_EnvironmentBase* env, MM_FreePageRange *ranges, uintptr_t count, MM_FreePageReleaseStats *stats);
 #endif
 	/**
 	 * Create a MemoryPool object.
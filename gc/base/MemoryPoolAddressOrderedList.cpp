@@ -428,10 +428,12 @@ MM_MemoryPoolAddressOrderedList::internalAllocate(MM_EnvironmentBase *env, uintp
 	J9ModronAllocateHint *allocateHintUsed;
 	void *addrBase;
 	uintptr_t largestFreeEntry = 0;
+	bool indexed = false;
 	
 	if (lockingRequired) {
 		_heapLock.acquire();
 	}
+	indexed = useFreeEntryIndex();
 
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 retry:
@@ -443,43 +445,55 @@ retry:
 	allocateHintUsed = NULL;
 	candidateHintSize = 0;
 
-	/* Large object - use a hint if it is available */
-	allocateHintUsed = findHint(sizeInBytesRequired);
-	if(allocateHintUsed) {
-		currentFreeEntry = allocateHintUsed->heapFreeHeader;
-		candidateHintSize = allocateHintUsed->size;
-	}
+	if (indexed) {
+		/* Find a fit through the size index; the list predecessor is recorded in the entry itself */
+		MM_LargeObjectAllocateStats::FreeEntryIndexLookup lookup;
+		currentFreeEntry = _freeEntryIndex.findFit(sizeInBytesRequired, lookup);
+		_largeObjectAllocateStats->incrementFreeEntryIndexLookups(lookup);
+		if (NULL == currentFreeEntry) {
+			largestFreeEntry = _freeEntryIndex.getLargestEntrySize();
+		} else {
+			previousFreeEntry = _freeEntryIndex.getListPrevious(currentFreeEntry);
+		}
+	} else {
+		/* Large object - use a hint if it is available */
+		allocateHintUsed = findHint(sizeInBytesRequired);
+		if(allocateHintUsed) {
+			currentFreeEntry = allocateHintUsed->heapFreeHeader;
+			candidateHintSize = allocateHintUsed->size;
+		}
 
 
-	while(currentFreeEntry) {
-		if (doesNeedAlignment(env, currentFreeEntry)) {
-			currentFreeEntry = doFreeEntryAlignmentUpTo(env, currentFreeEntry);
-			if (NULL == currentFreeEntry) {
-				currentFreeEntry = (FREE_ENTRY_END == _firstUnalignedFreeEntry) ? NULL : _firstUnalignedFreeEntry;
-				previousFreeEntry = (FREE_ENTRY_END == _prevFirstUnalignedFreeEntry) ? NULL : _prevFirstUnalignedFreeEntry;
-				walkCount += 1;
-				continue;
+		while(currentFreeEntry) {
+			if (doesNeedAlignment(env, currentFreeEntry)) {
+				currentFreeEntry = doFreeEntryAlignmentUpTo(env, currentFreeEntry);
+				if (NULL == currentFreeEntry) {
+					currentFreeEntry = (FREE_ENTRY_END == _firstUnalignedFreeEntry) ? NULL : _firstUnalignedFreeEntry;
+					previousFreeEntry = (FREE_ENTRY_END == _prevFirstUnalignedFreeEntry) ? NULL : _prevFirstUnalignedFreeEntry;
+					walkCount += 1;
+					continue;
+				}
+			}
+			uintptr_t currentFreeEntrySize = currentFreeEntry->getSize();
+			/* while we are walking, keep track of the largest free entry.  We will need this in the case of allocation failure to update the pool's largest free */
+			if (currentFreeEntrySize > largestFreeEntry) {
+				largestFreeEntry = currentFreeEntrySize;
+			}
+			
+			if(sizeInBytesRequired <= currentFreeEntrySize) {
+				break;
 			}
-		}
-		uintptr_t currentFreeEntrySize = currentFreeEntry->getSize();
-		/* while we are walking, keep track of the largest free entry.  We will need this in the case of allocation failure to update the pool's largest free */
-		if (currentFreeEntrySize > largestFreeEntry) {
-			largestFreeEntry = currentFreeEntrySize;
-		}
-		
-		if(sizeInBytesRequired <= currentFreeEntrySize) {
-			break;
-		}
 
-		if(candidateHintSize < currentFreeEntrySize) {
-			candidateHintSize = currentFreeEntrySize;
-		}
+			if(candidateHintSize < currentFreeEntrySize) {
+				candidateHintSize = currentFreeEntrySize;
+			}
 
-		walkCount += 1;
+			walkCount += 1;
 
-		previousFreeEntry = currentFreeEntry;
-		currentFreeEntry = currentFreeEntry->getNext(compressed);
-		Assert_MM_true((NULL == currentFreeEntry) || (currentFreeEntry > previousFreeEntry));
+			previousFreeEntry = currentFreeEntry;
+			currentFreeEntry = currentFreeEntry->getNext(compressed);
+			Assert_MM_true((NULL == currentFreeEntry) || (currentFreeEntry > previousFreeEntry));
+		}
 	}
 
 	/* Check if an entry was found */
@@ -493,6 +507,9 @@ retry:
 	}
 
 	_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(currentFreeEntry->getSize());
+	if (indexed) {
+		_freeEntryIndex.remove(currentFreeEntry);
+	}
 	if((walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK) || ((walkCount > 1) && allocateHintUsed)) {
 		addHint(previousFreeEntry, candidateHintSize);
 	}
@@ -517,6 +534,9 @@ retry:
 		}
 		updateHint(currentFreeEntry, recycleEntry);
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
+		if (indexed) {
+			_freeEntryIndex.insert(recycleEntry, previousFreeEntry, recycleEntry->getNext(compressed));
+		}
 	} else {
 		if (currentFreeEntry->getNext(compressed) == _firstUnalignedFreeEntry) {
 			_prevFirstUnalignedFreeEntry = previousFreeEntry;
@@ -530,6 +550,9 @@ retry:
 
 		/* Removed from the free list - Kill the hint if necessary */
 		removeHint(currentFreeEntry);
+		if (indexed) {
+			_freeEntryIndex.setListPrevious((NULL == previousFreeEntry) ? _heapFreeList : previousFreeEntry->getNext(compressed), previousFreeEntry);
+		}
 	}
 	
 	/* Collector object allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStats is null for Survivor) */	
@@ -597,10 +620,13 @@ MM_MemoryPoolAddressOrderedList::internalAllocateTLH(MM_EnvironmentBase *env, ui
 	MM_HeapLinkedFreeHeader *freeEntry = NULL;
 	uintptr_t consumedSize = 0;
 	uintptr_t recycleEntrySize = 0;
+	bool indexed = false;
 	
 	if (lockingRequired) {
 		_heapLock.acquire();
 	}
+	/* TLHs are always carved from the head of the list, but the index must follow the change */
+	indexed = useFreeEntryIndex();
 
 retry:
 	freeEntry = _heapFreeList;
@@ -633,6 +659,9 @@ retry:
 	Assert_MM_true(freeEntrySize >= _minimumFreeEntrySize);
 	consumedSize = (maximumSizeInBytesRequired > freeEntrySize) ? freeEntrySize : maximumSizeInBytesRequired;
 	_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(freeEntrySize);
+	if (indexed) {
+		_freeEntryIndex.remove(freeEntry);
+	}
 
 	/* If the leftover chunk is smaller than the minimum size, hand it out */
 	recycleEntrySize = freeEntrySize - consumedSize;
@@ -663,6 +692,9 @@ retry:
 				_prevFirstUnalignedFreeEntry = (MM_HeapLinkedFreeHeader *)addrTop;
 			}
 			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
+			if (indexed) {
+				_freeEntryIndex.insert((MM_HeapLinkedFreeHeader *)addrTop, NULL, entryNext);
+			}
 		} else {
 			if (entryNext == _firstUnalignedFreeEntry) {
 				_prevFirstUnalignedFreeEntry = FREE_ENTRY_END;
@@ -672,6 +704,9 @@ retry:
 			_freeEntryCount -= 1;
 
 			_allocDiscardedBytes += recycleEntrySize;
+			if (indexed) {
+				_freeEntryIndex.setListPrevious(entryNext, NULL);
+			}
 		}
 	} else {
 		if (entryNext == _firstUnalignedFreeEntry) {
@@ -681,6 +716,9 @@ retry:
 		_heapFreeList = entryNext;
 		/* also update the freeEntryCount as recycleHeapChunk would do this */
 		_freeEntryCount -= 1;
+		if (indexed) {
+			_freeEntryIndex.setListPrevious(entryNext, NULL);
+		}
 	}
 
 	if (lockingRequired) {
@@ -751,6 +789,7 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 
 	clearHints();
 	_heapFreeList = (MM_HeapLinkedFreeHeader *)NULL;
+	_freeEntryIndex.invalidate();
 	_scannableBytes = 0;
 	_nonScannableBytes = 0;
 	_firstUnalignedFreeEntry = FREE_ENTRY_END;
@@ -763,6 +802,31 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 	resetLargeObjectAllocateStats();
 }
 
+/**
+ * Build the free entry index once sweep or compact has rebuilt the free list.
+ * The index is only kept for tenure pools: nursery pools are rebuilt as a single entry on every scavenge and
+ * never walk far. Concurrent sweep replenishes the free list behind the allocator's back, so it disables the index.
+ */
+void
+MM_MemoryPoolAddressOrderedList::postProcess(MM_EnvironmentBase *env, Cause cause)
+{
+	if (!_freeEntryIndexEnabled
+		&& _extensions->indexedFreeList
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+		&& !_extensions->concurrentSweep
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+		&& (MEMORY_TYPE_NEW != (_memorySubSpace->getTypeFlags() & MEMORY_TYPE_NEW))
+	) {
+		_freeEntryIndexEnabled = _freeEntryIndex.initialize(env, _minimumFreeEntrySize);
+	}
+
+	if (_freeEntryIndexEnabled) {
+		/* hints are not consulted while the index is in use */
+		clearHints();
+		_freeEntryIndex.build(_heapFreeList, compressObjectReferences());
+	}
+}
+
 /**
  * As opposed to reset, which will empty out, this will fill out as if everything is free.
  * Returns the freelist entry created at the end of the given region
@@ -845,6 +909,8 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 		return ;
 	}
 
+	_freeEntryIndex.invalidate();
+
 	/* Handle the entries that are too small to make the free list */
 	if(expandSize < _minimumFreeEntrySize) {
 		abandonHeapChunk(lowAddress, highAddress);
@@ -957,6 +1023,8 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 		return NULL;
 	}
 
+	_freeEntryIndex.invalidate();
+
 	/* Find the free entry that encompasses the range to contract */
 	/* TODO: Could we use hints to find a better starting address?  Are hints still valid? */
 	previousFreeEntry = NULL;
@@ -1043,6 +1111,8 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 	bool const compressed = compressObjectReferences();
 	uintptr_t localFreeListMemoryCount = freeListMemoryCount;
 
+	_freeEntryIndex.invalidate();
+
 	MM_HeapLinkedFreeHeader *currentFreeEntry = freeListHead;
 
 	while (currentFreeEntry != NULL) {
@@ -1140,6 +1210,7 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 
 	retListHead = NULL;
 	retListTail = NULL;
+	_freeEntryIndex.invalidate();
 	retListMemoryCount = 0;
 	retListMemorySize = 0;
 
@@ -1515,6 +1586,7 @@ MM_MemoryPoolAddressOrderedList::moveHeap(MM_EnvironmentBase *env, void *srcBase
 	bool const compressed = compressObjectReferences();
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry;
 
+	_freeEntryIndex.invalidate();
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
@@ -1567,6 +1639,7 @@ MM_MemoryPoolAddressOrderedList::recycleHeapChunk(MM_EnvironmentBase *env, void
 	void *top = chunkTop;
 	intptr_t freeEntryCount = 1;
 	_heapLock.acquire();
+	_freeEntryIndex.invalidate();
 
 	MM_HeapLinkedFreeHeader  *currentFreeEntry = _heapFreeList;
 	MM_HeapLinkedFreeHeader  *nextFreeEntry = NULL;
@@ -1772,10 +1845,22 @@ MM_MemoryPoolAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase* env)
 {
 	uintptr_t releasedBytes = 0;
 	_heapLock.acquire();
+	/* decommitted pages may hold free entry index links */
+	_freeEntryIndex.invalidate();
 	releasedBytes = releaseFreeEntryMemoryPages(env, _heapFreeList);
 	_heapLock.release();
 	return releasedBytes;
 }
+
+void
+MM_MemoryPoolAddressOrderedList::releaseQueuedFreePages(MM_EnvironmentBase* env, MM_FreePageRange *ranges, uintptr_t count, MM_FreePageReleaseStats *stats)
+{
+	_heapLock.acquire();
+	/* decommitted pages may hold free entry index links */
+	_freeEntryIndex.invalidate();
+	releaseQueuedFreeEntryMemoryPages(env, _heapFreeList, ranges, count, stats);
+	_heapLock.release();
+}
 #endif
 
 MM_HeapLinkedFreeHeader *
@@ -1787,6 +1872,7 @@ MM_MemoryPoolAddressOrderedList::doFreeEntryAlignmentUpTo(MM_EnvironmentBase *en
 	MM_HeapLinkedFreeHeader *previousFreeEntry = (FREE_ENTRY_END == _prevFirstUnalignedFreeEntry) ? NULL : _prevFirstUnalignedFreeEntry;
 
 	uintptr_t lostToAlignment = 0;
+	_freeEntryIndex.invalidate();
 
 	uintptr_t freeBytes = _freeMemorySize;
 	uintptr_t freeEntryCount = _freeEntryCount;
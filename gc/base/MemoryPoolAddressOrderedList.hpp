@@ -33,6 +33,7 @@
 #include "HeapRegionDescriptor.hpp"
 #include "EnvironmentBase.hpp"
 #include "AtomicOperations.hpp"
+#include "FreeEntryIndex.hpp"
 
 class MM_AllocateDescription;
 #if defined(OMR_GC_CONCURRENT_SWEEP)
@@ -65,6 +66,9 @@ private:
 
 	MM_HeapLinkedFreeHeader *_firstUnalignedFreeEntry; /**< it is only for Balanced GC copyforward and non empty survivor region */
 	MM_HeapLinkedFreeHeader *_prevFirstUnalignedFreeEntry;
+
+	MM_FreeEntryIndex _freeEntryIndex; /**< size index over _heapFreeList, used by internalAllocate() when _freeEntryIndexEnabled */
+	bool _freeEntryIndexEnabled; /**< set by postProcess() once a sweep or compact has built the index for this pool */
 protected:
 public:
 	
@@ -98,6 +102,22 @@ private:
 	 */
 	MM_HeapLinkedFreeHeader *doFreeEntryAlignmentUpTo(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *lastFreeEntryToAlign);
 
+	/**
+	 * Determine whether allocation should search the free entry index rather than walk the free list.
+	 * An index invalidated by a free list change it does not track is rebuilt here, under the heap lock.
+	 * @return true if the index is enabled for this pool (and is now valid)
+	 */
+	MMINLINE bool useFreeEntryIndex()
+	{
+		if (!_freeEntryIndexEnabled) {
+			return false;
+		}
+		if (!_freeEntryIndex.isValid()) {
+			_freeEntryIndex.build(_heapFreeList, compressObjectReferences());
+		}
+		return true;
+	}
+
 protected:
 public:
 	static MM_MemoryPoolAddressOrderedList *newInstance(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize); 
@@ -115,6 +135,7 @@ public:
 	virtual void tearDown(MM_EnvironmentBase *env);
 
 	virtual void reset(Cause cause = any);
+	virtual void postProcess(MM_EnvironmentBase *env, Cause cause);
 	virtual MM_HeapLinkedFreeHeader *rebuildFreeListInRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, MM_HeapLinkedFreeHeader *previousFreeEntry);
 
 #if defined(DEBUG)
@@ -169,6 +190,7 @@ public:
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+	virtual void releaseQueuedFreePages(MM_EnvironmentBase* env, MM_FreePageRange *ranges, uintptr_t count, MM_FreePageReleaseStats *stats);
 #endif
 
 	/**
@@ -179,6 +201,7 @@ public:
 		bool const compressed = compressObjectReferences();
 		uintptr_t freeEntrySize = ((uintptr_t)addrTop) - ((uintptr_t)addrBase);
 		MM_HeapLinkedFreeHeader::fillWithHoles(addrBase, freeEntrySize, compressed);
+		_freeEntryIndex.invalidate();
 		if (previousFreeEntry) {
 			previousFreeEntry->setNext(nextFreeEntry, compressed);
 		}else {
@@ -237,6 +260,8 @@ public:
 		,_largeObjectCollectorAllocateStats(NULL)
 		,_firstUnalignedFreeEntry(FREE_ENTRY_END)
 		,_prevFirstUnalignedFreeEntry(FREE_ENTRY_END)
+		,_freeEntryIndex()
+		,_freeEntryIndexEnabled(false)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -247,6 +272,8 @@ public:
 		,_largeObjectCollectorAllocateStats(NULL)
 		,_firstUnalignedFreeEntry(FREE_ENTRY_END)
 		,_prevFirstUnalignedFreeEntry(FREE_ENTRY_END)
+		,_freeEntryIndex()
+		,_freeEntryIndexEnabled(false)
 	{
 		_typeId = __FUNCTION__;
 	};
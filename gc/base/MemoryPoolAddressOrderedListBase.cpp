@@ -32,6 +32,7 @@
 #include "AllocateDescription.hpp"
 #include "Debug.hpp"
 #include "EnvironmentBase.hpp"
+#include "FreePageReleaser.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Collector.hpp"
 #include "MemoryPool.hpp"
@@ -211,7 +212,16 @@ MM_MemoryPoolAddressOrderedListBase::releaseFreeEntryMemoryPages(MM_EnvironmentB
 				addressBase += commitPagesCount * pageSize;
 				/* now decommit pages of memory */
 				if (0 < decommitPagesCount) {
-					if (_extensions->heap->decommitMemory((void*)addressBase, decommitPagesCount * pageSize, NULL, currentFreeEntry->afterEnd())) {
+					MM_FreePageReleaser *releaser = _extensions->freePageReleaser;
+					void *addressTop = (void *)(addressBase + decommitPagesCount * pageSize);
+					if (NULL == releaser) {
+						if (_extensions->heap->decommitMemory((void*)addressBase, decommitPagesCount * pageSize, NULL, currentFreeEntry->afterEnd())) {
+							releasedMemory += decommitPagesCount * pageSize;
+						}
+					} else if (releaser->queueRange(env, this, (void*)addressBase, addressTop)) {
+						/* the background releaser decommits whatever is still free when it gets to the range */
+					} else if (_extensions->heap->decommitMemoryLazily((void*)addressBase, decommitPagesCount * pageSize, NULL, currentFreeEntry->afterEnd())) {
+						/* the range could not be queued, but it is still only needed once the OS is short of memory */
 						releasedMemory += decommitPagesCount * pageSize;
 					}
 				}
@@ -221,4 +231,51 @@ MM_MemoryPoolAddressOrderedListBase::releaseFreeEntryMemoryPages(MM_EnvironmentB
 	}
 	return releasedMemory;
 }
+
+void
+MM_MemoryPoolAddressOrderedListBase::releaseQueuedFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry, MM_FreePageRange *ranges, uintptr_t count, MM_FreePageReleaseStats *stats)
+{
+	bool const compressed = compressObjectReferences();
+	uintptr_t pageSize = _extensions->heap->getPageSize();
+	/* prefer not to split transparent huge pages, unless a range is too small to hold one */
+	uintptr_t alignment = MM_Math::roundToCeiling(pageSize, OMR_MAX(_extensions->freePageReleaseAlignment, pageSize));
+	MM_HeapLinkedFreeHeader* currentFreeEntry = freeEntry;
+	uintptr_t rangeIndex = 0;
+
+	/* both the free list and the ranges are address ordered, so walk them together */
+	while ((NULL != currentFreeEntry) && (rangeIndex < count)) {
+		/* the pages after the header of the entry are the only ones that can be released */
+		uintptr_t entryBase = MM_Math::roundToCeiling(pageSize, (uintptr_t)currentFreeEntry + sizeof(MM_HeapLinkedFreeHeader));
+		uintptr_t entryTop = MM_Math::roundToFloor(pageSize, (uintptr_t)currentFreeEntry->afterEnd());
+		uintptr_t rangeBase = (uintptr_t)ranges[rangeIndex].base;
+		uintptr_t rangeTop = (uintptr_t)ranges[rangeIndex].top;
+
+		if ((entryTop <= entryBase) || (entryTop <= rangeBase)) {
+			currentFreeEntry = currentFreeEntry->getNext(compressed);
+		} else if (rangeTop <= entryBase) {
+			/* nothing left of the range is free in this list */
+			rangeIndex += 1;
+		} else {
+			/* whatever part of the range was reallocated since it was queued is not released */
+			uintptr_t base = OMR_MAX(entryBase, rangeBase);
+			uintptr_t top = OMR_MIN(entryTop, rangeTop);
+			uintptr_t alignedBase = MM_Math::roundToCeiling(alignment, base);
+			uintptr_t alignedTop = MM_Math::roundToFloor(alignment, top);
+			if (alignedBase < alignedTop) {
+				base = alignedBase;
+				top = alignedTop;
+			}
+			stats->_decommitCount += 1;
+			if (_extensions->heap->decommitMemoryLazily((void*)base, top - base, NULL, currentFreeEntry->afterEnd())) {
+				stats->_releasedBytes += top - base;
+			}
+
+			if (rangeTop <= entryTop) {
+				rangeIndex += 1;
+			} else {
+				currentFreeEntry = currentFreeEntry->getNext(compressed);
+			}
+		}
+	}
+}
 #endif
@@ -234,6 +234,12 @@ public:
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	uintptr_t releaseFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry);
+
+	/**
+	 * Decommit the parts of the queued ranges that are still covered by entries of the free list.
+	 * @note The caller holds the lock of the free list.
+	 */
+	void releaseQueuedFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry, MM_FreePageRange *ranges, uintptr_t count, MM_FreePageReleaseStats *stats);
 #endif
 	/**
 	 * Create a MemoryPoolAddressOrderedList object.
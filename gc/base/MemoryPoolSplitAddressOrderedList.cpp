@@ -1311,4 +1311,16 @@ MM_MemoryPoolSplitAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase*
 
 	return releasedMemory;
 }
+
+void
+MM_MemoryPoolSplitAddressOrderedList::releaseQueuedFreePages(MM_EnvironmentBase* env, MM_FreePageRange *ranges, uintptr_t count, MM_FreePageReleaseStats *stats)
+{
+	/* a range may have been queued from any of the lists (and the entry may have moved to another list since) */
+	for (uintptr_t i = 0; i < _heapFreeListCountExtended; i++) {
+		_heapFreeLists[i]._lock.acquire();
+		_heapFreeLists[i]._timesLocked += 1;
+		releaseQueuedFreeEntryMemoryPages(env, _heapFreeLists[i]._freeList, ranges, count, stats);
+		_heapFreeLists[i]._lock.release();
+	}
+}
 #endif
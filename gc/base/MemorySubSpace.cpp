@@ -32,6 +32,7 @@
 #include "AllocateDescription.hpp"
 #include "EnvironmentBase.hpp"
 #include "Forge.hpp"
+#include "FreePageReleaser.hpp"
 #include "GCCode.hpp"
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
@@ -941,6 +942,10 @@ MM_MemorySubSpace::systemGarbageCollect(MM_EnvironmentBase* env, uint32_t gcCode
 			OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 			uint64_t startTime = omrtime_hires_clock();
 			uintptr_t releasedBytes = _extensions->heap->getDefaultMemorySpace()->releaseFreeMemoryPages(env);
+			if (NULL != _extensions->freePageReleaser) {
+				/* only the ranges that did not fit the queue have been released here */
+				_extensions->freePageReleaser->releaseQueuedRanges(env);
+			}
 			uint64_t endTime = omrtime_hires_clock();
 			TRIGGER_J9HOOK_MM_PRIVATE_HEAP_RESIZE(
 				_extensions->privateHookInterface,
@@ -421,6 +421,7 @@ MM_MemorySubSpaceSemiSpace::initialize(MM_EnvironmentBase *env)
 	_previousBytesFlipped = getMinimumSize() / 2;
 	_tiltedAverageBytesFlipped = _previousBytesFlipped;
 	_tiltedAverageBytesFlippedDelta = _previousBytesFlipped;
+	_pauseGoalController.initialize((uint64_t)_extensions->scavengerPauseGoal * 1000, getMinimumSize(), getMaximumSize(), _extensions->heapAlignment);
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	/* we are clueless about initial allocation rate and its deviation, but small non-zero values
 	 * are still better than 0 values, to help with faster learning of real values.
@@ -836,7 +837,9 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 	uintptr_t regionSize = extensions->getHeap()->getHeapRegionManager()->getRegionSize();
 	MM_Scavenger *scavenger = (MM_Scavenger *)_collector;
 
-	if (extensions->dynamicNewSpaceSizing) {
+	if (_pauseGoalController.isEnabled()) {
+		checkSubSpaceMemoryPostCollectPauseGoal(env);
+	} else if (extensions->dynamicNewSpaceSizing) {
 		bool doDynamicNewSpaceSizing = true;
 		bool debug = extensions->debugDynamicNewSpaceSizing;
 		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
@@ -1020,6 +1023,67 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 	}
 }
 
+/**
+ * Size new space so that the next scavenge is predicted to stay within the pause goal.
+ * The scavenger picks up the tenure age recommended alongside.
+ */
+void
+MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectPauseGoal(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	uintptr_t regionSize = extensions->getHeap()->getHeapRegionManager()->getRegionSize();
+	MM_Scavenger *scavenger = (MM_Scavenger *)_collector;
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (scavenger->_cycleTimes.cycleEnd == _lastGCEndTime) {
+		/* already accounted for, this is a resize check after a global collect */
+		return;
+	}
+	_lastGCEndTime = scavenger->_cycleTimes.cycleEnd;
+
+	MM_ScavengerPauseGoalController::Sample sample;
+	sample.pauseTime = 0;
+	/* the wall clock might be shifted backwards externally, the controller ignores a zero pause */
+	if (scavenger->_cycleTimes.cycleEnd > scavenger->_cycleTimes.cycleStart) {
+		sample.pauseTime = omrtime_hires_delta(scavenger->_cycleTimes.cycleStart, scavenger->_cycleTimes.cycleEnd, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	}
+	sample.nurserySize = getCurrentSize();
+	sample.flipBytes = extensions->scavengerStats._flipBytes;
+	sample.tenureBytes = extensions->scavengerStats._tenureAggregateBytes;
+	sample.tenureAge = extensions->scvTenureAdaptiveTenureAge;
+	_pauseGoalController.update(&sample);
+
+	uintptr_t currentSize = getCurrentSize();
+	uintptr_t desiredSize = _pauseGoalController.getRecommendedNurserySize();
+
+	Trc_MM_MemorySubSpaceSemiSpace_pauseGoal(env->getLanguageVMThread(), sample.pauseTime, sample.nurserySize, sample.flipBytes, sample.tenureBytes, sample.tenureAge,
+		_pauseGoalController.predictPauseTime(desiredSize), desiredSize, _pauseGoalController.getRecommendedTenureAge());
+
+	if (extensions->debugDynamicNewSpaceSizing) {
+		omrtty_printf("New space pause goal check: pause %llu us goal %llu us, copy rate %lf bytes/us survival rate %lf, size %zu -> %zu\n",
+			sample.pauseTime, _pauseGoalController.getPauseGoal(), _pauseGoalController.getCopyRate(), _pauseGoalController.getSurvivalRate(), currentSize, desiredSize);
+	}
+
+	if (0 == desiredSize) {
+		/* no measurement yet */
+	} else if (desiredSize > currentSize) {
+		if ((NULL != _physicalSubArena) && _physicalSubArena->canExpand(env) && (0 != maxExpansionInSpace(env))) {
+			_expansionSize = MM_Math::roundToCeiling(extensions->heapAlignment, desiredSize - currentSize);
+			_expansionSize = MM_Math::roundToCeiling(2 * regionSize, _expansionSize);
+
+			/* Adjust within -XsoftMx limit */
+			_expansionSize = adjustExpansionWithinSoftMax(env, _expansionSize, 0, MEMORY_TYPE_NEW);
+			extensions->heap->getResizeStats()->setLastExpandReason(SCAV_PAUSE_BELOW_GOAL);
+		}
+	} else if (desiredSize < currentSize) {
+		if ((NULL != _physicalSubArena) && _physicalSubArena->canContract(env) && (0 != maxContractionInSpace(env))) {
+			_contractionSize = MM_Math::roundToCeiling(extensions->heapAlignment, currentSize - desiredSize);
+			_contractionSize = MM_Math::roundToCeiling(regionSize, _contractionSize);
+			extensions->heap->getResizeStats()->setLastContractReason(SCAV_PAUSE_ABOVE_GOAL);
+		}
+	}
+}
+
 /**
  * Adjust the sub space memory consumed after a collect.
  * Adjusting semi space memory consumed after a collect includes changing the tilt and/or
@@ -30,6 +30,7 @@
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
 #include "MemorySubSpace.hpp"
+#include "ScavengerPauseGoalController.hpp"
 
 class MM_AllocateDescription;
 class MM_EnvironmentBase;
@@ -78,6 +79,7 @@ private:
 	uint64_t _lastGCEndTime;
 
 	double _desiredSurvivorSpaceRatio;
+	MM_ScavengerPauseGoalController _pauseGoalController; /**< Sizes new space for -Xgc:scavengerPauseGoal= */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	uintptr_t _bytesAllocatedDuringConcurrent;
 	uintptr_t _avgBytesAllocatedDuringConcurrent;
@@ -102,6 +104,7 @@ private:
 
 	void checkSubSpaceMemoryPostCollectTilt(MM_EnvironmentBase *env);
 	void checkSubSpaceMemoryPostCollectResize(MM_EnvironmentBase *env);
+	void checkSubSpaceMemoryPostCollectPauseGoal(MM_EnvironmentBase *env);
 
 protected:
 	virtual void *allocationRequestFailed(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, AllocationType allocationType, MM_ObjectAllocationInterface *objectAllocationInterface, MM_MemorySubSpace *baseSubSpace, MM_MemorySubSpace *previousSubSpace);
@@ -159,6 +162,8 @@ public:
 	
 	MMINLINE uintptr_t getSurvivorSpaceSizeRatio() const { return _survivorSpaceSizeRatio; }
 	MMINLINE void setSurvivorSpaceSizeRatio(uintptr_t size) { _survivorSpaceSizeRatio = size; }
+
+	MMINLINE MM_ScavengerPauseGoalController *getPauseGoalController() { return &_pauseGoalController; }
 	
 	virtual void checkResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription = NULL, bool systemGC = false);
 	virtual intptr_t performResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription = NULL);
@@ -189,6 +194,7 @@ public:
 		,_averageScavengeTimeRatio(0.0)
 		,_lastGCEndTime(0)
 		,_desiredSurvivorSpaceRatio(0.0)
+		,_pauseGoalController()
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)		
 		,_bytesAllocatedDuringConcurrent(0)
 		,_avgBytesAllocatedDuringConcurrent(0)
@@ -108,6 +108,14 @@ MM_NonVirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowVali
 	return true;
 }
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+bool
+MM_NonVirtualMemory::decommitMemoryLazily(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress)
+{
+	return true;
+}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 bool
 MM_NonVirtualMemory::setNumaAffinity(uintptr_t numaNode, void* address, uintptr_t byteAmount)
 {
@@ -72,6 +72,9 @@ public:
 #if (defined(AIXPPC) && (!defined(PPC64) || defined(OMR_GC_REALTIME))) || defined(J9ZOS39064) || defined(OMRZTPF)
 	virtual bool commitMemory(void* address, uintptr_t size);
 	virtual bool decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	virtual bool decommitMemoryLazily(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 	virtual bool setNumaAffinity(uintptr_t numaNode, void* address, uintptr_t byteAmount);
 #endif /* (defined(AIXPPC) && (!defined(PPC64) || defined(OMR_GC_REALTIME))) || defined(J9ZOS39064) || defined(OMRZTPF) */
 
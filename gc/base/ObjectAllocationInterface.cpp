@@ -28,6 +28,9 @@
 
 #include "ObjectAllocationInterface.hpp"
 
+#include <math.h>
+
+#include "AllocationSampleStats.hpp"
 #include "Debug.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -75,3 +78,78 @@ MM_ObjectAllocationInterface::restartCache(MM_EnvironmentBase *env)
 {
 	/* Do nothing */
 }
+
+bool
+MM_ObjectAllocationInterface::initializeAllocationSampling(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	bool result = true;
+
+	Assert_MM_true(NULL == _allocationSampleStats);
+
+	if (0 != env->getExtensions()->allocationSamplingInterval) {
+		_allocationSampleStats = MM_AllocationSampleStats::newInstance(env);
+		if (NULL == _allocationSampleStats) {
+			result = false;
+		} else {
+			/* the generator must not be seeded with 0, and threads must not share a sequence */
+			_allocationSamplingSeed = (omrtime_hires_clock() ^ (uint64_t)(uintptr_t)this) | 1;
+			startNextSamplingInterval(env);
+		}
+	}
+
+	return result;
+}
+
+void
+MM_ObjectAllocationInterface::tearDownAllocationSampling(MM_EnvironmentBase *env)
+{
+	if (NULL != _allocationSampleStats) {
+		_allocationSampleStats->kill(env);
+		_allocationSampleStats = NULL;
+	}
+	_bytesUntilAllocationSample = UDATA_MAX;
+}
+
+/**
+ * Called when an allocation exhausts the current sampling interval. Draws the next
+ * interval from an exponential distribution with the mean -Xgc:allocationSamplingInterval=.
+ * @return true if the allocation that exhausted the interval should be sampled
+ */
+bool
+MM_ObjectAllocationInterface::startNextSamplingInterval(MM_EnvironmentBase *env)
+{
+	uintptr_t meanInterval = env->getExtensions()->allocationSamplingInterval;
+	bool shouldSample = false;
+
+	if ((0 == meanInterval) || (NULL == _allocationSampleStats)) {
+		/* sampling is disabled, keep the fast path failing */
+		_bytesUntilAllocationSample = UDATA_MAX;
+	} else {
+		/* xorshift64 step, then the top 53 bits as a uniform value in (0, 1) */
+		_allocationSamplingSeed ^= _allocationSamplingSeed << 13;
+		_allocationSamplingSeed ^= _allocationSamplingSeed >> 7;
+		_allocationSamplingSeed ^= _allocationSamplingSeed << 17;
+		double uniform = ((double)(_allocationSamplingSeed >> 11) + 0.5) / (double)((uint64_t)1 << 53);
+		double interval = -log(uniform) * (double)meanInterval;
+
+		if (interval >= (double)UDATA_MAX) {
+			_bytesUntilAllocationSample = UDATA_MAX;
+		} else {
+			_bytesUntilAllocationSample = OMR_MAX((uintptr_t)interval, 1);
+		}
+		shouldSample = true;
+	}
+
+	return shouldSample;
+}
+
+void
+MM_ObjectAllocationInterface::reportAllocationSample(MM_EnvironmentBase *env, omrobjectptr_t object, uintptr_t allocationCategory, uintptr_t size)
+{
+	uintptr_t typeKey = allocationCategory;
+
+	TRIGGER_J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE(env->getExtensions()->omrHookInterface, env->getOmrVMThread(), object, allocationCategory, size, typeKey);
+
+	_allocationSampleStats->update(typeKey, 1);
+}
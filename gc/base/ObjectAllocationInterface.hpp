@@ -31,12 +31,14 @@
 
 #include "omrcfg.h"
 #include "modronbase.h"
+#include "objectdescription.h"
 #include "ModronAssertions.h"
 
 #include "BaseVirtual.hpp"
 #include "AllocationStats.hpp"
 
 class MM_AllocateDescription;
+class MM_AllocationSampleStats;
 class MM_EnvironmentBase;
 class MM_FrequentObjectsStats;
 class MM_MemoryPool;
@@ -59,6 +61,9 @@ protected:
 	MM_EnvironmentBase *_owningEnv;  /**< The environment with which the receiver is associated */
 	MM_AllocationStats _stats; /**< Allocation statistics for this allocation interface. */
 	MM_FrequentObjectsStats* _frequentObjectsStats;
+	MM_AllocationSampleStats *_allocationSampleStats; /**< Samples taken on this thread, aggregated by type, or NULL if sampling is disabled */
+	uintptr_t _bytesUntilAllocationSample; /**< Bytes the thread may allocate before its next sample, UDATA_MAX while sampling is disabled */
+	uint64_t _allocationSamplingSeed; /**< State of the random generator that draws the sampling intervals */
 
 public:
 
@@ -66,6 +71,7 @@ public:
  * Function members
  */
 private:
+	bool startNextSamplingInterval(MM_EnvironmentBase *env);
 
 protected:
 	/**
@@ -83,11 +89,21 @@ protected:
 	 */
 	virtual void tearDown(MM_EnvironmentBase *env) = 0;
 
+	/**
+	 * Set up allocation sampling for the thread if -Xgc:allocationSamplingInterval= is set.
+	 * @return true on success, false if the sample table could not be allocated
+	 */
+	bool initializeAllocationSampling(MM_EnvironmentBase *env);
+	void tearDownAllocationSampling(MM_EnvironmentBase *env);
+
 	MM_ObjectAllocationInterface(MM_EnvironmentBase *env) :
 		MM_BaseVirtual(),
 		_owningEnv(env)
 		,_stats()
 		,_frequentObjectsStats(NULL)
+		,_allocationSampleStats(NULL)
+		,_bytesUntilAllocationSample(UDATA_MAX)
+		,_allocationSamplingSeed(0)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -95,6 +111,7 @@ protected:
 public:
 	MM_AllocationStats* getAllocationStats() { return &_stats; }
 	MM_FrequentObjectsStats* getFrequentObjectsStats() { return _frequentObjectsStats; }
+	MM_AllocationSampleStats *getAllocationSampleStats() { return _allocationSampleStats; }
 	MM_EnvironmentBase *getOwningEnv() { return _owningEnv; }
 
 	virtual void kill(MM_EnvironmentBase *env) = 0;
@@ -131,6 +148,30 @@ public:
 	virtual void enableCachedAllocations(MM_EnvironmentBase* env) {};
 	virtual void disableCachedAllocations(MM_EnvironmentBase* env) {};
 	virtual bool cachedAllocationsEnabled(MM_EnvironmentBase* env) { return true; }
-	
+
+	/**
+	 * Count an allocation against the sampling interval of the thread. The intervals are
+	 * drawn from an exponential distribution so that samples are not biased towards
+	 * allocations that recur at a fixed period.
+	 * @param bytes the size of the allocation
+	 * @return true if the allocation should be reported with reportAllocationSample()
+	 */
+	MMINLINE bool
+	shouldSampleAllocation(MM_EnvironmentBase *env, uintptr_t bytes)
+	{
+		if (bytes < _bytesUntilAllocationSample) {
+			_bytesUntilAllocationSample -= bytes;
+			return false;
+		}
+		return startNextSamplingInterval(env);
+	}
+
+	/**
+	 * Report a sampled allocation to the language and record it in the sample table of the thread.
+	 * @param object the initialized object
+	 * @param allocationCategory the language-defined allocation category of the object
+	 * @param size the size of the object in bytes
+	 */
+	void reportAllocationSample(MM_EnvironmentBase *env, omrobjectptr_t object, uintptr_t allocationCategory, uintptr_t size);
 };
 #endif /* OBJECTALLOCATIONINTERFACE_HPP_ */
@@ -63,5 +63,11 @@ MM_Packet::initialize(MM_EnvironmentBase *env, MM_Packet *next, MM_Packet *previ
 	
 	_owner = NULL;
 
+#if defined(OMR_GC_REALTIME)
+	_barrierTopPtr = _topPtr;
+	_publishTime = 0;
+	_inUseBarrier = false;
+#endif /* OMR_GC_REALTIME */
+
 	return true;
 }
@@ -45,7 +45,13 @@ private:
 	uintptr_t *_topPtr;
 	uintptr_t *_currentPtr;
 	uintptr_t _sublistIndex;
+	uintptr_t _packetIndex; /**< Index of the packet among all packets of its MM_WorkPackets, used by lock free packet lists */
 	MM_EnvironmentBase *_owner;
+#if defined(OMR_GC_REALTIME)
+	uintptr_t *_barrierTopPtr; /**< End of the slots a mutator fills while the packet backs its SATB barrier buffer */
+	uint64_t _publishTime; /**< Time the full SATB barrier buffer was published, used to measure drain latency */
+	bool _inUseBarrier; /**< True while the packet backs the SATB barrier buffer of a thread */
+#endif /* OMR_GC_REALTIME */
 protected:
 public:
 	MM_Packet *_next;
@@ -65,6 +71,16 @@ private:
 		_sublistIndex = sublistIndex;
 	}
 
+	MMINLINE uintptr_t getPacketIndex()
+	{
+		return _packetIndex;
+	}
+
+	MMINLINE void setPacketIndex(uintptr_t packetIndex)
+	{
+		_packetIndex = packetIndex;
+	}
+
 protected:
 public:
 	/**
@@ -124,6 +140,25 @@ public:
 		return &_topPtr;
 	}
 	
+#if defined(OMR_GC_REALTIME)
+	/**
+	 * Return the address of the end of the SATB barrier buffer for this packet.
+	 * The buffer starts at currentPtr and is limited to the given number of slots,
+	 * so a thread publishes it before the packet itself is full.
+	 *
+	 * @param bufferSlots the number of slots in the buffer, or 0 to use the whole packet
+	 * @return the address of barrierTopPtr
+	 */
+	uintptr_t **getBarrierTopAddr(MM_EnvironmentBase *env, uintptr_t bufferSlots)
+	{
+		_barrierTopPtr = _topPtr;
+		if ((0 != bufferSlots) && (bufferSlots < (uintptr_t)(_topPtr - _currentPtr))) {
+			_barrierTopPtr = _currentPtr + bufferSlots;
+		}
+		return &_barrierTopPtr;
+	}
+#endif /* OMR_GC_REALTIME */
+
 	/**
 	 * Set _currentPtr equal to _topPtr so
 	 * the packet looks as if it is full.
@@ -212,7 +247,13 @@ public:
 		_topPtr(NULL),
 		_currentPtr(NULL),
 		_sublistIndex(0),
+		_packetIndex(0),
 		_owner(NULL),
+#if defined(OMR_GC_REALTIME)
+		_barrierTopPtr(NULL),
+		_publishTime(0),
+		_inUseBarrier(false),
+#endif /* OMR_GC_REALTIME */
 		_next(NULL),
 		_previous(NULL)
 	{
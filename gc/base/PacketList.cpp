@@ -66,6 +66,17 @@ MM_PacketList::tearDown(MM_EnvironmentBase *env)
 	}
 }
 
+void
+MM_PacketList::enableLockFree(MM_Packet **packetBlocks, uintptr_t packetsPerBlock)
+{
+	Assert_MM_true(0 == _count);
+	Assert_MM_true(0 < packetsPerBlock);
+
+	_packetBlocks = packetBlocks;
+	_packetsPerBlock = packetsPerBlock;
+	_lockFree = true;
+}
+
 void 
 MM_PacketList::pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count)
 {
@@ -73,6 +84,16 @@ MM_PacketList::pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count)
 	PacketSublist *list = &_sublists[0];
 	MM_Packet *current = head;
 	uintptr_t i;
+
+	if (_lockFree) {
+		for (i = 0; i < count; ++i) {
+			current->setSublistIndex(0);
+			current = current->_next;
+		}
+		incrementCount(count);
+		pushLockFree(list, head, tail);
+		return;
+	}
 	
 	list->_lock.acquire();
 	
@@ -101,6 +122,28 @@ MM_PacketList::popList(MM_Packet **head, MM_Packet **tail, uintptr_t *count)
 	*head = NULL;
 	*tail = NULL;
 	*count = 0;
+
+	if (_lockFree) {
+		for (uintptr_t i = 0; i < _sublistCount; i++) {
+			MM_Packet *current = popAllLockFree(&_sublists[i]);
+			if (NULL != current) {
+				didPop = true;
+
+				if (NULL == *head) {
+					*head = current;
+				} else {
+					(*tail)->_next = current;
+				}
+				while (NULL != current) {
+					*tail = current;
+					*count += 1;
+					current = current->_next;
+				}
+			}
+		}
+		decrementCount(*count);
+		return didPop;
+	}
 	
 	/* acquire all of our locks */
 	for (uintptr_t i = 0; i < _sublistCount; i++) {
@@ -146,6 +189,9 @@ MM_PacketList::remove(MM_Packet *packetToRemove)
 	PacketSublist *list = &_sublists[packetToRemove->getSublistIndex()];
 	MM_Packet *previous = NULL;
 	MM_Packet *next = NULL;
+
+	/* lock free lists do not maintain the _previous links */
+	Assert_MM_true(!_lockFree);
 	
 	list->_lock.acquire();
 	
@@ -188,7 +234,7 @@ MM_PacketList::getHead()
 	
 	if (popList(&head, &tail, &count)) {
 		pushList(head, tail, count);
-		result = _sublists[0]._head;
+		result = _lockFree ? decodeTaggedHead(_sublists[0]._taggedHead) : _sublists[0]._head;
 	}
 
 	return result;
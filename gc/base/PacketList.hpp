@@ -49,6 +49,7 @@ public:
 		MM_Packet * _head;  /**< Head of the list */
 		MM_Packet * _tail;  /**< Tail of the list */
 		MM_LightweightNonReentrantLock _lock;  /**< Lock for getting/putting packets */
+		volatile uint64_t _taggedHead; /**< Head of the list when lock free: packet index + 1 in the low 32 bits, ABA tag in the high 32 bits */
 
 		bool
 		initialize(MM_EnvironmentBase *env)
@@ -62,6 +63,7 @@ public:
 		PacketSublist()
 			: _head(NULL)
 			, _tail(NULL)
+			, _taggedHead(0)
 		{
 		}
 	};
@@ -73,6 +75,9 @@ private:
 	
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
 	volatile uintptr_t _count;  /**< Number of items in the list */
+	bool _lockFree; /**< True if the sublists are lock free stacks linked through _taggedHead rather than lock protected lists */
+	MM_Packet **_packetBlocks; /**< Packet blocks of the owning MM_WorkPackets, used to find a packet from its index when lock free */
+	uintptr_t _packetsPerBlock; /**< Number of packets in each of the _packetBlocks */
 	
 /* Functionality Section */
 private:
@@ -84,10 +89,10 @@ private:
 	 */
 	void incrementCount(uintptr_t value)
 	{
-		if (1 == _sublistCount) {
+		if ((1 == _sublistCount) && !_lockFree) {
 			_count += value;
 		} else {
-			/* use an atomic, as the locks have been split up */
+			/* use an atomic, as the locks have been split up (or there are none) */
 			MM_AtomicOperations::add(&_count, value);
 		}
 	}
@@ -100,10 +105,10 @@ private:
 	 */
 	void decrementCount(uintptr_t value)
 	{
-		if (1 == _sublistCount) {
+		if ((1 == _sublistCount) && !_lockFree) {
 			_count -= value;
 		} else {
-			/* use an atomic, as the locks have been split up */
+			/* use an atomic, as the locks have been split up (or there are none) */
 			MM_AtomicOperations::subtract(&_count, value);
 		}
 	}
@@ -121,6 +126,115 @@ private:
 	{
 		return env->getEnvironmentId() % _sublistCount;
 	}
+
+	/**
+	 * Build a tagged head value for a lock free sublist.
+	 * The packet is identified by its index rather than its address so that the tag fits in the same 64 bit word.
+	 *
+	 * @param packet the packet to become the head, or NULL for an empty sublist
+	 * @param tag the ABA tag, which must change on every update of the head
+	 *
+	 * @return the tagged head value
+	 */
+	MMINLINE uint64_t
+	encodeTaggedHead(MM_Packet *packet, uint64_t tag)
+	{
+		uint64_t index = (NULL == packet) ? 0 : ((uint64_t)packet->getPacketIndex() + 1);
+		return (tag << 32) | index;
+	}
+
+	/**
+	 * Find the packet referred to by a tagged head value of a lock free sublist.
+	 *
+	 * @param taggedHead the tagged head value
+	 *
+	 * @return the packet, or NULL if the value represents an empty sublist
+	 */
+	MMINLINE MM_Packet *
+	decodeTaggedHead(uint64_t taggedHead)
+	{
+		MM_Packet *packet = NULL;
+		uintptr_t index = (uintptr_t)(taggedHead & 0xFFFFFFFF);
+
+		if (0 != index) {
+			index -= 1;
+			packet = _packetBlocks[index / _packetsPerBlock] + (index % _packetsPerBlock);
+		}
+		return packet;
+	}
+
+	/**
+	 * Atomically link a chain of packets in front of the head of a lock free sublist.
+	 * The count must already have been incremented so that it never under-reports the list.
+	 *
+	 * @param list the sublist
+	 * @param head the first packet of the chain
+	 * @param tail the last packet of the chain
+	 */
+	MMINLINE void
+	pushLockFree(PacketSublist *list, MM_Packet *head, MM_Packet *tail)
+	{
+		uint64_t oldHead = list->_taggedHead;
+		while (true) {
+			tail->_next = decodeTaggedHead(oldHead);
+			uint64_t newHead = encodeTaggedHead(head, (oldHead >> 32) + 1);
+			uint64_t foundHead = MM_AtomicOperations::lockCompareExchangeU64(&list->_taggedHead, oldHead, newHead);
+			if (foundHead == oldHead) {
+				break;
+			}
+			oldHead = foundHead;
+		}
+	}
+
+	/**
+	 * Atomically unlink the head packet of a lock free sublist.
+	 * Packets are never freed while the list is in use, so reading _next of a packet which was concurrently
+	 * popped is safe and the tag makes the compare and swap fail if the head was recycled in the meantime.
+	 *
+	 * @param list the sublist
+	 *
+	 * @return the packet, or NULL if the sublist was empty
+	 */
+	MMINLINE MM_Packet *
+	popLockFree(PacketSublist *list)
+	{
+		uint64_t oldHead = list->_taggedHead;
+		MM_Packet *packet = decodeTaggedHead(oldHead);
+
+		while (NULL != packet) {
+			uint64_t newHead = encodeTaggedHead(packet->_next, (oldHead >> 32) + 1);
+			uint64_t foundHead = MM_AtomicOperations::lockCompareExchangeU64(&list->_taggedHead, oldHead, newHead);
+			if (foundHead == oldHead) {
+				decrementCount(1);
+				break;
+			}
+			oldHead = foundHead;
+			packet = decodeTaggedHead(oldHead);
+		}
+
+		return packet;
+	}
+
+	/**
+	 * Atomically unlink all packets of a lock free sublist.
+	 *
+	 * @param list the sublist
+	 *
+	 * @return the first packet of the chain that was unlinked, or NULL if the sublist was empty
+	 */
+	MMINLINE MM_Packet *
+	popAllLockFree(PacketSublist *list)
+	{
+		uint64_t oldHead = list->_taggedHead;
+		while (true) {
+			uint64_t foundHead = MM_AtomicOperations::lockCompareExchangeU64(&list->_taggedHead, oldHead, encodeTaggedHead(NULL, (oldHead >> 32) + 1));
+			if (foundHead == oldHead) {
+				break;
+			}
+			oldHead = foundHead;
+		}
+		return decodeTaggedHead(oldHead);
+	}
 		
 protected:
 	
@@ -128,6 +242,15 @@ public:
 	
 	bool initialize(MM_EnvironmentBase *env);
 	void tearDown(MM_EnvironmentBase *env) ;
+
+	/**
+	 * Switch the list to lock free operation. Must be called while the list is still empty.
+	 * A lock free list does not maintain the _previous links, so remove() is not supported.
+	 *
+	 * @param packetBlocks the packet blocks of the owning MM_WorkPackets (may be filled in later)
+	 * @param packetsPerBlock the number of packets in each block
+	 */
+	void enableLockFree(MM_Packet **packetBlocks, uintptr_t packetsPerBlock);
 	
 	/**
 	 * Push a list of packets onto this packet list.
@@ -162,21 +285,28 @@ public:
 	{
 		uintptr_t index = getSublistIndex(env);
 		PacketSublist *list = &_sublists[index];
-	
-		list->_lock.acquire();
 
-		packet->_next = list->_head;
-		packet->_previous = NULL;
-		packet->setSublistIndex(index);
-		if (NULL == list->_head) {
-			list->_tail = packet;
+		if (_lockFree) {
+			packet->setSublistIndex(index);
+			/* count first so that isEmpty() never reports an empty list while it holds packets */
+			incrementCount(1);
+			pushLockFree(list, packet, packet);
 		} else {
-			list->_head->_previous = packet;
+			list->_lock.acquire();
+
+			packet->_next = list->_head;
+			packet->_previous = NULL;
+			packet->setSublistIndex(index);
+			if (NULL == list->_head) {
+				list->_tail = packet;
+			} else {
+				list->_head->_previous = packet;
+			}
+			list->_head = packet;
+			incrementCount(1);
+
+			list->_lock.release();
 		}
-		list->_head = packet;
-		incrementCount(1);
-		
-		list->_lock.release();
 	}
 	
 	/**
@@ -192,7 +322,12 @@ public:
 		for (uintptr_t i = 0; i < _sublistCount; i++) {
 			PacketSublist *list = &_sublists[index];
 
-			if (NULL != list->_head) {
+			if (_lockFree) {
+				packet = popLockFree(list);
+				if (NULL != packet) {
+					break;
+				}
+			} else if (NULL != list->_head) {
 				list->_lock.acquire();
 				if (NULL != list->_head) {
 					packet = list->_head;
@@ -254,6 +389,9 @@ public:
 		,_sublists(NULL)
 		,_sublistCount(0)
 		,_count(0)
+		,_lockFree(false)
+		,_packetBlocks(NULL)
+		,_packetsPerBlock(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -37,6 +37,7 @@
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
 #include "Task.hpp"
+#include "TreeBarrier.hpp"
 
 #include "ParallelDispatcher.hpp"
 
@@ -236,6 +237,10 @@ MM_ParallelDispatcher::kill(MM_EnvironmentBase *env)
 		omrthread_monitor_destroy(_synchronizeMutex);
 		_synchronizeMutex = NULL;
 	}
+	if(_treeBarrier) {
+		_treeBarrier->kill(env);
+		_treeBarrier = NULL;
+	}
 
 	if(_taskTable) {
 		forge->free(_taskTable);
@@ -286,6 +291,13 @@ MM_ParallelDispatcher::initialize(MM_EnvironmentBase *env)
 	}
 	memset(_taskTable, 0, _threadCountMaximum * sizeof(MM_Task *));
 
+	if(_extensions->treeBarrier) {
+		_treeBarrier = MM_TreeBarrier::newInstance(env, _threadCountMaximum, _extensions->treeBarrierSpinCount);
+		if(!_treeBarrier) {
+			goto error_no_memory;
+		}
+	}
+
 	return true;
 
 error_no_memory:
@@ -524,6 +536,10 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 	_task = task;
 
 	task->setSynchronizeMutex(_synchronizeMutex);
+	if((NULL != _treeBarrier) && task->shouldUseTreeBarrier(env)) {
+		_treeBarrier->reset(threadCount);
+		task->setTreeBarrier(_treeBarrier);
+	}
 
 	/* Main thread will be used - update status */
 	_statusTable[env->getWorkerID()] = worker_status_reserved;
@@ -39,6 +39,7 @@
 #include "GCExtensionsBase.hpp"
 
 class MM_EnvironmentBase;
+class MM_TreeBarrier;
 
 class MM_ParallelDispatcher : public MM_BaseVirtual
 {
@@ -70,6 +71,7 @@ protected:
 	/* Task as they are dispatched.  For now, since there is only one task active at any time, a */
 	/* single mutex is sufficient */
 	omrthread_monitor_t _synchronizeMutex;
+	MM_TreeBarrier *_treeBarrier; /**< Barrier handed to tasks which opt into it, NULL if the tree barrier is disabled */
 	
 	bool _workerThreadsReservedForGC;  /**< States whether or not the worker threads are currently taking part in a GC */
 	bool _inShutdown;  /**< Shutdown request is received */
@@ -149,6 +151,7 @@ public:
 		,_workerThreadMutex(NULL)
 		,_dispatcherMonitor(NULL)
 		,_synchronizeMutex(NULL)
+		,_treeBarrier(NULL)
 		,_workerThreadsReservedForGC(false)
 		,_inShutdown(false)
 		,_threadCountMaximum(1)
@@ -34,6 +34,7 @@
 #include "MarkMap.hpp"
 #include "MarkMapSegmentChunkIterator.hpp"
 #include "MemorySubSpace.hpp"
+#include "ObjectHeapBufferedIterator.hpp"
 #include "ParallelGlobalGC.hpp"
 #include "ParallelObjectHeapIterator.hpp"
 #include "ObjectModel.hpp"
@@ -80,6 +81,54 @@ public:
 	}
 };
 
+/**
+ * Aggregation state of one worker in MM_ParallelHeapWalker::allObjectsDoAggregate().
+ */
+struct MM_HeapWalkerThreadState {
+	void *threadData; /**< State returned by the threadStart callback */
+	bool started; /**< True if the worker took part in the walk */
+};
+
+/**
+ * Task which walks the heap sections on each worker against that worker's own aggregation state.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelObjectAggregateTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	const OMR_GC_HeapIteratorCallbacks *_callbacks;
+	void *_userData;
+	bool _liveObjectsOnly;
+	MM_HeapWalkerThreadState *_threadStates;
+
+	MM_ParallelHeapWalker *_heapWalker;
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PARALLEL_OBJECT_DO; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	MM_ParallelObjectAggregateTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, const OMR_GC_HeapIteratorCallbacks *callbacks, void *userData, bool liveObjectsOnly, MM_HeapWalkerThreadState *threadStates)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, _callbacks(callbacks)
+		, _userData(userData)
+		, _liveObjectsOnly(liveObjectsOnly)
+		, _threadStates(threadStates)
+		, _heapWalker(heapWalker)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
 /**
  * newInstance of Parallel Heap Walker
  */
@@ -158,6 +207,130 @@ MM_ParallelHeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObject
 	}
 }
 
+/**
+ * @return the number of global and local collections started so far
+ */
+static uintptr_t
+getCollectionCount(MM_GCExtensionsBase *extensions)
+{
+	uintptr_t collectionCount = extensions->globalGCStats.gcCount;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	collectionCount += extensions->scavengerStats._gcCount;
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	return collectionCount;
+}
+
+bool
+MM_ParallelHeapWalker::isWalkMarkCurrent(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	return _walkMarkValid && (_walkMarkCollectionCount == getCollectionCount(extensions)) && (_walkMarkHeapSize == extensions->heap->getMemorySize());
+}
+
+void
+MM_ParallelHeapWalker::objectsDoInSections(MM_EnvironmentBase *env, void (*objectDo)(OMR_VMThread *, omrobjectptr_t, void *), void *threadData, bool liveObjectsOnly)
+{
+	Trc_MM_ParallelHeapWalker_objectsDoInSections_Entry(env->getLanguageVMThread(), liveObjectsOnly ? 1 : 0);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	/* A live walk finds its objects through the mark map, which has a bit at the start of every marked object, so a region
+	 * may be split anywhere. A walk of all objects has to parse from an object boundary, which the mark map only provides
+	 * while the mark made for the last walk is current; otherwise each region is one section. */
+	uintptr_t heapChunkFactor = 1;
+	if (liveObjectsOnly || isWalkMarkCurrent(env)) {
+		heapChunkFactor = env->_currentTask->getThreadCount() * 8;
+	}
+	uintptr_t parallelChunkSize = extensions->heap->getMemorySize() / heapChunkFactor;
+	parallelChunkSize = MM_Math::roundToCeiling(extensions->heapAlignment, parallelChunkSize);
+
+	uintptr_t objectsWalked = 0;
+	MM_HeapRegionManager *regionManager = extensions->heap->getHeapRegionManager();
+	regionManager->lock();
+	GC_HeapRegionIterator regionIterator(regionManager);
+	MM_HeapRegionDescriptor *region = NULL;
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		/* the evacuate half of the nursery holds stale copies of objects */
+		MM_MemorySubSpace *subSpace = region->getSubSpace();
+		if ((NULL == subSpace) || !subSpace->isActive()) {
+			continue;
+		}
+
+		if (liveObjectsOnly) {
+			uintptr_t *regionTop = (uintptr_t *)region->getHighAddress();
+			for (uintptr_t *chunkBase = (uintptr_t *)region->getLowAddress(); chunkBase < regionTop; chunkBase = (uintptr_t *)((uintptr_t)chunkBase + parallelChunkSize)) {
+				if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+					uintptr_t *chunkTop = (uintptr_t *)OMR_MIN((uintptr_t)regionTop, (uintptr_t)chunkBase + parallelChunkSize);
+					MM_HeapMapIterator markedObjectIterator(extensions, _markMap, chunkBase, chunkTop);
+					omrobjectptr_t object = NULL;
+					while (NULL != (object = markedObjectIterator.nextObject())) {
+						objectDo(omrVMThread, object, threadData);
+						objectsWalked += 1;
+					}
+				}
+			}
+		} else if (1 < heapChunkFactor) {
+			GC_ParallelObjectHeapIterator objectHeapIterator(env, region, region->getLowAddress(), region->getHighAddress(), _markMap, parallelChunkSize);
+			omrobjectptr_t object = NULL;
+			while (NULL != (object = objectHeapIterator.nextObject())) {
+				objectDo(omrVMThread, object, threadData);
+				objectsWalked += 1;
+			}
+		} else if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			GC_ObjectHeapBufferedIterator objectHeapIterator(extensions, region);
+			omrobjectptr_t object = NULL;
+			while (NULL != (object = objectHeapIterator.nextObject())) {
+				objectDo(omrVMThread, object, threadData);
+				objectsWalked += 1;
+			}
+		}
+	}
+	regionManager->unlock();
+	Trc_MM_ParallelHeapWalker_objectsDoInSections_Exit(env->getLanguageVMThread(), heapChunkFactor, parallelChunkSize, objectsWalked);
+}
+
+bool
+MM_ParallelHeapWalker::allObjectsDoAggregate(MM_EnvironmentBase *env, const OMR_GC_HeapIteratorCallbacks *callbacks, void *userData, bool liveObjectsOnly, bool singleThreaded)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_ParallelDispatcher *dispatcher = extensions->dispatcher;
+	uintptr_t threadCountMaximum = dispatcher->threadCountMaximum();
+
+	MM_HeapWalkerThreadState *threadStates = (MM_HeapWalkerThreadState *)env->getForge()->allocate(sizeof(MM_HeapWalkerThreadState) * threadCountMaximum, OMR::GC::AllocationCategory::OTHER, OMR_GET_CALLSITE());
+	if (NULL == threadStates) {
+		return false;
+	}
+	for (uintptr_t i = 0; i < threadCountMaximum; i++) {
+		threadStates[i].threadData = NULL;
+		threadStates[i].started = false;
+	}
+
+	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+	if (liveObjectsOnly || !_globalCollector->isHeapWalkable(env)) {
+		/* marking makes the heap walkable and leaves exactly the live objects set in the mark map */
+		_globalCollector->prepareHeapForWalk(env);
+		_walkMarkValid = true;
+		_walkMarkCollectionCount = getCollectionCount(extensions);
+		_walkMarkHeapSize = extensions->heap->getMemorySize();
+	}
+
+	MM_ParallelObjectAggregateTask aggregateTask(env, this, callbacks, userData, liveObjectsOnly, threadStates);
+	dispatcher->run(env, &aggregateTask, singleThreaded ? 1 : UDATA_MAX);
+
+	if (NULL != callbacks->threadMerge) {
+		OMR_VMThread *omrVMThread = env->getOmrVMThread();
+		for (uintptr_t i = 0; i < threadCountMaximum; i++) {
+			if (threadStates[i].started) {
+				callbacks->threadMerge(omrVMThread, threadStates[i].threadData, userData);
+			}
+		}
+	}
+
+	env->getForge()->free(threadStates);
+	return true;
+}
+
 /**
  * gets the heap walker and calls the actual objectSlotsDo function
  */
@@ -166,3 +339,25 @@ MM_ParallelObjectDoTask::run(MM_EnvironmentBase *env)
 {
 	_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags);
 }
+
+/**
+ * Creates the aggregation state of this worker on its first run and walks the heap sections it claims against it.
+ */
+void
+MM_ParallelObjectAggregateTask::run(MM_EnvironmentBase *env)
+{
+	uintptr_t workerID = env->getWorkerID();
+	Assert_MM_true(workerID < _dispatcher->threadCountMaximum());
+
+	/* a worker that is done early may take another of the reserved slots and run the task again */
+	MM_HeapWalkerThreadState *threadState = &_threadStates[workerID];
+	if (!threadState->started) {
+		threadState->threadData = _userData;
+		if (NULL != _callbacks->threadStart) {
+			threadState->threadData = _callbacks->threadStart(env->getOmrVMThread(), _userData);
+		}
+		threadState->started = true;
+	}
+
+	_heapWalker->objectsDoInSections(env, _callbacks->objectDo, threadState->threadData, _liveObjectsOnly);
+}
@@ -25,6 +25,7 @@
 
 #include "omr.h"
 #include "omrcfg.h"
+#include "omrgc.h"
 
 #include "HeapWalker.hpp"
 
@@ -40,6 +41,9 @@ class MM_ParallelHeapWalker : public MM_HeapWalker
 private:
 	MM_MarkMap *_markMap;
 	MM_ParallelGlobalGC *_globalCollector;
+	bool _walkMarkValid; /**< the heap has been marked for a walk since the walker was created */
+	uintptr_t _walkMarkCollectionCount; /**< number of collections completed when the heap was last marked for a walk */
+	uintptr_t _walkMarkHeapSize; /**< size of the heap when it was last marked for a walk */
 protected:
 public:
 	
@@ -47,6 +51,20 @@ public:
 	 * Function members
 	 */
 private:
+	/**
+	 * The mark made for the last walk locates object boundaries until the next collection moves or frees objects,
+	 * or the heap is resized; objects allocated since then are not marked but are found by parsing from a marked one.
+	 * @return true if the mark bits set for the last walk are all still at the start of an object
+	 */
+	bool isWalkMarkCurrent(MM_EnvironmentBase *env);
+
+	/**
+	 * Claim heap sections until none are left and report their objects to the provided function,
+	 * skipping the inactive half of the nursery. Live walks report the marked objects of fixed size
+	 * chunks of each region. Walks of all objects parse the same chunks starting from their first marked
+	 * object while the mark made for the last walk is current, and claim whole regions otherwise.
+	 */
+	void objectsDoInSections(MM_EnvironmentBase *env, void (*objectDo)(OMR_VMThread *, omrobjectptr_t, void *), void *threadData, bool liveObjectsOnly);
 protected:
 public:	
 	/**
@@ -61,6 +79,15 @@ public:
 	 */
 	virtual void allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk);
 
+	/**
+	 * Walk the heap on the dispatcher threads on behalf of OMR_GC_IterateHeap(). The heap is marked for live walks,
+	 * and for walks of all objects only if it is not walkable as it is, then split into sections; each worker creates its own aggregation state and reports the objects of the sections it claims
+	 * against it, and the calling thread merges the states in worker order once all workers are done.
+	 * @note the caller must hold exclusive VM access
+	 * @return false if the per-thread state table could not be allocated
+	 */
+	bool allObjectsDoAggregate(MM_EnvironmentBase *env, const OMR_GC_HeapIteratorCallbacks *callbacks, void *userData, bool liveObjectsOnly, bool singleThreaded);
+
 	MM_MarkMap *getMarkMap() {
 		return _markMap;
 	}
@@ -77,6 +104,9 @@ public:
 		: MM_HeapWalker()
 		, _markMap(markMap)
 		, _globalCollector(globalCollector)
+		, _walkMarkValid(false)
+		, _walkMarkCollectionCount(0)
+		, _walkMarkHeapSize(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -85,6 +115,7 @@ public:
 	 * Friends
 	 */
 	friend class MM_ParallelObjectDoTask;
+	friend class MM_ParallelObjectAggregateTask;
 };
 
 #endif /* PARALLEL_HEAP_WALKER_HPP_ */
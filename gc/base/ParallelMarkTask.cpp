@@ -30,6 +30,7 @@
 #include "ParallelMarkTask.hpp"
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 #include "MarkingScheme.hpp"
 #include "WorkStack.hpp"
 
@@ -102,6 +103,19 @@ MM_ParallelMarkTask::cleanup(MM_EnvironmentBase *env)
 		0/* TODO CRG figure out to get the array split size*/);
 }
 
+bool
+MM_ParallelMarkTask::shouldUseWorkStealing(MM_EnvironmentBase *env)
+{
+	return env->getExtensions()->workStealing;
+}
+
+bool
+MM_ParallelMarkTask::shouldCacheWorkPackets(MM_EnvironmentBase *env)
+{
+	/* run() flushes the work stack before the task completes */
+	return env->getExtensions()->workPacketCache;
+}
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 void
 MM_ParallelMarkTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
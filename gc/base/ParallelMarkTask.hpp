@@ -62,6 +62,9 @@ public:
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
 	virtual void cleanup(MM_EnvironmentBase *env);
+	virtual bool shouldUseWorkStealing(MM_EnvironmentBase *env);
+	virtual bool shouldCacheWorkPackets(MM_EnvironmentBase *env);
+	virtual bool shouldUseTreeBarrier(MM_EnvironmentBase *env) { return true; }
 	
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	virtual void synchronizeGCThreads(MM_EnvironmentBase *env, const char *id);
@@ -31,6 +31,17 @@
 #include "EnvironmentBase.hpp"
 #include "ModronAssertions.h"
 #include "ParallelDispatcher.hpp"
+#include "TreeBarrier.hpp"
+
+void
+MM_ParallelTask::accept(MM_EnvironmentBase *env)
+{
+	if (NULL != _treeBarrier) {
+		_treeBarrier->registerThread(env);
+	}
+
+	MM_Task::accept(env);
+}
 
 bool
 MM_ParallelTask::handleNextWorkUnit(MM_EnvironmentBase *env)
@@ -75,7 +86,9 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 	Trc_MM_SynchronizeGCThreads_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 	
-	if(1 < _totalThreadCount) {
+	if ((1 < _totalThreadCount) && (NULL != _treeBarrier)) {
+		synchronizeGCThreadsOnTreeBarrier(env, id, tree_barrier_release_all);
+	} else if(1 < _totalThreadCount) {
 		omrthread_monitor_enter(_synchronizeMutex);
 
 		/*check synchronization point*/
@@ -117,7 +130,9 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, con
 	Trc_MM_SynchronizeGCThreadsAndReleaseMain_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 
-	if(1 < _totalThreadCount) {
+	if ((1 < _totalThreadCount) && (NULL != _treeBarrier)) {
+		isMainThread = synchronizeGCThreadsOnTreeBarrier(env, id, tree_barrier_release_main);
+	} else if(1 < _totalThreadCount) {
 		volatile uintptr_t index = _synchronizeIndex;
 
 		omrthread_monitor_enter(_synchronizeMutex);
@@ -172,7 +187,9 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *
 	Trc_MM_SynchronizeGCThreadsAndReleaseSingleThread_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 
-	if(1 < _totalThreadCount) {
+	if ((1 < _totalThreadCount) && (NULL != _treeBarrier)) {
+		isReleasedThread = synchronizeGCThreadsOnTreeBarrier(env, id, tree_barrier_release_single);
+	} else if(1 < _totalThreadCount) {
 		volatile uintptr_t index = _synchronizeIndex;
 		uintptr_t workUnitIndex = env->getWorkUnitIndex();
 
@@ -230,6 +247,13 @@ MM_ParallelTask::releaseSynchronizedGCThreads(MM_EnvironmentBase *env)
 	Assert_GC_true_with_message2(env, _synchronized, "%s at %p from releaseSynchronizedGCThreads: call for non-synchronized\n", getBaseVirtualTypeId(), this);
 	/* Could not have gotten here unless all other threads are sync'd - don't check, just release */
 	_synchronized = false;
+	if (NULL != _treeBarrier) {
+		_syncPointUniqueId = NULL;
+		uint64_t notifyStartTime = omrtime_hires_clock();
+		_treeBarrier->release(env);
+		addToNotifyStallTime(env, notifyStartTime, omrtime_hires_clock());
+		return;
+	}
 	omrthread_monitor_enter(_synchronizeMutex);
 	_synchronizeCount = 0;
 	_synchronizeIndex += 1;
@@ -294,6 +318,57 @@ MM_ParallelTask::complete(MM_EnvironmentBase *env)
 	}
 }
 
+/**
+ * Synchronize on the tree barrier instead of the synchronize monitor.
+ * The first thread to arrive records the synchronization point, every other thread checks it matches.
+ * The thread releasing the barrier clears it again so that the next synchronization point can be recorded.
+ * @return true if the calling thread was released alone (depending on syncType), false otherwise
+ */
+bool
+MM_ParallelTask::synchronizeGCThreadsOnTreeBarrier(MM_EnvironmentBase *env, const char *id, TreeBarrierSyncType syncType)
+{
+	bool releasedAlone = false;
+	uintptr_t episode = _treeBarrier->getEpisode();
+
+	/*check synchronization point*/
+	const char *syncPointUniqueId = (const char *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_syncPointUniqueId, (uintptr_t)NULL, (uintptr_t)id);
+	Assert_GC_true_with_message4(env, (NULL == syncPointUniqueId) || (syncPointUniqueId == id),
+		"%s at %p from synchronizeGCThreadsOnTreeBarrier: call from (%s), expected (%s)\n", getBaseVirtualTypeId(), this, id, syncPointUniqueId);
+
+	if (_treeBarrier->arrive(env)) {
+		/* last thread to arrive */
+		switch (syncType) {
+		case tree_barrier_release_all:
+			_syncPointUniqueId = NULL;
+			_treeBarrier->release(env);
+			break;
+		case tree_barrier_release_main:
+			if (env->isMainThread()) {
+				releasedAlone = true;
+				_synchronized = true;
+			} else {
+				_treeBarrier->releaseMain(env, episode);
+				_treeBarrier->wait(env, episode, false);
+			}
+			break;
+		case tree_barrier_release_single:
+			releasedAlone = true;
+			_synchronized = true;
+			break;
+		default:
+			Assert_MM_unreachable();
+		}
+	} else {
+		bool mainMayLeaveEarly = (tree_barrier_release_main == syncType) && env->isMainThread();
+		if (_treeBarrier->wait(env, episode, mainMayLeaveEarly)) {
+			releasedAlone = true;
+			_synchronized = true;
+		}
+	}
+
+	return releasedAlone;
+}
+
 /**
  * Return true if threads are currently syncronized, false otherwise
  * @return true if threads are currently syncronized, false otherwise
@@ -36,6 +36,7 @@
 #include "Task.hpp"
 
 class MM_EnvironmentBase;
+class MM_TreeBarrier;
 
 /**
  * @todo Provide class documentation
@@ -47,6 +48,12 @@ class MM_ParallelTask : public MM_Task
 	 * Data members
 	 */
 private:
+	enum TreeBarrierSyncType {
+		tree_barrier_release_all = 0,
+		tree_barrier_release_main,
+		tree_barrier_release_single
+	};
+
 protected:
 	uint64_t _syncCriticalSectionStartTime; /**< Timestamp taken when a critical section of the task starts execution. */
 	uint64_t _syncCriticalSectionDuration; /**< The time, in hi-res ticks, it took to execute the lastest critical section. */
@@ -62,12 +69,17 @@ protected:
 	volatile uintptr_t _synchronizeIndex;
 	volatile uintptr_t _synchronizeCount;
 	omrthread_monitor_t _synchronizeMutex;
+	MM_TreeBarrier *_treeBarrier; /**< Barrier used instead of _synchronizeMutex for synchronize calls, NULL if the task did not opt in */
 public:
 	
 	/*
 	 * Function members
 	 */
+private:
+	bool synchronizeGCThreadsOnTreeBarrier(MM_EnvironmentBase *env, const char *id, TreeBarrierSyncType syncType);
+
 public:
+	virtual void accept(MM_EnvironmentBase *env);
 	virtual bool handleNextWorkUnit(MM_EnvironmentBase *env);
 	virtual void synchronizeGCThreads(MM_EnvironmentBase *env, const char *id);
 	virtual bool synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, const char *id);
@@ -77,6 +89,7 @@ public:
 	virtual bool synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, const char *id, uint64_t *stallTime);
 	
 	MMINLINE virtual void setSynchronizeMutex(omrthread_monitor_t synchronizeMutex) { _synchronizeMutex = synchronizeMutex; }
+	MMINLINE virtual void setTreeBarrier(MM_TreeBarrier *treeBarrier) { _treeBarrier = treeBarrier; }
 	virtual void complete(MM_EnvironmentBase *env);
 
 	/**
@@ -107,6 +120,7 @@ public:
 		,_synchronizeIndex(0)
 		,_synchronizeCount(0)
 		,_synchronizeMutex(NULL)
+		,_treeBarrier(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
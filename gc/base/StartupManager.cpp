@@ -48,6 +48,84 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCWORK_STEALING "-Xgc:workStealing"
+#define OMR_XGCWORK_STEALING_LENGTH 17
+#define OMR_XGCLOCK_FREE_PACKET_LISTS "-Xgc:lockFreePacketLists"
+#define OMR_XGCLOCK_FREE_PACKET_LISTS_LENGTH 24
+#define OMR_XGCWORK_PACKET_CACHE "-Xgc:workPacketCache"
+#define OMR_XGCWORK_PACKET_CACHE_LENGTH 20
+#define OMR_XGCTREE_BARRIER_SPIN_COUNT "-Xgc:treeBarrierSpinCount="
+#define OMR_XGCTREE_BARRIER_SPIN_COUNT_LENGTH 26
+#define OMR_XGCTREE_BARRIER "-Xgc:treeBarrier"
+#define OMR_XGCTREE_BARRIER_LENGTH 16
+#define OMR_XGCMARKING_PREFETCH_DEPTH "-Xgc:markingPrefetchDepth="
+#define OMR_XGCMARKING_PREFETCH_DEPTH_LENGTH 26
+#define OMR_XGCSCALAR_HEAP_MAP_KERNELS "-Xgc:scalarHeapMapKernels"
+#define OMR_XGCSCALAR_HEAP_MAP_KERNELS_LENGTH 25
+#define OMR_XGCINDEXED_FREE_LIST "-Xgc:indexedFreeList"
+#define OMR_XGCINDEXED_FREE_LIST_LENGTH 20
+#define OMR_XGCADAPTIVE_TLH_SIZING "-Xgc:adaptiveTLHSizing"
+#define OMR_XGCADAPTIVE_TLH_SIZING_LENGTH 22
+#define OMR_XGCTLH_REFRESH_TARGET_INTERVAL "-Xgc:tlhRefreshTargetInterval="
+#define OMR_XGCTLH_REFRESH_TARGET_INTERVAL_LENGTH 30
+#define OMR_XGCALLOCATION_SAMPLING_INTERVAL "-Xgc:allocationSamplingInterval="
+#define OMR_XGCALLOCATION_SAMPLING_INTERVAL_LENGTH 32
+#define OMR_XGCALLOCATION_SAMPLING_TOP_K "-Xgc:allocationSamplingTopK="
+#define OMR_XGCALLOCATION_SAMPLING_TOP_K_LENGTH 28
+#if defined(OMR_GC_MODRON_COMPACTION)
+#define OMR_XGCPARTIAL_COMPACTION_PERCENT "-Xgc:partialCompactionPercent="
+#define OMR_XGCPARTIAL_COMPACTION_PERCENT_LENGTH 30
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+#define OMR_XGCLAZY_SWEEP "-Xgc:lazySweep"
+#define OMR_XGCLAZY_SWEEP_LENGTH 14
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+#define OMR_XGCGC_ON_IDLE "-Xgc:gcOnIdle"
+#define OMR_XGCGC_ON_IDLE_LENGTH 13
+#define OMR_XGCDEFER_FREE_PAGE_RELEASE "-Xgc:deferFreePageRelease"
+#define OMR_XGCDEFER_FREE_PAGE_RELEASE_LENGTH 25
+#define OMR_XGCFREE_PAGE_RELEASE_ALIGNMENT "-Xgc:freePageReleaseAlignment="
+#define OMR_XGCFREE_PAGE_RELEASE_ALIGNMENT_LENGTH 30
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+#if defined(OMR_GC_REALTIME)
+#define OMR_XGCSATB_BUFFER_SIZE "-Xgc:satbBufferSize="
+#define OMR_XGCSATB_BUFFER_SIZE_LENGTH 20
+#endif /* defined(OMR_GC_REALTIME) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#define OMR_XGCLOCK_FREE_REGION_QUEUES "-Xgc:lockFreeRegionQueues"
+#define OMR_XGCLOCK_FREE_REGION_QUEUES_LENGTH 25
+#define OMR_XGCREGION_CACHE_SIZE "-Xgc:regionCacheSize="
+#define OMR_XGCREGION_CACHE_SIZE_LENGTH 21
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#define OMR_XGCBREADTH_FIRST_SCAN_ORDERING "-Xgc:breadthFirstScanOrdering"
+#define OMR_XGCBREADTH_FIRST_SCAN_ORDERING_LENGTH 29
+#define OMR_XGCDYNAMIC_BREADTH_FIRST_SCAN_ORDERING "-Xgc:dynamicBreadthFirstScanOrdering"
+#define OMR_XGCDYNAMIC_BREADTH_FIRST_SCAN_ORDERING_LENGTH 36
+#define OMR_XGCDEPTH_FIRST_SCAN_ORDERING "-Xgc:depthFirstScanOrdering"
+#define OMR_XGCDEPTH_FIRST_SCAN_ORDERING_LENGTH 27
+#define OMR_XGCDEPTH_FIRST_COPY_DEPTH "-Xgc:depthFirstCopyDepth="
+#define OMR_XGCDEPTH_FIRST_COPY_DEPTH_LENGTH 25
+#define OMR_XGCHIERARCHICAL_SCAN_ORDERING "-Xgc:hierarchicalScanOrdering"
+#define OMR_XGCHIERARCHICAL_SCAN_ORDERING_LENGTH 29
+#define OMR_XGCRECORD_REMEMBERED_SET_OVERFLOW "-Xgc:recordRememberedSetOverflow"
+#define OMR_XGCRECORD_REMEMBERED_SET_OVERFLOW_LENGTH 32
+#define OMR_XGCNUMA_AWARE_SCAVENGER_COPY "-Xgc:numaAwareScavengerCopy"
+#define OMR_XGCNUMA_AWARE_SCAVENGER_COPY_LENGTH 27
+#define OMR_XGCSCAVENGER_PAUSE_GOAL "-Xgc:scavengerPauseGoal="
+#define OMR_XGCSCAVENGER_PAUSE_GOAL_LENGTH 24
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+#define OMR_XGCCONCURRENT_SCAVENGE_BACKGROUND "-Xgc:concurrentScavengeBackground="
+#define OMR_XGCCONCURRENT_SCAVENGE_BACKGROUND_LENGTH 34
+#define OMR_XGCCONCURRENT_SCAVENGE "-Xgc:concurrentScavenge"
+#define OMR_XGCCONCURRENT_SCAVENGE_LENGTH 23
+#define OMR_XGCNO_CONCURRENT_SCAVENGE "-Xgc:noConcurrentScavenge"
+#define OMR_XGCNO_CONCURRENT_SCAVENGE_LENGTH 25
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#define OMR_XGCFVTEST_SIMULATED_NUMA_NODE_COUNT "-Xgc:fvtest_simulatedNUMANodeCount="
+#define OMR_XGCFVTEST_SIMULATED_NUMA_NODE_COUNT_LENGTH 35
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
 
@@ -276,6 +354,154 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCWORK_STEALING, OMR_XGCWORK_STEALING_LENGTH)) {
+		extensions->workStealing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCLOCK_FREE_PACKET_LISTS, OMR_XGCLOCK_FREE_PACKET_LISTS_LENGTH)) {
+		extensions->lockFreePacketLists = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCWORK_PACKET_CACHE, OMR_XGCWORK_PACKET_CACHE_LENGTH)) {
+		extensions->workPacketCache = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCTREE_BARRIER_SPIN_COUNT, OMR_XGCTREE_BARRIER_SPIN_COUNT_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCTREE_BARRIER_SPIN_COUNT_LENGTH, &extensions->treeBarrierSpinCount)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCTREE_BARRIER, OMR_XGCTREE_BARRIER_LENGTH)) {
+		extensions->treeBarrier = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCMARKING_PREFETCH_DEPTH, OMR_XGCMARKING_PREFETCH_DEPTH_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCMARKING_PREFETCH_DEPTH_LENGTH, &extensions->markingPrefetchDepth)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSCALAR_HEAP_MAP_KERNELS, OMR_XGCSCALAR_HEAP_MAP_KERNELS_LENGTH)) {
+		extensions->scalarHeapMapKernels = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCINDEXED_FREE_LIST, OMR_XGCINDEXED_FREE_LIST_LENGTH)) {
+		extensions->indexedFreeList = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCADAPTIVE_TLH_SIZING, OMR_XGCADAPTIVE_TLH_SIZING_LENGTH)) {
+		extensions->tlhAdaptiveSizing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCTLH_REFRESH_TARGET_INTERVAL, OMR_XGCTLH_REFRESH_TARGET_INTERVAL_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCTLH_REFRESH_TARGET_INTERVAL_LENGTH, &extensions->tlhRefreshTargetInterval))
+			|| (0 == extensions->tlhRefreshTargetInterval)
+		) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCALLOCATION_SAMPLING_INTERVAL, OMR_XGCALLOCATION_SAMPLING_INTERVAL_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCALLOCATION_SAMPLING_INTERVAL_LENGTH, &extensions->allocationSamplingInterval)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCALLOCATION_SAMPLING_TOP_K, OMR_XGCALLOCATION_SAMPLING_TOP_K_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCALLOCATION_SAMPLING_TOP_K_LENGTH, &extensions->allocationSamplingTopK))
+			|| (0 == extensions->allocationSamplingTopK)
+		) {
+			result = false;
+		}
+	}
+#if defined(OMR_GC_MODRON_COMPACTION)
+	else if (0 == strncmp(option, OMR_XGCPARTIAL_COMPACTION_PERCENT, OMR_XGCPARTIAL_COMPACTION_PERCENT_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCPARTIAL_COMPACTION_PERCENT_LENGTH, &extensions->partialCompactionPercent))
+			|| (100 < extensions->partialCompactionPercent)
+		) {
+			result = false;
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	else if (0 == strncmp(option, OMR_XGCLAZY_SWEEP, OMR_XGCLAZY_SWEEP_LENGTH)) {
+		extensions->concurrentSweep = true;
+		extensions->configurationOptions._forceOptionConcurrentSweep = true;
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	else if (0 == strncmp(option, OMR_XGCGC_ON_IDLE, OMR_XGCGC_ON_IDLE_LENGTH)) {
+		extensions->gcOnIdle = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCDEFER_FREE_PAGE_RELEASE, OMR_XGCDEFER_FREE_PAGE_RELEASE_LENGTH)) {
+		extensions->deferFreePageRelease = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCFREE_PAGE_RELEASE_ALIGNMENT, OMR_XGCFREE_PAGE_RELEASE_ALIGNMENT_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCFREE_PAGE_RELEASE_ALIGNMENT_LENGTH, &extensions->freePageReleaseAlignment)) {
+			result = false;
+		}
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+#if defined(OMR_GC_REALTIME)
+	else if (0 == strncmp(option, OMR_XGCSATB_BUFFER_SIZE, OMR_XGCSATB_BUFFER_SIZE_LENGTH)) {
+		if (!getUDATAValue(option + OMR_XGCSATB_BUFFER_SIZE_LENGTH, &extensions->satbBufferSize)) {
+			result = false;
+		}
+	}
+#endif /* defined(OMR_GC_REALTIME) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	else if (0 == strncmp(option, OMR_XGCLOCK_FREE_REGION_QUEUES, OMR_XGCLOCK_FREE_REGION_QUEUES_LENGTH)) {
+		extensions->lockFreeRegionQueues = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCREGION_CACHE_SIZE, OMR_XGCREGION_CACHE_SIZE_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCREGION_CACHE_SIZE_LENGTH, &extensions->regionCacheSize)) {
+			result = false;
+		}
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCBREADTH_FIRST_SCAN_ORDERING, OMR_XGCBREADTH_FIRST_SCAN_ORDERING_LENGTH)) {
+		extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST;
+	}
+	else if (0 == strncmp(option, OMR_XGCDYNAMIC_BREADTH_FIRST_SCAN_ORDERING, OMR_XGCDYNAMIC_BREADTH_FIRST_SCAN_ORDERING_LENGTH)) {
+		extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST;
+	}
+	else if (0 == strncmp(option, OMR_XGCDEPTH_FIRST_SCAN_ORDERING, OMR_XGCDEPTH_FIRST_SCAN_ORDERING_LENGTH)) {
+		extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DEPTH_FIRST;
+	}
+	else if (0 == strncmp(option, OMR_XGCDEPTH_FIRST_COPY_DEPTH, OMR_XGCDEPTH_FIRST_COPY_DEPTH_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCDEPTH_FIRST_COPY_DEPTH_LENGTH, &extensions->scavengerDepthFirstCopyDepth)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCHIERARCHICAL_SCAN_ORDERING, OMR_XGCHIERARCHICAL_SCAN_ORDERING_LENGTH)) {
+		extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL;
+	}
+	else if (0 == strncmp(option, OMR_XGCRECORD_REMEMBERED_SET_OVERFLOW, OMR_XGCRECORD_REMEMBERED_SET_OVERFLOW_LENGTH)) {
+		extensions->scavengerRecordRememberedSetOverflow = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCNUMA_AWARE_SCAVENGER_COPY, OMR_XGCNUMA_AWARE_SCAVENGER_COPY_LENGTH)) {
+		extensions->scavengerNUMAAwareCopy = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_PAUSE_GOAL, OMR_XGCSCAVENGER_PAUSE_GOAL_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCSCAVENGER_PAUSE_GOAL_LENGTH, &extensions->scavengerPauseGoal)) || (0 == extensions->scavengerPauseGoal)) {
+			result = false;
+		}
+	}
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCCONCURRENT_SCAVENGE_BACKGROUND, OMR_XGCCONCURRENT_SCAVENGE_BACKGROUND_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCCONCURRENT_SCAVENGE_BACKGROUND_LENGTH, &extensions->concurrentScavengerBackgroundThreads)) || (0 == extensions->concurrentScavengerBackgroundThreads)) {
+			result = false;
+		} else {
+			extensions->concurrentScavengerBackgroundThreadsForced = true;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCCONCURRENT_SCAVENGE, OMR_XGCCONCURRENT_SCAVENGE_LENGTH)) {
+		extensions->concurrentScavengerForced = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCNO_CONCURRENT_SCAVENGE, OMR_XGCNO_CONCURRENT_SCAVENGE_LENGTH)) {
+		extensions->concurrentScavengerForced = false;
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	else if (0 == strncmp(option, OMR_XGCFVTEST_SIMULATED_NUMA_NODE_COUNT, OMR_XGCFVTEST_SIMULATED_NUMA_NODE_COUNT_LENGTH)) {
+		uintptr_t simulatedNodeCount = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCFVTEST_SIMULATED_NUMA_NODE_COUNT_LENGTH, &simulatedNodeCount)) {
+			result = false;
+		} else {
+			extensions->_numaManager.setSimulatedNodeCountForFVTest(simulatedNodeCount);
+		}
+	}
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
@@ -48,6 +48,11 @@ public:
 
 	static MM_SweepPoolManagerAddressOrderedList *newInstance(MM_EnvironmentBase *env);
 
+	/**
+	 * Let the pool index the free list the sweep has just built.
+	 */
+	virtual void poolPostProcess(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool);
+
 	/**
 	 * Create a SweepPoolManager object.
 	 */
@@ -83,6 +83,10 @@ MM_TLHAllocationInterface::initialize(MM_EnvironmentBase *env)
 		result = (NULL != _frequentObjectsStats);
 	}
 
+	if (result) {
+		result = initializeAllocationSampling(env);
+	}
+
 	if (result) {
 		reconnect(env, false);
 	}
@@ -100,6 +104,7 @@ MM_TLHAllocationInterface::tearDown(MM_EnvironmentBase *env)
 		_frequentObjectsStats->kill(env);
 		_frequentObjectsStats = NULL;
 	}
+	tearDownAllocationSampling(env);
 }
 
 /**
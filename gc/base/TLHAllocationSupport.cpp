@@ -54,6 +54,12 @@
 #endif /* defined(OMR_VALGRIND_MEMCHECK) */
 
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
+/**
+ * Weight of the history in the per-thread averages used by adaptive TLH sizing.
+ * Low enough that a thread going from idle to busy (or back) is resized within a few refreshes.
+ */
+#define TLH_ADAPTIVE_SIZING_HISTORY_WEIGHT ((float)0.5)
+
 /**
  * Report clearing of a full allocation cache
  */
@@ -163,8 +169,8 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	uintptr_t halfRefreshSize = getRefreshSize() >> 1;
 	uintptr_t abandonSize = (tlhMinimumSize > halfRefreshSize ? tlhMinimumSize : halfRefreshSize);
 	if (sizeInBytesRequired > abandonSize) {
-		/* increase thread hungriness if we did not refresh */
-		if (getRefreshSize() < tlhMaximumSize && sizeInBytesRequired < tlhMaximumSize) {
+		/* increase thread hungriness if we did not refresh; adaptive sizing only changes the size on a refresh */
+		if (!extensions->tlhAdaptiveSizing && (getRefreshSize() < tlhMaximumSize) && (sizeInBytesRequired < tlhMaximumSize)) {
 			setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 		}
 		return false;
@@ -285,7 +291,9 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 			 * may not give you the size requested */
 			/* Increase thread hungriness */
 			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
+			if (extensions->tlhAdaptiveSizing) {
+				adaptRefreshSize(env, usedSize, stats);
+			} else if (getRefreshSize() < tlhMaximumSize) {
 				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 			}
 		}
@@ -295,6 +303,44 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 }
 
 
+void
+MM_TLHAllocationSupport::adaptRefreshSize(MM_EnvironmentBase *env, uintptr_t usedSize, MM_AllocationStats *stats)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t now = omrtime_hires_clock();
+
+	if (0 != _lastRefreshTime) {
+		uint64_t interval = omrtime_hires_delta(_lastRefreshTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		stats->_tlhRefreshInterval += (uintptr_t)interval;
+		/* clock granularity can report back to back refreshes as simultaneous */
+		float intervalSample = (0 == interval) ? (float)1.0 : (float)interval;
+
+		if ((float)0.0 == _refreshIntervalAverage) {
+			_bytesPerRefreshAverage = (float)usedSize;
+			_refreshIntervalAverage = intervalSample;
+		} else {
+			_bytesPerRefreshAverage = MM_Math::weightedAverage(_bytesPerRefreshAverage, (float)usedSize, TLH_ADAPTIVE_SIZING_HISTORY_WEIGHT);
+			_refreshIntervalAverage = MM_Math::weightedAverage(_refreshIntervalAverage, intervalSample, TLH_ADAPTIVE_SIZING_HISTORY_WEIGHT);
+		}
+
+		float targetSize = (_bytesPerRefreshAverage / _refreshIntervalAverage) * (float)extensions->tlhRefreshTargetInterval;
+		uintptr_t refreshSize = extensions->tlhMaximumSize;
+		if (targetSize < (float)extensions->tlhMaximumSize) {
+			refreshSize = OMR_MAX(extensions->tlhMinimumSize, MM_Math::roundToSizeofUDATA((uintptr_t)targetSize));
+		}
+
+		if (refreshSize > getRefreshSize()) {
+			stats->_tlhAdaptiveGrowCount += 1;
+		} else if (refreshSize < getRefreshSize()) {
+			stats->_tlhAdaptiveShrinkCount += 1;
+		}
+		setRefreshSize(refreshSize);
+	}
+
+	_lastRefreshTime = now;
+}
+
 /**
  * Attempt to allocate an object in this TLH.
  */
@@ -357,6 +403,8 @@ MM_TLHAllocationSupport::flushCache(MM_EnvironmentBase *env)
 	/* Since AllocationStats have been reset, reset the base as well*/
 	_abandonedList = NULL;
 	_abandonedListSize = 0;
+	/* Caches are flushed for GC and heap walks, whose pause must not count as time between refreshes */
+	_lastRefreshTime = 0;
 	clear(env);
 }
 
@@ -43,6 +43,7 @@
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 
 class MM_AllocateDescription;
+class MM_AllocationStats;
 class MM_MemoryPool;
 class MM_MemorySubSpace;
 class MM_ObjectAllocationInterface;
@@ -83,6 +84,10 @@ private:
 
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
+	uint64_t _lastRefreshTime; /**< hires clock at the last adaptively sized refresh, or 0 before the first one since the cache was last flushed */
+	float _bytesPerRefreshAverage; /**< weighted average of the bytes used out of each TLH before it was refreshed */
+	float _refreshIntervalAverage; /**< weighted average of the time (in microseconds) between refreshes */
+
 public:
 protected:
 private:
@@ -144,6 +149,14 @@ private:
 	void restart(MM_EnvironmentBase *env);
 	bool refresh(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
 
+	/**
+	 * Size the next refresh so that, at the thread's recent allocation rate, a TLH lasts about
+	 * tlhRefreshTargetInterval. Fast allocating threads get large TLHs and slow ones small TLHs,
+	 * which leaves less of the nursery stranded in idle threads' TLHs at the next collection.
+	 * @param usedSize bytes used out of the TLH that was just retired
+	 */
+	void adaptRefreshSize(MM_EnvironmentBase *env, uintptr_t usedSize, MM_AllocationStats *stats);
+
 	void *allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
 
 	void setupTLH(MM_EnvironmentBase *env, void *addrBase, void *addrTop, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
@@ -191,7 +204,10 @@ private:
 		_objectAllocationInterface(NULL),
 		_abandonedList(NULL),
 		_abandonedListSize(0),
-		_zeroTLH(zeroTLH)
+		_zeroTLH(zeroTLH),
+		_lastRefreshTime(0),
+		_bytesPerRefreshAverage(0.0f),
+		_refreshIntervalAverage(0.0f)
 	{};
 
 	/*
@@ -47,6 +47,7 @@
 
 class MM_EnvironmentBase;
 class MM_ParallelDispatcher;
+class MM_TreeBarrier;
 
 /**
  * @todo Provide class documentation
@@ -89,6 +90,11 @@ public:
 		/* in a Task we don't need a mutex */
 	}
 
+	MMINLINE virtual void setTreeBarrier(MM_TreeBarrier *treeBarrier)
+	{
+		/* in a Task we don't need a barrier */
+	}
+
 	virtual void accept(MM_EnvironmentBase *env);
 	virtual void complete(MM_EnvironmentBase *env);
 
@@ -159,6 +165,30 @@ public:
 	 */
 	virtual bool shouldYieldFromTask(MM_EnvironmentBase *env) { return false; }
 
+	/**
+	 * Called by work distribution code to check if the task wants its threads to keep their work
+	 * in per-worker deques (and steal from each other) rather than going through the shared lists.
+	 * @param env[in] The current thread
+	 * @return true if work stealing should be used for this task
+	 */
+	virtual bool shouldUseWorkStealing(MM_EnvironmentBase *env) { return false; }
+
+	/**
+	 * Called by work distribution code to check if the task's threads may keep a packet or two in their
+	 * work stacks between uses. Only tasks which flush the work stacks of all threads when done may say yes.
+	 * @param env[in] The current thread
+	 * @return true if packets may be cached in the work stack
+	 */
+	virtual bool shouldCacheWorkPackets(MM_EnvironmentBase *env) { return false; }
+
+	/**
+	 * Called by the dispatcher to check if the task wants its synchronize calls to go through the
+	 * combining tree barrier (if one is enabled) rather than the synchronize monitor.
+	 * @param env[in] The main thread
+	 * @return true if the tree barrier should be used for this task
+	 */
+	virtual bool shouldUseTreeBarrier(MM_EnvironmentBase *env) { return false; }
+
 	/**
 	 * Create a Task object.
 	 */
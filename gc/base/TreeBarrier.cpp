@@ -0,0 +1,236 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "TreeBarrier.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "ModronAssertions.h"
+
+/**
+ * Return the number of arrival nodes needed to combine the given number of threads.
+ */
+static uintptr_t
+countArrivalNodes(uintptr_t threadCount)
+{
+	uintptr_t nodeCount = 0;
+	uintptr_t children = threadCount;
+
+	do {
+		children = (children + TREE_BARRIER_FAN_IN - 1) / TREE_BARRIER_FAN_IN;
+		nodeCount += children;
+	} while (children > 1);
+
+	return nodeCount;
+}
+
+MM_TreeBarrier *
+MM_TreeBarrier::newInstance(MM_EnvironmentBase *env, uintptr_t threadCountMaximum, uintptr_t spinCount)
+{
+	MM_TreeBarrier *barrier = (MM_TreeBarrier *)env->getForge()->allocate(sizeof(MM_TreeBarrier), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != barrier) {
+		new(barrier) MM_TreeBarrier();
+		if (!barrier->initialize(env, threadCountMaximum, spinCount)) {
+			barrier->kill(env);
+			barrier = NULL;
+		}
+	}
+	return barrier;
+}
+
+void
+MM_TreeBarrier::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_TreeBarrier::initialize(MM_EnvironmentBase *env, uintptr_t threadCountMaximum, uintptr_t spinCount)
+{
+	OMR::GC::Forge *forge = env->getForge();
+	uintptr_t nodeCount = countArrivalNodes(threadCountMaximum);
+
+	_threadCountMaximum = threadCountMaximum;
+	_spinCount = spinCount;
+
+	_nodes = (ArrivalNode *)forge->allocate(nodeCount * sizeof(ArrivalNode), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	_threads = (omrthread_t *)forge->allocate(threadCountMaximum * sizeof(omrthread_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	_slotOfWorker = (uintptr_t *)forge->allocate(threadCountMaximum * sizeof(uintptr_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if ((NULL == _nodes) || (NULL == _threads) || (NULL == _slotOfWorker)) {
+		return false;
+	}
+	memset(_nodes, 0, nodeCount * sizeof(ArrivalNode));
+	memset(_threads, 0, threadCountMaximum * sizeof(omrthread_t));
+	memset(_slotOfWorker, 0, threadCountMaximum * sizeof(uintptr_t));
+
+	return true;
+}
+
+void
+MM_TreeBarrier::tearDown(MM_EnvironmentBase *env)
+{
+	OMR::GC::Forge *forge = env->getForge();
+
+	if (NULL != _nodes) {
+		forge->free(_nodes);
+		_nodes = NULL;
+	}
+	if (NULL != _threads) {
+		forge->free(_threads);
+		_threads = NULL;
+	}
+	if (NULL != _slotOfWorker) {
+		forge->free(_slotOfWorker);
+		_slotOfWorker = NULL;
+	}
+}
+
+void
+MM_TreeBarrier::reset(uintptr_t threadCount)
+{
+	Assert_MM_true((0 < threadCount) && (threadCount <= _threadCountMaximum));
+
+	uintptr_t levelStart = 0;
+	uintptr_t previousLevelStart = 0;
+	uintptr_t children = threadCount;
+	bool leafLevel = true;
+
+	/* Build the tree one level at a time, each node combining up to TREE_BARRIER_FAN_IN children of the level below */
+	do {
+		uintptr_t levelWidth = (children + TREE_BARRIER_FAN_IN - 1) / TREE_BARRIER_FAN_IN;
+		for (uintptr_t i = 0; i < levelWidth; i++) {
+			ArrivalNode *node = &_nodes[levelStart + i];
+			uintptr_t remaining = children - (i * TREE_BARRIER_FAN_IN);
+			node->_arrived = 0;
+			node->_expected = OMR_MIN(remaining, TREE_BARRIER_FAN_IN);
+			node->_parent = NULL;
+		}
+		if (!leafLevel) {
+			for (uintptr_t i = 0; i < children; i++) {
+				_nodes[previousLevelStart + i]._parent = &_nodes[levelStart + (i / TREE_BARRIER_FAN_IN)];
+			}
+		}
+		leafLevel = false;
+		previousLevelStart = levelStart;
+		levelStart += levelWidth;
+		children = levelWidth;
+	} while (children > 1);
+
+	_threadCount = threadCount;
+	_nextSlot = 0;
+	_mainSlot = 0;
+}
+
+void
+MM_TreeBarrier::registerThread(MM_EnvironmentBase *env)
+{
+	uintptr_t slot = MM_AtomicOperations::add(&_nextSlot, 1) - 1;
+	Assert_MM_true(slot < _threadCount);
+
+	_slotOfWorker[env->getWorkerID()] = slot;
+	_threads[slot] = env->getOmrVMThread()->_os_thread;
+	if (env->isMainThread()) {
+		_mainSlot = slot;
+	}
+}
+
+bool
+MM_TreeBarrier::arrive(MM_EnvironmentBase *env)
+{
+	ArrivalNode *node = &_nodes[_slotOfWorker[env->getWorkerID()] / TREE_BARRIER_FAN_IN];
+
+	while (true) {
+		if (MM_AtomicOperations::add(&node->_arrived, 1) < node->_expected) {
+			return false;
+		}
+		/* last to arrive at this node - nobody else touches it until the barrier is released */
+		node->_arrived = 0;
+		if (NULL == node->_parent) {
+			return true;
+		}
+		node = node->_parent;
+	}
+}
+
+bool
+MM_TreeBarrier::wait(MM_EnvironmentBase *env, uintptr_t episode, bool mainMayLeaveEarly)
+{
+	uintptr_t spins = 0;
+
+	while (episode == _episode) {
+		if (mainMayLeaveEarly && ((episode + 1) == _mainReleasedEpisode)) {
+			return true;
+		}
+		if (spins < _spinCount) {
+			spins += 1;
+			MM_AtomicOperations::yieldCPU();
+		} else if (0 != omrthread_park(0, 0)) {
+			/* interrupted - the flag is not cleared by park so don't spin on it */
+			omrthread_yield();
+		}
+	}
+	MM_AtomicOperations::readBarrier();
+
+	wakeChildren(_slotOfWorker[env->getWorkerID()]);
+
+	return false;
+}
+
+void
+MM_TreeBarrier::release(MM_EnvironmentBase *env)
+{
+	uintptr_t slot = _slotOfWorker[env->getWorkerID()];
+
+	/* everything written by the owner must be visible before the waiters see the new episode */
+	MM_AtomicOperations::add(&_episode, 1);
+
+	/* the wake up tree is rooted at slot 0, if the owner is elsewhere in the tree slot 0 has to be woken as well */
+	if (0 != slot) {
+		omrthread_unpark(_threads[0]);
+	}
+	wakeChildren(slot);
+}
+
+void
+MM_TreeBarrier::releaseMain(MM_EnvironmentBase *env, uintptr_t episode)
+{
+	Assert_MM_false(env->isMainThread());
+
+	MM_AtomicOperations::writeBarrier();
+	_mainReleasedEpisode = episode + 1;
+	MM_AtomicOperations::readWriteBarrier();
+	omrthread_unpark(_threads[_mainSlot]);
+}
+
+void
+MM_TreeBarrier::wakeChildren(uintptr_t slot)
+{
+	uintptr_t child = (2 * slot) + 1;
+
+	if (child < _threadCount) {
+		omrthread_unpark(_threads[child]);
+		child += 1;
+		if (child < _threadCount) {
+			omrthread_unpark(_threads[child]);
+		}
+	}
+}
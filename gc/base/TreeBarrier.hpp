@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(TREEBARRIER_HPP_)
+#define TREEBARRIER_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+#include "omrthread.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+/* Number of threads (or child nodes) combined by each node of the arrival tree */
+#define TREE_BARRIER_FAN_IN 4
+/* Size each arrival node is padded to, so that neighbouring nodes do not share a cache line */
+#define TREE_BARRIER_NODE_SIZE 128
+
+/**
+ * Combining tree barrier used by parallel tasks in place of the synchronize monitor.
+ * Threads arrive at a leaf node shared with at most TREE_BARRIER_FAN_IN - 1 other threads; the last thread to
+ * arrive at a node carries the arrival up to the parent, so no single location is contended by all threads.
+ * The thread completing the root owns the barrier and releases it by advancing the episode (sense reversal).
+ * Waiting threads spin for a bounded number of iterations and then park. Wake ups are propagated down a
+ * binary tree of slots so that the releasing thread only unparks a few threads itself.
+ * @ingroup GC_Base
+ */
+class MM_TreeBarrier : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	struct ArrivalNode {
+		volatile uintptr_t _arrived; /**< Number of threads (or child nodes) which arrived in the current episode */
+		uintptr_t _expected; /**< Number of threads (or child nodes) which have to arrive to complete the node */
+		ArrivalNode *_parent; /**< Parent node, NULL for the root */
+		uint8_t _padding[TREE_BARRIER_NODE_SIZE - (2 * sizeof(uintptr_t)) - sizeof(ArrivalNode *)];
+	};
+
+	ArrivalNode *_nodes; /**< Arrival nodes, leaves first, sized for the maximum thread count */
+	omrthread_t *_threads; /**< OS thread registered for each slot in the current task */
+	uintptr_t *_slotOfWorker; /**< Slot assigned to each worker ID in the current task */
+	uintptr_t _threadCountMaximum; /**< Maximum number of threads the barrier was sized for */
+	uintptr_t _threadCount; /**< Number of threads taking part in the current task */
+	uintptr_t _spinCount; /**< Number of spin iterations before a waiting thread parks */
+	volatile uintptr_t _nextSlot; /**< Next slot to hand out to a thread accepting the current task */
+	volatile uintptr_t _episode; /**< Incremented every time the barrier is released */
+	volatile uintptr_t _mainReleasedEpisode; /**< Set to episode + 1 when the main thread is released alone from that episode */
+	uintptr_t _mainSlot; /**< Slot of the main thread in the current task */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	void wakeChildren(uintptr_t slot);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t threadCountMaximum, uintptr_t spinCount);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_TreeBarrier *newInstance(MM_EnvironmentBase *env, uintptr_t threadCountMaximum, uintptr_t spinCount);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Rebuild the arrival tree for a task run by the given number of threads.
+	 * Must be called before any thread accepts the task.
+	 */
+	void reset(uintptr_t threadCount);
+
+	/**
+	 * Assign the calling thread a slot in the barrier. Called by every thread accepting the task.
+	 */
+	void registerThread(MM_EnvironmentBase *env);
+
+	/**
+	 * The episode must be read before arriving and passed to wait().
+	 */
+	MMINLINE uintptr_t getEpisode() { return _episode; }
+
+	/**
+	 * Record the arrival of the calling thread.
+	 * @return true if the calling thread was the last to arrive (and now owns the barrier), false otherwise
+	 */
+	bool arrive(MM_EnvironmentBase *env);
+
+	/**
+	 * Wait until the barrier owner releases the given episode.
+	 * @param episode[in] the episode read before arriving
+	 * @param mainMayLeaveEarly[in] true if the caller is the main thread and may be released alone by releaseMain()
+	 * @return true if the main thread was released alone, false if the barrier was released
+	 */
+	bool wait(MM_EnvironmentBase *env, uintptr_t episode, bool mainMayLeaveEarly);
+
+	/**
+	 * Release all threads waiting for the current episode. Must only be called by the owner of the barrier.
+	 */
+	void release(MM_EnvironmentBase *env);
+
+	/**
+	 * Release only the main thread from the given episode, the owner of the barrier then waits like the other threads.
+	 * The main thread is expected to call release() once done.
+	 */
+	void releaseMain(MM_EnvironmentBase *env, uintptr_t episode);
+
+	/**
+	 * Create a TreeBarrier object.
+	 */
+	MM_TreeBarrier()
+		: MM_BaseNonVirtual()
+		, _nodes(NULL)
+		, _threads(NULL)
+		, _slotOfWorker(NULL)
+		, _threadCountMaximum(0)
+		, _threadCount(0)
+		, _spinCount(0)
+		, _nextSlot(0)
+		, _episode(0)
+		, _mainReleasedEpisode(0)
+		, _mainSlot(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* TREEBARRIER_HPP_ */
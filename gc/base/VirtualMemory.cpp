@@ -241,6 +241,28 @@ MM_VirtualMemory::commitMemory(void* address, uintptr_t size)
  */
 bool
 MM_VirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress)
+{
+	return decommitRange(address, size, lowValidAddress, highValidAddress, &_identifier);
+}
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+/**
+ * Decommit the address range from physical memory, allowing the OS to leave the pages mapped until it is short of memory.
+ * The parameters are as for decommitMemory().
+ * @return true if successful, false otherwise.
+ */
+bool
+MM_VirtualMemory::decommitMemoryLazily(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress)
+{
+	/* only this decommit is lazy, the rest of the reservation keeps its mode */
+	J9PortVmemIdentifier identifier = _identifier;
+	identifier.mode |= OMRPORT_VMEM_MEMORY_MODE_DECOMMIT_LAZILY;
+	return decommitRange(address, size, lowValidAddress, highValidAddress, &identifier);
+}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
+bool
+MM_VirtualMemory::decommitRange(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress, J9PortVmemIdentifier* identifier)
 {
 	bool result = true;
 	void* decommitBase = address;
@@ -272,7 +294,7 @@ MM_VirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowValidAd
 	if (decommitBase < decommitTop) {
 		/* There is still memory to decommit, calculate size */
 		uintptr_t decommitSize = ((uintptr_t)decommitTop) - ((uintptr_t)decommitBase);
-		result = omrvmem_decommit_memory(decommitBase, decommitSize, &_identifier) == 0;
+		result = omrvmem_decommit_memory(decommitBase, decommitSize, identifier) == 0;
 	}
 
 	return result;
@@ -70,6 +70,7 @@ public:
  */
 private:
 	bool freeMemory();
+	bool decommitRange(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress, J9PortVmemIdentifier* identifier);
 
 protected:
 	/*
@@ -108,6 +109,9 @@ protected:
 
 	virtual bool commitMemory(void* address, uintptr_t size);
 	virtual bool decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	virtual bool decommitMemoryLazily(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 	void roundDownTop(uintptr_t rounding);
 
 	/*
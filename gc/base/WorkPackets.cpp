@@ -120,6 +120,12 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	if (_extensions->workStealing) {
+		if (!initializeStealingDeques(env)) {
+			return false;
+		}
+	}
+
 	if(0 != _extensions->workpacketCount) {
 		/* -Xgcworkpackets was specified, so base the number on that */
 		initialPacketCount = _extensions->workpacketCount;
@@ -148,6 +154,16 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 	for(uintptr_t i = 0; i < _maxPacketsBlocks; i++) {    
 		_packetsStart[i] = NULL;
 	}
+
+	if (_extensions->lockFreePacketLists) {
+		/* the lists find packets by index, so this has to happen once the block size is known and before any packet is pushed */
+		_emptyPacketList.enableLockFree(_packetsStart, _packetsPerBlock);
+		_fullPacketList.enableLockFree(_packetsStart, _packetsPerBlock);
+		_relativelyFullPacketList.enableLockFree(_packetsStart, _packetsPerBlock);
+		_nonEmptyPacketList.enableLockFree(_packetsStart, _packetsPerBlock);
+		_deferredPacketList.enableLockFree(_packetsStart, _packetsPerBlock);
+		_deferredFullPacketList.enableLockFree(_packetsStart, _packetsPerBlock);
+	}
 	
 	/* now allocate the initial active packets */
 	while(initialPacketCount > _activePackets) {
@@ -159,6 +175,48 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 	return true;
 }
 
+/**
+ * Allocate one work stealing deque for each GC thread
+ * @return true on success, false otherwise
+ */
+bool
+MM_WorkPackets::initializeStealingDeques(MM_EnvironmentBase *env)
+{
+	uintptr_t dequeCount = _extensions->gcThreadCount;
+
+	_stealingDeques = (MM_WorkStealingDeque *)env->getForge()->allocate(dequeCount * sizeof(MM_WorkStealingDeque), OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL == _stealingDeques) {
+		return false;
+	}
+
+	for (uintptr_t i = 0; i < dequeCount; i++) {
+		new(&_stealingDeques[i]) MM_WorkStealingDeque();
+	}
+	_stealingDequeCount = dequeCount;
+
+	for (uintptr_t i = 0; i < dequeCount; i++) {
+		/* seed each worker differently so that thieves spread out over the victims */
+		if (!_stealingDeques[i].initialize(env, _extensions->workStealingDequeSize, (i + 1) * 0x9E3779B9)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void
+MM_WorkPackets::tearDownStealingDeques(MM_EnvironmentBase *env)
+{
+	if (NULL != _stealingDeques) {
+		for (uintptr_t i = 0; i < _stealingDequeCount; i++) {
+			_stealingDeques[i].tearDown(env);
+		}
+		env->getForge()->free(_stealingDeques);
+		_stealingDeques = NULL;
+		_stealingDequeCount = 0;
+	}
+}
+
 /**
  * Allocate another workpacket block
  * @return true on sucess, false on allocation failure or if _maxpackets is already reached
@@ -194,6 +252,7 @@ MM_WorkPackets::initWorkPacketsBlock(MM_EnvironmentBase *env)
 	for(uintptr_t i = 0; i < _packetsPerBlock; i++) {
 		baseAddress = (uintptr_t *) (dataStart + (i * dataSize));
 		currentPtr->initialize(env, nextPtr, previousPtr, baseAddress, _slotsInPacket);
+		currentPtr->setPacketIndex((_packetsBlocksTop * _packetsPerBlock) + i);
 
 		previousPtr = currentPtr;
 		currentPtr += 1;
@@ -224,6 +283,8 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase *env)
 		_overflowHandler = NULL;
 	}
 
+	tearDownStealingDeques(env);
+
 	for(uintptr_t i = 0; i < _packetsBlocksTop; i++) {
 		if(NULL != _packetsStart[i]) {
 			env->getForge()->free(_packetsStart[i]);
@@ -286,6 +347,13 @@ MM_WorkPackets::resetAllPackets(MM_EnvironmentBase *env)
 		putPacket(env, packet);
 	}
 
+	for (uintptr_t i = 0; i < _stealingDequeCount; i++) {
+		while(NULL != (packet = (MM_Packet *)_stealingDeques[i].steal())) {
+			packet->resetData(env);
+			putPacket(env, packet);
+		}
+	}
+
 	/* Do sanity check on ctrs */	
 	assume0(_deferredFullPacketList.getCount() == 0);
 	assume0(_deferredPacketList.getCount() == 0);
@@ -384,7 +452,14 @@ MM_WorkPackets::getInputPacketFromOverflow(MM_EnvironmentBase *env)
 MM_Packet *
 MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 {
-	MM_Packet *packet;
+	MM_Packet *packet = getPacketFromStealingDeque(env);
+
+	if (NULL != packet) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats.workPacketsAcquired += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		return packet;
+	}
 
 	if (!inputPacketAvailable(env)) {
 		return NULL;
@@ -411,6 +486,7 @@ MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 	if(NULL != packet) {
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		env->_workPacketStats.workPacketsAcquired += 1;
+		env->_workPacketStats.workPacketsGlobalHits += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 		if((_inputListWaitCount > 0) && inputPacketAvailable(env)) {
 			notifyWaitingThreads(env);
@@ -435,6 +511,10 @@ MM_WorkPackets::getInputPacket(MM_EnvironmentBase *env)
 	
 	while(!doneFlag) {
 		if (!mustSyncThreadsAndExit) {
+			/* Try to steal before going to sleep, the shared lists do not see work held in deques */
+			if (NULL != (packet = getPacketFromStealingDeque(env))) {
+				return packet;
+			}
 			while (inputPacketAvailable(env)) {
 				/* Check if the regular cache list has work to be done */
 				if(NULL != (packet = getInputPacketNoWait(env))) {
@@ -762,7 +842,130 @@ MM_WorkPackets::putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	env->_workPacketStats.workPacketsReleased += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
-	putPacket(env, packet);
+	if (!putPacketToStealingDeque(env, packet)) {
+		putPacket(env, packet);
+	}
+}
+
+bool
+MM_WorkPackets::shouldCachePacket(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	bool result = false;
+
+	if ((NULL != env->_currentTask) && env->_currentTask->shouldCacheWorkPackets(env)) {
+		if (packet->isEmpty()) {
+			/* nobody else can do anything with an empty packet besides filling it */
+			result = true;
+		} else {
+			/* Work must stay visible to sleeping threads, and when the deque is in use it already keeps the packet local */
+			result = (0 == _inputListWaitCount) && (NULL == getStealingDeque(env));
+		}
+	}
+
+	return result;
+}
+
+MM_WorkStealingDeque *
+MM_WorkPackets::getStealingDeque(MM_EnvironmentBase *env)
+{
+	MM_WorkStealingDeque *deque = NULL;
+
+	if ((NULL != _stealingDeques) && (NULL != env->_currentTask) && env->_currentTask->shouldUseWorkStealing(env)) {
+		uintptr_t workerID = env->getWorkerID();
+		if (workerID < _stealingDequeCount) {
+			deque = &_stealingDeques[workerID];
+		}
+	}
+
+	return deque;
+}
+
+bool
+MM_WorkPackets::putPacketToStealingDeque(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	bool result = false;
+
+	/* While other threads are waiting for work feed them through the shared lists, they can not steal while asleep */
+	if ((0 == _inputListWaitCount) && !packet->isEmpty()) {
+		MM_WorkStealingDeque *deque = getStealingDeque(env);
+		if (NULL != deque) {
+			/* the packet may be stolen as soon as it is pushed */
+			packet->resetOwner();
+			result = deque->push(packet);
+			if (!result) {
+				packet->setOwner(env);
+			}
+		}
+	}
+
+	return result;
+}
+
+MM_Packet *
+MM_WorkPackets::getPacketFromStealingDeque(MM_EnvironmentBase *env)
+{
+	MM_WorkStealingDeque *deque = getStealingDeque(env);
+	MM_Packet *packet = NULL;
+
+	if (NULL != deque) {
+		packet = (MM_Packet *)deque->pop();
+		if (NULL != packet) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.workPacketsLocalHits += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			if ((0 < _inputListWaitCount) && !deque->isEmpty()) {
+				/* Other threads are starving - share our oldest packet through the shared lists (which wakes them up) */
+				MM_Packet *sharedPacket = (MM_Packet *)deque->steal();
+				if (NULL != sharedPacket) {
+					putPacket(env, sharedPacket);
+				}
+			}
+		} else {
+			packet = stealPacket(env, deque);
+		}
+
+		if (NULL != packet) {
+			packet->setOwner(env);
+		}
+	}
+
+	return packet;
+}
+
+MM_Packet *
+MM_WorkPackets::stealPacket(MM_EnvironmentBase *env, MM_WorkStealingDeque *thiefDeque)
+{
+	if (!thiefDeque->isNumaNodeKnown()) {
+		thiefDeque->setNumaNode(env->getNumaAffinity());
+	}
+
+	uintptr_t thiefNode = thiefDeque->getNumaNode();
+	uintptr_t start = thiefDeque->nextRandom() % _stealingDequeCount;
+	/* Without NUMA affinity every victim is local and a single pass is enough */
+	uintptr_t passes = (0 == thiefNode) ? 1 : 2;
+
+	for (uintptr_t pass = 0; pass < passes; pass++) {
+		bool localPass = (0 == pass);
+		for (uintptr_t i = 0; i < _stealingDequeCount; i++) {
+			MM_WorkStealingDeque *victim = &_stealingDeques[(start + i) % _stealingDequeCount];
+			if ((victim == thiefDeque) || victim->isEmpty()) {
+				continue;
+			}
+			bool localVictim = (0 == thiefNode) || (victim->getNumaNode() == thiefNode);
+			if (localVictim == localPass) {
+				MM_Packet *packet = (MM_Packet *)victim->steal();
+				if (NULL != packet) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+					env->_workPacketStats.workPacketsStolen += 1;
+					env->_workPacketStats.workPacketsGlobalHits += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+					return packet;
+				}
+			}
+		}
+	}
+
+	return NULL;
 }
 
 /**
@@ -38,6 +38,7 @@
 #include "Packet.hpp"
 #include "PacketList.hpp"
 #include "WorkPacketOverflow.hpp"
+#include "WorkStealingDeque.hpp"
 
 class MM_EnvironmentBase;
 class MM_GCExtensionsBase;
@@ -89,6 +90,9 @@ protected:
 	MM_WorkPacketOverflow *_overflowHandler;
 	MM_GCExtensionsBase *_extensions;
 
+	MM_WorkStealingDeque *_stealingDeques; /**< Per-worker deques of packets, indexed by worker ID (NULL if work stealing is disabled) */
+	uintptr_t _stealingDequeCount; /**< Number of entries in _stealingDeques */
+
 	void emptyToOverflow(MM_EnvironmentBase *env, MM_Packet *packet, MM_OverflowType type);
 	virtual MM_Packet *getInputPacketFromOverflow(MM_EnvironmentBase *env);
 	bool initWorkPacketsBlock(MM_EnvironmentBase *env);
@@ -96,6 +100,35 @@ protected:
 	MM_Packet *getPacket(MM_EnvironmentBase *env, MM_PacketList *list);
 	MM_Packet *getLeastFullPacket(MM_EnvironmentBase *env, int requiredSlots);
 
+	bool initializeStealingDeques(MM_EnvironmentBase *env);
+	void tearDownStealingDeques(MM_EnvironmentBase *env);
+
+	/**
+	 * Find the work stealing deque owned by the calling thread.
+	 * @return the deque, or NULL if the current task does not use work stealing
+	 */
+	MM_WorkStealingDeque *getStealingDeque(MM_EnvironmentBase *env);
+
+	/**
+	 * Keep a packet in the calling thread's work stealing deque instead of the shared lists.
+	 * @return true if the packet was pushed, false if the caller must put it on the shared lists
+	 */
+	bool putPacketToStealingDeque(MM_EnvironmentBase *env, MM_Packet *packet);
+
+	/**
+	 * Get an input packet from the calling thread's work stealing deque, or steal one from another thread.
+	 * @return a packet, or NULL if none could be found
+	 */
+	MM_Packet *getPacketFromStealingDeque(MM_EnvironmentBase *env);
+
+	/**
+	 * Steal a packet from another worker. Victims are visited from a random starting point, and
+	 * workers known to be on the same NUMA node as the thief are tried before remote ones.
+	 * @param thiefDeque[in] The deque owned by the calling thread
+	 * @return a packet, or NULL if all other deques appeared empty
+	 */
+	MM_Packet *stealPacket(MM_EnvironmentBase *env, MM_WorkStealingDeque *thiefDeque);
+
 	virtual bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
 	
@@ -116,6 +149,16 @@ public:
 	virtual MM_Packet *getOutputPacket(MM_EnvironmentBase *env);
 	void putPacket(MM_EnvironmentBase *env, MM_Packet *packet);
 	void putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+
+	/**
+	 * Determine whether a thread may keep the given packet in its work stack cache instead of handing it
+	 * to the shared lists. Empty packets may always be kept by tasks which cache packets; packets holding
+	 * work only while no thread is waiting for input.
+	 * @param env[in] The current thread
+	 * @param packet[in] The packet the thread is done with
+	 * @return true if the packet may be cached
+	 */
+	bool shouldCachePacket(MM_EnvironmentBase *env, MM_Packet *packet);
 	
 	MM_Packet *getDeferredPacket(MM_EnvironmentBase *env);
 	void putDeferredPacket(MM_EnvironmentBase *env, MM_Packet *packet);
@@ -235,7 +278,9 @@ public:
 		_inputListMonitor(NULL),
 		_inputListWaitCount(0),
 		_inputListDoneIndex(0),
-		_overflowHandler(NULL)
+		_overflowHandler(NULL),
+		_stealingDeques(NULL),
+		_stealingDequeCount(0)
 	{
 		_typeId = __FUNCTION__;
 	}
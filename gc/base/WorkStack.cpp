@@ -46,6 +46,8 @@ MM_WorkStack::reset(MM_EnvironmentBase *env, MM_WorkPackets *workPackets)
 	Assert_MM_true(NULL == _inputPacket);
 	Assert_MM_true(NULL == _outputPacket);
 	Assert_MM_true(NULL == _deferredPacket);
+	Assert_MM_true(NULL == _cachedEmptyPacket);
+	Assert_MM_true(NULL == _cachedFullPacket);
 }
 
 void
@@ -57,6 +59,8 @@ MM_WorkStack::prepareForWork(MM_EnvironmentBase *env, MM_WorkPackets *workPacket
 		Assert_MM_true(NULL == _inputPacket);
 		Assert_MM_true(NULL == _outputPacket);
 		Assert_MM_true(NULL == _deferredPacket);
+		Assert_MM_true(NULL == _cachedEmptyPacket);
+		Assert_MM_true(NULL == _cachedFullPacket);
 	} else {
 		Assert_MM_true(_workPackets == workPackets);
 	}
@@ -83,6 +87,14 @@ MM_WorkStack::flush(MM_EnvironmentBase *env)
 		_workPackets->putDeferredPacket(env, _deferredPacket);
 		_deferredPacket = NULL;
 	}	
+	if(NULL != _cachedEmptyPacket) {
+		_workPackets->putPacket(env, _cachedEmptyPacket);
+		_cachedEmptyPacket = NULL;
+	}
+	if(NULL != _cachedFullPacket) {
+		_workPackets->putPacket(env, _cachedFullPacket);
+		_cachedFullPacket = NULL;
+	}
 	_workPackets = NULL;
 }
 
@@ -135,8 +147,7 @@ MM_WorkStack::popNoWaitFailed(MM_EnvironmentBase *env)
 {
 	if(NULL != _inputPacket) {
 		/* The current input packet has been used up - return it to the output list for resuse */
-		_workPackets->putPacket(env, _inputPacket);
-		_inputPacket = NULL;
+		releaseInputPacket(env);
 	}
 
 	bool tryRetrieveInputPacket = true;
@@ -192,8 +203,7 @@ MM_WorkStack::popFailed(MM_EnvironmentBase *env)
 {
 	if(NULL != _inputPacket) {
 		/* The current input packet has been used up - return it to the output list for reuse */
-		_workPackets->putPacket(env, _inputPacket);
-		_inputPacket = NULL;
+		releaseInputPacket(env);
 	}
 
 	bool tryRetrieveInputPacket = true;
@@ -226,11 +236,11 @@ void MM_WorkStack::pushFailed(MM_EnvironmentBase *env, void *element)
 {
 	if(_outputPacket) {
 		/* The output packet is full - move it to the input list */
-		_workPackets->putOutputPacket(env, _outputPacket);
+		releaseOutputPacket(env);
 	}
 
 	/* Get a new output packet */
-	_outputPacket = _workPackets->getOutputPacket(env);
+	acquireOutputPacket(env);
 	if (NULL == _outputPacket) {
 		_workPackets->overflowItem(env, element, OVERFLOW_TYPE_WORKSTACK);
 	} else {
@@ -244,11 +254,11 @@ void MM_WorkStack::pushFailed(MM_EnvironmentBase *env, void *element1, void *ele
 {
 	if(_outputPacket) {
 		/* The output packet is full - move it to the input list */
-		_workPackets->putOutputPacket(env, _outputPacket);
+		releaseOutputPacket(env);
 	}
 
 	/* Get a new output packet */
-	_outputPacket = _workPackets->getOutputPacket(env);
+	acquireOutputPacket(env);
 	if (NULL == _outputPacket) {
 		_workPackets->overflowItem(env, element1, OVERFLOW_TYPE_WORKSTACK);
 		_workPackets->overflowItem(env, element2, OVERFLOW_TYPE_WORKSTACK);
@@ -271,6 +281,10 @@ MM_WorkStack::flushOutputPacket(MM_EnvironmentBase *env)
 		_workPackets->putOutputPacket(env, _outputPacket);
 		_outputPacket = NULL;
 	}
+	if (NULL != _cachedFullPacket) {
+		_workPackets->putOutputPacket(env, _cachedFullPacket);
+		_cachedFullPacket = NULL;
+	}
 }
 
 void *
@@ -282,8 +296,7 @@ MM_WorkStack::popNoWaitFromCurrentInputPacket(MM_EnvironmentBase *env)
 		result = _inputPacket->pop(env);
 		if (NULL == result) {
 			/* The current input packet has been used up - return it to the output list for reuse */
-			_workPackets->putPacket(env, _inputPacket);
-			_inputPacket = NULL;
+			releaseInputPacket(env);
 		}
 	}
 	return result;
@@ -295,9 +308,65 @@ MM_WorkStack::inputPacketAvailableFromWorkPackets(MM_EnvironmentBase *env)
 	return _workPackets->inputPacketAvailable(env);
 }
 
+void
+MM_WorkStack::releaseInputPacket(MM_EnvironmentBase *env)
+{
+	if ((NULL == _cachedEmptyPacket) && _workPackets->shouldCachePacket(env, _inputPacket)) {
+		_cachedEmptyPacket = _inputPacket;
+	} else {
+		_workPackets->putPacket(env, _inputPacket);
+	}
+	_inputPacket = NULL;
+}
+
+void
+MM_WorkStack::releaseOutputPacket(MM_EnvironmentBase *env)
+{
+	if (NULL != _cachedFullPacket) {
+		/* Hand the older packet over first so that the cache never holds back more than one packet of work */
+		_workPackets->putOutputPacket(env, _cachedFullPacket);
+		_cachedFullPacket = NULL;
+	}
+
+	if (_workPackets->shouldCachePacket(env, _outputPacket)) {
+		_cachedFullPacket = _outputPacket;
+	} else {
+		_workPackets->putOutputPacket(env, _outputPacket);
+	}
+	_outputPacket = NULL;
+}
+
+void
+MM_WorkStack::acquireOutputPacket(MM_EnvironmentBase *env)
+{
+	if (NULL != _cachedEmptyPacket) {
+		_outputPacket = _cachedEmptyPacket;
+		_cachedEmptyPacket = NULL;
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats.workPacketsLocalHits += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	} else {
+		_outputPacket = _workPackets->getOutputPacket(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		if (NULL != _outputPacket) {
+			env->_workPacketStats.workPacketsGlobalHits += 1;
+		}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	}
+}
+
 bool
 MM_WorkStack::retrieveInputPacket(MM_EnvironmentBase *env)
 {
+	if (NULL != _cachedFullPacket) {
+		_inputPacket = _cachedFullPacket;
+		_cachedFullPacket = NULL;
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats.workPacketsLocalHits += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		return true;
+	}
+
 	_inputPacket = _workPackets->getInputPacketNoWait(env);
 	if (NULL == _inputPacket) {
 		/* If the output packet contains at least a free entry - invert the input/output */
@@ -49,6 +49,8 @@ private:
 	MM_Packet *_inputPacket;
 	MM_Packet *_outputPacket;
 	MM_Packet *_deferredPacket;
+	MM_Packet *_cachedEmptyPacket; /**< An empty packet kept for the next output packet instead of going through the shared lists */
+	MM_Packet *_cachedFullPacket; /**< A full output packet kept for the next input packet instead of going through the shared lists */
 	
 	uintptr_t 		_pushCount;
 
@@ -85,6 +87,24 @@ private:
 	 */
 	void *popNoWaitFailed(MM_EnvironmentBase *env);
 
+	/**
+	 * Give up the used up input packet, either to the packet cache or to the shared lists
+	 * @param env[in] The thread which owns the work stack
+	 */
+	void releaseInputPacket(MM_EnvironmentBase *env);
+
+	/**
+	 * Give up the full output packet, either to the packet cache or to the shared lists
+	 * @param env[in] The thread which owns the work stack
+	 */
+	void releaseOutputPacket(MM_EnvironmentBase *env);
+
+	/**
+	 * Find a new output packet, preferring the cached empty packet
+	 * @param env[in] The thread which owns the work stack
+	 */
+	void acquireOutputPacket(MM_EnvironmentBase *env);
+
 public:
 	void reset(MM_EnvironmentBase *env, MM_WorkPackets *workPackets);
 	/**
@@ -231,7 +251,9 @@ public:
 		_workPackets(NULL),
 		_inputPacket(NULL),
 		_outputPacket(NULL),
-		_deferredPacket(NULL)
+		_deferredPacket(NULL),
+		_cachedEmptyPacket(NULL),
+		_cachedFullPacket(NULL)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -0,0 +1,60 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "WorkStealingDeque.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "ModronAssertions.h"
+
+/**
+ * Initialize the deque.
+ * @param capacity[in] maximum number of elements, must be a power of two
+ * @param seed[in] initial (non zero) state for victim selection
+ * @return true on success, false otherwise
+ */
+bool
+MM_WorkStealingDeque::initialize(MM_EnvironmentBase *env, uintptr_t capacity, uintptr_t seed)
+{
+	Assert_MM_true((0 != capacity) && (0 == (capacity & (capacity - 1))));
+
+	_slots = (void * volatile *)env->getForge()->allocate(capacity * sizeof(void *), OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL == _slots) {
+		return false;
+	}
+
+	_capacity = capacity;
+	_mask = capacity - 1;
+	_top = 0;
+	_bottom = 0;
+	_stealSeed = (0 == seed) ? 1 : seed;
+
+	return true;
+}
+
+void
+MM_WorkStealingDeque::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _slots) {
+		env->getForge()->free((void *)_slots);
+		_slots = NULL;
+	}
+}
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(WORKSTEALINGDEQUE_HPP_)
+#define WORKSTEALINGDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Bounded Chase-Lev work stealing deque.
+ * The owning thread pushes and pops at the bottom end without taking any lock, other threads
+ * steal from the top end with a single compare and swap. Only the last remaining element is
+ * contended between the owner and the thieves.
+ * The deque does not grow: a push to a full deque fails and the caller is expected to hand the
+ * element off to a shared structure instead.
+ * @ingroup GC_Base
+ */
+class MM_WorkStealingDeque : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	volatile uintptr_t _top; /**< Index of the oldest element, advanced by thieves (and the owner when taking the last element) */
+	volatile uintptr_t _bottom; /**< Index one past the youngest element, only written by the owner */
+	void * volatile *_slots; /**< Circular buffer of _capacity elements */
+	uintptr_t _capacity; /**< Number of slots in the buffer (power of two) */
+	uintptr_t _mask; /**< _capacity - 1 */
+	uintptr_t _numaNode; /**< NUMA node of the owning thread, 0 if none or not known yet */
+	bool _numaNodeKnown; /**< True once the owner has recorded its NUMA node */
+	uintptr_t _stealSeed; /**< Owner private state for choosing random victims */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t capacity, uintptr_t seed);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Push an element at the bottom of the deque. Must only be called by the owner.
+	 * @param element[in] The element to push (must not be NULL)
+	 * @return true if the element was pushed, false if the deque is full
+	 */
+	MMINLINE bool
+	push(void *element)
+	{
+		uintptr_t bottom = _bottom;
+		uintptr_t top = _top;
+
+		if ((intptr_t)(bottom - top) >= (intptr_t)_capacity) {
+			return false;
+		}
+
+		_slots[bottom & _mask] = element;
+		/* the element must be visible before thieves can see the new bottom */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+
+		return true;
+	}
+
+	/**
+	 * Pop the youngest element from the bottom of the deque. Must only be called by the owner.
+	 * @return the element, or NULL if the deque is empty (or the last element was stolen)
+	 */
+	MMINLINE void *
+	pop()
+	{
+		uintptr_t bottom = _bottom - 1;
+		_bottom = bottom;
+		/* the new bottom must be visible to thieves before we read top */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t top = _top;
+		void *element = NULL;
+
+		if ((intptr_t)(bottom - top) >= 0) {
+			element = _slots[bottom & _mask];
+			if (bottom == top) {
+				/* last element - race any thieves for it */
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					element = NULL;
+				}
+				_bottom = bottom + 1;
+			}
+		} else {
+			/* deque was empty - restore it */
+			_bottom = bottom + 1;
+		}
+
+		return element;
+	}
+
+	/**
+	 * Steal the oldest element from the top of the deque. May be called by any thread.
+	 * @return the element, or NULL if the deque is empty or another thread won the race for the element
+	 */
+	MMINLINE void *
+	steal()
+	{
+		uintptr_t top = _top;
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t bottom = _bottom;
+		void *element = NULL;
+
+		if ((intptr_t)(bottom - top) > 0) {
+			element = _slots[top & _mask];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				element = NULL;
+			}
+		}
+
+		return element;
+	}
+
+	/**
+	 * Approximate test for emptiness, suitable for deciding whether a steal attempt is worthwhile.
+	 * @return true if the deque appears to be empty
+	 */
+	MMINLINE bool isEmpty() { return (intptr_t)(_bottom - _top) <= 0; }
+
+	/**
+	 * Approximate number of elements currently in the deque.
+	 */
+	MMINLINE uintptr_t
+	getSize()
+	{
+		intptr_t size = (intptr_t)(_bottom - _top);
+		return (size > 0) ? (uintptr_t)size : 0;
+	}
+
+	MMINLINE uintptr_t getNumaNode() { return _numaNode; }
+	MMINLINE bool isNumaNodeKnown() { return _numaNodeKnown; }
+	MMINLINE void
+	setNumaNode(uintptr_t numaNode)
+	{
+		_numaNode = numaNode;
+		_numaNodeKnown = true;
+	}
+
+	/**
+	 * Generate the next pseudo-random number used to choose a steal victim (xorshift).
+	 * Must only be called by the owner.
+	 */
+	MMINLINE uintptr_t
+	nextRandom()
+	{
+		uintptr_t x = _stealSeed;
+		x ^= x << 13;
+		x ^= x >> 7;
+		x ^= x << 17;
+		_stealSeed = x;
+		return x;
+	}
+
+	/**
+	 * Create a WorkStealingDeque object.
+	 */
+	MM_WorkStealingDeque()
+		: MM_BaseNonVirtual()
+		, _top(0)
+		, _bottom(0)
+		, _slots(NULL)
+		, _capacity(0)
+		, _mask(0)
+		, _numaNode(0)
+		, _numaNodeKnown(false)
+		, _stealSeed(1)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* WORKSTEALINGDEQUE_HPP_ */
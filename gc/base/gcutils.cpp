@@ -196,6 +196,8 @@ getContractReasonAsString(ContractReason reason)
 		return "forced nursery contract";
 	case SOFT_MX_CONTRACT:
 		return "satisfy softmx";
+	case SCAV_PAUSE_ABOVE_GOAL:
+		return "scavenge pause above goal";
 	default:
 		return "unknown";
 	}
@@ -227,6 +229,8 @@ getExpandReasonAsString(ExpandReason reason)
 		return "forced nursery expand";
 	case HINT_PREVIOUS_RUNS:
 		return "hint from previous runs";
+	case SCAV_PAUSE_BELOW_GOAL:
+		return "scavenge pause below goal";
 	default:
 		return "unknown";
 	}
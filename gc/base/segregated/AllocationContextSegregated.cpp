@@ -62,6 +62,7 @@ bool
 MM_AllocationContextSegregated::initialize(MM_EnvironmentBase *env)
 {
 	memset(&_perContextSmallFullRegions[0], 0, sizeof(_perContextSmallFullRegions));
+	memset(&_perContextSmallCachedRegions[0], 0, sizeof(_perContextSmallCachedRegions));
 
 	if (!MM_AllocationContext::initialize(env)) {
 		return false;
@@ -82,6 +83,13 @@ MM_AllocationContextSegregated::initialize(MM_EnvironmentBase *env)
 		if (NULL == _perContextSmallFullRegions[i]) {
 			return false;
 		}
+		if (0 < env->getExtensions()->regionCacheSize) {
+			/* also protected by the small allocation lock */
+			_perContextSmallCachedRegions[i] = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_AVAILABLE, true, false, false);
+			if (NULL == _perContextSmallCachedRegions[i]) {
+				return false;
+			}
+		}
 	}
 
 	/* the arraylet allocation lock needs to be acquired before arraylet full region queue can be accessed, no concurrent access should be possible */
@@ -111,6 +119,10 @@ MM_AllocationContextSegregated::tearDown(MM_EnvironmentBase *env)
 			_perContextSmallFullRegions[i]->kill(env);
 			_perContextSmallFullRegions[i] = NULL;
 		}
+		if (NULL != _perContextSmallCachedRegions[i]) {
+			_perContextSmallCachedRegions[i]->kill(env);
+			_perContextSmallCachedRegions[i] = NULL;
+		}
 	}
 
 	if (NULL != _perContextArrayletFullRegions) {
@@ -157,6 +169,10 @@ MM_AllocationContextSegregated::flush(MM_EnvironmentBase *env)
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
 		flushSmall(env, sizeClass);
 		_regionPool->getSmallSweepRegions(sizeClass)->enqueue(_perContextSmallFullRegions[sizeClass]);
+		/* cached regions would have been on the available lists, which are swept as well */
+		if (NULL != _perContextSmallCachedRegions[sizeClass]) {
+			_regionPool->getSmallSweepRegions(sizeClass)->enqueue(_perContextSmallCachedRegions[sizeClass]);
+		}
 	}
 
 	/* flush the per-context large full region to sweep regions */
@@ -181,6 +197,9 @@ MM_AllocationContextSegregated::returnFullRegionsToRegionPool(MM_EnvironmentBase
 
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
 		_regionPool->getSmallFullRegions(sizeClass)->enqueue(_perContextSmallFullRegions[sizeClass]);
+		if (NULL != _perContextSmallCachedRegions[sizeClass]) {
+			_regionPool->returnAvailableRegions(env, sizeClass, _perContextSmallCachedRegions[sizeClass]);
+		}
 	}
 	_regionPool->getLargeFullRegions()->enqueue(_perContextLargeFullRegions);
 	_regionPool->getArrayletFullRegions()->enqueue(_perContextArrayletFullRegions);
@@ -197,7 +216,29 @@ MM_AllocationContextSegregated::signalSmallRegionDepleted(MM_EnvironmentBase *en
 bool
 MM_AllocationContextSegregated::tryAllocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass)
 {
-	MM_HeapRegionDescriptorSegregated *region = _regionPool->allocateRegionFromSmallSizeClass(env, sizeClass);
+	MM_HeapRegionQueue *cachedRegions = _perContextSmallCachedRegions[sizeClass];
+	MM_HeapRegionDescriptorSegregated *region = NULL;
+
+	if (NULL == cachedRegions) {
+		region = _regionPool->allocateRegionFromSmallSizeClass(env, sizeClass);
+	} else {
+		region = cachedRegions->dequeue();
+		if (NULL == region) {
+			/* refill the cache in a batch so that the shared available lists are touched once per regionCacheSize regions */
+			region = _regionPool->allocateRegionFromSmallSizeClass(env, sizeClass);
+			if (NULL != region) {
+				uintptr_t regionCacheSize = env->getExtensions()->regionCacheSize;
+				for (uintptr_t i = 1; i < regionCacheSize; i++) {
+					MM_HeapRegionDescriptorSegregated *cachedRegion = _regionPool->allocateRegionFromSmallSizeClass(env, sizeClass);
+					if (NULL == cachedRegion) {
+						break;
+					}
+					cachedRegions->enqueue(cachedRegion);
+				}
+			}
+		}
+	}
+
 	bool result = false;
 	if (region != NULL) {
 		_smallRegions[sizeClass] = region;
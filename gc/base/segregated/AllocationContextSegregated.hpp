@@ -61,6 +61,7 @@ private:
 	MM_HeapRegionQueue *_perContextSmallFullRegions[OMR_SIZECLASSES_NUM_SMALL+1]; /**< Per-context Regions that have been allocated into during this GC cycle. */
 	MM_HeapRegionQueue *_perContextArrayletFullRegions; /**< Per-context Arraylet regions that have been allocated into during this GC cycle. */
 	MM_HeapRegionQueue *_perContextLargeFullRegions; /**< Per-context Large object regions that have been allocated into during this GC cycle. */
+	MM_HeapRegionQueue *_perContextSmallCachedRegions[OMR_SIZECLASSES_NUM_SMALL+1]; /**< Per-context available regions taken from the region pool in a batch but not yet allocated into (-Xgc:regionCacheSize=). */
 
 /* Methods */
 public:
@@ -67,6 +67,19 @@ public:
 	
 	virtual MM_HeapRegionDescriptorSegregated* pop() = 0;
 
+	/**
+	 * Remove all regions from the list.
+	 * @param[out] count the number of regions removed
+	 * @return the first region of a NULL terminated chain linked through getNext(), with NULL prev links
+	 */
+	virtual MM_HeapRegionDescriptorSegregated *popAll(uintptr_t *count) = 0;
+
+	/**
+	 * @return true if the list is linked by compare and swap rather than under a lock, in which
+	 * case its regions can not be spliced onto another list and have to be moved with popAll()
+	 */
+	virtual bool isLockFree() { return false; }
+
 	/*
 	 * This method must be used with care.  
 	 * In particular, it is wrong to detach from a list
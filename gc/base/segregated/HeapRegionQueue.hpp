@@ -74,6 +74,29 @@ public:
 
 	virtual uintptr_t dequeue(MM_HeapRegionQueue *target, uintptr_t count) = 0;
 
+	/**
+	 * Remove all regions from the queue.
+	 * @param[out] count the number of regions removed
+	 * @return the first region of a NULL terminated chain linked through getNext(), with NULL prev links
+	 */
+	virtual MM_HeapRegionDescriptorSegregated *dequeueAll(uintptr_t *count) = 0;
+
+	/* check that the receiver is not empty before performing dequeue */
+	MM_HeapRegionDescriptorSegregated *dequeueIfNonEmpty()
+	{
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		if (0 != _length) {
+			region = dequeue();
+		}
+		return region;
+	}
+
+	/**
+	 * @return true if the queue is linked by compare and swap rather than under a lock, in which
+	 * case its regions can not be spliced onto another queue and have to be moved with dequeueAll()
+	 */
+	virtual bool isLockFree() { return false; }
+
 	virtual uintptr_t debugCountFreeBytesInRegions() = 0;
 
 	/* Virtual methods inherited from RegionList */
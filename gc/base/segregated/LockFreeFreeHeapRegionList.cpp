@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "modronopt.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "LockFreeFreeHeapRegionList.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_LockFreeFreeHeapRegionList *
+MM_LockFreeFreeHeapRegionList::newInstance(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind)
+{
+	MM_LockFreeFreeHeapRegionList *fpl = (MM_LockFreeFreeHeapRegionList *)env->getForge()->allocate(sizeof(MM_LockFreeFreeHeapRegionList), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (fpl) {
+		new (fpl) MM_LockFreeFreeHeapRegionList(regionListKind);
+		if (!fpl->initialize(env)) {
+			fpl->kill(env);
+			return NULL;
+		}
+	}
+	return fpl;
+}
+
+void
+MM_LockFreeFreeHeapRegionList::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_LockFreeFreeHeapRegionList::initialize(MM_EnvironmentBase *env)
+{
+	MM_HeapRegionManager *regionManager = env->getExtensions()->heapRegionManager;
+	_stack.initialize(regionManager);
+
+	return NULL != regionManager;
+}
+
+void
+MM_LockFreeFreeHeapRegionList::tearDown(MM_EnvironmentBase *env)
+{
+}
+
+MM_HeapRegionDescriptorSegregated *
+MM_LockFreeFreeHeapRegionList::popAll(uintptr_t *count)
+{
+	MM_HeapRegionDescriptorSegregated *chain = _stack.popAll();
+	uintptr_t length = 0;
+
+	for (MM_HeapRegionDescriptorSegregated *cur = chain; cur != NULL; cur = cur->getNext()) {
+		length += 1;
+	}
+	MM_AtomicOperations::subtract((volatile uintptr_t *)&_length, length);
+
+	*count = length;
+	return chain;
+}
+
+void
+MM_LockFreeFreeHeapRegionList::showList(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	omrtty_printf("LockFreeFreeHeapRegionList 0x%x: %d regions\n", this, _length);
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(LOCKFREEFREEHEAPREGIONLIST_HPP_)
+#define LOCKFREEFREEHEAPREGIONLIST_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "FreeHeapRegionList.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "LockFreeRegionStack.hpp"
+#include "ModronAssertions.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * A FreeHeapRegionList of single regions which threads push to and pop from with compare and swap
+ * rather than under a monitor (-Xgc:lockFreeRegionQueues). Regions can not be detached from the
+ * middle of the list, so it is not used for the lists that get coalesced.
+ */
+class MM_LockFreeFreeHeapRegionList : public MM_FreeHeapRegionList
+{
+/* Data members & types */
+public:
+protected:
+private:
+	MM_LockFreeRegionStack _stack; /**< The regions on the list */
+
+/* Methods */
+public:
+	static MM_LockFreeFreeHeapRegionList *newInstance(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	MM_LockFreeFreeHeapRegionList(MM_HeapRegionList::RegionListKind regionListKind) :
+		MM_FreeHeapRegionList(regionListKind, true),
+		_stack()
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	virtual bool isLockFree() { return true; }
+
+	virtual void
+	push(MM_HeapRegionDescriptorSegregated *region)
+	{
+		Assert_MM_true(NULL == region->getNext() && NULL == region->getPrev());
+		/* count first so that the list is never seen as empty while it holds the region */
+		MM_AtomicOperations::add((volatile uintptr_t *)&_length, 1);
+		_stack.push(region, region);
+	}
+
+	virtual void
+	push(MM_HeapRegionQueue *src)
+	{
+		uintptr_t count = 0;
+		/* count is only valid once the chain has been taken, so it can not be passed alongside the call */
+		MM_HeapRegionDescriptorSegregated *chain = src->dequeueAll(&count);
+		pushChain(chain, count);
+	}
+
+	virtual void
+	push(MM_FreeHeapRegionList *src)
+	{
+		uintptr_t count = 0;
+		/* count is only valid once the chain has been taken, so it can not be passed alongside the call */
+		MM_HeapRegionDescriptorSegregated *chain = src->popAll(&count);
+		pushChain(chain, count);
+	}
+
+	virtual MM_HeapRegionDescriptorSegregated *
+	pop()
+	{
+		MM_HeapRegionDescriptorSegregated *region = _stack.pop();
+		if (NULL != region) {
+			MM_AtomicOperations::subtract((volatile uintptr_t *)&_length, 1);
+		}
+		return region;
+	}
+
+	virtual MM_HeapRegionDescriptorSegregated *popAll(uintptr_t *count);
+
+	virtual void
+	detach(MM_HeapRegionDescriptorSegregated *cur)
+	{
+		Assert_MM_unreachable();
+	}
+
+	virtual MM_HeapRegionDescriptorSegregated *
+	allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess)
+	{
+		return (1 == numRegions) ? MM_FreeHeapRegionList::allocate(env, szClass) : NULL;
+	}
+
+	virtual uintptr_t getTotalRegions() { return _length; }
+	virtual void showList(MM_EnvironmentBase *env);
+
+private:
+	/* push a NULL terminated chain linked through getNext() */
+	void
+	pushChain(MM_HeapRegionDescriptorSegregated *chain, uintptr_t count)
+	{
+		if (NULL != chain) {
+			MM_HeapRegionDescriptorSegregated *tail = chain;
+			while (NULL != tail->getNext()) {
+				tail = tail->getNext();
+			}
+			MM_AtomicOperations::add((volatile uintptr_t *)&_length, count);
+			_stack.push(chain, tail);
+		}
+	}
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* LOCKFREEFREEHEAPREGIONLIST_HPP_ */
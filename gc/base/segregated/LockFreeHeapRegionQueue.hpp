@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(LOCKFREEHEAPREGIONQUEUE_HPP_)
+#define LOCKFREEHEAPREGIONQUEUE_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionQueue.hpp"
+#include "LockFreeRegionStack.hpp"
+#include "ModronAssertions.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * A HeapRegionQueue of single regions which threads enqueue to and dequeue from with compare and
+ * swap rather than under a monitor (-Xgc:lockFreeRegionQueues). Regions are handed out in LIFO
+ * rather than FIFO order, so it is only used for the available lists, where the order of regions
+ * is not significant.
+ */
+class MM_LockFreeHeapRegionQueue : public MM_HeapRegionQueue
+{
+/* Data members & types */
+public:
+protected:
+private:
+	MM_LockFreeRegionStack _stack; /**< The regions on the queue */
+
+/* Methods */
+public:
+	static MM_LockFreeHeapRegionQueue *newInstance(MM_EnvironmentBase *env, RegionListKind regionListKind, bool trackFreeBytes = false);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	MM_LockFreeHeapRegionQueue(RegionListKind regionListKind, bool trackFreeBytes) :
+		MM_HeapRegionQueue(regionListKind, true, trackFreeBytes),
+		_stack()
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	virtual bool isLockFree() { return true; }
+
+	virtual bool isEmpty() { return 0 == _length; }
+
+	virtual uintptr_t getTotalRegions() { return _length; }
+
+	virtual void
+	enqueue(MM_HeapRegionDescriptorSegregated *region)
+	{
+		Assert_MM_true(NULL == region->getNext() && NULL == region->getPrev());
+		/* count first so that the queue is never seen as empty while it holds the region */
+		MM_AtomicOperations::add((volatile uintptr_t *)&_length, 1);
+		_stack.push(region, region);
+	}
+
+	/* enqueue all regions of src, which may be a locking queue */
+	virtual void enqueue(MM_HeapRegionQueue *src);
+
+	virtual MM_HeapRegionDescriptorSegregated *
+	dequeue()
+	{
+		MM_HeapRegionDescriptorSegregated *region = _stack.pop();
+		if (NULL != region) {
+			MM_AtomicOperations::subtract((volatile uintptr_t *)&_length, 1);
+		}
+		return region;
+	}
+
+	virtual uintptr_t dequeue(MM_HeapRegionQueue *target, uintptr_t count);
+
+	virtual MM_HeapRegionDescriptorSegregated *dequeueAll(uintptr_t *count);
+
+	virtual uintptr_t debugCountFreeBytesInRegions();
+	virtual void showList(MM_EnvironmentBase *env);
+
+	/**
+	 * Cast a HeapRegionQueue as a LockFreeHeapRegionQueue
+	 */
+	MMINLINE static MM_LockFreeHeapRegionQueue* asLockFreeHeapRegionQueue(MM_HeapRegionQueue *pl) { return (MM_LockFreeHeapRegionQueue *)pl; }
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* LOCKFREEHEAPREGIONQUEUE_HPP_ */
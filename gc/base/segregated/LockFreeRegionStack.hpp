@@ -0,0 +1,153 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(LOCKFREEREGIONSTACK_HPP_)
+#define LOCKFREEREGIONSTACK_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionManager.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * A Treiber stack of single regions linked through their _next field, shared by the lock free
+ * region lists. The head is a 64 bit word holding the region table index + 1 of the top region in
+ * the low half and an ABA tag in the high half. Region descriptors are never freed while the heap
+ * exists, so reading _next of a region which was concurrently popped is safe and the tag makes the
+ * compare and swap fail if the top region was recycled in the meantime.
+ * The owning list keeps the count; the stack only links regions.
+ */
+class MM_LockFreeRegionStack : public MM_BaseNonVirtual
+{
+/* Data members & types */
+private:
+	volatile uint64_t _taggedHead; /**< Region table index + 1 of the top region in the low 32 bits, ABA tag in the high 32 bits */
+	MM_HeapRegionManager *_regionManager; /**< Manager of the region table the regions belong to */
+
+/* Methods */
+private:
+	MMINLINE uint64_t
+	encode(MM_HeapRegionDescriptorSegregated *region, uint64_t tag)
+	{
+		uint64_t index = (NULL == region) ? 0 : ((uint64_t)_regionManager->mapDescriptorToRegionTableIndex(region) + 1);
+		return (tag << 32) | index;
+	}
+
+	MMINLINE MM_HeapRegionDescriptorSegregated *
+	decode(uint64_t taggedHead)
+	{
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		uintptr_t index = (uintptr_t)(taggedHead & 0xFFFFFFFF);
+
+		if (0 != index) {
+			region = (MM_HeapRegionDescriptorSegregated *)_regionManager->physicalTableDescriptorForIndex(index - 1);
+		}
+		return region;
+	}
+
+public:
+	void initialize(MM_HeapRegionManager *regionManager) { _regionManager = regionManager; }
+
+	MMINLINE bool isEmpty() { return 0 == (_taggedHead & 0xFFFFFFFF); }
+
+	/**
+	 * Peek at the top region. Only meaningful while the stack is not being modified.
+	 */
+	MMINLINE MM_HeapRegionDescriptorSegregated *peek() { return decode(_taggedHead); }
+
+	/**
+	 * Atomically link a chain of regions in front of the top of the stack.
+	 * @param head the first region of the chain
+	 * @param tail the last region of the chain
+	 */
+	MMINLINE void
+	push(MM_HeapRegionDescriptorSegregated *head, MM_HeapRegionDescriptorSegregated *tail)
+	{
+		uint64_t oldHead = _taggedHead;
+		while (true) {
+			tail->setNext(decode(oldHead));
+			uint64_t foundHead = MM_AtomicOperations::lockCompareExchangeU64(&_taggedHead, oldHead, encode(head, (oldHead >> 32) + 1));
+			if (foundHead == oldHead) {
+				break;
+			}
+			oldHead = foundHead;
+		}
+	}
+
+	/**
+	 * Atomically unlink the top region.
+	 * @return the region, with a NULL _next link, or NULL if the stack was empty
+	 */
+	MMINLINE MM_HeapRegionDescriptorSegregated *
+	pop()
+	{
+		uint64_t oldHead = _taggedHead;
+		MM_HeapRegionDescriptorSegregated *region = decode(oldHead);
+
+		while (NULL != region) {
+			uint64_t foundHead = MM_AtomicOperations::lockCompareExchangeU64(&_taggedHead, oldHead, encode(region->getNext(), (oldHead >> 32) + 1));
+			if (foundHead == oldHead) {
+				region->setNext(NULL);
+				break;
+			}
+			oldHead = foundHead;
+			region = decode(oldHead);
+		}
+
+		return region;
+	}
+
+	/**
+	 * Atomically unlink all regions.
+	 * @return the first region of the chain that was unlinked, or NULL if the stack was empty
+	 */
+	MMINLINE MM_HeapRegionDescriptorSegregated *
+	popAll()
+	{
+		uint64_t oldHead = _taggedHead;
+		while (true) {
+			uint64_t foundHead = MM_AtomicOperations::lockCompareExchangeU64(&_taggedHead, oldHead, encode(NULL, (oldHead >> 32) + 1));
+			if (foundHead == oldHead) {
+				break;
+			}
+			oldHead = foundHead;
+		}
+		return decode(oldHead);
+	}
+
+	MM_LockFreeRegionStack()
+		: MM_BaseNonVirtual()
+		, _taggedHead(0)
+		, _regionManager(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* LOCKFREEREGIONSTACK_HPP_ */
@@ -68,6 +68,24 @@ MM_LockingFreeHeapRegionList::tearDown(MM_EnvironmentBase *env)
 	}
 }
 
+MM_HeapRegionDescriptorSegregated *
+MM_LockingFreeHeapRegionList::popAll(uintptr_t *count)
+{
+	lock();
+	MM_HeapRegionDescriptorSegregated *chain = _head;
+	*count = _length;
+	_head = NULL;
+	_tail = NULL;
+	_length = 0;
+	_totalRegionsCount = 0;
+	unlock();
+
+	for (MM_HeapRegionDescriptorSegregated *cur = chain; cur != NULL; cur = cur->getNext()) {
+		cur->setPrev(NULL);
+	}
+	return chain;
+}
+
 uintptr_t
 MM_LockingFreeHeapRegionList::getTotalRegions()
 {
@@ -75,6 +75,11 @@ public:
 	virtual void
 	push(MM_HeapRegionQueue *srcAsPQ)
 	{ 
+		if (srcAsPQ->isLockFree()) {
+			uintptr_t count = 0;
+			pushChain(srcAsPQ->dequeueAll(&count));
+			return;
+		}
 		MM_LockingHeapRegionQueue* src = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(srcAsPQ);
 		if (src->_head == NULL) { /* Nothing to move - single read needs no lock */
 			return;
@@ -110,6 +115,11 @@ public:
 	virtual void 
 	push(MM_FreeHeapRegionList *srcAsFPL) 
 	{ 
+		if (srcAsFPL->isLockFree()) {
+			uintptr_t count = 0;
+			pushChain(srcAsFPL->popAll(&count));
+			return;
+		}
 		MM_LockingFreeHeapRegionList* src = MM_LockingFreeHeapRegionList::asLockingFreeHeapRegionList(srcAsFPL);
 		if (src->_head == NULL) { /* Nothing to move - single read needs no lock */
 			return;
@@ -151,6 +161,8 @@ public:
 		return result;
 	}
 	
+	virtual MM_HeapRegionDescriptorSegregated *popAll(uintptr_t *count);
+
 	virtual void
 	detach(MM_HeapRegionDescriptorSegregated *cur)
 	{
@@ -181,6 +193,22 @@ private:
 	
 	MMINLINE void unlock() { omrthread_monitor_exit(_lockMonitor); }
 
+	/* push a NULL terminated chain linked through getNext(), taken from a lock free list */
+	void
+	pushChain(MM_HeapRegionDescriptorSegregated *chain)
+	{
+		if (NULL != chain) {
+			lock();
+			while (NULL != chain) {
+				MM_HeapRegionDescriptorSegregated *next = chain->getNext();
+				chain->setNext(NULL);
+				pushInternal(chain);
+				chain = next;
+			}
+			unlock();
+		}
+	}
+
 	void
 	pushInternal(MM_HeapRegionDescriptorSegregated *region)
 	{
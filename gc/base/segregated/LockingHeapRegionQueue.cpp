@@ -95,6 +95,24 @@ MM_LockingHeapRegionQueue::getTotalRegions()
 	}
 }
 
+MM_HeapRegionDescriptorSegregated *
+MM_LockingHeapRegionQueue::dequeueAll(uintptr_t *count)
+{
+	lock();
+	MM_HeapRegionDescriptorSegregated *chain = _head;
+	*count = _length;
+	_head = NULL;
+	_tail = NULL;
+	_length = 0;
+	_totalRegionsCount = 0;
+	unlock();
+
+	for (MM_HeapRegionDescriptorSegregated *cur = chain; cur != NULL; cur = cur->getNext()) {
+		cur->setPrev(NULL);
+	}
+	return chain;
+}
+
 void
 MM_LockingHeapRegionQueue::showList(MM_EnvironmentBase *env)
 {
@@ -91,6 +91,16 @@ public:
 	/* enqueue src at the _end_ of the receiver's queue */
 	virtual void enqueue(MM_HeapRegionQueue *srcAsPQ)
 	{
+		if (srcAsPQ->isLockFree()) {
+			uintptr_t count = 0;
+			MM_HeapRegionDescriptorSegregated *chain = srcAsPQ->dequeueAll(&count);
+			if (NULL != chain) {
+				lock();
+				enqueueChainInternal(chain);
+				unlock();
+			}
+			return;
+		}
 		MM_LockingHeapRegionQueue* src = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(srcAsPQ);
 		if (NULL == src->_head) { /* Nothing to move - single read needs no lock */
 			return;
@@ -130,18 +140,6 @@ public:
 		return result;
 	}
 
-	/* check that the receiver is not empty before locking it and performing dequeue */
-	MM_HeapRegionDescriptorSegregated *dequeueIfNonEmpty()
-	{
-		MM_HeapRegionDescriptorSegregated *region = NULL;
-		if (0 != _length) {
-			lock();
-			region = dequeueInternal();
-			unlock();
-		}
-		return region;
-	}
-
 	virtual uintptr_t dequeue(MM_HeapRegionQueue *targetAsPQ, uintptr_t count)
 	{
 		MM_LockingHeapRegionQueue* target = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(targetAsPQ);
@@ -153,6 +151,8 @@ public:
 		return moved;
 	}
 
+	virtual MM_HeapRegionDescriptorSegregated *dequeueAll(uintptr_t *count);
+
 	virtual uintptr_t debugCountFreeBytesInRegions();
 	virtual void showList(MM_EnvironmentBase *env);
 
@@ -188,6 +188,17 @@ private:
 		_totalRegionsCount += region->getRange();
 	}
 
+	/* enqueue a NULL terminated chain linked through getNext() */
+	void enqueueChainInternal(MM_HeapRegionDescriptorSegregated *chain)
+	{
+		while (NULL != chain) {
+			MM_HeapRegionDescriptorSegregated *next = chain->getNext();
+			chain->setNext(NULL);
+			enqueueInternal(chain);
+			chain = next;
+		}
+	}
+
 	uintptr_t dequeueInternal(MM_LockingHeapRegionQueue *target, uintptr_t count)
 	{
 		uintptr_t moved = 0;
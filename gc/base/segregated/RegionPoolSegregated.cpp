@@ -32,6 +32,8 @@
 #include "Heap.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
 #include "HeapRegionManager.hpp"
+#include "LockFreeFreeHeapRegionList.hpp"
+#include "LockFreeHeapRegionQueue.hpp"
 #include "LockingFreeHeapRegionList.hpp"
 #include "LockingHeapRegionQueue.hpp"
 #include "MemoryPoolAggregatedCellList.hpp"
@@ -90,16 +92,19 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 	Assert_MM_true(0 < _splitAvailableListSplitCount);
 	for (szClass=OMR_SIZECLASSES_MIN_SMALL; szClass<=OMR_SIZECLASSES_MAX_SMALL; szClass++) {
 		for (int32_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
-			uintptr_t splitAvailableListsSize = sizeof(MM_LockingHeapRegionQueue) * _splitAvailableListSplitCount;
-			_smallAvailableRegions[szClass][i] = (MM_LockingHeapRegionQueue *)env->getForge()->allocate(splitAvailableListsSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			uintptr_t splitAvailableListsSize = sizeof(MM_HeapRegionQueue *) * _splitAvailableListSplitCount;
+			_smallAvailableRegions[szClass][i] = (MM_HeapRegionQueue **)env->getForge()->allocate(splitAvailableListsSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 			if (NULL == _smallAvailableRegions[szClass][i]) {
 				return false;
 			}
-			MM_LockingHeapRegionQueue *regionQueue = _smallAvailableRegions[szClass][i];
+			MM_HeapRegionQueue **regionQueueArray = _smallAvailableRegions[szClass][i];
+			for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
+				regionQueueArray[j] = NULL;
+			}
 			for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
 				/* The available lists should track the free bytes in their regions (4th param = true) */
-				new (&regionQueue[j]) MM_LockingHeapRegionQueue(MM_HeapRegionList::HRL_KIND_AVAILABLE, true, true, true);
-				if (!(&regionQueue[j])->initialize(env)) {
+				regionQueueArray[j] = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_AVAILABLE, true, true, true);
+				if (NULL == regionQueueArray[j]) {
 					return false;
 				}
 			}
@@ -135,12 +140,20 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 MM_HeapRegionQueue*
 MM_RegionPoolSegregated::allocateHeapRegionQueue(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly, bool concurrentAccess, bool trackFreeBytes)
 {
+	/* The lock free queue hands regions out in LIFO order, which only the available lists can tolerate */
+	if (env->getExtensions()->lockFreeRegionQueues && singleRegionsOnly && concurrentAccess && (MM_HeapRegionList::HRL_KIND_AVAILABLE == regionListKind)) {
+		return MM_LockFreeHeapRegionQueue::newInstance(env, regionListKind, trackFreeBytes);
+	}
 	return MM_LockingHeapRegionQueue::newInstance(env, regionListKind, singleRegionsOnly, concurrentAccess, trackFreeBytes);
 }
 
 MM_FreeHeapRegionList*
 MM_RegionPoolSegregated::allocateFreeHeapRegionList(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly)
 {
+	/* Regions are never detached from the single free list, so it can be linked without a lock */
+	if (env->getExtensions()->lockFreeRegionQueues && singleRegionsOnly && (MM_HeapRegionList::HRL_KIND_FREE == regionListKind)) {
+		return MM_LockFreeFreeHeapRegionList::newInstance(env, regionListKind);
+	}
 	return MM_LockingFreeHeapRegionList::newInstance(env, regionListKind, singleRegionsOnly);
 }
 
@@ -186,12 +199,15 @@ MM_RegionPoolSegregated::tearDown(MM_EnvironmentBase *env)
 	
 	for (int32_t szClass=OMR_SIZECLASSES_MIN_SMALL; szClass <= OMR_SIZECLASSES_MAX_SMALL; szClass++) {
 		for (uintptr_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
-			MM_LockingHeapRegionQueue *regionQueueArray = _smallAvailableRegions[szClass][i];
+			MM_HeapRegionQueue **regionQueueArray = _smallAvailableRegions[szClass][i];
 			if (NULL != regionQueueArray) {
 				for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
-					(&regionQueueArray[j])->tearDown(env);
+					if (NULL != regionQueueArray[j]) {
+						regionQueueArray[j]->kill(env);
+					}
 				}
 				env->getForge()->free(regionQueueArray);
+				_smallAvailableRegions[szClass][i] = NULL;
 			}
 		}
 		if (_smallFullRegions[szClass]) {
@@ -221,9 +237,9 @@ MM_RegionPoolSegregated::moveInUseToSweep(MM_EnvironmentBase *env)
 		_darkMatterCellCount[sizeClass] = 0;
 		_smallSweepRegions[sizeClass]->enqueue(_smallFullRegions[sizeClass]);
 		for (int32_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
-			MM_LockingHeapRegionQueue *regionQueue = _smallAvailableRegions[sizeClass][i];
+			MM_HeapRegionQueue **regionQueueArray = _smallAvailableRegions[sizeClass][i];
 			for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
-				_smallSweepRegions[sizeClass]->enqueue(&regionQueue[j]);
+				_smallSweepRegions[sizeClass]->enqueue(regionQueueArray[j]);
 			}
 		}
 		_initialCountOfSweepRegions[sizeClass] = _currentCountOfSweepRegions[sizeClass] = _smallSweepRegions[sizeClass]->getTotalRegions();
@@ -250,12 +266,26 @@ MM_RegionPoolSegregated::enqueueAvailable(MM_HeapRegionDescriptorSegregated *reg
 {
 	for (int32_t i = 0; i < NUM_DEFRAG_BUCKETS; i++) {
 		if (occupancy >= defragBucketThresholds[i]) {
-			(&(_smallAvailableRegions[sizeClass][i])[splitListIndex])->enqueue(region);
+			_smallAvailableRegions[sizeClass][i][splitListIndex]->enqueue(region);
 			break;
 		}
 	}
 }
 
+/**
+ * Give back regions of size class sizeClass which an allocation context took from the available lists
+ * but did not allocate into.
+ */
+void
+MM_RegionPoolSegregated::returnAvailableRegions(MM_EnvironmentBase *env, uintptr_t sizeClass, MM_HeapRegionQueue *regionQueue)
+{
+	if (!regionQueue->isEmpty()) {
+		uintptr_t splitIndex = env->getEnvironmentId() % _splitAvailableListSplitCount;
+		_smallAvailableRegions[sizeClass][PRIMARY_BUCKET][splitIndex]->enqueue(regionQueue);
+		_skipAvailableRegionForAllocation[sizeClass] = 0;
+	}
+}
+
 void
 MM_RegionPoolSegregated::addFreeRange(void *lowAddress, void *highAddress)
 {
@@ -327,9 +357,9 @@ MM_RegionPoolSegregated::joinBucketListsForSplitIndex(MM_EnvironmentBase *env)
 {
 	uintptr_t splitIndex = env->getWorkerID() % _splitAvailableListSplitCount;
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
-		MM_LockingHeapRegionQueue *primaryQueue = &(_smallAvailableRegions[sizeClass][PRIMARY_BUCKET])[splitIndex];
+		MM_HeapRegionQueue *primaryQueue = _smallAvailableRegions[sizeClass][PRIMARY_BUCKET][splitIndex];
 		for (int32_t i=1; i<NUM_DEFRAG_BUCKETS; i++) {
-			primaryQueue->enqueue(&(_smallAvailableRegions[sizeClass][i])[splitIndex]);
+			primaryQueue->enqueue(_smallAvailableRegions[sizeClass][i][splitIndex]);
 		}
 	}
 }
@@ -349,8 +379,8 @@ MM_RegionPoolSegregated::allocateRegionFromSmallSizeClass(MM_EnvironmentBase *en
 
 	/* try bucket 0, i.e. primary bucket first */
 	uintptr_t startList = env->getEnvironmentId() % _splitAvailableListSplitCount;
-	MM_LockingHeapRegionQueue *primaryQueueArray = _smallAvailableRegions[sizeClass][PRIMARY_BUCKET];
-	MM_LockingHeapRegionQueue *allocationQueue = &primaryQueueArray[startList];
+	MM_HeapRegionQueue **primaryQueueArray = _smallAvailableRegions[sizeClass][PRIMARY_BUCKET];
+	MM_HeapRegionQueue *allocationQueue = primaryQueueArray[startList];
 	region = allocationQueue->dequeueIfNonEmpty();
 	if (region != NULL) {
 		return region;
@@ -358,7 +388,7 @@ MM_RegionPoolSegregated::allocateRegionFromSmallSizeClass(MM_EnvironmentBase *en
 
 	/* if primary bucket fails, try the other split queues, starting from the current thread's split index */
 	for (uintptr_t j=startList+1; j<startList+_splitAvailableListSplitCount; j++) {
-		allocationQueue = &primaryQueueArray[j%_splitAvailableListSplitCount];
+		allocationQueue = primaryQueueArray[j%_splitAvailableListSplitCount];
 		region = allocationQueue->dequeueIfNonEmpty();
 		if (region != NULL) {
 			return region;
@@ -368,9 +398,9 @@ MM_RegionPoolSegregated::allocateRegionFromSmallSizeClass(MM_EnvironmentBase *en
 	/* if all split lists in the primary bucket fail, try the remaining buckets */
 	if (_isSweepingSmall) {
 		for (int32_t i=1; i<NUM_DEFRAG_BUCKETS; i++) {
-			MM_LockingHeapRegionQueue *queueArray = _smallAvailableRegions[sizeClass][i];
+			MM_HeapRegionQueue **queueArray = _smallAvailableRegions[sizeClass][i];
 			for (uintptr_t j=startList; j<startList+_splitAvailableListSplitCount; j++) {
-				allocationQueue = &queueArray[j%_splitAvailableListSplitCount];
+				allocationQueue = queueArray[j%_splitAvailableListSplitCount];
 				region = allocationQueue->dequeueIfNonEmpty();
 				if (region != NULL) {
 					return region;
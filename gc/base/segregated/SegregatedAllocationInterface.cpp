@@ -87,6 +87,10 @@ MM_SegregatedAllocationInterface::initialize(MM_EnvironmentBase *env)
 		_frequentObjectsStats = MM_FrequentObjectsStats::newInstance(env);
 		result = (NULL != _frequentObjectsStats);
 	}
+
+	if (result) {
+		result = initializeAllocationSampling(env);
+	}
 	
 	if (result) {
 		_allocationCache = _languageAllocationCache.getLanguageSegregatedAllocationCacheStruct(env);
@@ -113,6 +117,7 @@ MM_SegregatedAllocationInterface::tearDown(MM_EnvironmentBase *env)
 		_frequentObjectsStats->kill(env);
 		_frequentObjectsStats = NULL;
 	}
+	tearDownAllocationSampling(env);
 }
 
 /**
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+
+#include "CompactRememberedSet.hpp"
+
+#include <string.h>
+
+#include "Bits.hpp"
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+
+MM_CompactRememberedSet *
+MM_CompactRememberedSet::newInstance(MM_EnvironmentBase *env, void *heapBase, uintptr_t heapRange, uintptr_t granuleShift)
+{
+	MM_CompactRememberedSet *rememberedSet = (MM_CompactRememberedSet *)env->getForge()->allocate(sizeof(MM_CompactRememberedSet), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != rememberedSet) {
+		new(rememberedSet) MM_CompactRememberedSet(env, heapBase, granuleShift);
+		if (!rememberedSet->initialize(env, heapRange)) {
+			rememberedSet->kill(env);
+			rememberedSet = NULL;
+		}
+	}
+	return rememberedSet;
+}
+
+bool
+MM_CompactRememberedSet::initialize(MM_EnvironmentBase *env, uintptr_t heapRange)
+{
+	uintptr_t granuleSize = ((uintptr_t)1) << _granuleShift;
+	_granuleCount = (heapRange + granuleSize - 1) >> _granuleShift;
+	_candidates = (uint8_t *)env->getForge()->allocate(_granuleCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _candidates) {
+		return false;
+	}
+	clearCandidates();
+
+	uintptr_t cardCount = (heapRange + J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT - 1) >> J9MODRON_HEAPMAP_INDEX_SHIFT;
+	_cardBitsCount = (cardCount + J9BITS_BITS_IN_SLOT - 1) >> J9MODRON_HEAPMAP_LOG_SIZEOF_UDATA;
+	_cardBits = (uintptr_t *)env->getForge()->allocate(_cardBitsCount * sizeof(uintptr_t), OMR::GC::AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL == _cardBits) {
+		return false;
+	}
+	clearCards();
+
+	return true;
+}
+
+void
+MM_CompactRememberedSet::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _candidates) {
+		env->getForge()->free(_candidates);
+		_candidates = NULL;
+	}
+	if (NULL != _cardBits) {
+		env->getForge()->free(_cardBits);
+		_cardBits = NULL;
+	}
+}
+
+/**
+ * Free the receiver and all associated resources.
+ */
+void
+MM_CompactRememberedSet::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+void
+MM_CompactRememberedSet::clearCandidates()
+{
+	memset(_candidates, 0, _granuleCount);
+	_candidateBase = 0;
+	_candidateRange = 0;
+}
+
+void
+MM_CompactRememberedSet::addCandidateGranule(uintptr_t granule)
+{
+	uintptr_t granuleBase = _heapBase + (granule << _granuleShift);
+	uintptr_t granuleTop = granuleBase + (((uintptr_t)1) << _granuleShift);
+
+	_candidates[granule] = 1;
+	if (0 != _candidateRange) {
+		granuleBase = OMR_MIN(granuleBase, _candidateBase);
+		granuleTop = OMR_MAX(granuleTop, _candidateBase + _candidateRange);
+	}
+	_candidateBase = granuleBase;
+	_candidateRange = granuleTop - granuleBase;
+}
+
+void
+MM_CompactRememberedSet::clearCards()
+{
+	memset(_cardBits, 0, _cardBitsCount * sizeof(uintptr_t));
+}
+
+void *
+MM_CompactRememberedSet::nextRememberedCard(void *from, void *to)
+{
+	uintptr_t card = (((uintptr_t)from) - _heapBase) >> J9MODRON_HEAPMAP_INDEX_SHIFT;
+	uintptr_t cardTop = ((((uintptr_t)to) - _heapBase) + J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT - 1) >> J9MODRON_HEAPMAP_INDEX_SHIFT;
+
+	while (card < cardTop) {
+		uintptr_t slot = card >> J9MODRON_HEAPMAP_LOG_SIZEOF_UDATA;
+		uintptr_t bits = _cardBits[slot] >> (card & (J9BITS_BITS_IN_SLOT - 1));
+		if (0 != bits) {
+			card += MM_Bits::leadingZeroes(bits);
+			break;
+		}
+		card = (slot + 1) << J9MODRON_HEAPMAP_LOG_SIZEOF_UDATA;
+	}
+
+	return (card < cardTop) ? (void *)(_heapBase + (card << J9MODRON_HEAPMAP_INDEX_SHIFT)) : NULL;
+}
+
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
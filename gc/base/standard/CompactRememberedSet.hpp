@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(COMPACTREMEMBEREDSET_HPP_)
+#define COMPACTREMEMBEREDSET_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+#include "HeapMap.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Remembers the objects which hold references into the compaction candidates, the granules of the heap a
+ * partial compaction may move objects within. The marking scheme reports every reference it scans, and an
+ * object referring into a candidate is remembered by setting the bit of the card it starts on, a card being
+ * the heap covered by one mark map slot. Once the selected sub areas have been moved, the compaction fixes up
+ * the marked objects starting on remembered cards instead of every live object outside of them.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_CompactRememberedSet : public MM_BaseVirtual
+{
+private:
+	uintptr_t _heapBase; /**< Lowest heap address covered */
+	uintptr_t _granuleShift; /**< Log2 of the heap covered by each entry of _candidates */
+	uint8_t *_candidates; /**< One byte per granule, non zero if the granule is a compaction candidate */
+	uintptr_t _granuleCount; /**< Number of entries in _candidates */
+	uintptr_t _candidateBase; /**< Lowest address of the lowest candidate */
+	uintptr_t _candidateRange; /**< Bytes from _candidateBase to the top of the highest candidate, 0 if there are no candidates */
+	uintptr_t *_cardBits; /**< One bit per card, set if an object starting on the card refers into a candidate */
+	uintptr_t _cardBitsCount; /**< Number of slots in _cardBits */
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t heapRange);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_CompactRememberedSet *newInstance(MM_EnvironmentBase *env, void *heapBase, uintptr_t heapRange, uintptr_t granuleShift);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t getGranuleCount() { return _granuleCount; }
+	MMINLINE bool isCandidateGranule(uintptr_t granule) { return 0 != _candidates[granule]; }
+
+	/**
+	 * Forget all candidates.
+	 */
+	void clearCandidates();
+
+	/**
+	 * Make a granule a compaction candidate. References into it are remembered from now on.
+	 * @param granule[in] index of the granule, from the heap base
+	 */
+	void addCandidateGranule(uintptr_t granule);
+
+	/**
+	 * Forget all remembered objects.
+	 */
+	void clearCards();
+
+	/**
+	 * Remember an object if a reference it holds points into a candidate. Safe to call from several threads.
+	 * @param objectPtr[in] the object holding the reference
+	 * @param referent[in] the object referred to, may be NULL
+	 */
+	MMINLINE void
+	rememberReference(omrobjectptr_t objectPtr, omrobjectptr_t referent)
+	{
+		/* NULL and every address below the candidates wrap around to beyond the range */
+		if ((((uintptr_t)referent) - _candidateBase) < _candidateRange) {
+			if (0 != _candidates[(((uintptr_t)referent) - _heapBase) >> _granuleShift]) {
+				rememberObject(objectPtr);
+			}
+		}
+	}
+
+	/**
+	 * Remember an object. Safe to call from several threads.
+	 * @param objectPtr[in] the object to remember
+	 */
+	MMINLINE void
+	rememberObject(omrobjectptr_t objectPtr)
+	{
+		uintptr_t card = (((uintptr_t)objectPtr) - _heapBase) >> J9MODRON_HEAPMAP_INDEX_SHIFT;
+		volatile uintptr_t *slotAddress = &_cardBits[card >> J9MODRON_HEAPMAP_LOG_SIZEOF_UDATA];
+		uintptr_t bitMask = ((uintptr_t)1) << (card & (J9BITS_BITS_IN_SLOT - 1));
+		uintptr_t oldValue = *slotAddress;
+
+		/* most references into a candidate come from objects on cards which are already remembered */
+		while (0 == (oldValue & bitMask)) {
+			uintptr_t foundValue = MM_AtomicOperations::lockCompareExchange(slotAddress, oldValue, oldValue | bitMask);
+			if (foundValue == oldValue) {
+				break;
+			}
+			oldValue = foundValue;
+		}
+	}
+
+	/**
+	 * Find the next remembered card.
+	 * @param from[in] the address to start searching from, the card holding it is included
+	 * @param to[in] the address to stop searching at
+	 * @return the lowest address of the first remembered card in [from, to), or NULL if there is none
+	 */
+	void *nextRememberedCard(void *from, void *to);
+
+	MM_CompactRememberedSet(MM_EnvironmentBase *env, void *heapBase, uintptr_t granuleShift)
+		: MM_BaseVirtual()
+		, _heapBase((uintptr_t)heapBase)
+		, _granuleShift(granuleShift)
+		, _candidates(NULL)
+		, _granuleCount(0)
+		, _candidateBase(0)
+		, _candidateRange(0)
+		, _cardBits(NULL)
+		, _cardBitsCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#endif /* COMPACTREMEMBEREDSET_HPP_ */
@@ -46,12 +46,14 @@
 #include "HeapStats.hpp"
 #include "MarkingScheme.hpp"
 #include "MarkMap.hpp"
+#include "Math.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "ObjectHeapIteratorAddressOrderedList.hpp"
 #include "ObjectModel.hpp"
 #include "ParallelDispatcher.hpp"
+#include "ParallelSweepChunk.hpp"
 #include "ParallelSweepScheme.hpp"
 #include "ParallelTask.hpp"
 #include "SlotObject.hpp"
@@ -286,6 +288,14 @@ MM_CompactScheme::initialize(MM_EnvironmentBase *env)
 void
 MM_CompactScheme::tearDown(MM_EnvironmentBase *env)
 {
+	if (NULL != _fragmentedBytes) {
+		env->getForge()->free(_fragmentedBytes);
+		_fragmentedBytes = NULL;
+	}
+	if (NULL != _rememberedSet) {
+		_rememberedSet->kill(env);
+		_rememberedSet = NULL;
+	}
 	_delegate.tearDown(env);
 }
 
@@ -411,7 +421,9 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 		min_subarea_size = _heap->getMaximumPhysicalRange();
 	}
 	uintptr_t size = (DESIRED_SUBAREA_SIZE >= min_subarea_size) ?  DESIRED_SUBAREA_SIZE : min_subarea_size;
-
+	/* A partial compaction uses the granules its candidates were chosen from as sub areas, if the table can hold that many */
+	uintptr_t granuleSize = ((uintptr_t)1) << _fragmentationGranuleShift;
+	bool granuleSubAreas = _partialCompaction && (granuleSize >= size);
 
 	/* Single threaded pass to set tentative sub area limits tentative limits are
 	 * listed in freeChunk field. This field will be reset during the third pass.
@@ -434,16 +446,26 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 			}
 			_subAreaTable[i].firstObject = (omrobjectptr_t)lowAddress;
 
-			/* Calculate number of sub areas..take care to avoid overflow if size is large */
-			uintptr_t numSubAreas = ((areaSize - 1) / size) + 1;
+			if (granuleSubAreas) {
+				/* Each sub area lies within a single granule, so it can be selected if that granule is a compaction candidate */
+				for (uint8_t *p = (uint8_t *)lowAddress; p < (uint8_t *)highAddress; p = (uint8_t *)(MM_Math::roundToFloor(granuleSize, (uintptr_t)p - _heapBase) + _heapBase + granuleSize)) {
+					_subAreaTable[i].freeChunk = (omrobjectptr_t)p;
+					_subAreaTable[i].memoryPool = memorySubSpace->getMemoryPool(p);
+					_subAreaTable[i].state = state;
+					_subAreaTable[i++].currentAction = SubAreaEntry::none;
+				}
+			} else {
+				/* Calculate number of sub areas..take care to avoid overflow if size is large */
+				uintptr_t numSubAreas = ((areaSize - 1) / size) + 1;
 
-			for( uintptr_t subAreaNum=0; subAreaNum < numSubAreas; subAreaNum++){
-				uint8_t *p = (uint8_t*)(((uintptr_t)lowAddress) + (subAreaNum * size));
+				for( uintptr_t subAreaNum=0; subAreaNum < numSubAreas; subAreaNum++){
+					uint8_t *p = (uint8_t*)(((uintptr_t)lowAddress) + (subAreaNum * size));
 
-				_subAreaTable[i].freeChunk = (omrobjectptr_t)p;
-				_subAreaTable[i].memoryPool = memorySubSpace->getMemoryPool(p);
-				_subAreaTable[i].state = state;
-				_subAreaTable[i++].currentAction = SubAreaEntry::none;
+					_subAreaTable[i].freeChunk = (omrobjectptr_t)p;
+					_subAreaTable[i].memoryPool = memorySubSpace->getMemoryPool(p);
+					_subAreaTable[i].state = state;
+					_subAreaTable[i++].currentAction = SubAreaEntry::none;
+				}
 			}
 			_subAreaTable[i].freeChunk = (omrobjectptr_t)highAddress;
 			_subAreaTable[i].memoryPool = NULL;
@@ -505,7 +527,12 @@ MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
 					_compactFrom = (_compactFrom < _subAreaTable[j-1].firstObject) ? _compactFrom : _subAreaTable[j-1].firstObject;
 					_compactTo = (_compactTo > _subAreaTable[j].firstObject) ? _compactTo : _subAreaTable[j].firstObject;
 				}
-				_subAreaTable[j].freeChunk = 0;
+				/* A partial compaction selects sub areas by the range their marked objects start in, which ends at the next tentative limit */
+				if (_partialCompaction && (SubAreaEntry::end_segment != _subAreaTable[i].state)) {
+					_subAreaTable[j].freeChunk = _subAreaTable[i + 1].freeChunk;
+				} else {
+					_subAreaTable[j].freeChunk = 0;
+				}
 				j++;
 			}
 		}
@@ -522,6 +549,11 @@ MM_CompactScheme::completeSubAreaTable(MM_EnvironmentStandard *env)
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
 		MM_HeapRegionDescriptorStandard *region = NULL;
 
+		if (_partialCompaction) {
+			selectFragmentedSubAreas(env);
+			saveFixupOnlyFreeEntries(env);
+		}
+
 		/* Finally iterate over all memory pools and reset in preparation for
 		 * rebuild of free list at end of compaction
 		 */
@@ -539,6 +571,247 @@ MM_CompactScheme::completeSubAreaTable(MM_EnvironmentStandard *env)
 	}
 }
 
+void
+MM_CompactScheme::recordSweepFragmentation(MM_EnvironmentBase *env)
+{
+	MM_Heap *heap = _extensions->heap;
+	uintptr_t heapBase = (uintptr_t)heap->getHeapBase();
+
+	if (NULL == _fragmentedBytes) {
+		if (0 == _extensions->parSweepChunkSize) {
+			return;
+		}
+		/* Granules are a power of two, so that the marking scheme finds the granule of a reference with a shift,
+		 * and hold whole sweep chunks and sub areas
+		 */
+		uintptr_t granuleSize = OMR_MAX(_extensions->parSweepChunkSize, DESIRED_SUBAREA_SIZE);
+		_fragmentationGranuleShift = MM_Math::floorLog2(granuleSize);
+		if ((((uintptr_t)1) << _fragmentationGranuleShift) < granuleSize) {
+			_fragmentationGranuleShift += 1;
+		}
+		_fragmentedBytesSize = ((heap->getMaximumPhysicalRange() - 1) >> _fragmentationGranuleShift) + 1;
+		_fragmentedBytes = (uintptr_t *)env->getForge()->allocate(_fragmentedBytesSize * sizeof(uintptr_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _fragmentedBytes) {
+			return;
+		}
+	}
+	memset(_fragmentedBytes, 0, _fragmentedBytesSize * sizeof(uintptr_t));
+
+	MM_SweepHeapSectioningIterator sectioningIterator(_extensions->sweepHeapSectioning);
+	MM_ParallelSweepChunk *chunk = NULL;
+	while (NULL != (chunk = sectioningIterator.nextChunk())) {
+		if (NULL == chunk->chunkBase) {
+			continue;
+		}
+		uintptr_t granule = ((uintptr_t)chunk->chunkBase - heapBase) >> _fragmentationGranuleShift;
+		if (granule < _fragmentedBytesSize) {
+			/* Free memory in the largest entry is usable as is, and leading/trailing free memory coalesces with the neighbouring chunks */
+			uintptr_t largestFreeEntry = OMR_MIN(chunk->_largestFreeEntry, chunk->freeBytes);
+			_fragmentedBytes[granule] += (chunk->freeBytes - largestFreeEntry) + chunk->_darkMatterBytes;
+		}
+	}
+
+	_fragmentationRecorded = true;
+}
+
+bool
+MM_CompactScheme::selectCompactionCandidates(MM_EnvironmentBase *env)
+{
+	if (NULL == _fragmentedBytes) {
+		/* No sweep has completed yet */
+		return false;
+	}
+
+	MM_Heap *heap = _extensions->heap;
+	if (NULL == _rememberedSet) {
+		_rememberedSet = MM_CompactRememberedSet::newInstance(env, heap->getHeapBase(), heap->getMaximumPhysicalRange(), _fragmentationGranuleShift);
+		if (NULL == _rememberedSet) {
+			return false;
+		}
+	}
+
+	/* Histogram of granules by fragmented percentage */
+	uintptr_t granuleCount[101];
+	memset(granuleCount, 0, sizeof(granuleCount));
+	for (uintptr_t granule = 0; granule < _fragmentedBytesSize; granule++) {
+		granuleCount[getGranuleFragmentation(granule)] += 1;
+	}
+
+	/* Take whole buckets, most fragmented first, while they fit in the budget. Unfragmented granules are never worth moving. */
+	uintptr_t granuleSize = ((uintptr_t)1) << _fragmentationGranuleShift;
+	uintptr_t budget = (uintptr_t)((((double)heap->getActiveMemorySize() * _extensions->partialCompactionPercent) / 100) / granuleSize);
+	budget = OMR_MAX(budget, 1);
+	uintptr_t threshold = 101;
+	uintptr_t selectedCount = 0;
+	while ((threshold > 1) && ((selectedCount + granuleCount[threshold - 1]) <= budget)) {
+		threshold -= 1;
+		selectedCount += granuleCount[threshold];
+	}
+	uintptr_t remainingBudget = budget - selectedCount;
+
+	/* Choose the granules above the threshold, filling what is left of the budget from the next bucket in address order */
+	uintptr_t lowestFragmentation = 100;
+	selectedCount = 0;
+	_rememberedSet->clearCandidates();
+	for (uintptr_t granule = 0; granule < _fragmentedBytesSize; granule++) {
+		uintptr_t fragmentation = getGranuleFragmentation(granule);
+		bool selected = (fragmentation >= threshold);
+		if (!selected && (fragmentation > 0) && ((fragmentation + 1) == threshold) && (0 < remainingBudget)) {
+			remainingBudget -= 1;
+			selected = true;
+		}
+
+		if (selected) {
+			_rememberedSet->addCandidateGranule(granule);
+			lowestFragmentation = OMR_MIN(lowestFragmentation, fragmentation);
+			selectedCount += 1;
+		}
+	}
+
+	if (0 < selectedCount) {
+		_rememberedSet->clearCards();
+	}
+	Trc_MM_CompactScheme_selectCompactionCandidates(env->getLanguageVMThread(), selectedCount, granuleSize, lowestFragmentation);
+
+	return (0 < selectedCount);
+}
+
+void
+MM_CompactScheme::mainSetupForMark(MM_EnvironmentBase *env, bool initMarkMap)
+{
+	_rememberedSetComplete = false;
+	_fragmentationRecorded = false;
+
+	/* Only a mark done entirely within this collection sees every object referring into the candidates */
+	if (initMarkMap && (0 != _extensions->partialCompactionPercent) && selectCompactionCandidates(env)) {
+		_markingScheme->setCompactRememberedSet(_rememberedSet);
+		_rememberedSetComplete = true;
+	}
+}
+
+void
+MM_CompactScheme::mainCleanupAfterMark(MM_EnvironmentBase *env)
+{
+	_markingScheme->setCompactRememberedSet(NULL);
+}
+
+void
+MM_CompactScheme::selectFragmentedSubAreas(MM_EnvironmentStandard *env)
+{
+	uintptr_t totalBytes = 0;
+	uintptr_t subAreaCount = 0;
+	uintptr_t selectedCount = 0;
+	uintptr_t selectedBytes = 0;
+	_compactFrom = (omrobjectptr_t)_heap->getHeapTop();
+	_compactTo = (omrobjectptr_t)_heap->getHeapBase();
+
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; SubAreaEntry::end_segment != subAreaTable[i].state; i++) {
+			uintptr_t size = (uintptr_t)subAreaTable[i + 1].firstObject - (uintptr_t)subAreaTable[i].firstObject;
+
+			/* The marked objects of the sub area start below the tentative limit removeNullSubAreas() left in freeChunk,
+			 * and may only move if every granule they start in is a candidate, as no other reference to them was remembered
+			 */
+			uintptr_t granule = ((uintptr_t)subAreaTable[i].firstObject - _heapBase) >> _fragmentationGranuleShift;
+			uintptr_t granuleEnd = (((uintptr_t)subAreaTable[i].freeChunk - 1 - _heapBase) >> _fragmentationGranuleShift) + 1;
+			bool selected = true;
+			for (; selected && (granule < granuleEnd); granule++) {
+				selected = _rememberedSet->isCandidateGranule(granule);
+			}
+			subAreaTable[i].freeChunk = NULL;
+
+			if (selected) {
+				Assert_MM_true(SubAreaEntry::init == subAreaTable[i].state);
+				_compactFrom = OMR_MIN(_compactFrom, subAreaTable[i].firstObject);
+				_compactTo = OMR_MAX(_compactTo, subAreaTable[i + 1].firstObject);
+				selectedCount += 1;
+				selectedBytes += size;
+			} else {
+				subAreaTable[i].state = SubAreaEntry::fixup_only;
+			}
+			totalBytes += size;
+			subAreaCount += 1;
+		}
+		subAreaTable += (i + 1);
+	}
+
+	env->_compactStats._subAreas = subAreaCount;
+	env->_compactStats._selectedSubAreas = selectedCount;
+	env->_compactStats._selectedBytes = selectedBytes;
+	Trc_MM_CompactScheme_selectFragmentedSubAreas(env->getLanguageVMThread(), selectedCount, subAreaCount, selectedBytes, totalBytes);
+}
+
+void
+MM_CompactScheme::saveFixupOnlyFreeEntries(MM_EnvironmentStandard *env)
+{
+	MM_HeapMemoryPoolIterator poolIterator(env, _heap);
+	MM_MemoryPool *memoryPool = NULL;
+
+	while (NULL != (memoryPool = poolIterator.nextPool())) {
+		/* Free entries come in address order, so the sub area holding them only moves forward */
+		SubAreaEntry *subArea = _subAreaTable;
+		SubAreaEntry *runSubArea = NULL;
+		MM_HeapLinkedFreeHeader *runHead = NULL;
+		MM_HeapLinkedFreeHeader *runTail = NULL;
+		void *freeEntry = memoryPool->getFirstFreeStartingAddr(env);
+		while (NULL != freeEntry) {
+			/* Relinking the run may change the entry, so find the next one first */
+			void *nextFreeEntry = memoryPool->getNextFreeStartingAddr(env, freeEntry);
+			while ((SubAreaEntry::end_segment == subArea->state) || ((void *)subArea[1].firstObject <= freeEntry)) {
+				Assert_MM_true(SubAreaEntry::end_heap != subArea->state);
+				subArea += 1;
+			}
+
+			if (subArea != runSubArea) {
+				if (NULL != runSubArea) {
+					linkFixupOnlyFreeEntries(env, runSubArea, runHead, runTail);
+					runSubArea = NULL;
+				}
+				if (SubAreaEntry::fixup_only == subArea->state) {
+					runSubArea = subArea;
+					runHead = (MM_HeapLinkedFreeHeader *)freeEntry;
+				}
+			} else {
+				runTail->setNext((MM_HeapLinkedFreeHeader *)freeEntry, env->compressObjectReferences());
+			}
+			runTail = (MM_HeapLinkedFreeHeader *)freeEntry;
+			freeEntry = nextFreeEntry;
+		}
+
+		if (NULL != runSubArea) {
+			linkFixupOnlyFreeEntries(env, runSubArea, runHead, runTail);
+		}
+	}
+}
+
+void
+MM_CompactScheme::linkFixupOnlyFreeEntries(MM_EnvironmentStandard *env, SubAreaEntry *subArea, MM_HeapLinkedFreeHeader *head, MM_HeapLinkedFreeHeader *tail)
+{
+	bool const compressed = env->compressObjectReferences();
+
+	/* The sub area may already hold the entries of another memory pool, which lie wholly below or above these */
+	MM_HeapLinkedFreeHeader *previous = NULL;
+	MM_HeapLinkedFreeHeader *next = (MM_HeapLinkedFreeHeader *)subArea->freeChunk;
+	while ((NULL != next) && (next < head)) {
+		previous = next;
+		next = next->getNext(compressed);
+	}
+
+	tail->setNext(next, compressed);
+	if (NULL == previous) {
+		subArea->freeChunk = (omrobjectptr_t)head;
+	} else {
+		previous->setNext(head, compressed);
+	}
+}
+
 void
 MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, bool aggressive)
 {
@@ -563,6 +836,11 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		/* Reset largestFreeEntry of all subSpaces at beginning of compaction */
 		_extensions->heap->resetLargestFreeEntry();
 
+		/* Only the non aggressive compactions can be partial, and only if the mark remembered the objects referring into the
+		 * candidates and the sweep left all free memory on the free lists, which the sub areas that are not moved keep
+		 */
+		_partialCompaction = !aggressive && _rememberedSetComplete && _fragmentationRecorded;
+
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
@@ -577,7 +855,8 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	}
 
 	env->_compactStats._setupStartTime = omrtime_hires_clock();
-	workerSetupForGC(env, singleThreaded);
+	/* A partial compaction chooses among sub areas, so keeps them even if only one thread moves objects */
+	workerSetupForGC(env, singleThreaded && !_partialCompaction);
 	env->_compactStats._setupEndTime = omrtime_hires_clock();
 
 	/* If a single threaded compaction force compact to run on main thread. Required
@@ -679,7 +958,11 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 		poolState->_memoryPool = subAreaTable[i].memoryPool;
 
 		do {
-			if (NULL != subAreaTable[i].freeChunk) {
+			if (SubAreaEntry::fixup_only == subAreaTable[i].state) {
+				/* Nothing moved in the sub area, so the free memory is still between the marked objects */
+				currentFreeBase = rebuildFreelistInFixupOnlySubArea(env, memorySubSpace, poolState, &subAreaTable[i], currentFreeBase);
+				currentFreeSize = 0;
+			} else if (NULL != subAreaTable[i].freeChunk) {
 				if (subAreaTable[i].freeChunk == subAreaTable[i].firstObject) {
 					/* The entire sub area is free */
 					if (NULL == currentFreeBase) {
@@ -699,9 +982,7 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 					currentFreeBase = (void *)subAreaTable[i].freeChunk;
 				}
 			} else {
-				/* Either there is no free area in the sub area or sub area is
-				 * a fixup_only sub area, i.e. IC is active
-				 */
+				/* There is no free area in the sub area */
 				if (NULL != currentFreeBase) {
 					currentFreeSize = (uintptr_t)subAreaTable[i].firstObject - (uintptr_t)currentFreeBase;
 
@@ -727,6 +1008,39 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 	}
 }
 
+void *
+MM_CompactScheme::rebuildFreelistInFixupOnlySubArea(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, MM_CompactMemoryPoolState *poolState, SubAreaEntry *subArea, void *freeBase)
+{
+	bool const compressed = env->compressObjectReferences();
+	void *end = (void *)subArea[1].firstObject;
+	/* A free range carried over from the previous sub area ends at this one's first object */
+	void *freeTop = (void *)subArea[0].firstObject;
+
+	MM_HeapLinkedFreeHeader *freeEntry = (MM_HeapLinkedFreeHeader *)subArea[0].freeChunk;
+	while (NULL != freeEntry) {
+		/* Adding a range rewrites the headers within it, so find the next entry first */
+		MM_HeapLinkedFreeHeader *nextFreeEntry = freeEntry->getNext(compressed);
+		if ((NULL != freeBase) && ((void *)freeEntry != freeTop)) {
+			addFreeEntry(env, memorySubSpace, poolState, freeBase, (uintptr_t)freeTop - (uintptr_t)freeBase);
+			freeBase = NULL;
+		}
+		if (NULL == freeBase) {
+			freeBase = (void *)freeEntry;
+		}
+		freeTop = (void *)freeEntry->afterEnd();
+		freeEntry = nextFreeEntry;
+	}
+
+	if (end == freeTop) {
+		/* The free range continues into the next sub area */
+		return freeBase;
+	}
+	if (NULL != freeBase) {
+		addFreeEntry(env, memorySubSpace, poolState, freeBase, (uintptr_t)freeTop - (uintptr_t)freeBase);
+	}
+	return NULL;
+}
+
 /*
  * Call appropriate Memory Pool to add a new free entry to the pool. If the free entry
  * spans more than one subpool then it will be split into 2 free entries.
@@ -1359,7 +1673,11 @@ MM_CompactScheme::fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCou
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_up)) {
-        		fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, subAreaTable[i].state == SubAreaEntry::fixup_only, objectCount);
+        		if (SubAreaEntry::fixup_only == subAreaTable[i].state) {
+        			fixupRememberedObjects(env, &subAreaTable[i], objectCount);
+        		} else {
+        			fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, false, objectCount);
+        		}
 			}
         }
         /* Number of regions in regionTable, including
@@ -1404,6 +1722,27 @@ MM_CompactScheme::fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t first
 	}
 }
 
+void
+MM_CompactScheme::fixupRememberedObjects(MM_EnvironmentStandard *env, SubAreaEntry *subArea, uintptr_t& objectCount)
+{
+	MM_CompactSchemeFixupObject fixupObject(env, this);
+
+	/* No marked object starts in the page of the next sub area's first object (see setRealLimitsSubAreas) */
+	void *start = (void *)subArea[0].firstObject;
+	void *end = (void *)pageStart(pageIndex(subArea[1].firstObject));
+	void *card = start;
+	while (NULL != (card = _rememberedSet->nextRememberedCard(card, end))) {
+		void *cardTop = (void *)((uintptr_t)card + J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT);
+		MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)OMR_MAX(card, start), (uintptr_t *)OMR_MIN(cardTop, end));
+		omrobjectptr_t objectPtr = NULL;
+		while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+			objectCount++;
+			fixupObject.fixupObject(env, objectPtr);
+		}
+		card = cardTop;
+	}
+}
+
 void
 MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 {
@@ -1419,7 +1758,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
@@ -1446,11 +1785,28 @@ MM_CompactScheme::rebuildMarkbitsInSubArea(MM_EnvironmentStandard *env, MM_HeapR
 		return;
 	}
 
-	/* Now set the markbits according to the new object locations */
+	/* Now set the markbits according to the new object locations. Objects arrive in address order, so the
+	 * bits of each mark map slot are accumulated and the slot is written once rather than once per object.
+	 */
 	GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, start, end, false);
 	omrobjectptr_t objectPtr;
+	uintptr_t slotIndex = 0;
+	uintptr_t slotValue = 0;
 	while(NULL != (objectPtr = objectIterator.nextObject())) {
-		_markMap->setBit(objectPtr);
+		uintptr_t objectSlotIndex = 0;
+		uintptr_t objectBitMask = 0;
+		_markMap->getSlotIndexAndMask(objectPtr, &objectSlotIndex, &objectBitMask);
+		if (objectSlotIndex != slotIndex) {
+			if (0 != slotValue) {
+				_markMap->setSlot(slotIndex, _markMap->getSlot(slotIndex) | slotValue);
+			}
+			slotIndex = objectSlotIndex;
+			slotValue = 0;
+		}
+		slotValue |= objectBitMask;
+	}
+	if (0 != slotValue) {
+		_markMap->setSlot(slotIndex, _markMap->getSlot(slotIndex) | slotValue);
 	}
 }
 
@@ -1484,7 +1840,7 @@ MM_CompactScheme::parallelFixHeapForWalk(MM_EnvironmentBase *env)
         	if (subAreaTable[i].state == SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_heap_for_walk)) {
 	        		omrobjectptr_t start = subAreaTable[i].firstObject;
-					omrobjectptr_t end   = subAreaTable[i].firstObject;
+					omrobjectptr_t end   = subAreaTable[i + 1].firstObject;
 					omrobjectptr_t alignedEnd = pageStart(pageIndex(end));
 
 					GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, start, end, false);
@@ -29,6 +29,7 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 
 #include "BaseVirtual.hpp"
+#include "CompactRememberedSet.hpp"
 #include "Debug.hpp"
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
@@ -138,6 +139,13 @@ protected:
 	omrobjectptr_t         _compactFrom;
 	omrobjectptr_t         _compactTo;
 	MM_CompactDelegate     _delegate;
+	bool                   _partialCompaction;  /**< True if the current compaction only moves objects within the most fragmented sub areas */
+	uintptr_t              *_fragmentedBytes;  /**< Bytes lost to fragmentation per granule of the heap, as found by the last completed sweep */
+	uintptr_t              _fragmentedBytesSize;  /**< Number of granules in _fragmentedBytes */
+	uintptr_t              _fragmentationGranuleShift;  /**< Log2 of the heap bytes covered by each entry of _fragmentedBytes, at least the sweep chunk size */
+	MM_CompactRememberedSet *_rememberedSet;  /**< The compaction candidates, and the objects referring into them */
+	bool                   _rememberedSetComplete;  /**< True if the mark of this cycle remembered every live object referring into the compaction candidates */
+	bool                   _fragmentationRecorded;  /**< True if the sweep of this cycle completed, so the free lists hold all free memory */
 
 public:
 
@@ -170,6 +178,56 @@ protected:
 	void removeNullSubAreas(MM_EnvironmentStandard *env);
 	void completeSubAreaTable(MM_EnvironmentStandard *env);
 
+	/**
+	 * Choose the most fragmented granules, up to partialCompactionPercent of the heap, as the compaction
+	 * candidates of this cycle, going by the fragmentation the last completed sweep recorded.
+	 *
+	 * @param env[in] the main thread
+	 * @return true if any granule was chosen
+	 */
+	bool selectCompactionCandidates(MM_EnvironmentBase *env);
+
+	/**
+	 * Answer the percentage of a granule lost to fragmentation, as recorded by recordSweepFragmentation().
+	 *
+	 * @param[in] granule index of the granule, from the heap base
+	 * @return the fragmented percentage, from 0 to 100
+	 */
+	MMINLINE uintptr_t
+	getGranuleFragmentation(uintptr_t granule)
+	{
+		uintptr_t percent = (uintptr_t)(((double)_fragmentedBytes[granule] * 100) / (double)(((uintptr_t)1) << _fragmentationGranuleShift));
+		return OMR_MIN(percent, 100);
+	}
+
+	/**
+	 * Select the sub areas lying entirely within the compaction candidates for compaction. The other sub areas
+	 * are made fixup_only: their objects neither move nor are moved over, and only the objects the mark
+	 * remembered as referring into the candidates are fixed up.
+	 *
+	 * @param env[in] the main thread
+	 */
+	void selectFragmentedSubAreas(MM_EnvironmentStandard *env);
+
+	/**
+	 * Keep the free entries the sweep left in fixup_only sub areas, which compaction does not touch, so that
+	 * rebuilding the free list does not have to walk the marked objects of those sub areas. The entries of each
+	 * fixup_only sub area are linked in address order from its freeChunk. Must run before the memory pools are reset.
+	 *
+	 * @param env[in] the main thread
+	 */
+	void saveFixupOnlyFreeEntries(MM_EnvironmentStandard *env);
+
+	/**
+	 * Link a run of free entries of one memory pool, lying in a fixup_only sub area, into the entries saved for the sub area.
+	 *
+	 * @param env[in] the main thread
+	 * @param[in] subArea the sub area
+	 * @param[in] head the lowest entry of the run
+	 * @param[in] tail the highest entry of the run, which is linked from all others
+	 */
+	void linkFixupOnlyFreeEntries(MM_EnvironmentStandard *env, SubAreaEntry *subArea, MM_HeapLinkedFreeHeader *head, MM_HeapLinkedFreeHeader *tail);
+
 	void saveForwardingPtr(class CompactTableEntry&,
 					omrobjectptr_t objectPtr,
 					omrobjectptr_t forwardingPtr,
@@ -216,10 +274,32 @@ protected:
 	 * @param[in/out] objectCount the number of objects fixed up (accumulated)
 	 */
 	void fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish,  bool markedOnly, uintptr_t& objectCount);
+
+	/**
+	 * Fix up the marked objects of a fixup_only sub area which start on cards remembered as holding references
+	 * into the compaction candidates. No other object of the sub area can refer to a moved object.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in] subArea the sub area, which must be followed by another entry in the table
+	 * @param[in/out] objectCount the number of objects fixed up (accumulated)
+	 */
+	void fixupRememberedObjects(MM_EnvironmentStandard *env, SubAreaEntry *subArea, uintptr_t& objectCount);
 	void fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCount);
 
 	void rebuildFreelist(MM_EnvironmentStandard *env);
 
+	/**
+	 * Add the free entries saved by saveFixupOnlyFreeEntries() for a fixup_only sub area back to the free list.
+	 *
+	 * @param env[in] the current thread
+	 * @param memorySubSpace[in] the subspace which contains the sub area
+	 * @param poolState[in/out] the free list being rebuilt
+	 * @param subArea[in] the sub area, which must be followed by another entry in the table
+	 * @param freeBase[in] the start of the free memory preceding the sub area, or NULL if there is none
+	 * @return the start of the free memory ending the sub area, or NULL if there is none
+	 */
+	void *rebuildFreelistInFixupOnlySubArea(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, MM_CompactMemoryPoolState *poolState, SubAreaEntry *subArea, void *freeBase);
+
 	void addFreeEntry(MM_EnvironmentStandard *env,
 					MM_MemorySubSpace *memorySubSpace,
 					MM_CompactMemoryPoolState *poolState,
@@ -310,6 +390,32 @@ public:
 	void workerSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded);
 	void mainSetupForGC(MM_EnvironmentStandard *env);
 	virtual void compact(MM_EnvironmentBase *env, bool rebuildMarkBits, bool aggressive);
+
+	/**
+	 * Prepare for the mark of a global collection. When partial compaction is enabled and the whole mark is done
+	 * by this collection, choose the compaction candidates and have the marking scheme remember the objects
+	 * referring into them.
+	 *
+	 * @param env[in] the main thread
+	 * @param initMarkMap[in] true if the mark starts from a cleared mark map, false if it completes a concurrent mark
+	 */
+	void mainSetupForMark(MM_EnvironmentBase *env, bool initMarkMap);
+
+	/**
+	 * Stop remembering the objects referring into the compaction candidates once the mark is complete.
+	 *
+	 * @param env[in] the main thread
+	 */
+	void mainCleanupAfterMark(MM_EnvironmentBase *env);
+
+	/**
+	 * Record the bytes each granule of the heap lost to fragmentation, as found by the completed sweep: the
+	 * free memory of each sweep chunk outside of its largest free entry, plus its dark matter. The sub area
+	 * table shares its backing store with the sweep chunks, so this must run before the table is created.
+	 *
+	 * @param env[in] the main thread
+	 */
+	void recordSweepFragmentation(MM_EnvironmentBase *env);
 	omrobjectptr_t getForwardingPtr(omrobjectptr_t objectPtr) const;
 	void flushPool(MM_EnvironmentStandard *env, MM_CompactMemoryPoolState *freeListState);
 	void fixHeapForWalk(MM_EnvironmentBase *env);
@@ -336,6 +442,13 @@ public:
 		, _subAreaTableSize(0)
 		, _subAreaTable(NULL)
 		, _delegate()
+		, _partialCompaction(false)
+		, _fragmentedBytes(NULL)
+		, _fragmentedBytesSize(0)
+		, _fragmentationGranuleShift(0)
+		, _rememberedSet(NULL)
+		, _rememberedSetComplete(false)
+		, _fragmentationRecorded(false)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -43,6 +43,7 @@
 #include "ConcurrentGCSATB.hpp"
 #include "ParallelMarkTask.hpp"
 #include "ConcurrentCompleteTracingTask.hpp"
+#include "EnvironmentStandard.hpp"
 #include "OMRVMInterface.hpp"
 #include "ParallelDispatcher.hpp"
 #include "RememberedSetSATB.hpp"
@@ -156,6 +157,8 @@ MM_ConcurrentGCSATB::localMark(MM_EnvironmentBase *env, uintptr_t sizeToTrace)
 	Assert_MM_true(_concurrentCycleState._referenceObjectOptions == MM_CycleState::references_default);
 	env->_cycleState = &_concurrentCycleState;
 
+	drainBarrierBuffers(env);
+
 	uintptr_t sizeTraced = 0;
 	while (NULL != (objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env))) {
 		/* Check for array scanPtr..if we find one ignore it*/
@@ -453,10 +456,14 @@ MM_ConcurrentGCSATB::completeConcurrentTracing(MM_EnvironmentBase *env, uintptr_
 
 #if defined(OMR_GC_REALTIME)
 	/* Flush barrier packets */
+	drainBarrierBuffers(env);
 	if (((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->inUsePacketsAvailable(env)) {
 			((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->moveInUseToNonEmpty(env);
 			_extensions->sATBBarrierRememberedSet->flushFragments(env);
 	}
+	Trc_MM_ConcurrentGCSATB_barrierBuffersDrained(env->getLanguageVMThread(), _stats.getSATBBufferFills(), _stats.getSATBDrainBatches(),
+		omrtime_hires_delta(0, _stats.getSATBDrainLatencySum(), OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+		omrtime_hires_delta(0, _stats.getSATBDrainLatencyMax(), OMRPORT_TIME_DELTA_IN_MICROSECONDS));
 
 	/* Deactivate barrier */
 	_extensions->sATBBarrierRememberedSet->preserveGlobalFragmentIndex(env);
@@ -482,6 +489,39 @@ MM_ConcurrentGCSATB::completeConcurrentTracing(MM_EnvironmentBase *env, uintptr_
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 }
 
+/**
+ * Drain the SATB barrier buffers published by mutators to the full packet list
+ * in one batch, so they can be traced, and account for them in the concurrent stats.
+ */
+void
+MM_ConcurrentGCSATB::drainBarrierBuffers(MM_EnvironmentBase *env)
+{
+	MM_WorkPacketsSATB *workPackets = (MM_WorkPacketsSATB *)_markingScheme->getWorkPackets();
+
+	if (workPackets->publishedPacketsAvailable(env)) {
+		uint64_t latencySum = 0;
+		uint64_t latencyMax = 0;
+		uintptr_t buffers = workPackets->drainPublishedBarrierPackets(env, &latencySum, &latencyMax);
+		if (0 != buffers) {
+			_stats.recordSATBBufferDrain(buffers, latencySum, latencyMax);
+		}
+	}
+}
+
+void
+MM_ConcurrentGCSATB::rememberObjectToRescan(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	/* an object marked here is scanned once the buffer holding it is drained */
+	if (_markingScheme->markObject(env, objectPtr, true)) {
+		MM_GCRememberedSetFragment *fragment = &MM_EnvironmentStandard::getEnvironment(env)->_sATBBarrierRememberedSetFragment;
+		if (NULL == fragment->fragmentParent) {
+			/* first reference this thread remembers */
+			_extensions->sATBBarrierRememberedSet->initializeFragment(env, fragment);
+		}
+		_extensions->sATBBarrierRememberedSet->storeInFragment(env, fragment, (uintptr_t *)objectPtr);
+	}
+}
+
 void
 MM_ConcurrentGCSATB::setThreadsScanned(MM_EnvironmentBase *env)
 {
@@ -50,6 +50,7 @@ private:
 	 */
 private:
 	void setThreadsScanned(MM_EnvironmentBase *env);
+	void drainBarrierBuffers(MM_EnvironmentBase *env);
 
 protected:
 	bool initialize(MM_EnvironmentBase *env);
@@ -79,6 +80,13 @@ public:
 	static MM_ConcurrentGCSATB *newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
 
+	/**
+	 * Remember an object whose reference is about to be overwritten while the SATB barrier is active,
+	 * so that the snapshot it belongs to is still traced.
+	 * @param objectPtr the object the overwritten slot referenced
+	 */
+	void rememberObjectToRescan(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+
 	MM_ConcurrentGCSATB(MM_EnvironmentBase *env)
 		: MM_ConcurrentGC(env)
 		,_bytesToTrace(0)
@@ -0,0 +1,215 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+
+#include "omrmodroncore.h"
+#include "ModronAssertions.h"
+
+#include "ConcurrentSweepGC.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+/**
+ * Create new instance of a lazily sweeping global collector.
+ * @return Reference to new MM_ConcurrentSweepGC object or NULL
+ */
+MM_ConcurrentSweepGC *
+MM_ConcurrentSweepGC::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentSweepGC *globalGC = (MM_ConcurrentSweepGC *)env->getForge()->allocate(sizeof(MM_ConcurrentSweepGC), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != globalGC) {
+		new(globalGC) MM_ConcurrentSweepGC(env);
+		if (!globalGC->initialize(env)) {
+			globalGC->kill(env);
+			globalGC = NULL;
+		}
+	}
+	return globalGC;
+}
+
+/**
+ * Destroy instance of a lazily sweeping global collector.
+ */
+void
+MM_ConcurrentSweepGC::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ConcurrentSweepGC::initialize(MM_EnvironmentBase *env)
+{
+	Assert_MM_true(_extensions->concurrentSweep);
+
+	if (!MM_ParallelGlobalGC::initialize(env)) {
+		return false;
+	}
+
+	/* Collections run in the requesting thread, the main GC thread is only woken to sweep (with VM access) in between */
+	if (!_mainGCThread.initialize(this, true, true, false)) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_ConcurrentSweepGC::tearDown(MM_EnvironmentBase *env)
+{
+	_mainGCThread.tearDown(env);
+
+	MM_ParallelGlobalGC::tearDown(env);
+}
+
+bool
+MM_ConcurrentSweepGC::collectorStartup(MM_GCExtensionsBase* extensions)
+{
+	if (!MM_ParallelGlobalGC::collectorStartup(extensions)) {
+		return false;
+	}
+	return _mainGCThread.startup();
+}
+
+void
+MM_ConcurrentSweepGC::collectorShutdown(MM_GCExtensionsBase *extensions)
+{
+	_mainGCThread.shutdown();
+	MM_ParallelGlobalGC::collectorShutdown(extensions);
+}
+
+/**
+ * Finish all sweep work left over from the last global collection.
+ * @note Expects exclusive access to be held.
+ * @note Expects to have parallel helper threads available.
+ */
+void
+MM_ConcurrentSweepGC::completeConcurrentSweep(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentSweepScheme *concurrentSweep = getConcurrentSweepScheme();
+
+	if (concurrentSweep->isConcurrentSweepActive()) {
+		concurrentSweep->completeSweep(env, ABOUT_TO_GC);
+	}
+}
+
+/**
+ * Scavenges allocate into and may walk the old area, so they start from a completely swept heap.
+ */
+void
+MM_ConcurrentSweepGC::completeWorkBeforeLocalCollection(MM_EnvironmentBase *env)
+{
+	completeConcurrentSweep(env);
+}
+
+void
+MM_ConcurrentSweepGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode)
+{
+	/* Finish off any sweep work still pending before the GC, so that the heap is walkable and the mark map can be reused */
+	completeConcurrentSweep(env);
+
+	MM_ParallelGlobalGC::internalPreCollect(env, subSpace, allocDescription, gcCode);
+}
+
+bool
+MM_ConcurrentSweepGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription)
+{
+	_extensions->globalGCStats.gcCount += 1;
+
+	/* Collect in this thread, then wake the main GC thread if the collection left chunks to sweep */
+	_mainGCThread.garbageCollect(env, allocDescription);
+
+	return true;
+}
+
+void
+MM_ConcurrentSweepGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool initMarkMap, bool rebuildMarkBits)
+{
+	/* Every collection marks from scratch, whether requested directly or through the main GC thread */
+	MM_ParallelGlobalGC::mainThreadGarbageCollect(env, allocDescription, true, rebuildMarkBits);
+}
+
+/**
+ * Complete the sweep of the heap before it is walked.
+ */
+void
+MM_ConcurrentSweepGC::prepareHeapForWalk(MM_EnvironmentBase *env)
+{
+	completeConcurrentSweep(env);
+
+	MM_ParallelGlobalGC::prepareHeapForWalk(env);
+}
+
+/**
+ * Sweep chunks into the given pool, as its free list has run dry.
+ * @note This call is made under the pools allocation lock (or equivalent)
+ * @return True if the pool was replenished with a free entry that can satisfy the size, false otherwise.
+ */
+bool
+MM_ConcurrentSweepGC::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size)
+{
+	return _sweepScheme->replenishPoolForAllocate(env, memoryPool, size);
+}
+
+bool
+MM_ConcurrentSweepGC::isConcurrentWorkAvailable(MM_EnvironmentBase *env)
+{
+	return getConcurrentSweepScheme()->isConcurrentSweepActive();
+}
+
+/**
+ * Sweep in the background until all chunks are swept or a thread requests exclusive access.
+ * @note The main GC thread holds VM access.
+ * @return the number of chunks swept
+ */
+uintptr_t
+MM_ConcurrentSweepGC::mainThreadConcurrentCollect(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	if (0 == env->_freeEntrySizeClassStats.getMaxSizeClasses()) {
+		/* The helper attached in collectorStartup, before the memory pools sized the free entry profile that sweeping updates */
+		uintptr_t veryLargeObjectThreshold = (_extensions->largeObjectAllocationProfilingVeryLargeObjectThreshold <= _extensions->memoryMax) ? 0 : _extensions->largeObjectAllocationProfilingVeryLargeObjectThreshold;
+		env->_freeEntrySizeClassStats.tearDown(env);
+		if (!env->_freeEntrySizeClassStats.initialize(env, _extensions->largeObjectAllocationProfilingTopK, _extensions->freeMemoryProfileMaxSizeClasses, veryLargeObjectThreshold)) {
+			return 0;
+		}
+	}
+
+	_concurrentPhaseStats._startTime = omrtime_hires_clock();
+	uintptr_t oldVMstate = env->pushVMstate(OMRVMSTATE_GC_CONCURRENT_SWEEP);
+	uintptr_t chunksSwept = getConcurrentSweepScheme()->sweepInBackground(env);
+	env->popVMstate(oldVMstate);
+	_concurrentPhaseStats._endTime = omrtime_hires_clock();
+
+	return chunksSwept;
+}
+
+#endif /* OMR_GC_CONCURRENT_SWEEP */
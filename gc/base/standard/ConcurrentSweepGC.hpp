@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(CONCURRENTSWEEPGC_HPP_)
+#define CONCURRENTSWEEPGC_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+
+#include "omrgcconsts.h"
+
+#include "ConcurrentPhaseStatsBase.hpp"
+#include "ConcurrentSweepScheme.hpp"
+#include "MainGCThread.hpp"
+#include "ParallelGlobalGC.hpp"
+
+/**
+ * Stop-the-world mark and sweep global collector which sweeps lazily.
+ * The collection only sweeps enough of the heap to satisfy the allocation that triggered it. The remaining chunks
+ * are swept by allocating threads when the free list runs dry, and by a background helper thread woken at the end
+ * of the collection. Any sweep work still pending is completed before the next collection, global or local, starts.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentSweepGC : public MM_ParallelGlobalGC
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_MainGCThread _mainGCThread; /**< Implicit main GC thread, woken to sweep in the background after a collection */
+	MM_ConcurrentPhaseStatsBase _concurrentPhaseStats; /**< Timing of the most recent background sweep */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MM_ConcurrentSweepScheme *getConcurrentSweepScheme() { return (MM_ConcurrentSweepScheme *)_sweepScheme; }
+
+	void completeConcurrentSweep(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	virtual void mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool initMarkMap, bool rebuildMarkBits);
+	virtual bool internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription);
+	virtual void internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode);
+
+public:
+	static MM_ConcurrentSweepGC *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	virtual bool collectorStartup(MM_GCExtensionsBase* extensions);
+	virtual void collectorShutdown(MM_GCExtensionsBase *extensions);
+
+	virtual void prepareHeapForWalk(MM_EnvironmentBase *env);
+	virtual void completeWorkBeforeLocalCollection(MM_EnvironmentBase *env);
+
+	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size);
+
+	virtual bool isConcurrentWorkAvailable(MM_EnvironmentBase *env);
+	virtual uintptr_t mainThreadConcurrentCollect(MM_EnvironmentBase *env);
+	virtual MM_ConcurrentPhaseStatsBase *getConcurrentPhaseStats() { return &_concurrentPhaseStats; }
+
+	MM_ConcurrentSweepGC(MM_EnvironmentBase *env)
+		: MM_ParallelGlobalGC(env)
+		, _mainGCThread(env)
+		, _concurrentPhaseStats()
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+
+#endif /* CONCURRENTSWEEPGC_HPP_ */
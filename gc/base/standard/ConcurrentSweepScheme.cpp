@@ -1440,7 +1440,8 @@ void
 MM_ConcurrentSweepScheme::checkRestrictions(MM_EnvironmentBase *env)
 {
 #if defined(OMR_GC_MODRON_SCAVENGER)
-	assume(env->getExtensions()->scavengerEnabled == false, "Must be a flat collector");
+	/* Only MM_ConcurrentSweepGC completes the sweep ahead of each scavenge */
+	assume(env->getExtensions()->scavengerEnabled == false || env->getExtensions()->isConcurrentMarkEnabled() == false, "Must be a flat collector when marking concurrently");
 #endif /* OMR_GC_MODRON_SCAVENGER */	
 }
 
@@ -1566,6 +1567,35 @@ MM_ConcurrentSweepScheme::completeSweepingConcurrently(MM_EnvironmentBase *envMo
 	return true;
 }
 
+/**
+ * Sweep the remaining chunks of all memory pools on behalf of a background helper thread.
+ * Unlike completeSweepingConcurrently(), the helper stops as soon as exclusive access is requested, leaving any
+ * chunks it did not get to for allocating threads or for the completion of the sweep at the next collection.
+ * Chunks are only swept, connecting them to the free list is still left to allocation.
+ * @note The calling thread has VM access.
+ * @return the number of chunks swept by the caller.
+ */
+UDATA
+MM_ConcurrentSweepScheme::sweepInBackground(MM_EnvironmentBase *envModron)
+{
+	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envModron);
+	UDATA chunksSwept = 0;
+
+	if(_stats.canCompleteSweepConcurrently()) {
+		MM_HeapMemoryPoolIterator poolIterator(envModron, _extensions->heap);
+		MM_MemoryPool *memoryPool;
+		while(NULL != (memoryPool = poolIterator.nextPool())) {
+			MM_ConcurrentSweepPoolState *sweepState = (MM_ConcurrentSweepPoolState *)getPoolState(memoryPool);
+
+			while(!env->isExclusiveAccessRequestWaiting() && concurrentSweepNextAvailableChunk(env, sweepState)) {
+				chunksSwept += 1;
+			}
+		}
+	}
+
+	return chunksSwept;
+}
+
 /**
  * Add to the concurrently sweeping thread pool count.
  * 
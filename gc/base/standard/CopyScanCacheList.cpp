@@ -32,6 +32,7 @@
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
 #include "ParallelDispatcher.hpp"
+#include "Task.hpp"
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
@@ -50,6 +51,7 @@ MM_CopyScanCacheList::initialize(MM_EnvironmentBase *env, volatile uintptr_t *ca
 	} else {
 		for (uintptr_t i = 0; i < _sublistCount; i++) {
 			new (&_sublists[i]) CopyScanCacheSublist();
+			_sublists[i]._victimSeed = (i + 1) * 0x9E3779B9;
 			if(_sublists[i].initialize(env)) {
 				result = false;
 				break;
@@ -320,11 +322,24 @@ MM_CopyScanCacheList::pushCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandar
 MM_CopyScanCacheStandard *
 MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 {
-	uintptr_t index = getSublistIndex(env);
+	uintptr_t ownIndex = getSublistIndex(env);
+	uintptr_t index = ownIndex;
+	uintptr_t victimOffset = 0;
 	MM_CopyScanCacheStandard *cache = NULL;
 
 	for (uintptr_t i = 0; i < _sublistCount; i++) {
-		MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[index];
+		MM_CopyScanCacheList::CopyScanCacheSublist *list = NULL;
+
+		if (0 == i) {
+			list = &_sublists[ownIndex];
+		} else {
+			if (1 == i) {
+				victimOffset = getFirstVictimOffset(env, ownIndex);
+			}
+			/* visit every other sublist exactly once, starting from the chosen victim */
+			index = (ownIndex + 1 + ((victimOffset + i - 1) % (_sublistCount - 1))) % _sublistCount;
+			list = &_sublists[index];
+		}
 
 		if (NULL != list->_cacheHead) {
 			env->_scavengerStats._acquireListLockCount += 1;
@@ -344,12 +359,28 @@ MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 				break;
 			}
 		}
-
-		index = (index + 1) % _sublistCount;
 	}
 
 	return cache;
 }
 
+uintptr_t
+MM_CopyScanCacheList::getFirstVictimOffset(MM_EnvironmentBase *env, uintptr_t sublistIndex)
+{
+	uintptr_t offset = 0;
+
+	if ((2 < _sublistCount) && (NULL != env->_currentTask) && env->_currentTask->shouldUseWorkStealing(env)) {
+		/* xorshift; racing updates of the seed only affect the quality of the random sequence */
+		uintptr_t x = _sublists[sublistIndex]._victimSeed;
+		x ^= x << 13;
+		x ^= x >> 7;
+		x ^= x << 17;
+		_sublists[sublistIndex]._victimSeed = x;
+		offset = x % (_sublistCount - 1);
+	}
+
+	return offset;
+}
+
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
@@ -58,10 +58,12 @@ private:
 		MM_CopyScanCacheStandard * volatile _cacheHead;  /**< Head of the list */
 		MM_LightweightNonReentrantLock _cacheLock;  /**< Lock for getting/putting caches */
 		uintptr_t _entryCount;	/**< number of entries in sublist */
+		uintptr_t _victimSeed; /**< state for picking a random sublist to steal from when this sublist is empty (updated without locking) */
 
 		CopyScanCacheSublist () 
 			: _cacheHead(NULL)
-			, _entryCount(0) {
+			, _entryCount(0)
+			, _victimSeed(0) {
 		}
 
 		bool initialize(MM_EnvironmentBase *env) {
@@ -124,6 +126,17 @@ private:
 	 */
 	void decrementCount(CopyScanCacheSublist *sublist, uintptr_t value);
 
+	/**
+	 * Choose the offset (from the current thread's own sublist) of the first sublist to steal from.
+	 * Random when the current task uses work stealing, so that idle threads spread out over the
+	 * victims instead of all contending for the sublist next to their own.
+	 *
+	 * @param env the current environment
+	 * @param sublistIndex the current thread's own sublist
+	 * @return an offset in the range [0, _sublistCount - 1)
+	 */
+	uintptr_t getFirstVictimOffset(MM_EnvironmentBase *env, uintptr_t sublistIndex);
+
 protected:
 public:
 	bool initialize(MM_EnvironmentBase *env, volatile uintptr_t *cachedEntryCount);
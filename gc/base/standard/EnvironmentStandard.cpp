@@ -60,7 +60,8 @@ MM_EnvironmentStandard::initialize(MM_GCExtensionsBase *extensions)
 #endif
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
-	if (extensions->concurrentScavenger) {
+	/* Threads started by the global collector attach before the scavenger is created */
+	if (extensions->concurrentScavenger && (NULL != extensions->scavenger)) {
 		extensions->scavenger->mutatorSetupForGC(this);
 	}
 #endif
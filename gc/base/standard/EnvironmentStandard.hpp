@@ -66,6 +66,13 @@ public:
 	bool _loaAllocation;  /** true, if tenure TLH remainder is in LOA (TODO: try preventing remainder creation in LOA) */
 	void *_survivorTLHRemainderBase; /**< base and top pointers of the last unused survivor TLH copy cache, that might be reused  on next copy refresh */
 	void *_survivorTLHRemainderTop;
+	uintptr_t _copyCacheNumaNode; /**< affinity leader (1-based, 0 for none) this thread carves scavenger copy caches for, with numaAwareScavengerCopy */
+	void *_numaCopyChunkBase; /**< base and top of the unused part of the NUMA copy granule this thread last claimed */
+	void *_numaCopyChunkTop;
+	bool _numaCopyChunkLocal; /**< true if that granule is bound to _copyCacheNumaNode */
+#if defined(OMR_GC_REALTIME)
+	MM_GCRememberedSetFragment _sATBBarrierRememberedSetFragment; /**< SATB barrier buffer this thread remembers overwritten references in */
+#endif /* defined(OMR_GC_REALTIME) */
 
 protected:
 
@@ -98,6 +105,13 @@ public:
 		,_loaAllocation(false)
 		,_survivorTLHRemainderBase(NULL)
 		,_survivorTLHRemainderTop(NULL)
+		,_copyCacheNumaNode(0)
+		,_numaCopyChunkBase(NULL)
+		,_numaCopyChunkTop(NULL)
+		,_numaCopyChunkLocal(false)
+#if defined(OMR_GC_REALTIME)
+		,_sATBBarrierRememberedSetFragment()
+#endif /* defined(OMR_GC_REALTIME) */
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -60,6 +60,42 @@ MM_ParallelCompactTask::cleanup(MM_EnvironmentBase *env)
 	finalGCStats->compactStats.merge(&env->_compactStats);
 }
 
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+void
+MM_ParallelCompactTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t startTime = omrtime_hires_clock();
+	MM_ParallelTask::synchronizeGCThreads(env, id);
+	uint64_t endTime = omrtime_hires_clock();
+	env->_compactStats.addToSyncStallTime(startTime, endTime);
+}
+
+bool
+MM_ParallelCompactTask::synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, const char *id)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t startTime = omrtime_hires_clock();
+	bool result = MM_ParallelTask::synchronizeGCThreadsAndReleaseMain(env, id);
+	uint64_t endTime = omrtime_hires_clock();
+	env->_compactStats.addToSyncStallTime(startTime, endTime);
+
+	return result;
+}
+
+bool
+MM_ParallelCompactTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *env, const char *id)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t startTime = omrtime_hires_clock();
+	bool result = MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(env, id);
+	uint64_t endTime = omrtime_hires_clock();
+	env->_compactStats.addToSyncStallTime(startTime, endTime);
+
+	return result;
+}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 
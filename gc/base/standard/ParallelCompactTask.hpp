@@ -55,6 +55,13 @@ public:
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
 	virtual void cleanup(MM_EnvironmentBase *env);
+	virtual bool shouldUseTreeBarrier(MM_EnvironmentBase *env) { return true; }
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	virtual void synchronizeGCThreads(MM_EnvironmentBase *env, const char *id);
+	virtual bool synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, const char *id);
+	virtual bool synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *env, const char *id);
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	/**
 	 * Create an ParallelCompactTask object.
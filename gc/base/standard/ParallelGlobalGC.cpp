@@ -38,6 +38,7 @@
 #include "Configuration.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
+#include "FreePageReleaser.hpp"
 #include "GlobalAllocationManager.hpp"
 #include "Heap.hpp"
 #include "HeapMapIterator.hpp"
@@ -63,6 +64,7 @@
 #include "ParallelSweepScheme.hpp"
 #include "ParallelTask.hpp"
 #if defined(OMR_GC_MODRON_SCAVENGER)
+#include "RSOverflowMap.hpp"
 #include "Scavenger.hpp"
 #endif /* OMR_GC_MODRON_SCAVENGER */
 #include "WorkPackets.hpp"
@@ -191,10 +193,21 @@ hookGlobalGcSweepEndRsoSafetyFixHeap(J9HookInterface** hook, uintptr_t eventNum,
 	MM_SweepEndEvent* event = (MM_SweepEndEvent*)eventData;
 	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
 	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_ParallelGlobalGC *pggc = (MM_ParallelGlobalGC *)userData;
+
+	if (extensions->isRememberedSetOverflowRecorded()) {
+		/* The scavenger finds overflowed objects in the overflow map rather than walking the heap, so the heap
+		 * does not need fixing. Only forget the recorded objects which did not survive this collection.
+		 */
+		if (!extensions->rememberedSetOverflowMap->retainMarkedObjects(env, pggc->getMarkingScheme()->getMarkMap())) {
+			extensions->clearRememberedSetOverflowState();
+		}
+		extensions->scavengerRsoScanUnsafe = true;
+		return;
+	}
 
 	extensions->scavengerRsoScanUnsafe = !extensions->isRememberedSetInOverflowState();
 	if (!extensions->scavengerRsoScanUnsafe) {
-		MM_ParallelGlobalGC *pggc = (MM_ParallelGlobalGC *)userData;
 		pggc->fixHeapForWalk(env, MEMORY_TYPE_OLD_RAM, FIXUP_DEBUG_TOOLING, fixObject);
 	}
 }
@@ -314,6 +327,15 @@ MM_ParallelGlobalGC::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if (_extensions->deferFreePageRelease) {
+		_extensions->freePageReleaser = MM_FreePageReleaser::newInstance(env);
+		if (NULL == _extensions->freePageReleaser) {
+			goto error_no_memory;
+		}
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 	/* Attach to hooks required by the global collector's
 	 * heap resize (expand/contraction) functions
 	 */
@@ -378,6 +400,13 @@ MM_ParallelGlobalGC::tearDown(MM_EnvironmentBase *env)
 		_heapWalker->kill(env);
 		_heapWalker = NULL;
 	}
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if (NULL != _extensions->freePageReleaser) {
+		_extensions->freePageReleaser->kill(env);
+		_extensions->freePageReleaser = NULL;
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 }
 
 uintptr_t
@@ -464,6 +493,12 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 	
 	sweep(env, allocDescription, rebuildMarkBits);
 
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/* The next partial compaction chooses what to move by the fragmentation this sweep found */
+	if ((0 != _extensions->partialCompactionPercent) && _sweepScheme->isSweepCompleted(env)) {
+		_compactScheme->recordSweepFragmentation(env);
+	}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 	/* If a compaction was required, then do one */
@@ -475,6 +510,12 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 
 		mainThreadCompact(env, allocDescription, rebuildMarkBits);
 		_collectionStatistics._tenureFragmentation = NO_FRAGMENTATION;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		if (_extensions->isRememberedSetOverflowRecorded()) {
+			/* Recorded objects have moved, the scavenger must find them by walking the heap again */
+			_extensions->setRememberedSetOverflowState();
+		}
+#endif /* OMR_GC_MODRON_SCAVENGER */
 		if (_extensions->processLargeAllocateStats) {
 			processLargeAllocateStatsAfterCompact(env);
 		}
@@ -722,7 +763,7 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		uintptr_t totalSize = memorySubSpace->getActiveMemorySize();
 		MM_MemoryPool *memoryPool= memorySubSpace->getMemoryPool();
 		uintptr_t darkMatterBytes = 0;
-		if (!_extensions->concurrentSweep) {
+		if (!_extensions->isConcurrentSweepEnabled()) {
 			darkMatterBytes = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t freeMemorySize = memoryPool->getActualFreeMemorySize();
@@ -929,6 +970,13 @@ MM_ParallelGlobalGC::completeFreelistRebuildRequired(MM_EnvironmentBase *env, Sw
 		*reason = CONTRACTION_REQUIRED;
 	} else if (activeSubSpace->completeFreelistRebuildRequired(env)) {
 		*reason = LOA_RESIZE;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	} else if (_extensions->isConcurrentSweepEnabled() && _extensions->scavengerEnabled
+		&& _extensions->isRememberedSetInOverflowState() && !_extensions->isRememberedSetOverflowRecorded()
+	) {
+		/* the sweep end hook walks the heap so the scavenger can scan it for remembered objects */
+		*reason = HEAP_WALK_REQUIRED;
+#endif /* OMR_GC_MODRON_SCAVENGER */
 	} else if (env->_cycleState->_gcCode.isExplicitGC()) {
 		*reason = SYSTEM_GC;
 	}
@@ -953,7 +1001,13 @@ MM_ParallelGlobalGC::markAll(MM_EnvironmentBase *env, bool initMarkMap)
 
 	/* run the mark */
 	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
+#if defined(OMR_GC_MODRON_COMPACTION)
+	_compactScheme->mainSetupForMark(env, initMarkMap);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 	_dispatcher->run(env, &markTask);
+#if defined(OMR_GC_MODRON_COMPACTION)
+	_compactScheme->mainCleanupAfterMark(env);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 	
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 
@@ -1155,6 +1209,16 @@ MM_ParallelGlobalGC::processLargeAllocateStatsBeforeGC(MM_EnvironmentBase *env)
 
 	memoryPool->getLargeObjectAllocateStats()->setTimeMergeAverage(omrtime_hires_clock() - startTime);
 
+	if (_extensions->indexedFreeList) {
+		MM_LargeObjectAllocateStats *stats = memoryPool->getLargeObjectAllocateStats();
+		Trc_ParallelGlobalGC_freeEntryIndexLookups(env->getLanguageVMThread(),
+			stats->getFreeEntryIndexLookups(MM_LargeObjectAllocateStats::freeEntryIndexBinHit),
+			stats->getFreeEntryIndexLookups(MM_LargeObjectAllocateStats::freeEntryIndexLargerBinHit),
+			stats->getFreeEntryIndexLookups(MM_LargeObjectAllocateStats::freeEntryIndexTreeHit),
+			stats->getFreeEntryIndexLookups(MM_LargeObjectAllocateStats::freeEntryIndexBinWalkHit),
+			stats->getFreeEntryIndexLookups(MM_LargeObjectAllocateStats::freeEntryIndexMiss));
+	}
+
 	/* merge largeObjectAllocateStats in nursery space */
 	if (defaultMemorySubspace->isPartOfSemiSpace()) {
 		/* SemiSpace stats include only Mutator stats (no Collector stats during flipping) */
@@ -1311,6 +1375,15 @@ MM_ParallelGlobalGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *su
 	}
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->rememberedSetOverflowMap) {
+		result = _extensions->rememberedSetOverflowMap->heapAddRange(env, size, lowAddress, highAddress);
+		if (0 == result) {
+			goto rememberedSetOverflowMap_failed_heapAddRange;
+		}
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 	result = _delegate.heapAddRange(env, subspace, size, lowAddress, highAddress);
 	if (0 == result) {
 		goto parallelGlobalGC_failed_heapAddRange;
@@ -1319,6 +1392,12 @@ MM_ParallelGlobalGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *su
 	return true;
 
 parallelGlobalGC_failed_heapAddRange:
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->rememberedSetOverflowMap) {
+		_extensions->rememberedSetOverflowMap->heapRemoveRange(env, size, lowAddress, highAddress, NULL, NULL);
+	}
+rememberedSetOverflowMap_failed_heapAddRange:
+#endif /* OMR_GC_MODRON_SCAVENGER */
 #if defined(OMR_GC_OBJECT_MAP)
 	_extensions->getObjectMap()->heapRemoveRange(env, subspace, size, lowAddress, highAddress, NULL, NULL);
 objectMap_failed_heapAddRange:
@@ -1339,6 +1418,11 @@ MM_ParallelGlobalGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace
 {
 	bool result = _markingScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 	result = result && _sweepScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->rememberedSetOverflowMap) {
+		result = result && _extensions->rememberedSetOverflowMap->heapRemoveRange(env, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
 
 	result = result && _delegate.heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 
@@ -1362,12 +1446,22 @@ MM_ParallelGlobalGC::collectorStartup(MM_GCExtensionsBase* extensions)
 		extensions->scavenger->collectorStartup(extensions);
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if ((NULL != extensions->freePageReleaser) && !extensions->freePageReleaser->startup()) {
+		return false;
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 	return true;
 }
 
 void
 MM_ParallelGlobalGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 {
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if (NULL != extensions->freePageReleaser) {
+		extensions->freePageReleaser->shutdown();
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	if (extensions->scavengerEnabled && (NULL != extensions->scavenger)) {
 		extensions->scavenger->collectorShutdown(extensions);
@@ -45,6 +45,12 @@ MM_ParallelScavengeTask::mainSetup(MM_EnvironmentBase *env)
 	_collector->setAliasThreshold(calculatedAliasThreshold);
 }
 
+bool
+MM_ParallelScavengeTask::shouldUseWorkStealing(MM_EnvironmentBase *env)
+{
+	return env->getExtensions()->workStealing;
+}
+
 void
 MM_ParallelScavengeTask::setup(MM_EnvironmentBase *env)
 {
@@ -59,6 +59,7 @@ public:
 	virtual void setup(MM_EnvironmentBase *env);
 	virtual void cleanup(MM_EnvironmentBase *env);
 	virtual void mainSetup(MM_EnvironmentBase *env);
+	virtual bool shouldUseWorkStealing(MM_EnvironmentBase *env);
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/**
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "RSOverflowMap.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "ModronAssertions.h"
+
+/* number of heap map slots summarized by one dirty chunk byte */
+#define OMR_RSOVERFLOWMAP_SLOTS_PER_CHUNK (OMR_RSOVERFLOWMAP_CHUNK_SIZE / J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT)
+
+MM_RSOverflowMap *
+MM_RSOverflowMap::newInstance(MM_EnvironmentBase *env, uintptr_t maxHeapSize)
+{
+	MM_RSOverflowMap *overflowMap = (MM_RSOverflowMap *)env->getForge()->allocate(sizeof(MM_RSOverflowMap), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != overflowMap) {
+		new(overflowMap) MM_RSOverflowMap(env, maxHeapSize);
+		if (!overflowMap->initialize(env)) {
+			overflowMap->kill(env);
+			overflowMap = NULL;
+		}
+	}
+	return overflowMap;
+}
+
+bool
+MM_RSOverflowMap::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_HeapMap::initialize(env)) {
+		return false;
+	}
+
+	_chunkCount = (_maxHeapSize + OMR_RSOVERFLOWMAP_CHUNK_SIZE - 1) >> OMR_RSOVERFLOWMAP_CHUNK_SHIFT;
+	_dirtyChunks = (volatile uint8_t *)env->getForge()->allocate(_chunkCount, OMR::GC::AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL == _dirtyChunks) {
+		return false;
+	}
+	memset((void *)_dirtyChunks, 0, _chunkCount);
+
+	return true;
+}
+
+void
+MM_RSOverflowMap::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _dirtyChunks) {
+		env->getForge()->free((void *)_dirtyChunks);
+		_dirtyChunks = NULL;
+	}
+	MM_HeapMap::tearDown(env);
+}
+
+bool
+MM_RSOverflowMap::heapRemoveRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
+{
+	/* chunks entirely inside the range lose their map memory, so they must never be visited again */
+	uintptr_t lowChunk = (((uintptr_t)lowAddress) - _heapMapBaseDelta + OMR_RSOVERFLOWMAP_CHUNK_SIZE - 1) >> OMR_RSOVERFLOWMAP_CHUNK_SHIFT;
+	uintptr_t highChunk = (((uintptr_t)highAddress) - _heapMapBaseDelta) >> OMR_RSOVERFLOWMAP_CHUNK_SHIFT;
+	for (uintptr_t chunkIndex = lowChunk; chunkIndex < highChunk; chunkIndex++) {
+		_dirtyChunks[chunkIndex] = 0;
+	}
+
+	return MM_HeapMap::heapRemoveRange(env, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+}
+
+bool
+MM_RSOverflowMap::refreshChunk(uintptr_t chunkIndex)
+{
+	_dirtyChunks[chunkIndex] = 0;
+	/* a concurrent addObject() either sees the cleared flag and sets it again, or its bit is seen below */
+	MM_AtomicOperations::sync();
+
+	volatile uintptr_t *slot = &_heapMapBits[chunkIndex * OMR_RSOVERFLOWMAP_SLOTS_PER_CHUNK];
+	for (uintptr_t i = 0; i < OMR_RSOVERFLOWMAP_SLOTS_PER_CHUNK; i++) {
+		if (0 != slot[i]) {
+			_dirtyChunks[chunkIndex] = 1;
+			return true;
+		}
+	}
+	return false;
+}
+
+void
+MM_RSOverflowMap::clearChunk(uintptr_t chunkIndex)
+{
+	memset((void *)&_heapMapBits[chunkIndex * OMR_RSOVERFLOWMAP_SLOTS_PER_CHUNK], 0, OMR_RSOVERFLOWMAP_SLOTS_PER_CHUNK * sizeof(uintptr_t));
+	_dirtyChunks[chunkIndex] = 0;
+}
+
+bool
+MM_RSOverflowMap::isEmpty()
+{
+	for (uintptr_t chunkIndex = 0; chunkIndex < _chunkCount; chunkIndex++) {
+		if (isChunkDirty(chunkIndex)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void
+MM_RSOverflowMap::clearAll(MM_EnvironmentBase *env)
+{
+	for (uintptr_t chunkIndex = 0; chunkIndex < _chunkCount; chunkIndex++) {
+		if (isChunkDirty(chunkIndex)) {
+			clearChunk(chunkIndex);
+		}
+	}
+}
+
+bool
+MM_RSOverflowMap::retainMarkedObjects(MM_EnvironmentBase *env, MM_HeapMap *markMap)
+{
+	Assert_MM_true(markMap->getHeapBase() == getHeapBase());
+	Assert_MM_true(markMap->getObjectGrain() == getObjectGrain());
+
+	bool anyRemaining = false;
+	for (uintptr_t chunkIndex = 0; chunkIndex < _chunkCount; chunkIndex++) {
+		if (isChunkDirty(chunkIndex)) {
+			uintptr_t slotIndex = chunkIndex * OMR_RSOVERFLOWMAP_SLOTS_PER_CHUNK;
+			uintptr_t *slot = &_heapMapBits[slotIndex];
+			for (uintptr_t i = 0; i < OMR_RSOVERFLOWMAP_SLOTS_PER_CHUNK; i++) {
+				if (0 != slot[i]) {
+					slot[i] &= markMap->getSlot(slotIndex + i);
+				}
+			}
+			anyRemaining |= refreshChunk(chunkIndex);
+		}
+	}
+	return anyRemaining;
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
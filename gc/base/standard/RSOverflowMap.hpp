@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(RSOVERFLOWMAP_HPP_)
+#define RSOVERFLOWMAP_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "AtomicOperations.hpp"
+#include "HeapMap.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Log2 of the heap size summarized by one dirty chunk byte.
+ */
+#define OMR_RSOVERFLOWMAP_CHUNK_SHIFT 16
+#define OMR_RSOVERFLOWMAP_CHUNK_SIZE (((uintptr_t)1) << OMR_RSOVERFLOWMAP_CHUNK_SHIFT)
+
+/**
+ * Records tenured objects that could not be added to the remembered set lists because the
+ * remembered set ran out of fragments. Objects are recorded by address in a heap map, and a
+ * one byte per chunk summary of the map lets the scavenger find recorded objects in time
+ * proportional to the number of chunks that hold any, instead of walking the tenure space.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_RSOverflowMap : public MM_HeapMap
+{
+private:
+	volatile uint8_t *_dirtyChunks; /**< One byte per heap chunk, non zero if the chunk may contain recorded objects */
+	uintptr_t _chunkCount; /**< Number of chunks covering the maximum heap */
+
+protected:
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_RSOverflowMap *newInstance(MM_EnvironmentBase *env, uintptr_t maxHeapSize);
+
+	virtual bool heapRemoveRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
+
+	MMINLINE uintptr_t getChunkCount() { return _chunkCount; }
+	MMINLINE bool isChunkDirty(uintptr_t chunkIndex) { return 0 != _dirtyChunks[chunkIndex]; }
+	MMINLINE uintptr_t *getChunkBase(uintptr_t chunkIndex) { return (uintptr_t *)(_heapMapBaseDelta + (chunkIndex << OMR_RSOVERFLOWMAP_CHUNK_SHIFT)); }
+
+	/**
+	 * Record an object. Safe to call concurrently with other threads adding or removing objects.
+	 * @param objectPtr[in] tenured object which is flagged as remembered
+	 */
+	MMINLINE void
+	addObject(omrobjectptr_t objectPtr)
+	{
+		atomicSetBit(objectPtr);
+		/* the bit must be visible before the chunk is flagged, see refreshChunk() */
+		_dirtyChunks[(((uintptr_t)objectPtr) - _heapMapBaseDelta) >> OMR_RSOVERFLOWMAP_CHUNK_SHIFT] = 1;
+	}
+
+	/**
+	 * Forget a recorded object. The chunk stays flagged until refreshChunk() is called for it.
+	 * Safe to call concurrently with other threads adding or removing objects.
+	 * @param objectPtr[in] previously recorded object
+	 */
+	MMINLINE void
+	removeObject(omrobjectptr_t objectPtr)
+	{
+		uintptr_t slotIndex = 0;
+		uintptr_t bitMask = 0;
+		getSlotIndexAndMask(objectPtr, &slotIndex, &bitMask);
+		volatile uintptr_t *slotAddress = &(_heapMapBits[slotIndex]);
+		uintptr_t oldValue = 0;
+		do {
+			oldValue = *slotAddress;
+		} while (oldValue != MM_AtomicOperations::lockCompareExchange(slotAddress, oldValue, oldValue & ~bitMask));
+	}
+
+	/**
+	 * Recompute the dirty flag of a chunk after objects have been removed from it.
+	 * @return true if the chunk still contains recorded objects
+	 */
+	bool refreshChunk(uintptr_t chunkIndex);
+
+	/**
+	 * Forget all objects recorded in a chunk.
+	 */
+	void clearChunk(uintptr_t chunkIndex);
+
+	/**
+	 * @return true if no chunk contains recorded objects
+	 */
+	bool isEmpty();
+
+	/**
+	 * Forget all recorded objects.
+	 */
+	void clearAll(MM_EnvironmentBase *env);
+
+	/**
+	 * Forget recorded objects which are not marked in the given map. Both maps must share the same geometry.
+	 * @param markMap[in] a valid mark map of the completed global collection
+	 * @return true if any recorded object remains
+	 */
+	bool retainMarkedObjects(MM_EnvironmentBase *env, MM_HeapMap *markMap);
+
+	MM_RSOverflowMap(MM_EnvironmentBase *env, uintptr_t maxHeapSize)
+		: MM_HeapMap(env, maxHeapSize, false)
+		, _dirtyChunks(NULL)
+		, _chunkCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* RSOVERFLOWMAP_HPP_ */
@@ -26,6 +26,7 @@
 #if defined(OMR_GC_REALTIME)
 
 #include "Debug.hpp"
+#include "GCExtensionsBase.hpp"
 #include "RememberedSetSATB.hpp"
 #include "WorkPackets.hpp"
 
@@ -265,6 +266,9 @@ MM_RememberedSetSATB::setGlobalIndex(MM_EnvironmentBase* env, UDATA indexValue)
 
 /**
  * Refresh the fragment.
+ * A full fragment is published to the lock free queue of the work packets and the
+ * thread continues with a new buffer of at most satbBufferSize slots. Unlike the old
+ * in use packet list, neither step takes a list lock.
  * 
  * @Note that the refresh fragment mustn't blindly update the localFragmentIndex, 
  * it must determine which of the localFragmentFlushID or preservedFragmentFlushID 
@@ -280,8 +284,7 @@ MM_RememberedSetSATB::refreshFragment(MM_EnvironmentBase *env, MM_GCRememberedSe
 	MM_Packet *oldPacket = (MM_Packet *)fragment->fragmentStorage;
 		
 	if ((NULL != oldPacket) && (getLocalFragmentIndex(env, fragment) == getGlobalFragmentIndex(env)) && (*fragment->fragmentTop == *fragment->fragmentAlloc)) {
-		_workPackets->removePacketFromInUseList(env, oldPacket);
-		_workPackets->putFullPacket(env, oldPacket);
+		_workPackets->publishBarrierPacket(env, oldPacket);
 	}
 	
 	if (J9GC_REMEMBERED_SET_RESERVED_INDEX == fragment->localFragmentIndex) {
@@ -293,7 +296,7 @@ MM_RememberedSetSATB::refreshFragment(MM_EnvironmentBase *env, MM_GCRememberedSe
 	
 	if (NULL != packet) {
 		fragment->fragmentAlloc = packet->getCurrentAddr(env);
-		fragment->fragmentTop = packet->getTopAddr(env);
+		fragment->fragmentTop = packet->getBarrierTopAddr(env, env->getExtensions()->satbBufferSize);
 		fragment->fragmentStorage = (void *)packet;
 	    
 	    _workPackets->putInUsePacket(env, packet);
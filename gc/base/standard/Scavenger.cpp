@@ -55,12 +55,16 @@
 #include "EnvironmentBase.hpp"
 #include "EnvironmentStandard.hpp"
 #include "ForwardedHeader.hpp"
+#include "GlobalCollector.hpp"
 #include "IndexableObjectScanner.hpp"
 #include "Heap.hpp"
+#include "HeapMapIterator.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "HeapStats.hpp"
+#include "HeapVirtualMemory.hpp"
+#include "MemoryManager.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -77,6 +81,7 @@
 #include "ParallelScavengeTask.hpp"
 #include "PhysicalSubArena.hpp"
 #include "RSOverflow.hpp"
+#include "RSOverflowMap.hpp"
 #include "Scavenger.hpp"
 #include "ScavengerBackOutScanner.hpp"
 #include "ScavengerRootScanner.hpp"
@@ -105,6 +110,9 @@
 #define FLIP_TENURE_LARGE_SCAN 4
 #define FLIP_TENURE_LARGE_SCAN_DEFERRED 5
 
+/* Number of RS overflow map chunks (see OMR_RSOVERFLOWMAP_CHUNK_SIZE) handed out to a GC thread at once */
+#define OMR_SCV_RSOVERFLOWMAP_CHUNKS_PER_WORK_UNIT 16
+
 /* If scavenger dynamicBreadthFirstScanOrdering and alwaysDepthCopyFirstOffset is enabled, always copy the first offset of each object after the object itself is copied */
 #define DEFAULT_HOT_FIELD_OFFSET 1
 
@@ -250,6 +258,10 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 	 * So long as (N * _cachesPerThread) cache entries exist,the head of the scan list
 	 * will contain a valid entry. We set the appropriate number of caches per thread here */
 	switch (_extensions->scavengerScanOrdering) {
+	case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DEPTH_FIRST:
+		_depthFirstCopyDepth = _extensions->scavengerDepthFirstCopyDepth;
+		_cachesPerThread = FLIP_TENURE_LARGE_SCAN;
+		break;
 	case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST:
 	case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST:
 		_cachesPerThread = FLIP_TENURE_LARGE_SCAN;
@@ -294,6 +306,14 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 	}
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
+	/* Concurrent Scavenger keeps walking the heap on overflow, recording is only supported for STW scavenges */
+	if (_extensions->scavengerRecordRememberedSetOverflow && !_extensions->isConcurrentScavengerEnabled()) {
+		_extensions->rememberedSetOverflowMap = MM_RSOverflowMap::newInstance(env, _extensions->heap->getMaximumPhysicalRange());
+		if (NULL == _extensions->rememberedSetOverflowMap) {
+			return false;
+		}
+	}
+
 	if (!_delegate.initialize(env)) {
 		return false;
 	}
@@ -306,6 +326,11 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 {
 	_delegate.tearDown(env);
 
+	if (NULL != _extensions->rememberedSetOverflowMap) {
+		_extensions->rememberedSetOverflowMap->kill(env);
+		_extensions->rememberedSetOverflowMap = NULL;
+	}
+
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
@@ -442,8 +467,13 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	_activeSubSpace->cacheRanges(_evacuateMemorySubSpace, &_evacuateSpaceBase, &_evacuateSpaceTop);
 	_activeSubSpace->cacheRanges(_survivorMemorySubSpace, &_survivorSpaceBase, &_survivorSpaceTop);
 
+	if (_extensions->scavengerNUMAAwareCopy) {
+		setupNumaCopyGranules(env);
+	}
+
 	/* assume that value of RS Overflow flag will not be changed until scavengeRememberedSet() call, so handle it first */
 	_isRememberedSetInOverflowAtTheBeginning = isRememberedSetInOverflowState();
+	_isRememberedSetOverflowRecordedAtTheBeginning = isRememberedSetOverflowRecorded();
 	_extensions->rememberedSet.startProcessingSublist();
 }
 
@@ -454,6 +484,8 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 
 	clearThreadGCStats(env, true);
 
+	env->_copyCacheNumaNode = _extensions->scavengerNUMAAwareCopy ? selectCopyCacheNumaNode(env) : 0;
+
 	/* This thread just started the scavenge task, record the timestamp.
 	 * This must be done after clearThreadGCStats or else the timestamp will be cleared. */
 	env->_scavengerStats._startTime = omrtime_hires_clock();
@@ -579,6 +611,13 @@ MM_Scavenger::scavenge(MM_EnvironmentBase *envBase)
 	MM_ParallelScavengeTask scavengeTask(env, _dispatcher, this, env->_cycleState, _recommendedThreads);
 	_dispatcher->run(env, &scavengeTask);
 
+	releaseNumaCopyGranules(env);
+
+	if (isRememberedSetOverflowRecorded() && _extensions->rememberedSetOverflowMap->isEmpty()) {
+		/* pruning moved every recorded object back into the remembered set lists, or unremembered it */
+		clearRememberedSetOverflowState();
+	}
+
 	/* remove all scan caches temporary allocated in Heap */
 	_scavengeCacheFreeList.removeAllHeapAllocatedChunks(env);
 
@@ -766,6 +805,7 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 {
 	finalGCStats->_rememberedSetOverflow |= scavStats->_rememberedSetOverflow;
 	finalGCStats->_causedRememberedSetOverflow |= scavStats->_causedRememberedSetOverflow;
+	finalGCStats->_rememberedSetOverflowRecordedCount += scavStats->_rememberedSetOverflowRecordedCount;
 	finalGCStats->_scanCacheOverflow |= scavStats->_scanCacheOverflow;
 	finalGCStats->_scanCacheAllocationFromHeap |= scavStats->_scanCacheAllocationFromHeap;
 	finalGCStats->_scanCacheAllocationDurationDuringSavenger = OMR_MAX(finalGCStats->_scanCacheAllocationDurationDuringSavenger, scavStats->_scanCacheAllocationDurationDuringSavenger);
@@ -821,6 +861,14 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 		finalGCStats->getFlipHistory(0)->_tenureBytes[i] += scavStats->getFlipHistory(0)->_tenureBytes[i];
 	}
 
+	for (uintptr_t node = 1; node < OMR_SCAVENGER_NUMA_NODE_BINS; node++) {
+		MM_ScavengerStats::NUMANodeCopyStats *finalNodeStats = finalGCStats->getNUMANodeCopyStats(node);
+		MM_ScavengerStats::NUMANodeCopyStats *nodeStats = scavStats->getNUMANodeCopyStats(node);
+		finalNodeStats->_survivorBytes += nodeStats->_survivorBytes;
+		finalNodeStats->_tenureBytes += nodeStats->_tenureBytes;
+		finalNodeStats->_localBytes += nodeStats->_localBytes;
+	}
+
 	finalGCStats->_tenureExpandedBytes += scavStats->_tenureExpandedBytes;
 	finalGCStats->_tenureExpandedCount += scavStats->_tenureExpandedCount;
 	finalGCStats->_tenureExpandedTime += scavStats->_tenureExpandedTime;
@@ -835,6 +883,9 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	}
 	finalGCStats->_leafObjectCount += scavStats->_leafObjectCount;
 	finalGCStats->_copy_cachesize_sum += scavStats->_copy_cachesize_sum;
+	finalGCStats->_localityCopyCount += scavStats->_localityCopyCount;
+	finalGCStats->_localitySameCacheLineCount += scavStats->_localitySameCacheLineCount;
+	finalGCStats->_localitySamePageCount += scavStats->_localitySamePageCount;
 	finalGCStats->_workStallTime += scavStats->_workStallTime;
 	finalGCStats->_completeStallTime += scavStats->_completeStallTime;
 	finalGCStats->_syncStallTime += scavStats->_syncStallTime;
@@ -1170,21 +1221,35 @@ retry:
 				env->_survivorTLHRemainderTop = NULL;
 				activateDeferredCopyScanCache(env);
 			} else if (_extensions->tlhSurvivorDiscardThreshold < cacheSize) {
-				MM_AllocateDescription allocDescription(cacheSize, 0, false, true);
-
-				addrBase = _survivorMemorySubSpace->collectorAllocate(env, this, &allocDescription);
-				if(NULL != addrBase) {
-					addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
-					/* Check that there is no overflow */
-					Assert_MM_true(addrTop >= addrBase);
+				if ((0 != env->_copyCacheNumaNode) && carveNumaCopyChunk(env, cacheSize, addrBase, addrTop)) {
 					allocateResult = true;
+				} else {
+					MM_AllocateDescription allocDescription(cacheSize, 0, false, true);
+
+					addrBase = _survivorMemorySubSpace->collectorAllocate(env, this, &allocDescription);
+					if(NULL != addrBase) {
+						addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
+						/* Check that there is no overflow */
+						Assert_MM_true(addrTop >= addrBase);
+						allocateResult = true;
+					}
+				}
+				if (allocateResult && (0 != env->_copyCacheNumaNode)) {
+					accountNumaCopyCache(env, addrBase, addrTop, false);
 				}
 				env->_scavengerStats._semiSpaceAllocationCountLarge += 1;
 			} else {
-				MM_AllocateDescription allocDescription(0, 0, false, true);
 				/* Update the optimum scan cache size */
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if ((0 != env->_copyCacheNumaNode) && carveNumaCopyChunk(env, OMR_MAX(scanCacheSize, cacheSize), addrBase, addrTop)) {
+					allocateResult = true;
+				} else {
+					MM_AllocateDescription allocDescription(0, 0, false, true);
+					allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				}
+				if (allocateResult && (0 != env->_copyCacheNumaNode)) {
+					accountNumaCopyCache(env, addrBase, addrTop, false);
+				}
 				env->_scavengerStats._semiSpaceAllocationCountSmall += 1;
 			}
 		}
@@ -1244,6 +1309,206 @@ retry:
 	return copyCache;
 }
 
+uintptr_t
+MM_Scavenger::selectCopyCacheNumaNode(MM_EnvironmentStandard *env)
+{
+	MM_NUMAManager *numaManager = &_extensions->_numaManager;
+	uintptr_t affinityLeaderCount = 0;
+	J9MemoryNodeDetail const *affinityLeaders = numaManager->getAffinityLeaders(&affinityLeaderCount);
+	uintptr_t numaNode = 0;
+
+	if (0 != affinityLeaderCount) {
+		uintptr_t spreadNode = (env->getWorkerID() % affinityLeaderCount) + 1;
+		if (numaManager->isPhysicalNUMASupported()) {
+			uintptr_t boundJ9NodeNumber = env->getNumaAffinity();
+			for (uintptr_t i = 0; i < affinityLeaderCount; i++) {
+				if (affinityLeaders[i].j9NodeNumber == boundJ9NodeNumber) {
+					numaNode = i + 1;
+					break;
+				}
+			}
+			if ((0 == numaNode) && numaManager->shouldSetCPUAffinity()) {
+				/* an unbound worker would drift away from the memory it carves */
+				uintptr_t j9NodeNumber = affinityLeaders[spreadNode - 1].j9NodeNumber;
+				if (env->setNumaAffinity(&j9NodeNumber, 1)) {
+					numaNode = spreadNode;
+				}
+			}
+		} else {
+			numaNode = spreadNode;
+		}
+	}
+
+	return numaNode;
+}
+
+void
+MM_Scavenger::accountNumaCopyCache(MM_EnvironmentStandard *env, void *base, void *top, bool tenure)
+{
+	MM_ScavengerStats::NUMANodeCopyStats *nodeStats = env->_scavengerStats.getNUMANodeCopyStats(env->_copyCacheNumaNode);
+	uintptr_t size = (uintptr_t)top - (uintptr_t)base;
+	if (tenure) {
+		nodeStats->_tenureBytes += size;
+	} else {
+		nodeStats->_survivorBytes += size;
+	}
+}
+
+uintptr_t
+MM_Scavenger::getNumaCopyGranuleSize()
+{
+	return MM_Math::roundToCeiling(_extensions->heap->getPageSize(), OMR_SCAVENGER_NUMA_COPY_GRANULE_SIZE);
+}
+
+void
+MM_Scavenger::bindNumaCopyGranules(MM_EnvironmentBase *env, void *lowAddress, void *highAddress)
+{
+	MM_NUMAManager *numaManager = &_extensions->_numaManager;
+	uintptr_t affinityLeaderCount = 0;
+	numaManager->getAffinityLeaders(&affinityLeaderCount);
+	uintptr_t nodeCount = OMR_MIN(affinityLeaderCount, OMR_SCAVENGER_NUMA_NODE_BINS - 1);
+
+	if (1 < nodeCount) {
+		const MM_MemoryHandle *handle = ((MM_HeapVirtualMemory *)_extensions->heap)->getVmemHandle();
+		uintptr_t heapBase = (uintptr_t)_extensions->heap->getHeapBase();
+		uintptr_t granuleSize = getNumaCopyGranuleSize();
+		uintptr_t granule = ((uintptr_t)lowAddress - heapBase) / granuleSize;
+
+		/* the range has just been committed, so the binding places every one of its pages */
+		for (uintptr_t granuleBase = heapBase + (granule * granuleSize); granuleBase < (uintptr_t)highAddress; granuleBase += granuleSize, granule++) {
+			uintptr_t base = OMR_MAX(granuleBase, (uintptr_t)lowAddress);
+			uintptr_t top = OMR_MIN(granuleBase + granuleSize, (uintptr_t)highAddress);
+			uintptr_t j9NodeNumber = numaManager->getJ9NodeNumber((granule % nodeCount) + 1);
+			/* placement is only a hint: memory that cannot be bound stays usable */
+			_extensions->memoryManager->setNumaAffinity(handle, j9NodeNumber, (void *)base, top - base);
+		}
+	}
+}
+
+void
+MM_Scavenger::setupNumaCopyGranules(MM_EnvironmentStandard *env)
+{
+	uintptr_t affinityLeaderCount = 0;
+	_extensions->_numaManager.getAffinityLeaders(&affinityLeaderCount);
+	_numaCopyNodeCount = OMR_MIN(affinityLeaderCount, OMR_SCAVENGER_NUMA_NODE_BINS - 1);
+	_numaCopyBase = NULL;
+	_numaCopyTop = NULL;
+
+	/* mutators copy too during a concurrent scavenge, and they have no node to carve for */
+	if ((1 < _numaCopyNodeCount) && !_extensions->isConcurrentScavengerEnabled()) {
+		MM_AllocateDescription allocDescription(0, 0, false, true);
+		void *addrBase = NULL;
+		void *addrTop = NULL;
+		if (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, UDATA_MAX, addrBase, addrTop)) {
+			uintptr_t firstGranule = ((uintptr_t)addrBase - (uintptr_t)_heapBase) / getNumaCopyGranuleSize();
+			for (uintptr_t node = 1; node <= _numaCopyNodeCount; node++) {
+				/* first granule of the node at or after the start of the range */
+				_numaCopyNextGranule[node] = firstGranule + ((node - 1 + _numaCopyNodeCount - (firstGranule % _numaCopyNodeCount)) % _numaCopyNodeCount);
+			}
+			_numaCopyBase = addrBase;
+			_numaCopyTop = addrTop;
+		}
+	}
+}
+
+void
+MM_Scavenger::releaseNumaCopyGranules(MM_EnvironmentStandard *env)
+{
+	if (NULL != _numaCopyBase) {
+		uintptr_t granuleSize = getNumaCopyGranuleSize();
+		uintptr_t granule = ((uintptr_t)_numaCopyBase - (uintptr_t)_heapBase) / granuleSize;
+		void *runBase = NULL;
+
+		/* a granule is unclaimed if its node's cursor has not passed it; adjacent unclaimed granules are returned as one run */
+		for (uintptr_t granuleBase = (uintptr_t)_heapBase + (granule * granuleSize); granuleBase < (uintptr_t)_numaCopyTop; granuleBase += granuleSize, granule++) {
+			void *base = (void *)OMR_MAX(granuleBase, (uintptr_t)_numaCopyBase);
+			if (granule >= _numaCopyNextGranule[getNumaCopyGranuleNode(granule)]) {
+				if (NULL == runBase) {
+					runBase = base;
+				}
+			} else if (NULL != runBase) {
+				returnNumaCopyMemory(env, runBase, base);
+				runBase = NULL;
+			}
+		}
+		if (NULL != runBase) {
+			returnNumaCopyMemory(env, runBase, _numaCopyTop);
+		}
+
+		_numaCopyBase = NULL;
+		_numaCopyTop = NULL;
+	}
+}
+
+bool
+MM_Scavenger::carveNumaCopyChunk(MM_EnvironmentStandard *env, uintptr_t size, void *&addrBase, void *&addrTop)
+{
+	uintptr_t granuleSize = getNumaCopyGranuleSize();
+
+	if ((NULL == _numaCopyBase) || (size > granuleSize)) {
+		return false;
+	}
+
+	uintptr_t ownNode = ((env->_copyCacheNumaNode - 1) % _numaCopyNodeCount) + 1;
+	while (((uintptr_t)env->_numaCopyChunkTop - (uintptr_t)env->_numaCopyChunkBase) < size) {
+		/* claim a granule of the worker's own node, or of the next node that has one left */
+		releaseNumaCopyChunk(env);
+		bool claimed = false;
+		for (uintptr_t i = 0; !claimed && (i < _numaCopyNodeCount); i++) {
+			uintptr_t node = ((ownNode - 1 + i) % _numaCopyNodeCount) + 1;
+			if ((uintptr_t)_numaCopyTop > ((uintptr_t)_heapBase + (_numaCopyNextGranule[node] * granuleSize))) {
+				uintptr_t granule = MM_AtomicOperations::add(&_numaCopyNextGranule[node], _numaCopyNodeCount) - _numaCopyNodeCount;
+				uintptr_t granuleBase = (uintptr_t)_heapBase + (granule * granuleSize);
+				if (granuleBase < (uintptr_t)_numaCopyTop) {
+					env->_numaCopyChunkBase = (void *)OMR_MAX(granuleBase, (uintptr_t)_numaCopyBase);
+					env->_numaCopyChunkTop = (void *)OMR_MIN(granuleBase + granuleSize, (uintptr_t)_numaCopyTop);
+					env->_numaCopyChunkLocal = (node == ownNode);
+					claimed = true;
+				}
+			}
+		}
+		if (!claimed) {
+			return false;
+		}
+	}
+
+	addrBase = env->_numaCopyChunkBase;
+	addrTop = (void *)((uintptr_t)addrBase + size);
+	if (((uintptr_t)env->_numaCopyChunkTop - (uintptr_t)addrTop) < _extensions->tlhSurvivorDiscardThreshold) {
+		/* a tail too small for another copy cache goes with this one */
+		addrTop = env->_numaCopyChunkTop;
+	}
+	env->_numaCopyChunkBase = addrTop;
+	if (env->_numaCopyChunkLocal) {
+		env->_scavengerStats.getNUMANodeCopyStats(env->_copyCacheNumaNode)->_localBytes += (uintptr_t)addrTop - (uintptr_t)addrBase;
+	}
+
+	return true;
+}
+
+void
+MM_Scavenger::releaseNumaCopyChunk(MM_EnvironmentStandard *env)
+{
+	returnNumaCopyMemory(env, env->_numaCopyChunkBase, env->_numaCopyChunkTop);
+	env->_numaCopyChunkBase = NULL;
+	env->_numaCopyChunkTop = NULL;
+}
+
+void
+MM_Scavenger::returnNumaCopyMemory(MM_EnvironmentStandard *env, void *base, void *top)
+{
+	uintptr_t size = (uintptr_t)top - (uintptr_t)base;
+	if (0 != size) {
+		MM_MemoryPool *memoryPool = _survivorMemorySubSpace->getMemoryPool();
+		if (size >= memoryPool->getMinimumFreeEntrySize()) {
+			memoryPool->recycleHeapChunk(env, base, top);
+		} else {
+			env->_scavengerStats._flipDiscardBytes += size;
+			_survivorMemorySubSpace->abandonHeapChunk(base, top);
+		}
+	}
+}
+
 MM_CopyScanCacheStandard *
 MM_Scavenger::reserveMemoryForAllocateInTenureSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes)
 {
@@ -1294,6 +1559,9 @@ retry:
 					/* Check that there is no overflow */
 					Assert_MM_true(addrTop >= addrBase);
 					allocateResult = true;
+					if (0 != env->_copyCacheNumaNode) {
+						accountNumaCopyCache(env, addrBase, addrTop, true);
+					}
 
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 					if (allocDescription.isLOAAllocation()) {
@@ -1307,6 +1575,9 @@ retry:
 				allocDescription.setCollectorAllocateExpandOnFailure(true);
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
 				allocateResult = (NULL != _tenureMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if (allocateResult && (0 != env->_copyCacheNumaNode)) {
+					accountNumaCopyCache(env, addrBase, addrTop, true);
+				}
 
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 				if (allocateResult && allocDescription.isLOAAllocation()) {
@@ -2018,6 +2289,14 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 		shouldRemember |= isSlotObjectInNewSpace;
 		if (NULL != *copyCache) {
 			slotsCopied += 1;
+			/* objects scanned from a scan cache are copies themselves, so the referent's placement relative to the slot is meaningful */
+			if (NULL != scanCache) {
+				omrobjectptr_t copiedObjectPtr = slotObject->readReferenceFromSlot();
+				env->_scavengerStats.countCopyLocality((uintptr_t)slotObject->readAddressFromSlot(), (uintptr_t)copiedObjectPtr, _cacheLineAlignment);
+				if (0 != _depthFirstCopyDepth) {
+					depthFirstCopy(env, copiedObjectPtr);
+				}
+			}
 		}
 		slotsScanned += 1;
 	}
@@ -2088,6 +2367,39 @@ MM_Scavenger::deepScanOutline(MM_EnvironmentStandard *env, omrobjectptr_t object
 	}
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 }
+
+void
+MM_Scavenger::depthFirstCopy(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	omrobjectptr_t currentObjectPtr = objectPtr;
+	/* Throttle - same as deep scan, stop descending when the free list is utilized more than 50% */
+	uintptr_t freeListUtilizationLimit = _scavengeCacheFreeList.getAllocatedCacheCount() / 2;
+	uintptr_t depth = 0;
+
+	/* The copied object slot can possibly be overwritten with NULL by a mutator (CS) */
+	while ((NULL != currentObjectPtr) && (depth < _depthFirstCopyDepth) && (env->approxScanCacheCount <= freeListUtilizationLimit)) {
+		GC_ObjectScannerState objectScannerState;
+		GC_ObjectScanner *objectScanner = getObjectScanner(env, currentObjectPtr, &objectScannerState, GC_ObjectScanner::scanHeap);
+		if ((NULL == objectScanner) || objectScanner->isLeafObject() || objectScanner->isIndexableObject()) {
+			/* arrays are left to the scan cache so that they can be split */
+			break;
+		}
+
+		omrobjectptr_t nextObjectPtr = NULL;
+		GC_SlotObject *slotObject = NULL;
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			copyAndForward(env, slotObject);
+			if (NULL != env->_effectiveCopyScanCache) {
+				nextObjectPtr = slotObject->readReferenceFromSlot();
+				env->_scavengerStats.countCopyLocality((uintptr_t)slotObject->readAddressFromSlot(), (uintptr_t)nextObjectPtr, _cacheLineAlignment);
+				break;
+			}
+		}
+		currentObjectPtr = nextObjectPtr;
+		depth += 1;
+	}
+}
+
 /**
  * Scans the slots of a non-indexable object, remembering objects as required. Scanning is interrupted
  * as soon as there is a copy cache that is preferred to the current scan cache. This is returned
@@ -2157,6 +2469,7 @@ MM_Scavenger::incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobj
 		if (NULL != copyCache) {
 			/* Copy cache will be set only if a referent object is copied (ie, if not previously forwarded) */
 			slotsCopied += 1;
+			env->_scavengerStats.countCopyLocality((uintptr_t)slotObject->readAddressFromSlot(), (uintptr_t)slotObject->readReferenceFromSlot(), _cacheLineAlignment);
 
 			MM_CopyScanCacheStandard *nextScanCache = aliasToCopyCache(env, slotObject, scanCache, copyCache);
 			if (NULL != nextScanCache) {
@@ -2534,6 +2847,7 @@ MM_Scavenger::completeScan(MM_EnvironmentStandard *env)
 		switch (_extensions->scavengerScanOrdering) {
 		case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST:
 		case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST:
+		case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DEPTH_FIRST:
 			completeScanCache(env, scanCache);
 			break;
 		case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL:
@@ -2593,6 +2907,7 @@ MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 	finalReturnCopyCachesToFreeList(env);
 	abandonSurvivorTLHRemainder(env);
 	abandonTenureTLHRemainder(env, true);
+	releaseNumaCopyChunk(env);
 
 	/* If -Xgc:fvtest=forceScavengerBackout has been specified, set backout flag every 3rd scavenge */
 	if(_extensions->fvtest_forceScavengerBackout) {
@@ -2658,15 +2973,30 @@ MM_Scavenger::addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectp
 	Assert_MM_true(!isObjectInNewSpace(objectPtr));
 	Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
 
+	if (!tryAddToRememberedSetFragment(env, objectPtr)) {
+		/* Failed to allocate a fragment - set the remembered set overflow state and exit */
+		if (!_isRememberedSetInOverflowAtTheBeginning) {
+			env->_scavengerStats._causedRememberedSetOverflow = 1;
+		}
+		if (NULL != _extensions->rememberedSetOverflowMap) {
+			_extensions->rememberedSetOverflowMap->addObject(objectPtr);
+			_extensions->setRememberedSetOverflowStateRecorded();
+		} else {
+			setRememberedSetOverflowState();
+		}
+	}
+}
+
+MMINLINE bool
+MM_Scavenger::tryAddToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
 	if(env->_scavengerRememberedSet.fragmentCurrent >= env->_scavengerRememberedSet.fragmentTop) {
 		/* There wasn't enough room in the current fragment - allocate a new one */
-		if(allocateMemoryForSublistFragment(env->getOmrVMThread(), (J9VMGC_SublistFragment*)&env->_scavengerRememberedSet)) {
-			/* Failed to allocate a fragment - set the remembered set overflow state and exit */
-			if (!_isRememberedSetInOverflowAtTheBeginning) {
-				env->_scavengerStats._causedRememberedSetOverflow = 1;
-			}
-			setRememberedSetOverflowState();
-			return ;
+		J9VMGC_SublistFragment *fragmentPrimitive = (J9VMGC_SublistFragment*)&env->_scavengerRememberedSet;
+		MM_SublistFragment fragment(fragmentPrimitive);
+		MM_SublistFragment::flush(fragmentPrimitive);
+		if (!((MM_SublistPool *)fragmentPrimitive->parentList)->allocate(env, &fragment)) {
+			return false;
 		}
 	}
 
@@ -2680,6 +3010,8 @@ MM_Scavenger::addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectp
 	omrtty_printf("{SCAV: Add to remembered set %p; env count = %lld; ext count = %lld}\n",
 			objectPtr, env->_scavengerRememberedSet.count, _extensions->rememberedSet.countElements());
 #endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
+
+	return true;
 }
 
 void
@@ -2864,13 +3196,48 @@ MM_Scavenger::flushRememberedSet(MM_EnvironmentStandard *env)
 void
 MM_Scavenger::pruneRememberedSet(MM_EnvironmentStandard *env)
 {
-	if(isRememberedSetInOverflowState()) {
+	if(isRememberedSetOverflowRecorded()) {
+		pruneRememberedSetList(env);
+		/* the list must not grow while other threads may still be iterating it */
+		env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+		pruneRememberedSetOverflowMap(env);
+	} else if(isRememberedSetInOverflowState()) {
 		pruneRememberedSetOverflow(env);
 	} else {
 		pruneRememberedSetList(env);
 	}
 }
 
+MMINLINE bool
+MM_Scavenger::pruneRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	/* Check if object still has nursery references, direct or indirect */
+	bool shouldBeRemembered = shouldRememberObject(env, objectPtr);
+
+	/* Unconditionally remember object if it was recently referenced */
+	if (!IS_CONCURRENT_ENABLED && !shouldBeRemembered && processRememberedThreadReference(env, objectPtr)) {
+		Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
+		shouldBeRemembered = true;
+	}
+
+	if (!shouldBeRemembered) {
+		/* Tenured object remembered flags can be cleared */
+		_extensions->objectModel.clearRemembered(objectPtr);
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		if (_extensions->shouldScavengeNotifyGlobalGCOfOldToOldReference() && !IS_CONCURRENT_ENABLED) {
+			/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set.
+			 * In non-concurrent Scavenger this is the only way to create an old-to-old reference, that has parent object being marked.
+			 * In Concurrent Scavenger, it can be created even with parent object that was not in RS to start with. So this is handled
+			 * in a more generic spot when object is scavenged and is unnecessary to do it here.
+			 */
+			oldToOldReferenceCreated(env, objectPtr);
+		}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+	}
+
+	return shouldBeRemembered;
+}
+
 void
 MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 {
@@ -2890,6 +3257,10 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 		/* Clear the overflow state. Probability is high that we'll wind up re-overflowing. */
 		clearRememberedSetOverflowState();
 		clearRememberedSetLists(env);
+		if (NULL != _extensions->rememberedSetOverflowMap) {
+			/* recorded objects are found again by the walk below */
+			_extensions->rememberedSetOverflowMap->clearAll(env);
+		}
 
 		/* Walk the tenure memory subspace finding all tenured objects flagged as remembered */
 		MM_HeapRegionDescriptorStandard *region = NULL;
@@ -2900,32 +3271,10 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 			omrobjectptr_t objectPtr;
 			while((objectPtr = objectIterator.nextObject()) != NULL) {
 				if(_extensions->objectModel.isRemembered(objectPtr)) {
-					/* Check if object still has nursery references, direct or indirect */
-					bool shouldBeRemembered = shouldRememberObject(env, objectPtr);
-
-					/* Unconditionally remember object if it was recently referenced */
-					if (!IS_CONCURRENT_ENABLED && !shouldBeRemembered && processRememberedThreadReference(env, objectPtr)) {
-						Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
-						shouldBeRemembered = true;
-					}
-
-					if(shouldBeRemembered) {
+					if(pruneRememberedObject(env, objectPtr)) {
 						/* Tenured object remains flagged as remembered */
-						/* Add tenured object to the thread's remembered set list if possible. Otherwise, this will force setRememberedSetOverflowState(). */
+						/* Add tenured object to the thread's remembered set list if possible. Otherwise, this will force the overflow state again. */
 						addToRememberedSetFragment(env, objectPtr);
-					} else {
-						/* Tenured object remembered flags can be cleared */
-						_extensions->objectModel.clearRemembered(objectPtr);
-#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
-						if (_extensions->shouldScavengeNotifyGlobalGCOfOldToOldReference() && !IS_CONCURRENT_ENABLED) {
-							/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set.
-							 * In non-concurrent Scavenger this is the only way to create an old-to-old reference, that has parent object being marked.
-							 * In Concurrent Scavenger, it can be created even with parent object that was not in RS to start with. So this is handled
-							 * in a more generic spot when object is scavenged and is unnecessary to do it here.
-							 */
-							oldToOldReferenceCreated(env, objectPtr);
-						}
-#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 					}
 				}
 			}
@@ -2946,6 +3295,65 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 	}
 }
 
+void
+MM_Scavenger::scavengeRememberedSetOverflowMap(MM_EnvironmentStandard *env)
+{
+	Assert_MM_false(IS_CONCURRENT_ENABLED);
+
+	MM_RSOverflowMap *overflowMap = _extensions->rememberedSetOverflowMap;
+	uintptr_t chunkCount = overflowMap->getChunkCount();
+	for (uintptr_t chunkBase = 0; chunkBase < chunkCount; chunkBase += OMR_SCV_RSOVERFLOWMAP_CHUNKS_PER_WORK_UNIT) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t chunkTop = OMR_MIN(chunkBase + OMR_SCV_RSOVERFLOWMAP_CHUNKS_PER_WORK_UNIT, chunkCount);
+			for (uintptr_t chunkIndex = chunkBase; chunkIndex < chunkTop; chunkIndex++) {
+				if (overflowMap->isChunkDirty(chunkIndex)) {
+					/*
+					 * Scan any recorded objects, but don't adjust their remembered bit.
+					 * Objects that no longer need remembering will be pruned at the end of the scavenge.
+					 */
+					MM_HeapMapIterator recordedObjectIterator(_extensions, overflowMap, overflowMap->getChunkBase(chunkIndex), overflowMap->getChunkBase(chunkIndex + 1));
+					omrobjectptr_t objectPtr = NULL;
+					while (NULL != (objectPtr = recordedObjectIterator.nextObject())) {
+						env->_scavengerStats._rememberedSetOverflowRecordedCount += 1;
+						scavengeRememberedObject(env, objectPtr);
+					}
+				}
+			}
+		}
+	}
+}
+
+void
+MM_Scavenger::pruneRememberedSetOverflowMap(MM_EnvironmentStandard *env)
+{
+	Assert_MM_false(IS_CONCURRENT_ENABLED);
+
+	MM_RSOverflowMap *overflowMap = _extensions->rememberedSetOverflowMap;
+	uintptr_t chunkCount = overflowMap->getChunkCount();
+	for (uintptr_t chunkBase = 0; chunkBase < chunkCount; chunkBase += OMR_SCV_RSOVERFLOWMAP_CHUNKS_PER_WORK_UNIT) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t chunkTop = OMR_MIN(chunkBase + OMR_SCV_RSOVERFLOWMAP_CHUNKS_PER_WORK_UNIT, chunkCount);
+			for (uintptr_t chunkIndex = chunkBase; chunkIndex < chunkTop; chunkIndex++) {
+				if (overflowMap->isChunkDirty(chunkIndex)) {
+					MM_HeapMapIterator recordedObjectIterator(_extensions, overflowMap, overflowMap->getChunkBase(chunkIndex), overflowMap->getChunkBase(chunkIndex + 1));
+					omrobjectptr_t objectPtr = NULL;
+					while (NULL != (objectPtr = recordedObjectIterator.nextObject())) {
+						Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
+						/* Objects staying remembered move back to the remembered set lists while fragments can be had */
+						if (!pruneRememberedObject(env, objectPtr) || tryAddToRememberedSetFragment(env, objectPtr)) {
+							overflowMap->removeObject(objectPtr);
+						}
+					}
+					overflowMap->refreshChunk(chunkIndex);
+				}
+			}
+		}
+	}
+
+	/* Objects may have been remembered during prune, fragment must be flushed */
+	flushRememberedSet(env);
+}
+
 void
 MM_Scavenger::pruneRememberedSetList(MM_EnvironmentStandard *env)
 {
@@ -3149,7 +3557,12 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 void
 MM_Scavenger::scavengeRememberedSet(MM_EnvironmentStandard *env)
 {
-	if (_isRememberedSetInOverflowAtTheBeginning) {
+	if (_isRememberedSetOverflowRecordedAtTheBeginning) {
+		/* Overflowed objects are recorded, the lists are complete otherwise */
+		env->_scavengerStats._rememberedSetOverflow = 1;
+		scavengeRememberedSetList(env);
+		scavengeRememberedSetOverflowMap(env);
+	} else if (_isRememberedSetInOverflowAtTheBeginning) {
 		env->_scavengerStats._rememberedSetOverflow = 1;
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		/* For CS, in case of OF, we deal with both direct and indirect refs with only one pass. */
@@ -4086,6 +4499,11 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 		 */
 		_extensions->scavengerRsoScanUnsafe = true;
 
+		if (isRememberedSetOverflowRecorded()) {
+			/* Objects tenured by this scavenge may have been recorded in the overflow map, find remembered objects by walking old space instead */
+			setRememberedSetOverflowState();
+		}
+
 		if(isRememberedSetInOverflowState()) {
 			GC_MemorySubSpaceRegionIterator evacuateRegionIterator(_activeSubSpace);
 			MM_HeapRegionDescriptor* rootRegion;
@@ -4200,6 +4618,9 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 #endif
 
 	if (firstIncrement)	{
+		/* The old area is allocated into and may be walked by the scavenge, so it must not be left partially swept */
+		_extensions->getGlobalCollector()->completeWorkBeforeLocalCollection(env);
+
 		if (_extensions->processLargeAllocateStats) {
 			processLargeAllocateStatsBeforeGC(env);
 		}
@@ -4264,7 +4685,13 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 			/* Defer to collector language interface */
 			_delegate.mainThreadGarbageCollect_scavengeSuccess(env);
 
-			if(_extensions->scvTenureStrategyAdaptive) {
+			if (_activeSubSpace->getPauseGoalController()->isEnabled()) {
+				/* The tenure age was picked with the new space size to meet the pause goal */
+				uintptr_t tenureAge = _activeSubSpace->getPauseGoalController()->getRecommendedTenureAge();
+				if (_extensions->scvTenureStrategyAdaptive && (0 != tenureAge)) {
+					_extensions->scvTenureAdaptiveTenureAge = tenureAge;
+				}
+			} else if(_extensions->scvTenureStrategyAdaptive) {
 				/* Adjust the tenure age based on the percentage of new space used.  Also, avoid / by 0 */
 				uintptr_t newSpaceTotalSize = _activeSubSpace->getMemorySubSpaceAllocate()->getActiveMemorySize();
 				uintptr_t newSpaceConsumedSize = _extensions->scavengerStats._flipBytes;
@@ -4418,6 +4845,9 @@ MM_Scavenger::reportGCCycleFinalIncrementEnding(MM_EnvironmentStandard *env)
 bool
 MM_Scavenger::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress)
 {
+	if (_extensions->scavengerNUMAAwareCopy && _extensions->_numaManager.isPhysicalNUMASupported()) {
+		bindNumaCopyGranules(env, lowAddress, highAddress);
+	}
 	return true;
 }
 
@@ -4725,7 +5155,7 @@ MM_Scavenger::internalGarbageCollect(MM_EnvironmentBase *envBase, MM_MemorySubSp
 	}
 
 	/* Check if there is an RSO and the heap is not safely walkable */
-	if(isRememberedSetInOverflowState() && _extensions->scavengerRsoScanUnsafe) {
+	if(isRememberedSetInOverflowState() && !isRememberedSetOverflowRecorded() && _extensions->scavengerRsoScanUnsafe) {
 		/* NOTE: No need to set that the collect was unsuccessful - we will actually execute
 		 * the scavenger after percolation.
 		 */
@@ -5636,6 +6066,7 @@ MM_Scavenger::workThreadComplete(MM_EnvironmentStandard *env)
 	finalReturnCopyCachesToFreeList(env);
 	abandonSurvivorTLHRemainder(env);
 	abandonTenureTLHRemainder(env, true);
+	releaseNumaCopyChunk(env);
 
 	/* If -Xgc:fvtest=forceScavengerBackout has been specified, set backout flag every 3rd scavenge */
 	if(_extensions->fvtest_forceScavengerBackout) {
@@ -59,6 +59,8 @@ class MM_SublistPool;
 
 struct OMR_VM;
 
+#define OMR_SCAVENGER_NUMA_COPY_GRANULE_SIZE (256 * 1024) /**< nursery memory is interleaved over NUMA nodes in granules of this size (at least a page) with numaAwareScavengerCopy */
+
 extern "C" void concurrentScavengerAsyncCallbackHandler(OMR_VMThread *omrVMThread);
 
 /**
@@ -84,6 +86,7 @@ private:
 
 	const uintptr_t _objectAlignmentInBytes;	/**< Run-time objects alignment in bytes */
 	bool _isRememberedSetInOverflowAtTheBeginning; /**< Cached RS Overflow flag at the beginning of the scavenge */
+	bool _isRememberedSetOverflowRecordedAtTheBeginning; /**< Cached flag at the beginning of the scavenge, set if all overflowed objects are in the RS overflow map */
 
 	MM_GCExtensionsBase *_extensions;
 	
@@ -111,6 +114,11 @@ private:
 	uintptr_t _minSemiSpaceFailureSize;
 	uintptr_t _recommendedThreads; /** Number of threads recommended to the dispatcher for the Scavenge task */
 
+	void *_numaCopyBase; /**< base of the survivor memory taken for NUMA copy granules during this scavenge, NULL if none (numaAwareScavengerCopy) */
+	void *_numaCopyTop; /**< top of the survivor memory taken for NUMA copy granules */
+	uintptr_t _numaCopyNodeCount; /**< number of NUMA nodes the nursery granules are interleaved over, at most OMR_SCAVENGER_NUMA_NODE_BINS - 1 */
+	volatile uintptr_t _numaCopyNextGranule[OMR_SCAVENGER_NUMA_NODE_BINS]; /**< for each node (1-based), the index of its next unclaimed granule */
+
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics;  /** Common collect stats (memory, time etc.) */
 
@@ -118,6 +126,7 @@ private:
 	MM_CopyScanCacheList _scavengeCacheScanList; /**< scan lists */
 	volatile uintptr_t _cachedEntryCount; /**< non-empty scanCacheList count (not the total count of caches in the lists) */
 	uintptr_t _cachesPerThread; /**< maximum number of copy and scan caches required per thread at any one time */
+	uintptr_t _depthFirstCopyDepth; /**< maximum number of descendants copied behind each copied object, 0 unless depthFirst scan ordering is selected */
 	omrthread_monitor_t _scanCacheMonitor; /**< monitor to synchronize threads on scan lists */
 	omrthread_monitor_t _freeCacheMonitor; /**< monitor to synchronize threads on free list */
 	uintptr_t _waitingCountAliasThreshold; /**< Only alias a copy cache IF the number of threads waiting hasn't reached the threshold*/
@@ -259,6 +268,86 @@ public:
 	MMINLINE MM_CopyScanCacheStandard *reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes);
 	MM_CopyScanCacheStandard *reserveMemoryForAllocateInTenureSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes);
 
+	/**
+	 * Choose the NUMA affinity leader a worker carves copy caches for during this scavenge (numaAwareScavengerCopy).
+	 * With physical NUMA this is the node the thread is bound to, binding an unbound thread first if CPU affinity may be set.
+	 * With simulated NUMA, workers are spread over the nodes by worker ID.
+	 * @param env current thread environment
+	 * @return the affinity leader (1-based), or 0 if the thread has no node
+	 */
+	uintptr_t selectCopyCacheNumaNode(MM_EnvironmentStandard *env);
+
+	/**
+	 * @return the size of the granules the nursery is interleaved over NUMA nodes in, a multiple of the heap page size
+	 */
+	uintptr_t getNumaCopyGranuleSize();
+
+	/**
+	 * @return the NUMA node (1-based) the nursery granule of the given index is bound to
+	 */
+	MMINLINE uintptr_t
+	getNumaCopyGranuleNode(uintptr_t granule)
+	{
+		return (granule % _numaCopyNodeCount) + 1;
+	}
+
+	/**
+	 * Bind each nursery granule overlapping a newly committed range to its NUMA node, interleaving the granules over the nodes.
+	 * @param env current thread environment
+	 * @param lowAddress base of the committed range
+	 * @param highAddress top of the committed range
+	 */
+	void bindNumaCopyGranules(MM_EnvironmentBase *env, void *lowAddress, void *highAddress);
+
+	/**
+	 * Take the first free entry of the survivor space as NUMA copy granules for this scavenge, so that each
+	 * worker carves its survivor copy caches from the granules bound to its own node.
+	 * Main thread only, before the scavenge task is dispatched.
+	 * @param env current thread environment
+	 */
+	void setupNumaCopyGranules(MM_EnvironmentStandard *env);
+
+	/**
+	 * Give the NUMA copy granules no worker claimed back to the survivor free list.
+	 * Main thread only, once every worker has released its chunk.
+	 * @param env current thread environment
+	 */
+	void releaseNumaCopyGranules(MM_EnvironmentStandard *env);
+
+	/**
+	 * Carve survivor memory for a copy cache from the worker's NUMA copy chunk, claiming a new granule of the
+	 * worker's node (or, once those are gone, of another node) when the chunk is too small.
+	 * @param env current thread environment, with a non-zero _copyCacheNumaNode
+	 * @param size the number of bytes to carve
+	 * @param[out] addrBase base of the carved memory
+	 * @param[out] addrTop top of the carved memory, which may include a chunk tail too small to be used otherwise
+	 * @return true if the memory was carved, false if no granule is left
+	 */
+	bool carveNumaCopyChunk(MM_EnvironmentStandard *env, uintptr_t size, void *&addrBase, void *&addrTop);
+
+	/**
+	 * Return the unused part of the worker's NUMA copy chunk to the survivor free list, or abandon it if it is too small.
+	 * @param env current thread environment
+	 */
+	void releaseNumaCopyChunk(MM_EnvironmentStandard *env);
+
+	/**
+	 * Return unclaimed NUMA copy memory to the survivor free list, or abandon it if it is too small for a free entry.
+	 * @param env current thread environment
+	 * @param base base of the memory
+	 * @param top top of the memory
+	 */
+	void returnNumaCopyMemory(MM_EnvironmentStandard *env, void *base, void *top);
+
+	/**
+	 * Add a copy cache to the per node copy statistics of the worker.
+	 * @param env current thread environment, with a non-zero _copyCacheNumaNode
+	 * @param base base of the copy cache memory
+	 * @param top top of the copy cache memory
+	 * @param tenure true if the memory is in tenure space, false if it is in survivor space
+	 */
+	void accountNumaCopyCache(MM_EnvironmentStandard *env, void *base, void *top, bool tenure);
+
 	MM_CopyScanCacheStandard *getNextScanCache(MM_EnvironmentStandard *env);
 
 	/**
@@ -354,6 +443,17 @@ public:
 
 	void deepScanOutline(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t priorityFieldOffset1, uintptr_t priorityFieldOffset2);
 
+	/**
+	 * Copy a bounded depth first path of descendants of a freshly copied object right behind it (depthFirst scan ordering).
+	 * At each level the first slot whose referent gets copied is followed. Copied objects are not scanned here,
+	 * they are scanned when their copy cache is scanned (slots updated here are then found already forwarded).
+	 * Note that the delegate is asked for an object scanner for each object on the path, so this ordering should
+	 * only be selected when creating an object scanner has no side effects.
+	 * @param env The environment.
+	 * @param objectPtr The pointer to the new copy of the object.
+	 */
+	void depthFirstCopy(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+
 	MMINLINE bool scavengeRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
 	void scavengeRememberedSetList(MM_EnvironmentStandard *env);
 	void scavengeRememberedSetOverflow(MM_EnvironmentStandard *env);
@@ -361,6 +461,34 @@ public:
 	void pruneRememberedSetList(MM_EnvironmentStandard *env);
 	void pruneRememberedSetOverflow(MM_EnvironmentStandard *env);
 
+	/**
+	 * Scan the objects recorded in the RS overflow map. Work is distributed among GC threads by groups of map chunks,
+	 * so the cost is proportional to the part of the heap holding recorded objects.
+	 * @param env The environment.
+	 */
+	void scavengeRememberedSetOverflowMap(MM_EnvironmentStandard *env);
+
+	/**
+	 * Prune the objects recorded in the RS overflow map in parallel. Objects which remain remembered are moved back
+	 * into the remembered set lists when fragments can be allocated for them.
+	 * @param env The environment.
+	 */
+	void pruneRememberedSetOverflowMap(MM_EnvironmentStandard *env);
+
+	/**
+	 * Decide if a remembered object found during pruning is to stay remembered, and unremember it otherwise.
+	 * @param env The environment.
+	 * @param objectPtr The remembered object in Tenured Space.
+	 * @return true if the object stays remembered
+	 */
+	MMINLINE bool pruneRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+
+	/**
+	 * Add the specified object to the current thread's remembered set fragment, growing the remembered set if necessary.
+	 * @return false if the remembered set could not grow, the overflow state is left unchanged
+	 */
+	MMINLINE bool tryAddToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+
 	/**
 	 * Checks if the  Object should be remembered or not
 	 * @param env Standard Environment
@@ -524,6 +652,7 @@ public:
 	void clearRememberedSetLists(MM_EnvironmentStandard *env);
 
 	MMINLINE bool isRememberedSetInOverflowState() { return _extensions->isRememberedSetInOverflowState(); }
+	MMINLINE bool isRememberedSetOverflowRecorded() { return _extensions->isRememberedSetOverflowRecorded(); }
 	MMINLINE void setRememberedSetOverflowState() { _extensions->setRememberedSetOverflowState(); }
 	MMINLINE void clearRememberedSetOverflowState() { _extensions->clearRememberedSetOverflowState(); }
 
@@ -848,7 +977,8 @@ public:
 
 	/**
 	 * Attempt to add the specified object to the current thread's remembered set fragment.
-	 * Grow the remembered set if necessary and, if that fails, overflow.
+	 * Grow the remembered set if necessary and, if that fails, overflow. With -Xgc:recordRememberedSetOverflow
+	 * the object is then recorded in the RS overflow map, otherwise any tenured object may be remembered.
 	 * The object must already have its remembered bits set.
 	 *
 	 * @param env[in] the current thread
@@ -912,6 +1042,7 @@ public:
 		, _delegate(env)
 		, _objectAlignmentInBytes(env->getObjectAlignmentInBytes())
 		, _isRememberedSetInOverflowAtTheBeginning(false)
+		, _isRememberedSetOverflowRecordedAtTheBeginning(false)
 		, _extensions(env->getExtensions())
 		, _dispatcher(_extensions->dispatcher)
 		, _doneIndex(0)
@@ -931,10 +1062,14 @@ public:
 		, _minTenureFailureSize(UDATA_MAX)
 		, _minSemiSpaceFailureSize(UDATA_MAX)
 		, _recommendedThreads(UDATA_MAX)
+		, _numaCopyBase(NULL)
+		, _numaCopyTop(NULL)
+		, _numaCopyNodeCount(0)
 		, _cycleState()
 		, _collectionStatistics()
 		, _cachedEntryCount(0)
 		, _cachesPerThread(0)
+		, _depthFirstCopyDepth(0)
 		, _scanCacheMonitor(NULL)
 		, _freeCacheMonitor(NULL)
 		, _waitingCountAliasThreshold(0)
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrgcconsts.h"
+
+#include "ScavengerPauseGoalController.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+const double MM_ScavengerPauseGoalController::SAMPLE_WEIGHT = 0.3;
+const double MM_ScavengerPauseGoalController::PAUSE_HEADROOM = 0.1;
+const uintptr_t MM_ScavengerPauseGoalController::RESIZE_DEADBAND_SHIFT = 4;
+
+void
+MM_ScavengerPauseGoalController::initialize(uint64_t pauseGoal, uintptr_t minimumNurserySize, uintptr_t maximumNurserySize, uintptr_t nurseryAlignment)
+{
+	_pauseGoal = pauseGoal;
+	_minimumNurserySize = minimumNurserySize;
+	_maximumNurserySize = OMR_MAX(minimumNurserySize, maximumNurserySize);
+	_nurseryAlignment = OMR_MAX(nurseryAlignment, 1);
+	_sampleCount = 0;
+	_copyRate = 0.0;
+	_survivalRate = 0.0;
+	_flipRatio = 0.0;
+	_recommendedNurserySize = 0;
+	_recommendedTenureAge = 0;
+}
+
+void
+MM_ScavengerPauseGoalController::update(const Sample *sample)
+{
+	if ((0 == sample->pauseTime) || (0 == sample->nurserySize)) {
+		/* nothing can be learned from this cycle */
+		return;
+	}
+
+	uintptr_t copiedBytes = sample->flipBytes + sample->tenureBytes;
+	double survivalRate = (double)copiedBytes / (double)sample->nurserySize;
+	double weight = (0 == _sampleCount) ? 1.0 : SAMPLE_WEIGHT;
+
+	_survivalRate = (survivalRate * weight) + (_survivalRate * (1.0 - weight));
+	if (0 != copiedBytes) {
+		/* the pause includes fixed costs such as root scanning, which makes the measured rate conservative */
+		double copyRate = (double)copiedBytes / (double)sample->pauseTime;
+		double flipRatio = (double)sample->flipBytes / (double)copiedBytes;
+		double rateWeight = (0.0 == _copyRate) ? 1.0 : SAMPLE_WEIGHT;
+		_copyRate = (copyRate * rateWeight) + (_copyRate * (1.0 - rateWeight));
+		_flipRatio = (flipRatio * rateWeight) + (_flipRatio * (1.0 - rateWeight));
+	}
+	_sampleCount += 1;
+
+	_recommendedNurserySize = calculateNurserySize(sample->nurserySize);
+	_recommendedTenureAge = calculateTenureAge(sample);
+}
+
+uint64_t
+MM_ScavengerPauseGoalController::predictPauseTime(uintptr_t nurserySize) const
+{
+	uint64_t pauseTime = 0;
+	if (0.0 < _copyRate) {
+		pauseTime = (uint64_t)((_survivalRate * (double)nurserySize) / _copyRate);
+	}
+	return pauseTime;
+}
+
+uintptr_t
+MM_ScavengerPauseGoalController::calculateNurserySize(uintptr_t currentNurserySize) const
+{
+	uintptr_t desiredNurserySize = _maximumNurserySize;
+
+	if ((0.0 < _copyRate) && (0.0 < _survivalRate)) {
+		/* largest nursery whose survivors can be copied within the goal, less the headroom */
+		double budget = (double)_pauseGoal * (1.0 - PAUSE_HEADROOM);
+		double desired = (budget * _copyRate) / _survivalRate;
+		if (desired < (double)_maximumNurserySize) {
+			desiredNurserySize = (uintptr_t)desired;
+		}
+	}
+
+	/* the survival rate is only known for sizes close to the current one, so move at most by a factor of two per cycle */
+	desiredNurserySize = OMR_MIN(desiredNurserySize, currentNurserySize * 2);
+	desiredNurserySize = OMR_MAX(desiredNurserySize, currentNurserySize / 2);
+
+	/* ignore small corrections, which would only resize back and forth on noise */
+	uintptr_t difference = (desiredNurserySize > currentNurserySize) ? (desiredNurserySize - currentNurserySize) : (currentNurserySize - desiredNurserySize);
+	if (difference < (currentNurserySize >> RESIZE_DEADBAND_SHIFT)) {
+		desiredNurserySize = currentNurserySize;
+	}
+
+	desiredNurserySize -= desiredNurserySize % _nurseryAlignment;
+	desiredNurserySize = OMR_MIN(desiredNurserySize, _maximumNurserySize);
+	desiredNurserySize = OMR_MAX(desiredNurserySize, _minimumNurserySize);
+
+	return desiredNurserySize;
+}
+
+uintptr_t
+MM_ScavengerPauseGoalController::calculateTenureAge(const Sample *sample) const
+{
+	uintptr_t tenureAge = OMR_MIN(OMR_MAX(sample->tenureAge, OBJECT_HEADER_AGE_MIN), OBJECT_HEADER_AGE_MAX);
+
+	if ((sample->pauseTime > _pauseGoal) && (0.5 < _flipRatio)) {
+		/* most of the pause went into flipping survivors which are copied again next cycle, promote them sooner */
+		if (tenureAge > OBJECT_HEADER_AGE_MIN) {
+			tenureAge -= 1;
+		}
+	} else if (sample->pauseTime < (_pauseGoal / 2)) {
+		/* enough slack to keep objects in the nursery longer, so that fewer of them are tenured before they die */
+		if (tenureAge < OBJECT_HEADER_AGE_MAX) {
+			tenureAge += 1;
+		}
+	}
+
+	return tenureAge;
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SCAVENGERPAUSEGOALCONTROLLER_HPP_)
+#define SCAVENGERPAUSEGOALCONTROLLER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "BaseNonVirtual.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+/**
+ * Sizes the nursery and picks the tenure age so that scavenges stay within a pause time goal
+ * (-Xgc:scavengerPauseGoal=<ms>).
+ *
+ * A scavenge pause is modelled as the bytes that survive it divided by the rate the collector copies
+ * at. Both the copy rate and the fraction of the nursery that survives are measured every cycle and
+ * smoothed, and the nursery is sized so the predicted pause fits the goal with some headroom. When the
+ * goal is missed because the same survivors are flipped over and over, they are tenured sooner; when
+ * there is plenty of slack they are kept longer so that more of them die in the nursery.
+ *
+ * The controller only does arithmetic on the samples it is given, so recorded samples can be replayed
+ * through it offline.
+ */
+class MM_ScavengerPauseGoalController : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+	/**
+	 * What one scavenge measured.
+	 */
+	struct Sample {
+		uint64_t pauseTime; /**< Duration of the scavenge in microseconds */
+		uintptr_t nurserySize; /**< Size of new space during the scavenge */
+		uintptr_t flipBytes; /**< Bytes copied within new space */
+		uintptr_t tenureBytes; /**< Bytes copied to tenure space */
+		uintptr_t tenureAge; /**< Tenure age the scavenge ran with */
+	};
+
+private:
+	uint64_t _pauseGoal; /**< Target pause in microseconds, 0 if the controller is disabled */
+	uintptr_t _minimumNurserySize; /**< Smallest nursery that may be recommended */
+	uintptr_t _maximumNurserySize; /**< Largest nursery that may be recommended */
+	uintptr_t _nurseryAlignment; /**< Granularity of recommended nursery sizes */
+	uintptr_t _sampleCount; /**< Number of samples seen */
+	double _copyRate; /**< Smoothed bytes copied per microsecond of pause */
+	double _survivalRate; /**< Smoothed fraction of the nursery copied by a scavenge */
+	double _flipRatio; /**< Smoothed fraction of copied bytes which stayed in the nursery */
+	uintptr_t _recommendedNurserySize; /**< Nursery size for the next cycle */
+	uintptr_t _recommendedTenureAge; /**< Tenure age for the next cycle */
+
+	static const double SAMPLE_WEIGHT; /**< Weight of the newest sample in the smoothed rates */
+	static const double PAUSE_HEADROOM; /**< Fraction of the goal kept in reserve when sizing the nursery */
+	static const uintptr_t RESIZE_DEADBAND_SHIFT; /**< Resizes smaller than nursery size >> shift are ignored */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * @param pauseGoal target pause in microseconds, 0 to disable the controller
+	 * @param minimumNurserySize smallest nursery that may be recommended
+	 * @param maximumNurserySize largest nursery that may be recommended
+	 * @param nurseryAlignment granularity of recommended nursery sizes
+	 */
+	void initialize(uint64_t pauseGoal, uintptr_t minimumNurserySize, uintptr_t maximumNurserySize, uintptr_t nurseryAlignment);
+
+	MMINLINE bool isEnabled() const { return 0 != _pauseGoal; }
+
+	/**
+	 * Fold the measurements of a completed scavenge into the model and recompute the recommendations.
+	 */
+	void update(const Sample *sample);
+
+	/**
+	 * @return the pause in microseconds the model predicts for a scavenge of a nursery of the given size
+	 */
+	uint64_t predictPauseTime(uintptr_t nurserySize) const;
+
+	MMINLINE uint64_t getPauseGoal() const { return _pauseGoal; }
+	MMINLINE uintptr_t getSampleCount() const { return _sampleCount; }
+	MMINLINE double getCopyRate() const { return _copyRate; }
+	MMINLINE double getSurvivalRate() const { return _survivalRate; }
+	MMINLINE uintptr_t getRecommendedNurserySize() const { return _recommendedNurserySize; }
+	MMINLINE uintptr_t getRecommendedTenureAge() const { return _recommendedTenureAge; }
+
+	MM_ScavengerPauseGoalController()
+		: MM_BaseNonVirtual()
+		, _pauseGoal(0)
+		, _minimumNurserySize(0)
+		, _maximumNurserySize(0)
+		, _nurseryAlignment(1)
+		, _sampleCount(0)
+		, _copyRate(0.0)
+		, _survivalRate(0.0)
+		, _flipRatio(0.0)
+		, _recommendedNurserySize(0)
+		, _recommendedTenureAge(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+private:
+	uintptr_t calculateNurserySize(uintptr_t currentNurserySize) const;
+	uintptr_t calculateTenureAge(const Sample *sample) const;
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+#endif /* SCAVENGERPAUSEGOALCONTROLLER_HPP_ */
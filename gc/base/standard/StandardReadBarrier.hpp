@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef STANDARDREADBARRIER_HPP_
+#define STANDARDREADBARRIER_HPP_
+
+#include "objectdescription.h"
+#include "omr.h"
+
+#include "EnvironmentStandard.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Scavenger.hpp"
+#include "SlotObject.hpp"
+
+/**
+ * Range check of the software read barrier used by Concurrent Scavenger when the platform has no
+ * hardware guarded loads. This is the part that is meant to be inlined at every load of an object
+ * reference: the range lives in the thread, is switched by MM_ScavengerDelegate::switchConcurrentForThread()
+ * when a cycle starts or ends, and is empty otherwise.
+ *
+ * @param omrThread The thread loading the reference
+ * @param object The reference that was loaded
+ * @return true if the reference points into evacuate space and must be resolved with standardReadBarrier()
+ */
+MMINLINE bool
+isReadBarrierRangeCheckHit(OMR_VMThread *omrThread, omrobjectptr_t object)
+{
+	return ((void *)object >= omrThread->readBarrierRangeCheckBase) && ((void *)object < omrThread->readBarrierRangeCheckTop);
+}
+
+/**
+ * Read barrier slow path. Copies the object the slot refers to, or waits for the copy made by another
+ * thread to complete, and updates the slot to point at the copy. If there is no room to copy the object
+ * it is self-forwarded and the slot is left alone; the scavenge will be backed out.
+ *
+ * @param omrThread The thread loading the reference
+ * @param slotObject The slot holding a reference that hit the range check
+ */
+MMINLINE void
+standardReadBarrier(OMR_VMThread *omrThread, GC_SlotObject *slotObject)
+{
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(omrThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->isConcurrentScavengerInProgress()) {
+		extensions->scavenger->copyObjectSlot(env, slotObject);
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+}
+
+/**
+ * Convenience method to load a reference from a heap slot through the read barrier.
+ *
+ * @param omrThread The thread loading the reference
+ * @param srcSlot Points to the slot in the source object that holds the reference
+ * @return the reference, which never points into evacuate space while a Concurrent Scavenge is in progress
+ * @see standardReadBarrier(OMR_VMThread *, GC_SlotObject *)
+ */
+MMINLINE omrobjectptr_t
+standardReadBarrierLoad(OMR_VMThread *omrThread, fomrobject_t *srcSlot)
+{
+	GC_SlotObject slotObject(omrThread->_vm, srcSlot);
+	omrobjectptr_t object = slotObject.readReferenceFromSlot();
+	if (isReadBarrierRangeCheckHit(omrThread, object)) {
+		standardReadBarrier(omrThread, &slotObject);
+		object = slotObject.readReferenceFromSlot();
+	}
+	return object;
+}
+
+/**
+ * Load a reference from an uncompressed slot outside the heap (e.g. a language side table that the
+ * scavenger only fixes up at the end of a cycle) through the read barrier.
+ *
+ * @param omrThread The thread loading the reference
+ * @param srcSlot Points to the slot holding the reference
+ * @return the reference, which never points into evacuate space while a Concurrent Scavenge is in progress
+ */
+MMINLINE omrobjectptr_t
+standardReadBarrierLoadRoot(OMR_VMThread *omrThread, omrobjectptr_t *srcSlot)
+{
+	omrobjectptr_t object = *srcSlot;
+	if (isReadBarrierRangeCheckHit(omrThread, object)) {
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(omrThread);
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		if (extensions->isConcurrentScavengerInProgress()) {
+			extensions->scavenger->copyObjectSlot(env, (volatile omrobjectptr_t *)srcSlot);
+		}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+		object = *srcSlot;
+	}
+	return object;
+}
+
+#endif /* STANDARDREADBARRIER_HPP_ */
@@ -26,6 +26,7 @@
 #include "objectdescription.h"
 
 #include "CardTable.hpp"
+#include "ConcurrentGCSATB.hpp"
 #include "Configuration.hpp"
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
@@ -35,6 +36,32 @@
 
 struct OMR_VMThread;
 
+/**
+ * Out-of-line pre-store write barrier. In the absence of other (equivalent inline) write barrier, this method must
+ * be called before a reference in a parent slot is overwritten.
+ *
+ * While the snapshot at the beginning (SATB) barrier is active, the object the slot referenced is remembered, so
+ * that concurrent marking still traces every object that was reachable when the cycle started.
+ *
+ * @param omrThread The thread overwriting the parent slot
+ * @param parentSlot Points to the slot in the parent object that is about to be overwritten
+ */
+MMINLINE void
+standardWriteBarrierPre(OMR_VMThread *omrThread, fomrobject_t *parentSlot)
+{
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK) && defined(OMR_GC_REALTIME)
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->isSATBBarrierActive()) {
+		GC_SlotObject slotObject(omrThread->_vm, parentSlot);
+		omrobjectptr_t oldObject = slotObject.readReferenceFromSlot();
+		if (NULL != oldObject) {
+			((MM_ConcurrentGCSATB *)extensions->getGlobalCollector())->rememberObjectToRescan(env, oldObject);
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) && defined(OMR_GC_REALTIME) */
+}
+
 /**
  * Out-of-line write barrier. In the absence of other (equivalent inline) write barrier, this method must
  * be called whenever a child reference is assigned to a parent slot.
@@ -78,11 +105,14 @@ standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrob
  * @param parentObject the parent object
  * @param parentSlot Points to the slot in the parent object that will receive the child reference
  * @param childObject THe child object reference
+ * @see standardWriteBarrierPre(OMR_VMThread *, fomrobject_t *)
  * @see standardWriteBarrier(OMR_VMThread *, omrobjectptr_t, omrobjectptr_t)
  */
 MMINLINE void
 standardWriteBarrierStore(OMR_VMThread *omrThread, omrobjectptr_t parentObject, fomrobject_t *parentSlot, omrobjectptr_t childObject)
 {
+	standardWriteBarrierPre(omrThread, parentSlot);
+
 	GC_SlotObject slotObject(omrThread->_vm, parentSlot);
 	slotObject.writeReferenceToSlot(childObject);
 
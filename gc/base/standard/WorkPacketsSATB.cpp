@@ -63,9 +63,11 @@ MM_WorkPacketsSATB::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
-	if (!_inUseBarrierPacketList.initialize(env)) {
+	if (!_publishedBarrierPacketList.initialize(env)) {
 		return false;
 	}
+	/* published buffers are only pushed by mutators and popped in batches, so the queue never needs remove() */
+	_publishedBarrierPacketList.enableLockFree(_packetsStart, _packetsPerBlock);
 
 	return true;
 }
@@ -78,7 +80,7 @@ MM_WorkPacketsSATB::tearDown(MM_EnvironmentBase *env)
 {
 	MM_WorkPackets::tearDown(env);
 
-	_inUseBarrierPacketList.tearDown(env);
+	_publishedBarrierPacketList.tearDown(env);
 }
 
 /**
@@ -148,44 +150,86 @@ MM_WorkPacketsSATB::getPacketByOverflowing(MM_EnvironmentBase *env)
 }
 
 /**
- * Put the packet on the inUseBarrierPacket list.
- * @param packet the packet to put on the list
+ * Mark the packet as backing the SATB barrier buffer of a thread.
+ * In use packets are not kept on a list, so attaching a buffer only costs an atomic increment.
+ * @param packet the packet to mark
  */
 void
 MM_WorkPacketsSATB::putInUsePacket(MM_EnvironmentBase *env, MM_Packet *packet)
 {
-	_inUseBarrierPacketList.push(env, packet);
+	packet->_inUseBarrier = true;
+	MM_AtomicOperations::add(&_inUseBarrierPacketCount, 1);
 }
 
+/**
+ * Publish a full SATB barrier buffer to the lock free queue, from which it is
+ * drained in batches by the threads doing concurrent marking.
+ * @param packet the packet that backed the buffer
+ */
 void
-MM_WorkPacketsSATB::removePacketFromInUseList(MM_EnvironmentBase *env, MM_Packet *packet)
+MM_WorkPacketsSATB::publishBarrierPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 {
-	_inUseBarrierPacketList.remove(packet);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	packet->_inUseBarrier = false;
+	MM_AtomicOperations::subtract(&_inUseBarrierPacketCount, 1);
+	packet->_publishTime = omrtime_hires_clock();
+	_publishedBarrierPacketList.push(env, packet);
 }
 
-void
-MM_WorkPacketsSATB::putFullPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+/**
+ * Move all published SATB barrier buffers to the full packet list in one batch
+ * so they are available for processing.
+ *
+ * @param latencySum[out] incremented by the time each buffer waited in the queue
+ * @param latencyMax[in/out] raised to the longest time a buffer waited in the queue
+ * @return the number of buffers drained
+ */
+uintptr_t
+MM_WorkPacketsSATB::drainPublishedBarrierPackets(MM_EnvironmentBase *env, uint64_t *latencySum, uint64_t *latencyMax)
 {
-	_fullPacketList.push(env, packet);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_Packet *head = NULL;
+	MM_Packet *tail = NULL;
+	uintptr_t count = 0;
+
+	if (_publishedBarrierPacketList.popList(&head, &tail, &count)) {
+		uint64_t now = omrtime_hires_clock();
+		for (MM_Packet *packet = head; NULL != packet; packet = packet->_next) {
+			uint64_t latency = (now > packet->_publishTime) ? (now - packet->_publishTime) : 0;
+			*latencySum += latency;
+			*latencyMax = OMR_MAX(*latencyMax, latency);
+		}
+		_fullPacketList.pushList(head, tail, count);
+
+		omrthread_monitor_enter(_inputListMonitor);
+		if (_inputListWaitCount > 0) {
+			omrthread_monitor_notify(_inputListMonitor);
+		}
+		omrthread_monitor_exit(_inputListMonitor);
+	}
+
+	return count;
 }
 
 /**
- * Move all of the packets from the inUse list to the processing list
- * so they are available for processing.
+ * Move all of the packets backing SATB barrier buffers to the processing list
+ * so they are available for processing. The threads must be stopped, as the
+ * packets are found by walking every packet block.
  */
 void
 MM_WorkPacketsSATB::moveInUseToNonEmpty(MM_EnvironmentBase *env)
 {
-	MM_Packet *head, *tail;
-	UDATA count;
-	bool didPop;
-
-	/* pop the inUseList */
-	didPop = _inUseBarrierPacketList.popList(&head, &tail, &count);
-	/* push the values from the inUseList onto the processingList */
-	if (didPop) {
-		_nonEmptyPacketList.pushList(head, tail, count);
+	for (uintptr_t block = 0; block < _packetsBlocksTop; block++) {
+		MM_Packet *packet = _packetsStart[block];
+		for (uintptr_t i = 0; i < _packetsPerBlock; i++, packet++) {
+			if (packet->_inUseBarrier) {
+				packet->_inUseBarrier = false;
+				_nonEmptyPacketList.push(env, packet);
+			}
+		}
 	}
+	_inUseBarrierPacketCount = 0;
 }
 
 /**
@@ -237,11 +281,23 @@ MM_WorkPacketsSATB::resetAllPackets(MM_EnvironmentBase *env)
 {
 	MM_Packet *packet;
 
-	while (NULL != (packet = getPacket(env, &_inUseBarrierPacketList))) {
+	while (NULL != (packet = getPacket(env, &_publishedBarrierPacketList))) {
 		packet->resetData(env);
 		putPacket(env, packet);
 	}
 
+	for (uintptr_t block = 0; block < _packetsBlocksTop; block++) {
+		packet = _packetsStart[block];
+		for (uintptr_t i = 0; i < _packetsPerBlock; i++, packet++) {
+			if (packet->_inUseBarrier) {
+				packet->_inUseBarrier = false;
+				packet->resetData(env);
+				putPacket(env, packet);
+			}
+		}
+	}
+	_inUseBarrierPacketCount = 0;
+
 	MM_WorkPackets::resetAllPackets(env);
 }
 
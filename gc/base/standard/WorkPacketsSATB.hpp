@@ -34,7 +34,8 @@ class MM_IncrementalOverflow;
 class MM_WorkPacketsSATB : public MM_WorkPackets
 {
 protected:
-	MM_PacketList _inUseBarrierPacketList;  /**< List for packets currently being used for the remembered set*/
+	volatile uintptr_t _inUseBarrierPacketCount; /**< Number of packets currently backing the SATB barrier buffer of a thread */
+	MM_PacketList _publishedBarrierPacketList; /**< Lock free queue of full SATB barrier buffers waiting to be drained to the full packet list */
 
 public:
 	static MM_WorkPacketsSATB *newInstance(MM_EnvironmentBase *env);
@@ -44,17 +45,19 @@ public:
 
 	MM_IncrementalOverflow *getIncrementalOverflowHandler() const { return (MM_IncrementalOverflow*)_overflowHandler; }
 
-	MMINLINE bool effectiveTraceExhausted() { return ((_emptyPacketList.getCount() + _inUseBarrierPacketList.getCount()) == _activePackets); };
+	MMINLINE bool effectiveTraceExhausted() { return ((_emptyPacketList.getCount() + _inUseBarrierPacketCount) == _activePackets); };
 
-	MMINLINE uintptr_t getBarrierPacketCount() { return (_inUseBarrierPacketList.getCount()); };
+	MMINLINE uintptr_t getBarrierPacketCount() { return _inUseBarrierPacketCount; };
 
-	MMINLINE bool inUsePacketsAvailable(MM_EnvironmentBase *env) { return !_inUseBarrierPacketList.isEmpty();}
+	MMINLINE bool inUsePacketsAvailable(MM_EnvironmentBase *env) { return (0 != _inUseBarrierPacketCount); }
+
+	MMINLINE bool publishedPacketsAvailable(MM_EnvironmentBase *env) { return !_publishedBarrierPacketList.isEmpty(); }
 
 	virtual MM_Packet *getBarrierPacket(MM_EnvironmentBase *env);
 	virtual void putInUsePacket(MM_EnvironmentBase *env, MM_Packet *packet);
-	virtual void removePacketFromInUseList(MM_EnvironmentBase *env, MM_Packet *packet);
-	virtual void putFullPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+	virtual void publishBarrierPacket(MM_EnvironmentBase *env, MM_Packet *packet);
 
+	uintptr_t drainPublishedBarrierPackets(MM_EnvironmentBase *env, uint64_t *latencySum, uint64_t *latencyMax);
 	void moveInUseToNonEmpty(MM_EnvironmentBase *env);
 
 	void resetAllPackets(MM_EnvironmentBase *env);
@@ -64,7 +67,8 @@ public:
 	 */
 	MM_WorkPacketsSATB(MM_EnvironmentBase *env) :
 		MM_WorkPackets(env)
-		, _inUseBarrierPacketList(NULL)
+		, _inUseBarrierPacketCount(0)
+		, _publishedBarrierPacketList(NULL)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -42,6 +42,32 @@ omrobjectptr_t OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, uintptr_t alloc
 
 omr_error_t OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode);
 
+/**
+ * Callbacks for OMR_GC_IterateHeap(). Each GC worker taking part in the walk calls threadStart once
+ * to create its own aggregation state (e.g. a class histogram), then objectDo for every object in the
+ * heap sections it claims. Once all workers are done, the requesting thread calls threadMerge once
+ * per worker, in worker order, to fold each state into the result. threadStart and threadMerge may be NULL,
+ * in which case objectDo is handed the userData passed to OMR_GC_IterateHeap().
+ */
+typedef struct OMR_GC_HeapIteratorCallbacks {
+	void *(*threadStart)(OMR_VMThread *omrVMThread, void *userData);
+	void (*objectDo)(OMR_VMThread *omrVMThread, omrobjectptr_t object, void *threadData);
+	void (*threadMerge)(OMR_VMThread *omrVMThread, void *threadData, void *userData);
+} OMR_GC_HeapIteratorCallbacks;
+
+#define OMR_GC_HEAP_ITERATE_LIVE_OBJECTS_ONLY 0x1 /**< Only report objects that are reachable from the roots */
+#define OMR_GC_HEAP_ITERATE_SINGLE_THREADED 0x2 /**< Walk the heap on the requesting thread only */
+
+/**
+ * Walk every object in the heap on all GC worker threads. The calling thread must hold VM access; exclusive
+ * access is acquired for the duration of the walk. The heap is marked first for a walk of live objects, or if it
+ * cannot be parsed as it is; the mark splits it into sections at object boundaries until the next collection.
+ * @return OMR_ERROR_ILLEGAL_ARGUMENT if no objectDo callback is given, OMR_ERROR_NOT_AVAILABLE if the configured
+ * collector does not support parallel heap walks, OMR_ERROR_OUT_OF_NATIVE_MEMORY if the per-thread state table
+ * could not be allocated
+ */
+omr_error_t OMR_GC_IterateHeap(OMR_VMThread *omrVMThread, const OMR_GC_HeapIteratorCallbacks *callbacks, void *userData, uintptr_t iterateFlags);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
@@ -28,6 +28,9 @@
 #include "Heap.hpp"
 #include "ModronAssertions.h"
 #include "ObjectAllocationInterface.hpp"
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+#include "Scavenger.hpp"
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 
 /* OMRTODO temporary workaround to allow both ut_j9mm.h and ut_omrmm.h to be included.
  *                 Dependency on ut_j9mm.h should be removed in the future.
@@ -61,6 +64,20 @@ initializeMutatorModel(OMR_VMThread *omrVMThread)
 			/* replacement values for lowTenureAddress and highTenureAddress */
 			omrVMThread->heapBaseForBarrierRange0 = extensions->heapBaseForBarrierRange0;
 			omrVMThread->heapSizeForBarrierRange0 = extensions->heapSizeForBarrierRange0;
+
+			/* no reference is caught by the read barrier range check unless a Concurrent Scavenge is in progress */
+			omrVMThread->readBarrierRangeCheckBase = (void *)UINTPTR_MAX;
+			omrVMThread->readBarrierRangeCheckTop = NULL;
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+			/* A thread attaching during a cycle must resolve evacuate space references from its first load. Its switch
+			 * count is left behind the scavenger's, so the next cycle transition still switches it, and a transition
+			 * in progress (which may not have set up evacuate space yet) corrects the range once it is done.
+			 */
+			if (extensions->isConcurrentScavengerInProgress()) {
+				omrVMThread->readBarrierRangeCheckBase = extensions->scavenger->getEvacuateBase();
+				omrVMThread->readBarrierRangeCheckTop = extensions->scavenger->getEvacuateTop();
+			}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 		} else if (extensions->isVLHGC()) {
 			MM_Heap *heap = extensions->getHeap();
 			void *heapBase = heap->getHeapBase();
@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omr.h"
+#include "omrgc.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "omrgcstartup.hpp"
+#if defined(OMR_GC_MODRON_STANDARD)
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+
+omr_error_t
+OMR_GC_IterateHeap(OMR_VMThread *omrVMThread, const OMR_GC_HeapIteratorCallbacks *callbacks, void *userData, uintptr_t iterateFlags)
+{
+	if ((NULL == callbacks) || (NULL == callbacks->objectDo)) {
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+	omr_error_t result = OMR_ERROR_NOT_AVAILABLE;
+#if defined(OMR_GC_MODRON_STANDARD)
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->isStandardGC()) {
+		result = OMR_ERROR_NONE;
+		if (NULL == extensions->getGlobalCollector()) {
+			result = OMR_GC_InitializeCollector(omrVMThread);
+		}
+		if (OMR_ERROR_NONE == result) {
+			MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)extensions->getGlobalCollector();
+			MM_ParallelHeapWalker *heapWalker = (MM_ParallelHeapWalker *)globalCollector->getHeapWalker();
+			bool liveObjectsOnly = OMR_ARE_ANY_BITS_SET(iterateFlags, OMR_GC_HEAP_ITERATE_LIVE_OBJECTS_ONLY);
+			bool singleThreaded = OMR_ARE_ANY_BITS_SET(iterateFlags, OMR_GC_HEAP_ITERATE_SINGLE_THREADED);
+
+			env->acquireExclusiveVMAccessForGC(globalCollector);
+			/* a Concurrent Scavenge in progress leaves forwarded objects behind in evacuate space */
+			globalCollector->completeExternalConcurrentCycle(env);
+			if (!heapWalker->allObjectsDoAggregate(env, callbacks, userData, liveObjectsOnly, singleThreaded)) {
+				result = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+			}
+			env->releaseExclusiveVMAccessForGC();
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+	return result;
+}
@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#include "AllocationSampleStats.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ModronAssertions.h"
+
+/**
+ * The space saving table tracks more types than are reported, so that the counts
+ * of the reported types are accurate even when many types are sampled.
+ */
+#define ALLOCATION_SAMPLE_TABLE_RATIO 4
+
+MM_AllocationSampleStats *
+MM_AllocationSampleStats::newInstance(MM_EnvironmentBase *env)
+{
+	MM_AllocationSampleStats *stats = (MM_AllocationSampleStats *)env->getForge()->allocate(sizeof(MM_AllocationSampleStats), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+
+	if (NULL != stats) {
+		new(stats) MM_AllocationSampleStats();
+		if (!stats->initialize(env)) {
+			stats->kill(env);
+			stats = NULL;
+		}
+	}
+
+	return stats;
+}
+
+bool
+MM_AllocationSampleStats::initialize(MM_EnvironmentBase *env)
+{
+	_topK = env->getExtensions()->allocationSamplingTopK;
+	_spaceSaving = spaceSavingNew(env->getPortLibrary(), (uint32_t)(_topK * ALLOCATION_SAMPLE_TABLE_RATIO));
+
+	return (NULL != _spaceSaving);
+}
+
+void
+MM_AllocationSampleStats::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _spaceSaving) {
+		spaceSavingFree(_spaceSaving);
+		_spaceSaving = NULL;
+	}
+}
+
+void
+MM_AllocationSampleStats::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+void
+MM_AllocationSampleStats::merge(MM_AllocationSampleStats *stats)
+{
+	uintptr_t size = spaceSavingGetCurSize(stats->_spaceSaving);
+
+	for (uintptr_t k = 1; k <= size; k++) {
+		void *typeKey = spaceSavingGetKthMostFreq(stats->_spaceSaving, k);
+		spaceSavingUpdate(_spaceSaving, typeKey, spaceSavingGetKthMostFreqCount(stats->_spaceSaving, k));
+	}
+	_sampleCount += stats->_sampleCount;
+}
+
+void
+MM_AllocationSampleStats::traceStats(MM_EnvironmentBase *env)
+{
+	uintptr_t interval = env->getExtensions()->allocationSamplingInterval;
+	uintptr_t size = OMR_MIN(spaceSavingGetCurSize(_spaceSaving), _topK);
+
+	Trc_MM_AllocationSampleStats_samples(env->getLanguageVMThread(), _sampleCount, interval);
+	for (uintptr_t k = 1; k <= size; k++) {
+		uintptr_t count = spaceSavingGetKthMostFreqCount(_spaceSaving, k);
+		Trc_MM_AllocationSampleStats_type(env->getLanguageVMThread(), k, (uintptr_t)spaceSavingGetKthMostFreq(_spaceSaving, k), count, count * interval);
+	}
+}
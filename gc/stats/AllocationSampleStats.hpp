@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(ALLOCATIONSAMPLESTATS_HPP_)
+#define ALLOCATIONSAMPLESTATS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+#include "spacesaving.h"
+
+#include "Base.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Aggregates the allocations chosen by the allocation sampler by type, in a bounded
+ * table that keeps the most frequently sampled types (see -Xgc:allocationSamplingInterval=).
+ * @ingroup GC_Stats
+ */
+class MM_AllocationSampleStats : public MM_Base
+{
+/* Data members */
+private:
+	OMRSpaceSaving *_spaceSaving; /**< Top-k-frequent table of sampled type keys */
+	uintptr_t _topK; /**< Number of most frequently sampled types to report */
+	uintptr_t _sampleCount; /**< Number of samples recorded since the last clear */
+
+/* Function members */
+private:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_AllocationSampleStats *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Record samples for a type.
+	 * @param typeKey the key the samples are aggregated under
+	 * @param count the number of samples
+	 */
+	MMINLINE void
+	update(uintptr_t typeKey, uintptr_t count)
+	{
+		spaceSavingUpdate(_spaceSaving, (void *)typeKey, count);
+		_sampleCount += count;
+	}
+
+	/**
+	 * Add the samples recorded by another (per-thread) table to this one.
+	 * @param stats the table to merge
+	 */
+	void merge(MM_AllocationSampleStats *stats);
+
+	/**
+	 * Trace the most frequently sampled types, with the number of bytes they are
+	 * estimated to account for given the mean sampling interval.
+	 */
+	void traceStats(MM_EnvironmentBase *env);
+
+	MMINLINE void
+	clear()
+	{
+		spaceSavingClear(_spaceSaving);
+		_sampleCount = 0;
+	}
+
+	MMINLINE uintptr_t getSampleCount() { return _sampleCount; }
+
+	MM_AllocationSampleStats()
+		: MM_Base()
+		, _spaceSaving(NULL)
+		, _topK(0)
+		, _sampleCount(0)
+	{}
+};
+
+#endif /* ALLOCATIONSAMPLESTATS_HPP_ */
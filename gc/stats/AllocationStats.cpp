@@ -35,6 +35,9 @@ MM_AllocationStats::clear()
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
+	_tlhRefreshInterval = 0;
+	_tlhAdaptiveGrowCount = 0;
+	_tlhAdaptiveShrinkCount = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	_arrayletLeafAllocationCount = 0;
@@ -59,6 +62,9 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 	MM_AtomicOperations::add(&_tlhRequestedBytes, stats->_tlhRequestedBytes);
 	MM_AtomicOperations::add(&_tlhDiscardedBytes, stats->_tlhDiscardedBytes);
 	MM_AtomicOperations::add(&_tlhAllocatedReused, stats->_tlhAllocatedReused);
+	MM_AtomicOperations::add(&_tlhRefreshInterval, stats->_tlhRefreshInterval);
+	MM_AtomicOperations::add(&_tlhAdaptiveGrowCount, stats->_tlhAdaptiveGrowCount);
+	MM_AtomicOperations::add(&_tlhAdaptiveShrinkCount, stats->_tlhAdaptiveShrinkCount);
 	/* looping to set a maximum value in _tlhMaxAbandonedListSize */
 	for (
 			uintptr_t prevMax = _tlhMaxAbandonedListSize;
@@ -42,6 +42,9 @@ public:
 	uintptr_t _tlhRequestedBytes; 		/**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; 		/**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhRefreshInterval; 		/**< Total time (in microseconds) between consecutive adaptively sized refreshes. */
+	uintptr_t _tlhAdaptiveGrowCount; 	/**< Number of adaptively sized refreshes that raised the refresh size. */
+	uintptr_t _tlhAdaptiveShrinkCount; 	/**< Number of adaptively sized refreshes that lowered the refresh size. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	uintptr_t _arrayletLeafAllocationCount;	/**< Number of arraylet leaf allocations */
@@ -94,6 +97,9 @@ public:
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhRefreshInterval(0),
+		_tlhAdaptiveGrowCount(0),
+		_tlhAdaptiveShrinkCount(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 		_arrayletLeafAllocationCount(0),
 		_arrayletLeafAllocationBytes(0),
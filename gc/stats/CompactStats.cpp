@@ -40,6 +40,9 @@ MM_CompactStats::clear()
 	_movedBytes = 0;
 	
 	_fixupObjects = 0;
+	_subAreas = 0;
+	_selectedSubAreas = 0;
+	_selectedBytes = 0;
 	_setupStartTime = 0;
 	_setupEndTime = 0;
 	_moveStartTime = 0;
@@ -48,6 +51,11 @@ MM_CompactStats::clear()
 	_fixupEndTime = 0;
 	_rootFixupStartTime = 0;
 	_rootFixupEndTime = 0;
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	_syncStallCount = 0;
+	_syncStallTime = 0;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 };
 
 void
@@ -56,6 +64,9 @@ MM_CompactStats::merge(MM_CompactStats *statsToMerge)
 	_movedObjects += statsToMerge->_movedObjects;
 	_movedBytes += statsToMerge->_movedBytes;
 	_fixupObjects += statsToMerge->_fixupObjects;
+	_subAreas += statsToMerge->_subAreas;
+	_selectedSubAreas += statsToMerge->_selectedSubAreas;
+	_selectedBytes += statsToMerge->_selectedBytes;
 	/* merging time intervals is a little different than just creating a total since the sum of two time intervals, for our uses, is their union (as opposed to the sum of two time spans, which is their sum) */
 	_setupStartTime = (0 == _setupStartTime) ? statsToMerge->_setupStartTime : OMR_MIN(_setupStartTime, statsToMerge->_setupStartTime);
 	_setupEndTime = OMR_MAX(_setupEndTime, statsToMerge->_setupEndTime);
@@ -65,6 +76,11 @@ MM_CompactStats::merge(MM_CompactStats *statsToMerge)
 	_fixupEndTime = OMR_MAX(_fixupEndTime, statsToMerge->_fixupEndTime);
 	_rootFixupStartTime = (0 == _rootFixupStartTime) ? statsToMerge->_rootFixupStartTime : OMR_MIN(_rootFixupStartTime, statsToMerge->_rootFixupStartTime);
 	_rootFixupEndTime = OMR_MAX(_rootFixupEndTime, statsToMerge->_rootFixupEndTime);
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	_syncStallCount += statsToMerge->_syncStallCount;
+	_syncStallTime += statsToMerge->_syncStallTime;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 };
 
 #endif /* OMR_GC_MODRON_COMPACTION */
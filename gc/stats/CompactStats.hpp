@@ -31,6 +31,7 @@
 #include "omrcfg.h"
 #include "omrcomp.h"
 #include "modronbase.h"
+#include "modronopt.h"
 
 #if defined(OMR_GC_MODRON_STANDARD)
 
@@ -50,6 +51,9 @@ public:
 	uintptr_t _movedObjects;
 	uintptr_t _movedBytes;
 	uintptr_t _fixupObjects;
+	uintptr_t _subAreas; /**< Number of sub areas a partial compaction chose from */
+	uintptr_t _selectedSubAreas; /**< Number of sub areas a partial compaction moved objects within */
+	uintptr_t _selectedBytes; /**< Size of the sub areas a partial compaction moved objects within */
 	uint64_t _setupStartTime;
 	uint64_t _setupEndTime;
 	uint64_t _moveStartTime;
@@ -58,6 +62,11 @@ public:
 	uint64_t _fixupEndTime;
 	uint64_t _rootFixupStartTime;
 	uint64_t _rootFixupEndTime;
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	uintptr_t _syncStallCount; /**< The number of times the thread stalled at a sync point */
+	uint64_t _syncStallTime; /**< The time, in hi-res ticks, the thread spent stalled at a sync point */
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 		
 	/* Remember gc count on last compaction of heap */
 	uintptr_t _lastHeapCompaction;
@@ -68,6 +77,25 @@ public:
 	void clear();
 	void merge(MM_CompactStats *statsToMerge);
 
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	MMINLINE void
+	addToSyncStallTime(uint64_t startTime, uint64_t endTime)
+	{
+		_syncStallCount += 1;
+		_syncStallTime += (endTime - startTime);
+	}
+
+	/**
+	 * Get the total stall time
+	 * @return the time in hi-res ticks
+	 */
+	MMINLINE uint64_t
+	getStallTime()
+	{
+		return _syncStallTime;
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
 	MM_CompactStats() :
 		MM_Base()
 		,_lastHeapCompaction(0)
@@ -67,6 +67,10 @@ class MM_ConcurrentGCStats : public MM_Base
 	volatile uintptr_t _RSObjectsFound;
 	volatile uintptr_t _threadsScannedCount;
 	uintptr_t _threadsToScanCount;
+	volatile uintptr_t _satbBufferFills; /**< SATB barrier buffers filled by mutators and drained for marking */
+	volatile uintptr_t _satbDrainBatches; /**< Batches in which the filled SATB barrier buffers were drained */
+	volatile uint64_t _satbDrainLatencySum; /**< Total hi-res time filled SATB barrier buffers waited before being drained */
+	volatile uint64_t _satbDrainLatencyMax; /**< Longest hi-res time a filled SATB barrier buffer waited before being drained */
 	
 	bool _concurrentWorkStackOverflowOcurred;
 	uintptr_t _concurrentWorkStackOverflowCount;
@@ -202,6 +206,32 @@ public:
 	MMINLINE void incThreadsScannedCount() { incrementCount((uintptr_t*)&_threadsScannedCount, 1); };
 	MMINLINE uintptr_t getThreadsScannedCount() { return _threadsScannedCount; };
 	
+	MMINLINE uintptr_t getSATBBufferFills() { return _satbBufferFills; };
+	MMINLINE uintptr_t getSATBDrainBatches() { return _satbDrainBatches; };
+	MMINLINE uint64_t getSATBDrainLatencySum() { return _satbDrainLatencySum; };
+	MMINLINE uint64_t getSATBDrainLatencyMax() { return _satbDrainLatencyMax; };
+
+	/**
+	 * Account for a batch of filled SATB barrier buffers drained for marking.
+	 * @param buffers the number of buffers in the batch
+	 * @param latencySum the total time the buffers waited before being drained
+	 * @param latencyMax the longest time one of the buffers waited
+	 */
+	MMINLINE void recordSATBBufferDrain(uintptr_t buffers, uint64_t latencySum, uint64_t latencyMax)
+	{
+		incrementCount((uintptr_t *)&_satbBufferFills, buffers);
+		incrementCount((uintptr_t *)&_satbDrainBatches, 1);
+		MM_AtomicOperations::addU64(&_satbDrainLatencySum, latencySum);
+		uint64_t currentMax = _satbDrainLatencyMax;
+		while (currentMax < latencyMax) {
+			uint64_t foundMax = MM_AtomicOperations::lockCompareExchangeU64(&_satbDrainLatencyMax, currentMax, latencyMax);
+			if (foundMax == currentMax) {
+				break;
+			}
+			currentMax = foundMax;
+		}
+	}
+	
 	MMINLINE bool isRootTracingComplete() { return (_completedModes & CONCURRENT_ROOT_TRACING) == CONCURRENT_ROOT_TRACING; };
 	MMINLINE void setModeComplete(ConcurrentStatus mode) {
 		uint32_t mask = (uint32_t)1 << mode;
@@ -227,6 +257,10 @@ public:
 		clearCount((uintptr_t *)&_RSObjectsFound);
 		clearCount((uintptr_t *)&_threadsScannedCount);
 		clearCount(&_threadsToScanCount);
+		clearCount((uintptr_t *)&_satbBufferFills);
+		clearCount((uintptr_t *)&_satbDrainBatches);
+		_satbDrainLatencySum = 0;
+		_satbDrainLatencyMax = 0;
 		_completedModes = 0;
 		_cardCleaningReason = CARD_CLEANING_REASON_NONE;
 	};
@@ -260,6 +294,10 @@ public:
 		_RSObjectsFound(0),
 		_threadsScannedCount(0),
 		_threadsToScanCount(0),
+		_satbBufferFills(0),
+		_satbDrainBatches(0),
+		_satbDrainLatencySum(0),
+		_satbDrainLatencyMax(0),
 		_concurrentWorkStackOverflowOcurred(false),
 		_concurrentWorkStackOverflowCount(0),
 		_completedModes(0),
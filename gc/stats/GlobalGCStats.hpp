@@ -84,7 +84,11 @@ public:
 	MMINLINE uint64_t 
 	getStallTime()
 	{
-		return markStats.getStallTime() + workPacketStats.getStallTime() + sweepStats.idleTime;
+		uint64_t stallTime = markStats.getStallTime() + workPacketStats.getStallTime() + sweepStats.idleTime;
+#if defined(OMR_GC_MODRON_COMPACTION)
+		stallTime += compactStats.getStallTime();
+#endif /* OMR_GC_MODRON_COMPACTION */
+		return stallTime;
 	}
 
 	MM_GlobalGCStats()
@@ -201,6 +201,10 @@ MM_LargeObjectAllocateStats::resetCurrent()
 {
 	spaceSavingClear(_spaceSavingSizes);
 	spaceSavingClear(_spaceSavingSizeClasses);
+
+	for (uintptr_t i = 0; i < freeEntryIndexLookupCount; i++) {
+		_freeEntryIndexLookups[i] = 0;
+	}
 }
 
 void
@@ -248,6 +252,10 @@ MM_LargeObjectAllocateStats::mergeCurrent(MM_LargeObjectAllocateStats *statsToMe
 	for(i = 0; i < spaceSavingGetCurSize(spaceSavingToMerge); i++ ){
 		spaceSavingUpdate(_spaceSavingSizeClasses, spaceSavingGetKthMostFreq(spaceSavingToMerge, i + 1), spaceSavingGetKthMostFreqCount(spaceSavingToMerge, i + 1));
 	}
+
+	for (i = 0; i < freeEntryIndexLookupCount; i++) {
+		_freeEntryIndexLookups[i] += statsToMerge->_freeEntryIndexLookups[i];
+	}
 }
 
 void
@@ -40,6 +40,17 @@ class MM_FreeEntrySizeClassStats;
  */
 class MM_LargeObjectAllocateStats : public MM_Base {
 public:
+	/**
+	 * How an allocate was resolved by a pool's free entry index (see MM_FreeEntryIndex)
+	 */
+	enum FreeEntryIndexLookup {
+		freeEntryIndexBinHit = 0, /**< satisfied from the size-class bin of the request */
+		freeEntryIndexLargerBinHit, /**< satisfied from a larger non-empty size-class bin */
+		freeEntryIndexTreeHit, /**< satisfied from the large entry tree */
+		freeEntryIndexBinWalkHit, /**< satisfied by walking the request's own bin */
+		freeEntryIndexMiss, /**< no indexed entry was large enough */
+		freeEntryIndexLookupCount
+	};
 private:
 	MM_EnvironmentBase *_env;				/**< cached thread environment */
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
@@ -75,6 +86,8 @@ private:
 	uintptr_t _TLHSizeClassIndex; /**< preserved next value of sizeClassIndex on last invocation of simulateAllocateTLHs */
 	uintptr_t _TLHFrequentAllocationSize;/**< preserved next value of FrequentAllocationSize on last invocation of simulateAllocateTLHs */
 
+	uintptr_t _freeEntryIndexLookups[freeEntryIndexLookupCount]; /**< current count of allocates per free entry index lookup outcome */
+
 	MMINLINE uintptr_t getNextSizeClass(uintptr_t sizeClassIndex, uintptr_t maxSizeClasses);
 	MMINLINE bool isFirstIterationCompleteForCurrentStride(uintptr_t sizeClassIndex, uintptr_t maxSizeClasses);
 
@@ -222,6 +235,9 @@ public:
 	uintptr_t getFreeMemory(){return _freeEntrySizeClassStats.getFreeMemory(_sizeClassSizes);}
 	uintptr_t getPageAlignedFreeMemory(uintptr_t pageSize) {return _freeEntrySizeClassStats.getPageAlignedFreeMemory(_sizeClassSizes, pageSize);}
 
+	void incrementFreeEntryIndexLookups(FreeEntryIndexLookup lookup) { _freeEntryIndexLookups[lookup] += 1; }
+	uintptr_t getFreeEntryIndexLookups(FreeEntryIndexLookup lookup) { return _freeEntryIndexLookups[lookup]; }
+
 
 	MM_LargeObjectAllocateStats(MM_EnvironmentBase* env) :
 		_env(env),
@@ -249,6 +265,9 @@ public:
 		_TLHSizeClassIndex(0),
 		_TLHFrequentAllocationSize(0)
 	{
+		for (uintptr_t i = 0; i < freeEntryIndexLookupCount; i++) {
+			_freeEntryIndexLookups[i] = 0;
+		}
 	}
 
 };
@@ -34,6 +34,7 @@ MM_ScavengerStats::MM_ScavengerStats()
 	_gcCount(UDATA_MAX)
 	,_rememberedSetOverflow(0)
 	,_causedRememberedSetOverflow(0)
+	,_rememberedSetOverflowRecordedCount(0)
 	,_scanCacheOverflow(0)
 	,_scanCacheAllocationFromHeap(0)
 	,_scanCacheAllocationDurationDuringSavenger(0)
@@ -91,6 +92,9 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_tenureExpandedTime(0)
 	,_leafObjectCount(0)
 	,_copy_cachesize_sum(0)
+	,_localityCopyCount(0)
+	,_localitySameCacheLineCount(0)
+	,_localitySamePageCount(0)
 	,_slotsCopied(0)
 	,_slotsScanned(0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -102,6 +106,7 @@ MM_ScavengerStats::MM_ScavengerStats()
 	memset(_flipHistory, 0, sizeof(_flipHistory));
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
+	memset(_numaNodeCopyStats, 0, sizeof(_numaNodeCopyStats));
 }
 
 struct MM_ScavengerStats::FlipHistory*
@@ -137,6 +142,7 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	
 	_rememberedSetOverflow = 0;
 	_causedRememberedSetOverflow = 0;
+	_rememberedSetOverflowRecordedCount = 0;
 	_scanCacheOverflow = 0;
 	_scanCacheAllocationFromHeap = 0;
 	_scanCacheAllocationDurationDuringSavenger = 0;
@@ -209,8 +215,12 @@ MM_ScavengerStats::clear(bool firstIncrement)
 
 	_leafObjectCount = 0;
 	_copy_cachesize_sum = 0;
+	_localityCopyCount = 0;
+	_localitySameCacheLineCount = 0;
+	_localitySamePageCount = 0;
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
+	memset(_numaNodeCopyStats, 0, sizeof(_numaNodeCopyStats));
 }
 
 bool
@@ -35,7 +35,9 @@ class MM_EnvironmentBase;
 #include "Math.hpp"
 
 #define OMR_SCAVENGER_DISTANCE_BINS 32
+#define OMR_SCAVENGER_LOCALITY_PAGE_SIZE 4096
 #define OMR_SCAVENGER_CACHESIZE_BINS 16
+#define OMR_SCAVENGER_NUMA_NODE_BINS 16
 
 #define SCAVENGER_FLIP_HISTORY_SIZE 16
 
@@ -57,6 +59,7 @@ public:
 	uintptr_t _gcCount;  /**< Count of the number of GC cycles that have occurred */
 	uintptr_t _rememberedSetOverflow;
 	uintptr_t _causedRememberedSetOverflow;
+	uintptr_t _rememberedSetOverflowRecordedCount; /**< Number of objects scanned from the remembered set overflow map */
 	uintptr_t _scanCacheOverflow;
 	uintptr_t _scanCacheAllocationFromHeap;
 	uint64_t  _scanCacheAllocationDurationDuringSavenger;
@@ -146,6 +149,20 @@ public:
 	uint64_t _copy_cachesize_counts[OMR_SCAVENGER_CACHESIZE_BINS];
 	uint64_t _copy_cachesize_sum;
 
+	uint64_t _localityCopyCount; /**< The number of objects copied while scanning a reference slot of an object in survivor or tenure space */
+	uint64_t _localitySameCacheLineCount; /**< The number of those copies that start in the same cache line as the referencing slot */
+	uint64_t _localitySamePageCount; /**< The number of those copies that start in the same page as the referencing slot */
+
+	/**
+	 * Copy caches carved for each NUMA affinity leader with numaAwareScavengerCopy, indexed by node (1-based, bin 0 unused).
+	 * Nodes beyond the last bin are counted in the last bin.
+	 */
+	struct NUMANodeCopyStats {
+		uintptr_t _survivorBytes; /**< bytes of survivor copy caches carved for the node */
+		uintptr_t _tenureBytes; /**< bytes of tenure copy caches carved for the node */
+		uintptr_t _localBytes; /**< bytes of those survivor copy caches carved from nursery granules bound to the node */
+	} _numaNodeCopyStats[OMR_SCAVENGER_NUMA_NODE_BINS];
+
 	uint64_t _slotsCopied; /**< The number of slots copied by the thread since _slotsScanned was last sampled and reset */
 	uint64_t _slotsScanned; /**< The number of slots scanned by the thread since _slotsCopied was last sampled and reset */
 	
@@ -231,6 +248,33 @@ public:
 		}
 	}
 
+	MMINLINE NUMANodeCopyStats *
+	getNUMANodeCopyStats(uintptr_t numaNode)
+	{
+		return &_numaNodeCopyStats[OMR_MIN(numaNode, OMR_SCAVENGER_NUMA_NODE_BINS - 1)];
+	}
+
+	/**
+	 * Record where an object copied while scanning a reference slot landed relative to that slot.
+	 * A copy that starts in the same cache line as the referencing slot is free to reach once
+	 * the parent is in cache; the same page rate captures TLB locality.
+	 * @param slotAddr[in] address of the (already copied) parent slot that referenced the object
+	 * @param childAddr[in] address of the new copy of the object
+	 * @param cacheLineSize[in] bytes per cache line (power of two)
+	 */
+	MMINLINE void
+	countCopyLocality(uintptr_t slotAddr, uintptr_t childAddr, uintptr_t cacheLineSize)
+	{
+		uintptr_t delta = slotAddr ^ childAddr;
+		_localityCopyCount += 1;
+		if (delta < cacheLineSize) {
+			_localitySameCacheLineCount += 1;
+		}
+		if (delta < OMR_SCAVENGER_LOCALITY_PAGE_SIZE) {
+			_localitySamePageCount += 1;
+		}
+	}
+
 	MMINLINE void
 	countCopyCacheSize(uint64_t copyCacheSize, uint64_t copyCacheSizeMax)
 	{
@@ -40,6 +40,7 @@
 
 static void verboseHandlerInitialized(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerFreePagesReleased(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutput::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
@@ -103,6 +104,7 @@ MM_VerboseHandlerOutput::enableVerbose()
 	/* Initialized */
 	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_INITIALIZED, verboseHandlerInitialized, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseHandlerHeapResize, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_FREE_PAGES_RELEASED, verboseHandlerFreePagesReleased, OMR_GET_CALLSITE(), (void *)this);
 
 	return ;
 }
@@ -113,6 +115,7 @@ MM_VerboseHandlerOutput::disableVerbose()
 	/* Initialized */
 	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_INITIALIZED, verboseHandlerInitialized, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseHandlerHeapResize, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_FREE_PAGES_RELEASED, verboseHandlerFreePagesReleased, NULL);
 
 	return ;
 }
@@ -820,6 +823,14 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
 	}
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	if (_extensions->tlhAdaptiveSizing) {
+		uint64_t refreshInterval = systemStats->_tlhRefreshInterval;
+		writer->formatAndOutput(env, 1, "<tlh-adaptive-sizing refreshintervalms=\"%llu.%03.3llu\" growcount=\"%zu\" shrinkcount=\"%zu\" />",
+				refreshInterval / 1000, refreshInterval % 1000, systemStats->_tlhAdaptiveGrowCount, systemStats->_tlhAdaptiveShrinkCount);
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+
 	if(0 != _extensions->bytesAllocatedMost){
 		const char *dots = "";
 		char escapedThreadName[128];
@@ -1001,6 +1012,24 @@ MM_VerboseHandlerOutput::outputHeapResizeInfo(MM_EnvironmentBase *env, uintptr_t
 	writer->flush(env);
 }
 
+void
+MM_VerboseHandlerOutput::handleFreePagesReleased(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_FreePagesReleasedEvent *event = (MM_FreePagesReleasedEvent *)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	uint64_t timeInMicroSeconds = event->timeTaken;
+	char tagTemplate[200];
+
+	enterAtomicReportingBlock();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), _manager->getIdAndIncrement(), omrtime_current_time_millis());
+	writer->formatAndOutput(env, _manager->getIndentLevel(), "<release-free-pages %s queued=\"%zu\" released=\"%zu\" cancelled=\"%zu\" decommits=\"%zu\" timems=\"%llu.%03llu\" />",
+		tagTemplate, event->queuedBytes, event->releasedBytes, event->cancelledBytes, event->decommitCount, timeInMicroSeconds / 1000, timeInMicroSeconds % 1000);
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+
 void
 MM_VerboseHandlerOutput::outputCollectorHeapResizeInfo(MM_EnvironmentBase *env, uintptr_t indent, HeapResizeType resizeType, uintptr_t resizeAmount, uintptr_t resizeCount, uintptr_t subSpaceType, uintptr_t reason, uint64_t timeInMicroSeconds)
 {
@@ -1096,6 +1125,12 @@ verboseHandlerHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* event
 	((MM_VerboseHandlerOutput*)userData)->handleHeapResize(hook, eventNum, eventData);
 }
 
+void
+verboseHandlerFreePagesReleased(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutput*)userData)->handleFreePagesReleased(hook, eventNum, eventData);
+}
+
 void
 MM_VerboseHandlerOutput::handleGCOPOuterStanzaStart(MM_EnvironmentBase* env, const char *type, uintptr_t contextID, uint64_t duration, bool deltaTimeSuccess)
 {
@@ -510,6 +510,14 @@ public:
 
 	void handleHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 
+	/**
+	 * Write the verbose stanza for a pass of the background free page releaser.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleFreePagesReleased(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+
 	/**
 	 * Write the verbose stanza for the excessive gc raised event.
 	 * @param hook Hook interface used by the JVM.
@@ -291,12 +291,22 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 	MM_MarkStats *markStats = &extensions->globalGCStats.markStats;
 	uint64_t duration = 0;
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, markStats->_startTime, markStats->_endTime);
+	uint64_t syncStall = 0;
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	getTimeDeltaInMicroSeconds(&syncStall, 0, markStats->getStallTime());
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	enterAtomicReportingBlock();
 	handleGCOPOuterStanzaStart(env, "mark", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
 
-	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
-			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" syncstallms=\"%llu.%03.3llu\" />",
+			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned, syncStall / 1000, syncStall % 1000);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	MM_WorkPacketStats *workPacketStats = &extensions->globalGCStats.workPacketStats;
+	writer->formatAndOutput(env, 1, "<workpackets acquired=\"%zu\" released=\"%zu\" exchanged=\"%zu\" localhits=\"%zu\" globalhits=\"%zu\" stolen=\"%zu\" />",
+			workPacketStats->workPacketsAcquired, workPacketStats->workPacketsReleased, workPacketStats->workPacketsExchanged,
+			workPacketStats->workPacketsLocalHits, workPacketStats->workPacketsGlobalHits, workPacketStats->workPacketsStolen);
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	handleMarkEndInternal(env, eventData);
 
@@ -317,14 +327,26 @@ MM_VerboseHandlerOutputStandard::handleSweepEnd(J9HookInterface** hook, uintptr_
 	MM_SweepEndEvent* event = (MM_SweepEndEvent*)eventData;
 	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
 	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	MM_VerboseManager* manager = getManager();
+	MM_VerboseWriterChain* writer = manager->getWriterChain();
 	MM_SweepStats *sweepStats = &extensions->globalGCStats.sweepStats;
 	uint64_t duration = 0;
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
+	uint64_t syncStall = 0;
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	/* sweep threads are only ever idle while stalled at a sync point */
+	getTimeDeltaInMicroSeconds(&syncStall, 0, sweepStats->idleTime);
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	enterAtomicReportingBlock();
-	handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+	handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+
+	writer->formatAndOutput(env, 1, "<sweep-info syncstallms=\"%llu.%03.3llu\" />", syncStall / 1000, syncStall % 1000);
 
 	handleSweepEndInternal(env, eventData);
+
+	handleGCOPOuterStanzaEnd(env);
+	writer->flush(env);
 	exitAtomicReportingBlock();
 }
 
@@ -365,13 +387,21 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	MM_CompactStats *compactStats = &MM_GCExtensionsBase::getExtensions(env->getOmrVM())->globalGCStats.compactStats;
 	uint64_t duration = 0;
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, compactStats->_startTime, compactStats->_endTime);
+	uint64_t syncStall = 0;
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	getTimeDeltaInMicroSeconds(&syncStall, 0, compactStats->getStallTime());
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	enterAtomicReportingBlock();
 	handleGCOPOuterStanzaStart(env, "compact", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
 
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
-		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
-				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" syncstallms=\"%llu.%03.3llu\" />",
+				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason), syncStall / 1000, syncStall % 1000);
+		if (0 != compactStats->_subAreas) {
+			writer->formatAndOutput(env, 1, "<partial-compact subareas=\"%zu\" selected=\"%zu\" selectedbytes=\"%zu\" fixupobjects=\"%zu\" />",
+					compactStats->_subAreas, compactStats->_selectedSubAreas, compactStats->_selectedBytes, compactStats->_fixupObjects);
+		}
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -422,6 +452,17 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<memory-copied type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" bytesdiscarded=\"%zu\" />",
 				scavengerStats->_tenureAggregateCount, scavengerStats->_tenureAggregateBytes, scavengerStats->_tenureDiscardBytes);
 	}
+	if (0 != scavengerStats->_localityCopyCount) {
+		writer->formatAndOutput(env, 1, "<copy-locality copies=\"%llu\" samecacheline=\"%llu\" samepage=\"%llu\" />",
+				scavengerStats->_localityCopyCount, scavengerStats->_localitySameCacheLineCount, scavengerStats->_localitySamePageCount);
+	}
+	for (uintptr_t node = 1; node < OMR_SCAVENGER_NUMA_NODE_BINS; node++) {
+		MM_ScavengerStats::NUMANodeCopyStats *nodeStats = scavengerStats->getNUMANodeCopyStats(node);
+		if ((0 != nodeStats->_survivorBytes) || (0 != nodeStats->_tenureBytes)) {
+			writer->formatAndOutput(env, 1, "<numa-copy node=\"%zu\" survivorbytes=\"%zu\" tenurebytes=\"%zu\" localbytes=\"%zu\" />",
+					node, nodeStats->_survivorBytes, nodeStats->_tenureBytes, nodeStats->_localBytes);
+		}
+	}
 	if (0 != scavengerStats->_failedFlipCount) {
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"nursery\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedFlipCount, scavengerStats->_failedFlipBytes);
@@ -443,6 +484,9 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		if(scavengerStats->_causedRememberedSetOverflow) {
 			writer->formatAndOutput(env, 1, "<warning details=\"remembered set overflow triggered\" />");
 		}
+		if(0 != scavengerStats->_rememberedSetOverflowRecordedCount) {
+			writer->formatAndOutput(env, 1, "<warning details=\"remembered set overflow scanned %zu recorded objects\" />", scavengerStats->_rememberedSetOverflowRecordedCount);
+		}
 	}
 	if(scavengerStats->_scanCacheOverflow) {
 		writer->formatAndOutput(env, 1, "<warning details=\"scan cache overflow (new chunk allocation acquired durationms=%zu, fromHeap=%s)\" />", scavengerStats->_scanCacheAllocationDurationDuringSavenger, (0 != scavengerStats->_scanCacheAllocationFromHeap)?"true":"false");
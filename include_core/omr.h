@@ -186,6 +186,9 @@ typedef struct OMR_VMThread {
 	void *heapBaseForBarrierRange0;
 	uintptr_t heapSizeForBarrierRange0;
 
+	void *readBarrierRangeCheckBase; /**< references in [base, top) must be resolved by the software read barrier; empty (base > top) unless a Concurrent Scavenge is in progress */
+	void *readBarrierRangeCheckTop;
+
 	void *memorySpace;
 
 	int32_t _attachCount;
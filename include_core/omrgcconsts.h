@@ -427,6 +427,7 @@ typedef enum {
 	SATISFY_EXPAND,
 	FORCED_NURSERY_CONTRACT,
 	SOFT_MX_CONTRACT,
+	SCAV_PAUSE_ABOVE_GOAL,
 } ContractReason;
 
 typedef enum {
@@ -439,7 +440,8 @@ typedef enum {
 	SATISFY_COLLECTOR,
 	EXPAND_DESPERATE,
 	FORCED_NURSERY_EXPAND,
-	HINT_PREVIOUS_RUNS
+	HINT_PREVIOUS_RUNS,
+	SCAV_PAUSE_BELOW_GOAL
 } ExpandReason;
 
 typedef enum {
@@ -466,7 +468,8 @@ typedef enum {
 	CONTRACTION_REQUIRED,
 	EXPANSION_REQUIRED,
 	LOA_RESIZE,
-	SYSTEM_GC
+	SYSTEM_GC,
+	HEAP_WALK_REQUIRED
 } SweepCompletionReason;
 
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
@@ -228,6 +228,7 @@
 #define OMRPORT_VMEM_MEMORY_MODE_SHARE_FILE_OPEN 0x000000200
 #define OMRPORT_VMEM_MEMORY_MODE_MMAP_HUGE_PAGES 0x000000400
 #define OMRPORT_VMEM_MEMORY_MODE_DOUBLE_MAP_AVAILABLE 0x000000800
+#define OMRPORT_VMEM_MEMORY_MODE_DECOMMIT_LAZILY 0x000001000
 #define OMRPORT_VMEM_ALLOCATE_TOP_DOWN 0x00000020
 #define OMRPORT_VMEM_ALLOCATE_PERSIST 0x00000040
 #define OMRPORT_VMEM_NO_AFFINITY 0x00000080
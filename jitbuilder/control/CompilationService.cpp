@@ -0,0 +1,257 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "control/CompilationService.hpp"
+#include "compile/Compilation.hpp"
+#include "ilgen/MethodBuilder.hpp"
+
+extern int32_t compileJitBuilderMethod(TR::MethodBuilder *m, void **entry, int32_t compThreadID, TR_Hotness hotness);
+
+JitBuilder::CompilationService *
+JitBuilder::CompilationService::instance()
+   {
+   static CompilationService service;
+   return &service;
+   }
+
+bool
+JitBuilder::CompilationService::startThreads(int32_t numThreads)
+   {
+   if (numThreads < 1 || numThreads > MAX_COMPILATION_THREADS)
+      return false;
+
+   std::lock_guard<std::mutex> lock(_mutex);
+   if (!_threads.empty() || _shuttingDown)
+      return false;
+
+   // compilation thread IDs start at 1; 0 identifies an application thread
+   for (int32_t t=1;t <= numThreads;t++)
+      _threads.push_back(std::thread(&CompilationService::compilationThreadLoop, this, t));
+
+   return true;
+   }
+
+void
+JitBuilder::CompilationService::startDefaultThreads()
+   {
+   bool needThreads;
+      {
+      std::lock_guard<std::mutex> lock(_mutex);
+      needThreads = _threads.empty();
+      }
+
+   if (needThreads)
+      {
+      int32_t numThreads = static_cast<int32_t>(std::thread::hardware_concurrency());
+      if (numThreads < 1)
+         numThreads = 1;
+      else if (numThreads > MAX_COMPILATION_THREADS)
+         numThreads = MAX_COMPILATION_THREADS;
+
+      // a concurrent request may have started the threads first, which is fine
+      startThreads(numThreads);
+      }
+   }
+
+bool
+JitBuilder::CompilationService::requestCompilation(TR::MethodBuilder *methodBuilder)
+   {
+   startDefaultThreads();
+
+   std::lock_guard<std::mutex> lock(_mutex);
+   if (methodBuilder == NULL || _shuttingDown || _requests.find(methodBuilder) != _requests.end())
+      return false;
+
+   Request *request = new Request(methodBuilder, methodBuilder->typeDictionary());
+   _requests[methodBuilder] = request;
+   _queue.push_back(request);
+   _workAvailable.notify_one();
+
+   return true;
+   }
+
+bool
+JitBuilder::CompilationService::requestCompilation(TR::MethodBuilder *methodBuilder, TR_Hotness hotness, CompletionCallback callback, void *data)
+   {
+   startDefaultThreads();
+
+   std::lock_guard<std::mutex> lock(_mutex);
+   if (methodBuilder == NULL || _shuttingDown)
+      return false;
+
+   // nobody waits for this request, so it is not recorded in _requests
+   _queue.push_back(new Request(methodBuilder, methodBuilder->typeDictionary(), hotness, callback, data));
+   _workAvailable.notify_one();
+
+   return true;
+   }
+
+int32_t
+JitBuilder::CompilationService::compile(TR::MethodBuilder *methodBuilder, void **entry, TR_Hotness hotness)
+   {
+   TR::TypeDictionary *types = methodBuilder->typeDictionary();
+   bool reserved = reserveTypeDictionary(types);
+
+   int32_t rc = compileJitBuilderMethod(methodBuilder, entry, 0, hotness);
+
+   if (reserved)
+      releaseTypeDictionary(types);
+
+   return rc;
+   }
+
+bool
+JitBuilder::CompilationService::reserveTypeDictionary(TR::TypeDictionary *types)
+   {
+   std::thread::id self = std::this_thread::get_id();
+   std::unique_lock<std::mutex> lock(_mutex);
+   while (true)
+      {
+      auto inUse = _typeDictionariesInUse.find(types);
+      if (inUse == _typeDictionariesInUse.end())
+         {
+         _typeDictionariesInUse[types] = self;
+         return true;
+         }
+
+      // a compile on this thread (e.g. from a RequestFunction callback) already holds it
+      if (inUse->second == self)
+         return false;
+
+      _compilationDone.wait(lock);
+      }
+   }
+
+void
+JitBuilder::CompilationService::releaseTypeDictionary(TR::TypeDictionary *types)
+   {
+   std::lock_guard<std::mutex> lock(_mutex);
+   _typeDictionariesInUse.erase(types);
+
+   // both compilation threads and application threads may be waiting for it
+   _workAvailable.notify_all();
+   _compilationDone.notify_all();
+   }
+
+int32_t
+JitBuilder::CompilationService::waitForCompilation(TR::MethodBuilder *methodBuilder, void **entry)
+   {
+   std::unique_lock<std::mutex> lock(_mutex);
+   auto it = _requests.find(methodBuilder);
+   if (it == _requests.end())
+      return COMPILATION_FAILED;
+
+   Request *request = it->second;
+   while (!request->_done)
+      _compilationDone.wait(lock);
+
+   _requests.erase(methodBuilder);
+   *entry = request->_entry;
+   int32_t rc = request->_rc;
+   delete request;
+
+   return rc;
+   }
+
+void
+JitBuilder::CompilationService::shutdown()
+   {
+      {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _shuttingDown = true;
+      _workAvailable.notify_all();
+      }
+
+   for (auto it = _threads.begin(); it != _threads.end(); ++it)
+      it->join();
+
+   // discard the results nobody waited for so the service can be restarted
+   // if the JIT is initialized again
+   std::lock_guard<std::mutex> lock(_mutex);
+   for (auto it = _requests.begin(); it != _requests.end(); ++it)
+      delete it->second;
+   _requests.clear();
+   _threads.clear();
+   _shuttingDown = false;
+   }
+
+// Must be called with _mutex held. Returns the oldest queued request whose
+// TypeDictionary is not being used by another compilation, or NULL if there
+// is none.
+JitBuilder::CompilationService::Request *
+JitBuilder::CompilationService::nextCompilableRequest()
+   {
+   for (auto it = _queue.begin(); it != _queue.end(); ++it)
+      {
+      Request *request = *it;
+      if (_typeDictionariesInUse.find(request->_types) == _typeDictionariesInUse.end())
+         {
+         _queue.erase(it);
+         return request;
+         }
+      }
+   return NULL;
+   }
+
+void
+JitBuilder::CompilationService::compilationThreadLoop(int32_t compThreadID)
+   {
+   std::unique_lock<std::mutex> lock(_mutex);
+   while (true)
+      {
+      Request *request = nextCompilableRequest();
+      if (request == NULL)
+         {
+         // drain the queue before honouring a shutdown request
+         if (_shuttingDown && _queue.empty())
+            break;
+         _workAvailable.wait(lock);
+         continue;
+         }
+
+      _typeDictionariesInUse[request->_types] = std::this_thread::get_id();
+      lock.unlock();
+
+      void *entry = NULL;
+      int32_t rc = compileJitBuilderMethod(request->_methodBuilder, &entry, compThreadID, request->_hotness);
+
+      if (request->_callback != NULL)
+         request->_callback(request->_methodBuilder, entry, rc, request->_callbackData);
+
+      lock.lock();
+      _typeDictionariesInUse.erase(request->_types);
+      if (request->_callback != NULL)
+         {
+         delete request;
+         }
+      else
+         {
+         request->_entry = entry;
+         request->_rc = rc;
+         request->_done = true;
+         }
+
+      // another thread may be waiting for this TypeDictionary to become free
+      _workAvailable.notify_all();
+      _compilationDone.notify_all();
+      }
+   }
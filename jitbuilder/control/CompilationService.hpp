@@ -0,0 +1,153 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef JITBUILDER_COMPILATIONSERVICE_INCL
+#define JITBUILDER_COMPILATIONSERVICE_INCL
+
+#include <stdint.h>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "compile/CompilationTypes.hpp"
+
+namespace TR { class MethodBuilder; }
+namespace TR { class TypeDictionary; }
+
+namespace JitBuilder
+{
+
+/**
+ * @brief A pool of compilation threads that compile MethodBuilders asynchronously.
+ *
+ * A MethodBuilder is submitted with requestCompilation() and its entry point is
+ * collected later with waitForCompilation(), which blocks until the compile has
+ * finished. Each compilation thread compiles with its own compilation thread ID
+ * (starting at 1; 0 is reserved for synchronous compiles on application threads)
+ * so the code cache manager hands each thread its own code cache.
+ *
+ * Symbol references for struct and union fields are cached in the TypeDictionary
+ * for the duration of a compile, and a MethodBuilder that calls another one
+ * generates IL for the callee inside its own compile. Requests whose
+ * MethodBuilders share a TypeDictionary are therefore never compiled at the
+ * same time: a thread picks the oldest queued request whose TypeDictionary is
+ * not in use by another thread, and compile() waits on the application thread
+ * until no compilation thread is using the TypeDictionary.
+ *
+ * A request may instead name a callback that receives the result on the
+ * compilation thread; such requests are not retired by waitForCompilation().
+ */
+class CompilationService
+   {
+public:
+   static const int32_t MAX_COMPILATION_THREADS = 16;
+
+   typedef void (*CompletionCallback)(TR::MethodBuilder *methodBuilder, void *entry, int32_t rc, void *data);
+
+   static CompilationService *instance();
+
+   /**
+    * @brief start numThreads compilation threads
+    * @returns false if the threads have already been started or numThreads is out of range
+    */
+   bool startThreads(int32_t numThreads);
+
+   /**
+    * @brief queue methodBuilder for compilation, starting the default number of threads if none are running
+    * @returns true if the request was queued, false if methodBuilder is NULL or already queued
+    */
+   bool requestCompilation(TR::MethodBuilder *methodBuilder);
+
+   /**
+    * @brief queue methodBuilder for compilation at hotness and pass the result to callback on the compilation thread
+    * @returns true if the request was queued, false if methodBuilder is NULL or the service is shutting down
+    */
+   bool requestCompilation(TR::MethodBuilder *methodBuilder, TR_Hotness hotness, CompletionCallback callback, void *data);
+
+   /**
+    * @brief compile methodBuilder at hotness on the calling thread once its TypeDictionary is not in use by a compilation thread
+    * @returns the compilation return code
+    */
+   int32_t compile(TR::MethodBuilder *methodBuilder, void **entry, TR_Hotness hotness = warm);
+
+   /**
+    * @brief wait until no other thread is compiling with types, then claim it for the calling thread
+    * @returns true if types was claimed, false if the calling thread already holds it
+    */
+   bool reserveTypeDictionary(TR::TypeDictionary *types);
+
+   /**
+    * @brief release a TypeDictionary claimed by reserveTypeDictionary()
+    */
+   void releaseTypeDictionary(TR::TypeDictionary *types);
+
+   /**
+    * @brief block until the compilation of methodBuilder completes and retire the request
+    * @returns the compilation return code, or COMPILATION_FAILED if methodBuilder was never requested
+    */
+   int32_t waitForCompilation(TR::MethodBuilder *methodBuilder, void **entry);
+
+   /**
+    * @brief finish all queued compilations and join the compilation threads
+    */
+   void shutdown();
+
+private:
+   struct Request
+      {
+      Request(TR::MethodBuilder *methodBuilder, TR::TypeDictionary *types, TR_Hotness hotness = warm,
+              CompletionCallback callback = NULL, void *callbackData = NULL)
+         : _methodBuilder(methodBuilder), _types(types), _hotness(hotness), _callback(callback),
+           _callbackData(callbackData), _entry(NULL), _rc(0), _done(false)
+         {}
+
+      TR::MethodBuilder  *_methodBuilder;
+      TR::TypeDictionary *_types;
+      TR_Hotness          _hotness;
+      CompletionCallback  _callback;
+      void               *_callbackData;
+      void               *_entry;
+      int32_t             _rc;
+      bool                _done;
+      };
+
+   CompilationService() : _shuttingDown(false) {}
+
+   void compilationThreadLoop(int32_t compThreadID);
+   void startDefaultThreads();
+   Request *nextCompilableRequest();
+
+   std::mutex                                      _mutex;
+   std::condition_variable                         _workAvailable;
+   std::condition_variable                         _compilationDone;
+   std::vector<std::thread>                        _threads;
+   std::deque<Request *>                           _queue;
+   std::map<TR::MethodBuilder *, Request *>        _requests;
+   std::map<TR::TypeDictionary *, std::thread::id> _typeDictionariesInUse;
+   bool                                            _shuttingDown;
+   };
+
+} // namespace JitBuilder
+
+#endif // JITBUILDER_COMPILATIONSERVICE_INCL
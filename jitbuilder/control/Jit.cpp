@@ -24,7 +24,9 @@
 #include "codegen/CodeGenerator.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/Method.hpp"
+#include "control/CompilationService.hpp"
 #include "control/CompileMethod.hpp"
+#include "control/TieredCompilation.hpp"
 #include "env/CompilerEnv.hpp"
 #include "env/FrontEnd.hpp"
 #include "env/IO.hpp"
@@ -35,6 +37,7 @@
 #include "runtime/CodeCache.hpp"
 #include "runtime/Runtime.hpp"
 #include "runtime/JBJitConfig.hpp"
+#include "runtime/PersistentCodeCache.hpp"
 
 #if defined(AIXPPC)
 #include "p/codegen/PPCTableOfConstants.hpp"
@@ -43,6 +46,8 @@
 extern TR_RuntimeHelperTable runtimeHelpers;
 extern void setupCodeCacheParameters(int32_t *, OMR::CodeCacheCodeGenCallbacks *callBacks, int32_t *numHelpers, int32_t *CCPreLoadedCodeSize);
 
+static JitBuilder::PersistentCodeCache *persistentCodeCache = NULL;
+
 static void
 initHelper(void *helper, TR_RuntimeHelper id)
    {
@@ -145,6 +150,13 @@ initializeJitBuilder(TR_RuntimeHelper *helperIDs, void **helperAddresses, int32_
 
    initializeCodeCache(fe.codeCacheManager());
 
+   const char *persistentCodeCacheDir = TR::Options::getCmdLineOptions()->getPersistentCodeCacheDir();
+   if (persistentCodeCacheDir)
+      {
+      persistentCodeCache = new (rawAllocator) JitBuilder::PersistentCodeCache(persistentCodeCacheDir, options);
+      fe.setCompiledBodyCache(persistentCodeCache);
+      }
+
    return true;
    }
 
@@ -166,6 +178,10 @@ initializeJitBuilder(TR_RuntimeHelper *helperIDs, void **helperAddresses, int32_
 // An individual program should link statically against JitBuilder, then call:
 //     initializeJit() or initializeJitWithOptions() to initialize the Jit
 //     compileMethodBuilder() as many times as needed to create compiled code
+//     or compileMethodBuilderAsync() followed by waitForMethodBuilder() to compile
+//        on a pool of compilation threads (sized with startCompilationThreads())
+//     or compileMethodBuilderTiered() to compile at cold and recompile at hot on
+//        the compilation threads once the method has been called often enough
 //     shuwdownJit() when the test is complete
 //
 
@@ -184,10 +200,12 @@ internal_initializeJit()
    return initializeJitBuilder(0, 0, 0, (char *)"-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator");
    }
 
+// Compiles m on the calling thread. compThreadID is 0 for application threads
+// and identifies the compilation thread otherwise.
 int32_t
-internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
+compileJitBuilderMethod(TR::MethodBuilder *m, void **entry, int32_t compThreadID, TR_Hotness hotness)
    {
-   auto rc = m->Compile(entry);
+   auto rc = m->Compile(entry, compThreadID, hotness);
 
 #if defined(AIXPPC)
    struct FunctionDescriptor
@@ -210,11 +228,59 @@ internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
    return rc;
    }
 
+int32_t
+internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
+   {
+   return JitBuilder::CompilationService::instance()->compile(m, entry);
+   }
+
+int32_t
+internal_compileMethodBuilderTiered(TR::MethodBuilder *m, int32_t hotInvocationCount, void **entry)
+   {
+   return JitBuilder::TieredCompilation::instance()->compile(m, hotInvocationCount, entry);
+   }
+
+bool
+internal_waitForTieredRecompilation(TR::MethodBuilder *m)
+   {
+   return JitBuilder::TieredCompilation::instance()->waitForRecompilation(m);
+   }
+
+bool
+internal_startCompilationThreads(int32_t numThreads)
+   {
+   return JitBuilder::CompilationService::instance()->startThreads(numThreads);
+   }
+
+bool
+internal_compileMethodBuilderAsync(TR::MethodBuilder *m)
+   {
+   return JitBuilder::CompilationService::instance()->requestCompilation(m);
+   }
+
+int32_t
+internal_waitForMethodBuilder(TR::MethodBuilder *m, void **entry)
+   {
+   return JitBuilder::CompilationService::instance()->waitForCompilation(m, entry);
+   }
+
 void
 internal_shutdownJit()
    {
+   // compilation threads must be idle before the code caches go away
+   JitBuilder::CompilationService::instance()->shutdown();
+   JitBuilder::TieredCompilation::instance()->shutdown();
+
    auto fe = JitBuilder::FrontEnd::instance();
 
+   if (persistentCodeCache)
+      {
+      fe->setCompiledBodyCache(NULL);
+      persistentCodeCache->~PersistentCodeCache();
+      TR::RawAllocator().deallocate(persistentCodeCache);
+      persistentCodeCache = NULL;
+      }
+
    TR::CodeCacheManager &codeCacheManager = fe->codeCacheManager();
    codeCacheManager.destroy();
 
@@ -0,0 +1,202 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+#include <atomic>
+#include "compile/Compilation.hpp"
+#include "control/CompilationService.hpp"
+#include "control/TieredCompilation.hpp"
+#include "ilgen/MethodBuilder.hpp"
+#include "ilgen/TypeDictionary.hpp"
+#include "runtime/CodeCache.hpp"
+#include "runtime/CodeCacheManager.hpp"
+
+extern int32_t compileJitBuilderMethod(TR::MethodBuilder *m, void **entry, int32_t compThreadID, TR_Hotness hotness);
+
+// name under which counterTripped is defined in every tiered MethodBuilder
+static const char * const COUNTER_TRIP_FUNCTION = "omrTieredCompilationCounterTripped";
+
+JitBuilder::TieredCompilation *
+JitBuilder::TieredCompilation::instance()
+   {
+   static TieredCompilation tieredCompilation;
+   return &tieredCompilation;
+   }
+
+int32_t
+JitBuilder::TieredCompilation::compile(TR::MethodBuilder *methodBuilder, int32_t hotInvocationCount, void **entry)
+   {
+   CompilationService *service = CompilationService::instance();
+
+#if defined(TR_TARGET_X86) && defined(TR_TARGET_64BIT)
+   if (hotInvocationCount < 1)
+      hotInvocationCount = 1;
+
+   TieredMethod *method = new TieredMethod(methodBuilder, hotInvocationCount);
+   TR::TypeDictionary *types = methodBuilder->typeDictionary();
+
+   // a hot recompilation of this MethodBuilder may be running on a compilation
+   // thread, so the counter can only be requested once the TypeDictionary is ours
+   bool reserved = service->reserveTypeDictionary(types);
+   methodBuilder->DefineFunction(COUNTER_TRIP_FUNCTION, __FILE__, "0", (void *)&counterTripped, types->NoType, 1, types->Address);
+   methodBuilder->setInvocationCounter(&method->_count, COUNTER_TRIP_FUNCTION);
+
+   void *coldEntry = NULL;
+   int32_t rc = compileJitBuilderMethod(methodBuilder, &coldEntry, 0, cold);
+
+   if (reserved)
+      service->releaseTypeDictionary(types);
+
+   if (rc != COMPILATION_SUCCEEDED)
+      {
+      delete method;
+      return rc;
+      }
+
+   std::lock_guard<std::mutex> lock(_mutex);
+   void *trampoline = createTrampoline(coldEntry, &method->_target);
+   if (trampoline == NULL)
+      {
+      // nothing can be patched, so the method stays in its cold body
+      method->_state = RecompilationFailed;
+      trampoline = coldEntry;
+      }
+
+   _methods[methodBuilder] = method;
+   _allMethods.push_back(method);
+   *entry = trampoline;
+
+   return rc;
+#else
+   return service->compile(methodBuilder, entry);
+#endif
+   }
+
+bool
+JitBuilder::TieredCompilation::waitForRecompilation(TR::MethodBuilder *methodBuilder)
+   {
+   std::unique_lock<std::mutex> lock(_mutex);
+   auto it = _methods.find(methodBuilder);
+   if (it == _methods.end())
+      return false;
+
+   TieredMethod *method = it->second;
+   while (method->_state == Recompiling)
+      _recompilationDone.wait(lock);
+
+   return method->_state == Recompiled;
+   }
+
+void
+JitBuilder::TieredCompilation::shutdown()
+   {
+   std::lock_guard<std::mutex> lock(_mutex);
+   for (auto it = _allMethods.begin(); it != _allMethods.end(); ++it)
+      delete *it;
+   _allMethods.clear();
+   _methods.clear();
+   }
+
+// Called from a cold body on the invocation that brings its counter to zero.
+void
+JitBuilder::TieredCompilation::counterTripped(int32_t *count)
+   {
+   instance()->requestRecompilation(reinterpret_cast<TieredMethod *>(count));
+   }
+
+void
+JitBuilder::TieredCompilation::requestRecompilation(TieredMethod *method)
+   {
+      {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (method->_state != Counting)
+         return;
+      method->_state = Recompiling;
+      }
+
+   if (!CompilationService::instance()->requestCompilation(method->_methodBuilder, hot, recompilationDone, method))
+      {
+      std::lock_guard<std::mutex> lock(_mutex);
+      method->_state = RecompilationFailed;
+      _recompilationDone.notify_all();
+      }
+   }
+
+// Called on the compilation thread once the hot compile has finished.
+void
+JitBuilder::TieredCompilation::recompilationDone(TR::MethodBuilder *methodBuilder, void *entry, int32_t rc, void *data)
+   {
+   TieredMethod *method = static_cast<TieredMethod *>(data);
+   TieredCompilation *tieredCompilation = instance();
+
+   std::lock_guard<std::mutex> lock(tieredCompilation->_mutex);
+   if (rc == COMPILATION_SUCCEEDED && entry != NULL)
+      {
+      // the hot body must be complete before any thread can jump to it
+      std::atomic_thread_fence(std::memory_order_release);
+      *method->_target = entry;
+      method->_state = Recompiled;
+      }
+   else
+      {
+      method->_state = RecompilationFailed;
+      }
+
+   tieredCompilation->_recompilationDone.notify_all();
+   }
+
+// Returns a trampoline that jumps to target through *targetSlot, or NULL if
+// trampolines are not supported or there is no room for one in the code cache.
+void *
+JitBuilder::TieredCompilation::createTrampoline(void *target, void * volatile **targetSlot)
+   {
+#if defined(TR_TARGET_X86) && defined(TR_TARGET_64BIT)
+   // jmp qword ptr [rip+disp32] to a pointer-aligned slot, which a single
+   // store can then update while other threads are going through it
+   const size_t jumpSize = 6;
+   const size_t trampolineSize = jumpSize + sizeof(void *) - 1 + sizeof(void *);
+
+   TR::CodeCacheManager *manager = TR::CodeCacheManager::instance();
+   int32_t numReserved = 0;
+   TR::CodeCache *codeCache = manager->reserveCodeCache(false, trampolineSize, 0, &numReserved);
+   if (codeCache == NULL)
+      return NULL;
+
+   uint8_t *coldCode = NULL;
+   uint8_t *start = manager->allocateCodeMemory(trampolineSize, 0, &codeCache, &coldCode, false, false);
+   manager->unreserveCodeCache(codeCache);
+   if (start == NULL)
+      return NULL;
+
+   uint8_t *slot = (uint8_t *)(((uintptr_t)start + jumpSize + sizeof(void *) - 1) & ~(uintptr_t)(sizeof(void *) - 1));
+   start[0] = 0xFF;
+   start[1] = 0x25;
+   *(int32_t *)(start + 2) = (int32_t)(slot - (start + jumpSize));
+   memset(start + jumpSize, 0xCC, slot - (start + jumpSize));
+   *(void **)slot = target;
+
+   *targetSlot = (void * volatile *)slot;
+   return start;
+#else
+   return NULL;
+#endif
+   }
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef JITBUILDER_TIEREDCOMPILATION_INCL
+#define JITBUILDER_TIEREDCOMPILATION_INCL
+
+#include <stdint.h>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace TR { class MethodBuilder; }
+
+namespace JitBuilder
+{
+
+/**
+ * @brief Compiles MethodBuilders in two tiers: quickly at cold, then at hot once they are used.
+ *
+ * A tiered MethodBuilder is first compiled at cold with an invocation counter
+ * at its entry, and callers are handed a small trampoline that jumps through a
+ * patchable target slot to the cold body. When the counter reaches zero the
+ * MethodBuilder is queued for a hot compile on the CompilationService, and the
+ * compilation thread points the trampoline at the hot body once it is ready.
+ *
+ * The MethodBuilder must stay alive until shutdownJit(), since any call to the
+ * cold body may trigger its recompilation.
+ *
+ * Cold bodies are never freed, so threads already running one finish in it.
+ * Recursive calls made by a cold body target that body directly and only
+ * reach the hot body on the next call through the trampoline.
+ *
+ * Trampolines are only generated for x86-64; on other targets compile() falls
+ * back to a single compile at the default optimization level.
+ */
+class TieredCompilation
+   {
+public:
+   static TieredCompilation *instance();
+
+   /**
+    * @brief compile methodBuilder at cold and recompile it at hot after hotInvocationCount invocations
+    * @returns the compilation return code of the cold compile; entry is the address callers should use
+    */
+   int32_t compile(TR::MethodBuilder *methodBuilder, int32_t hotInvocationCount, void **entry);
+
+   /**
+    * @brief block until a triggered hot recompilation of methodBuilder has finished
+    * @returns true if the hot body is installed, false if it failed or has not been triggered
+    */
+   bool waitForRecompilation(TR::MethodBuilder *methodBuilder);
+
+   /**
+    * @brief release all tiered methods; compilations must have been drained first
+    */
+   void shutdown();
+
+private:
+   enum State
+      {
+      Counting,
+      Recompiling,
+      Recompiled,
+      RecompilationFailed
+      };
+
+   struct TieredMethod
+      {
+      TieredMethod(TR::MethodBuilder *methodBuilder, int32_t hotInvocationCount)
+         : _count(hotInvocationCount), _methodBuilder(methodBuilder), _target(NULL), _state(Counting)
+         {}
+
+      int32_t             _count; // must stay first: the counter trip function is passed its address
+      TR::MethodBuilder  *_methodBuilder;
+      void * volatile    *_target;
+      State               _state;
+      };
+
+   TieredCompilation() {}
+
+   static void counterTripped(int32_t *count);
+   static void recompilationDone(TR::MethodBuilder *methodBuilder, void *entry, int32_t rc, void *data);
+
+   void requestRecompilation(TieredMethod *method);
+   void *createTrampoline(void *target, void * volatile **targetSlot);
+
+   std::mutex                                      _mutex;
+   std::condition_variable                         _recompilationDone;
+   std::map<TR::MethodBuilder *, TieredMethod *>   _methods;
+   std::vector<TieredMethod *>                     _allMethods;
+   };
+
+} // namespace JitBuilder
+
+#endif // JITBUILDER_TIEREDCOMPILATION_INCL
@@ -55,6 +55,7 @@
 #include "optimizer/LoopCanonicalizer.hpp"
 #include "optimizer/LoopReducer.hpp"
 #include "optimizer/LoopReplicator.hpp"
+#include "optimizer/LoopVectorizer.hpp"
 #include "optimizer/LoopVersioner.hpp"
 #include "optimizer/OrderBlocks.hpp"
 #include "optimizer/PartialRedundancy.hpp"
@@ -126,7 +127,9 @@ static const OptimizationStrategy JBwarmStrategyOpts[] =
 
    { OMR::basicBlockOrdering,                        OMR::IfLoops                  }, // clean up block order for loop canonicalization, if it will run
    { OMR::loopCanonicalization,                      OMR::IfLoops                  }, // canonicalization must run before inductionVariableAnalysis else indvar data gets messed up
-   { OMR::inductionVariableAnalysis,                 OMR::IfLoops                  }, // needed for loop unroller
+   { OMR::inductionVariableAnalysis,                 OMR::IfLoops                  }, // needed for loop vectorizer and unroller
+   { OMR::loopVectorization,                         OMR::IfLoops                  },
+   { OMR::inductionVariableAnalysis,                 OMR::IfEnabled                }, // vectorized loops need their induction variables rediscovered
    { OMR::generalLoopUnroller,                       OMR::IfLoops                  },
    { OMR::basicBlockExtension,                       OMR::MarkLastRun              }, // clean up order and extend blocks now
    { OMR::treeSimplification                                                       },
@@ -187,6 +190,8 @@ Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *methodSymb
       new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopCanonicalizer::create, OMR::loopCanonicalization);
    _opts[OMR::inductionVariableAnalysis] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR_InductionVariableAnalysis::create, OMR::inductionVariableAnalysis);
+   _opts[OMR::loopVectorization] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopVectorizer::create, OMR::loopVectorization);
    _opts[OMR::liveRangeSplitter] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR_LiveRangeSplitter::create, OMR::liveRangeSplitter);
    _opts[OMR::tacticalGlobalRegisterAllocator] =
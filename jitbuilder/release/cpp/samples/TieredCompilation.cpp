@@ -0,0 +1,236 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+// Compares a single warm compile with tiered compilation on the MethodBuilders
+// from the IterativeFib, MatMult and Mandelbrot samples. The samples are built
+// into this program with their main() functions renamed (see the Makefile).
+//
+// For each method and mode it reports:
+//    compile   time until the first entry point can be called
+//    startup   average time per call over the first <hotInvocationCount> calls
+//    peak      average time per call once the method has reached its final body
+//    total     wall time for all calls, including compiles and any wait for the hot body
+//
+// The modes are:
+//    warm      compileMethodBuilder(): one compile at the default (warm) level
+//    tiered    compileMethodBuilderTiered(): cold first, hot in the background
+//    hot       tiered with a count of 1, waiting for the hot body before starting
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <chrono>
+#include <vector>
+
+#include "IterativeFib.hpp"
+#include "Mandelbrot.hpp"
+#include "MatMult.hpp"
+
+typedef std::chrono::steady_clock Clock;
+
+static double
+elapsedMicros(Clock::time_point start, Clock::time_point end)
+   {
+   return std::chrono::duration<double, std::micro>(end - start).count();
+   }
+
+class Workload
+   {
+   public:
+   virtual ~Workload() {}
+   virtual const char *name() = 0;
+   virtual int32_t peakCalls() = 0;
+   virtual OMR::JitBuilder::MethodBuilder *createBuilder(OMR::JitBuilder::TypeDictionary *types) = 0;
+   virtual void invoke(void *entry) = 0;
+   };
+
+class IterativeFibWorkload : public Workload
+   {
+   public:
+   IterativeFibWorkload() : _sink(0) {}
+   const char *name() { return "iterfib"; }
+   int32_t peakCalls() { return 200000; }
+   OMR::JitBuilder::MethodBuilder *createBuilder(OMR::JitBuilder::TypeDictionary *types) { return new IterativeFibonnaciMethod(types); }
+   void invoke(void *entry) { _sink += ((IterativeFibFunctionType *)entry)(40); }
+
+   private:
+   volatile int32_t _sink;
+   };
+
+class MatMultWorkload : public Workload
+   {
+   public:
+   MatMultWorkload()
+      {
+      for (int32_t i=0;i < N*N;i++)
+         {
+         _A[i] = 1.0;
+         _B[i] = (double)(i % N);
+         _C[i] = 0.0;
+         }
+      }
+   const char *name() { return "matmult"; }
+   int32_t peakCalls() { return 2000; }
+   OMR::JitBuilder::MethodBuilder *createBuilder(OMR::JitBuilder::TypeDictionary *types) { return new MatMult(types); }
+   void invoke(void *entry) { ((MatMultFunctionType *)entry)(_C, _A, _B, N); }
+
+   private:
+   static const int32_t N = 32;
+   double _A[N*N];
+   double _B[N*N];
+   double _C[N*N];
+   };
+
+class MandelbrotWorkload : public Workload
+   {
+   public:
+   const char *name() { return "mandelbrot"; }
+   int32_t peakCalls() { return 500; }
+   OMR::JitBuilder::MethodBuilder *createBuilder(OMR::JitBuilder::TypeDictionary *types) { return new MandelbrotMethod(types); }
+   void invoke(void *entry) { ((MandelbrotFunctionType *)entry)(N, _buffer, _cr0); }
+
+   private:
+   static const int32_t N = 64;
+   uint8_t _buffer[N*N];
+   double _cr0[8*N];
+   };
+
+enum Mode
+   {
+   Warm,
+   Tiered,
+   Hot
+   };
+
+static const char *modeNames[] = { "warm", "tiered", "hot" };
+
+// builders and their types must stay alive until shutdownJit(), since a cold body may still trigger a recompilation
+static std::vector<OMR::JitBuilder::MethodBuilder *> builders;
+static std::vector<OMR::JitBuilder::TypeDictionary *> typeDictionaries;
+
+static void
+measure(Workload *workload, Mode mode, int32_t hotInvocationCount)
+   {
+   OMR::JitBuilder::TypeDictionary *types = new OMR::JitBuilder::TypeDictionary();
+   OMR::JitBuilder::MethodBuilder *builder = workload->createBuilder(types);
+   typeDictionaries.push_back(types);
+   builders.push_back(builder);
+
+   Clock::time_point start = Clock::now();
+
+   void *entry = 0;
+   int32_t rc;
+   if (mode == Warm)
+      rc = compileMethodBuilder(builder, &entry);
+   else
+      rc = compileMethodBuilderTiered(builder, (mode == Hot) ? 1 : hotInvocationCount, &entry);
+   if (rc != 0)
+      {
+      fprintf(stderr,"FAIL: compilation error %d\n", rc);
+      exit(-2);
+      }
+
+   if (mode == Hot)
+      {
+      workload->invoke(entry);
+      if (!waitForTieredRecompilation(builder))
+         {
+         fprintf(stderr,"FAIL: hot recompilation of %s failed\n", workload->name());
+         exit(-2);
+         }
+      }
+
+   Clock::time_point compiled = Clock::now();
+
+   for (int32_t i=0;i < hotInvocationCount;i++)
+      workload->invoke(entry);
+
+   Clock::time_point startupDone = Clock::now();
+
+   // the hot compile normally finishes while the startup calls run, so this rarely waits
+   if (mode == Tiered && !waitForTieredRecompilation(builder))
+      {
+      fprintf(stderr,"FAIL: hot recompilation of %s failed\n", workload->name());
+      exit(-2);
+      }
+
+   Clock::time_point peakStart = Clock::now();
+
+   int32_t peakCalls = workload->peakCalls();
+   for (int32_t i=0;i < peakCalls;i++)
+      workload->invoke(entry);
+
+   Clock::time_point end = Clock::now();
+
+   printf("%-12s %-8s %12.2f %14.3f %14.3f %12.2f\n",
+          workload->name(),
+          modeNames[mode],
+          elapsedMicros(start, compiled) / 1000.0,
+          elapsedMicros(compiled, startupDone) / hotInvocationCount,
+          elapsedMicros(peakStart, end) / peakCalls,
+          elapsedMicros(start, end) / 1000.0);
+   }
+
+int
+main(int argc, char *argv[])
+   {
+   const int32_t hotInvocationCount = (argc > 1) ? atoi(argv[1]) : 100;
+   if (hotInvocationCount < 1)
+      {
+      fprintf(stderr, "Usage: tieredcompilation [hot invocation count]\n");
+      exit(-1);
+      }
+
+   printf("Step 1: initialize JIT\n");
+   bool initialized = initializeJit();
+   if (!initialized)
+      {
+      fprintf(stderr, "FAIL: could not initialize JIT\n");
+      exit(-1);
+      }
+
+   printf("Step 2: compile and run each method, recompiling at hot after %d invocations\n\n", hotInvocationCount);
+   printf("%-12s %-8s %12s %14s %14s %12s\n", "method", "mode", "compile(ms)", "startup(us)", "peak(us)", "total(ms)");
+
+   IterativeFibWorkload iterativeFib;
+   MatMultWorkload matMult;
+   MandelbrotWorkload mandelbrot;
+   Workload *workloads[] = { &iterativeFib, &matMult, &mandelbrot };
+
+   for (int32_t w=0;w < 3;w++)
+      {
+      measure(workloads[w], Warm, hotInvocationCount);
+      measure(workloads[w], Tiered, hotInvocationCount);
+      measure(workloads[w], Hot, hotInvocationCount);
+      }
+
+   printf("\nStep 3: shutdown JIT\n");
+   shutdownJit();
+
+   for (size_t b=0;b < builders.size();b++)
+      {
+      delete builders[b];
+      delete typeDictionaries[b];
+      }
+
+   printf("PASS\n");
+   }
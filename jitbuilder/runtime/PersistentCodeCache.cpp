@@ -0,0 +1,439 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#if defined(OMR_OS_WINDOWS)
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif /* OMR_OS_WINDOWS */
+#include "codegen/CodeGenerator.hpp"
+#include "codegen/StaticRelocation.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "env/CompilerEnv.hpp"
+#include "il/Block.hpp"
+#include "il/MethodSymbol.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/StaticSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "runtime/PersistentCodeCache.hpp"
+
+// Bump whenever the file layout or the contents of the key change
+static const uint32_t PERSISTENT_CODE_CACHE_VERSION = 2;
+static const char PERSISTENT_CODE_CACHE_MAGIC[8] = { 'O', 'M', 'R', 'J', 'B', 'C', 'C', '\0' };
+
+struct PersistentBodyHeader
+   {
+   char     _magic[8];
+   uint32_t _version;
+   uint32_t _codeSize;
+   uint64_t _key;
+   uint32_t _entryOffset;
+   uint32_t _numRelocations;
+   };
+
+struct PersistentRelocation
+   {
+   uint32_t    _offset;
+   std::string _symbol;
+   };
+
+// 64-bit FNV-1a, used both for cache keys and for the checksum that ends every body file
+class KeyHasher
+   {
+public:
+   KeyHasher() : _hash(UINT64_C(14695981039346656037)) {}
+
+   void addBytes(const void *data, size_t size)
+      {
+      const uint8_t *bytes = static_cast<const uint8_t *>(data);
+      for (size_t i = 0; i < size; i++)
+         {
+         _hash ^= bytes[i];
+         _hash *= UINT64_C(1099511628211);
+         }
+      }
+
+   template <typename T> void add(T value) { addBytes(&value, sizeof(value)); }
+
+   void addString(const char *string)
+      {
+      size_t length = strlen(string);
+      add(length);
+      addBytes(string, length);
+      }
+
+   uint64_t value() const { return _hash; }
+
+private:
+   uint64_t _hash;
+   };
+
+// A call target that is itself a MethodBuilder can be inlined by the optimizer,
+// which would pull IL into the body that the key does not cover. Only calls
+// back into the method being compiled are safe in that case.
+static bool
+isCacheableCallTarget(TR::Compilation *comp, TR::ResolvedMethodSymbol *callee)
+   {
+   TR_ResolvedMethod *method = callee->getResolvedMethod();
+   if (method->isSameMethod(comp->getCurrentMethod()))
+      return true;
+   return method->resolvedMethodAddress() == NULL && callee->getMethodAddress() != NULL;
+   }
+
+static bool
+hashSymbolReference(TR::Compilation *comp, KeyHasher &hasher, TR::SymbolReference *symRef)
+   {
+   TR::Symbol *sym = symRef->getSymbol();
+   hasher.add(symRef->getReferenceNumber());
+   hasher.add(static_cast<int64_t>(symRef->getOffset()));
+   hasher.add(sym->getFlags());
+   hasher.add(static_cast<uint32_t>(sym->getDataType().getDataType()));
+   hasher.add(static_cast<uint64_t>(sym->getSize()));
+
+   if (sym->isStatic())
+      {
+      // static addresses are embedded as is, so they have to match exactly
+      hasher.add(sym->castToStaticSymbol()->getStaticAddress());
+      }
+   else if (sym->isMethod())
+      {
+      TR::ResolvedMethodSymbol *callee = sym->getResolvedMethodSymbol();
+      if (sym->castToMethodSymbol()->isHelper() || callee == NULL || !isCacheableCallTarget(comp, callee))
+         return false;
+
+      // function addresses are relocated by name when the body is loaded
+      hasher.addString(callee->getResolvedMethod()->externalName(comp->trMemory()));
+      }
+
+   return true;
+   }
+
+static bool
+hashNode(TR::Compilation *comp, KeyHasher &hasher, TR::Node *node, vcount_t visitCount)
+   {
+   hasher.add(node->getGlobalIndex());
+   if (node->getVisitCount() == visitCount)
+      return true;
+   node->setVisitCount(visitCount);
+
+   TR::ILOpCode &op = node->getOpCode();
+
+   // jump tables hold absolute label addresses that no relocation describes
+   if (node->getOpCodeValue() == TR::table)
+      return false;
+
+   hasher.add(static_cast<uint32_t>(node->getOpCodeValue()));
+   hasher.add(static_cast<uint32_t>(node->getDataType().getDataType()));
+   hasher.add(node->getFlags().getValue());
+   hasher.add(node->getNumChildren());
+
+   if (op.isLoadConst())
+      {
+      switch (node->getDataType())
+         {
+         case TR::Int8:
+         case TR::Int16:
+         case TR::Int32:
+         case TR::Int64:
+            hasher.add(node->getConstValue());
+            break;
+         case TR::Float:
+            hasher.add(node->getFloatBits());
+            break;
+         case TR::Double:
+            hasher.add(node->getDoubleBits());
+            break;
+         case TR::Address:
+            hasher.add(node->getAddress());
+            break;
+         default:
+            return false;
+         }
+      }
+
+   if (op.isCase())
+      hasher.add(node->getCaseConstant());
+
+   if (node->getOpCodeValue() == TR::BBStart)
+      {
+      TR::Block *block = node->getBlock();
+      hasher.add(block->getNumber());
+      hasher.add(block->getFrequency());
+      hasher.add(block->isCold());
+      }
+
+   if (op.isBranch() || op.isCase())
+      hasher.add(node->getBranchDestination()->getNode()->getBlock()->getNumber());
+
+   if (op.hasSymbolReference() && node->getSymbolReference() != NULL)
+      {
+      if (!hashSymbolReference(comp, hasher, node->getSymbolReference()))
+         return false;
+      }
+
+   for (int32_t c = 0; c < node->getNumChildren(); c++)
+      {
+      if (!hashNode(comp, hasher, node->getChild(c), visitCount))
+         return false;
+      }
+
+   return true;
+   }
+
+static void *
+findFunctionAddress(TR::Compilation *comp, const char *name)
+   {
+   TR::SymbolReferenceTable *symRefTab = comp->getSymRefTab();
+   for (int32_t i = symRefTab->getNumHelperSymbols(); i < symRefTab->getNumSymRefs(); i++)
+      {
+      TR::SymbolReference *symRef = symRefTab->getSymRef(i);
+      if (symRef == NULL || !symRef->getSymbol()->isMethod())
+         continue;
+
+      TR::ResolvedMethodSymbol *callee = symRef->getSymbol()->getResolvedMethodSymbol();
+      if (callee != NULL && !strcmp(callee->getResolvedMethod()->externalName(comp->trMemory()), name))
+         return callee->getMethodAddress();
+      }
+   return NULL;
+   }
+
+JitBuilder::PersistentCodeCache::PersistentCodeCache(const char *directory, const char *options)
+   : _directory(directory),
+     _options(options ? options : "")
+   {
+   }
+
+std::string
+JitBuilder::PersistentCodeCache::bodyFileName(uint64_t key)
+   {
+   char name[32];
+   snprintf(name, sizeof(name), "/%016llx.jbc", static_cast<unsigned long long>(key));
+   return _directory + name;
+   }
+
+bool
+JitBuilder::PersistentCodeCache::computeKey(TR::Compilation *comp, uint64_t &key)
+   {
+#if defined(TR_TARGET_X86) && defined(TR_TARGET_64BIT)
+   KeyHasher hasher;
+   hasher.add(PERSISTENT_CODE_CACHE_VERSION);
+   hasher.addString(_options.c_str());
+
+   OMRProcessorDesc processor = comp->target().cpu.getProcessorDescription();
+   hasher.add(static_cast<uint32_t>(processor.processor));
+   hasher.add(static_cast<uint32_t>(processor.physicalProcessor));
+   hasher.addBytes(processor.features, sizeof(processor.features));
+
+   hasher.add(static_cast<int32_t>(comp->getMethodHotness()));
+   hasher.addString(comp->signature());
+
+   vcount_t visitCount = comp->incVisitCount();
+   for (TR::TreeTop *tt = comp->getStartTree(); tt; tt = tt->getNextTreeTop())
+      {
+      if (!hashNode(comp, hasher, tt->getNode(), visitCount))
+         return false;
+      }
+
+   key = hasher.value();
+   return true;
+#else
+   // only the x86-64 code generator describes every embedded function address
+   // with a static relocation
+   return false;
+#endif
+   }
+
+static bool
+readFile(const std::string &fileName, std::vector<uint8_t> &contents)
+   {
+   FILE *file = fopen(fileName.c_str(), "rb");
+   if (file == NULL)
+      return false;
+
+   long size = -1;
+   if (fseek(file, 0, SEEK_END) == 0)
+      size = ftell(file);
+   bool read = size > 0 && fseek(file, 0, SEEK_SET) == 0;
+   if (read)
+      {
+      contents.resize(static_cast<size_t>(size));
+      read = fread(&contents[0], 1, contents.size(), file) == contents.size();
+      }
+   fclose(file);
+   return read;
+   }
+
+uint8_t *
+JitBuilder::PersistentCodeCache::load(TR::Compilation *comp, uint64_t key)
+   {
+   std::vector<uint8_t> contents;
+   if (!readFile(bodyFileName(key), contents))
+      return NULL;
+
+   // a body is only trusted if the checksum at its end matches everything before it
+   PersistentBodyHeader header;
+   uint64_t checksum;
+   if (contents.size() < sizeof(header) + sizeof(checksum))
+      return NULL;
+   size_t checkedSize = contents.size() - sizeof(checksum);
+   memcpy(&checksum, &contents[checkedSize], sizeof(checksum));
+   KeyHasher hasher;
+   hasher.addBytes(&contents[0], checkedSize);
+   if (hasher.value() != checksum)
+      return NULL;
+
+   memcpy(&header, &contents[0], sizeof(header));
+   if (memcmp(header._magic, PERSISTENT_CODE_CACHE_MAGIC, sizeof(header._magic))
+       || header._version != PERSISTENT_CODE_CACHE_VERSION
+       || header._key != key
+       || header._codeSize < sizeof(uintptr_t)
+       || header._codeSize > checkedSize - sizeof(header)
+       || header._entryOffset >= header._codeSize)
+      return NULL;
+
+   size_t cursor = sizeof(header) + header._codeSize;
+   std::vector<PersistentRelocation> relocations;
+   for (uint32_t r = 0; r < header._numRelocations; r++)
+      {
+      uint32_t fields[2];
+      if (checkedSize - cursor < sizeof(fields))
+         return NULL;
+      memcpy(fields, &contents[cursor], sizeof(fields));
+      cursor += sizeof(fields);
+
+      // the relocated word has to lie entirely inside the code
+      if (static_cast<uint64_t>(fields[0]) + sizeof(uintptr_t) > header._codeSize
+          || fields[1] > checkedSize - cursor)
+         return NULL;
+
+      PersistentRelocation relocation;
+      relocation._offset = fields[0];
+      relocation._symbol.assign(reinterpret_cast<const char *>(&contents[cursor]), fields[1]);
+      cursor += fields[1];
+      relocations.push_back(relocation);
+      }
+   if (cursor != checkedSize)
+      return NULL;
+
+   std::vector<void *> targets;
+   for (auto it = relocations.begin(); it != relocations.end(); ++it)
+      {
+      void *target = findFunctionAddress(comp, it->_symbol.c_str());
+      if (target == NULL)
+         return NULL;
+      targets.push_back(target);
+      }
+
+   TR::CodeGenerator *cg = comp->cg();
+   cg->reserveCodeCache();
+   uint8_t *start = cg->allocateCodeMemory(header._codeSize, false);
+   memcpy(start, &contents[sizeof(header)], header._codeSize);
+   for (size_t r = 0; r < relocations.size(); r++)
+      {
+      uintptr_t target = reinterpret_cast<uintptr_t>(targets[r]);
+      memcpy(start + relocations[r]._offset, &target, sizeof(target));
+      }
+
+   cg->setBinaryBufferStart(start);
+   cg->setBinaryBufferCursor(start + header._codeSize);
+
+   return start + header._entryOffset;
+   }
+
+void
+JitBuilder::PersistentCodeCache::store(TR::Compilation *comp, uint64_t key)
+   {
+   // calls to runtime helpers are not described by static relocations
+   TR::SymbolReferenceTable *symRefTab = comp->getSymRefTab();
+   for (int32_t i = 0; i < symRefTab->getNumHelperSymbols(); i++)
+      {
+      if (symRefTab->getSymRef(i) != NULL)
+         return;
+      }
+
+   TR::CodeGenerator *cg = comp->cg();
+   uint8_t *start = cg->getBinaryBufferStart();
+   uint8_t *end = cg->getCodeEnd();
+
+   PersistentBodyHeader header;
+   memcpy(header._magic, PERSISTENT_CODE_CACHE_MAGIC, sizeof(header._magic));
+   header._version = PERSISTENT_CODE_CACHE_VERSION;
+   header._codeSize = static_cast<uint32_t>(end - start);
+   header._key = key;
+   header._entryOffset = static_cast<uint32_t>(cg->getCodeStart() - start);
+   header._numRelocations = 0;
+
+   auto &relocations = cg->getStaticRelocations();
+   for (auto it = relocations.begin(); it != relocations.end(); ++it)
+      {
+      if (it->type() != TR::StaticRelocationType::Absolute
+          || it->size() != TR::StaticRelocationSize::word64
+          || it->location() < start
+          || it->location() + sizeof(uintptr_t) > end)
+         return;
+      header._numRelocations++;
+      }
+
+   std::vector<uint8_t> contents(reinterpret_cast<uint8_t *>(&header), reinterpret_cast<uint8_t *>(&header + 1));
+   contents.insert(contents.end(), start, end);
+   for (auto it = relocations.begin(); it != relocations.end(); ++it)
+      {
+      uint32_t fields[2];
+      fields[0] = static_cast<uint32_t>(it->location() - start);
+      fields[1] = static_cast<uint32_t>(strlen(it->symbol()));
+      contents.insert(contents.end(), reinterpret_cast<uint8_t *>(fields), reinterpret_cast<uint8_t *>(fields + 2));
+      contents.insert(contents.end(), it->symbol(), it->symbol() + fields[1]);
+      }
+
+   KeyHasher hasher;
+   hasher.addBytes(&contents[0], contents.size());
+   uint64_t checksum = hasher.value();
+
+   // write to a private file first so concurrent compilations and processes
+   // never observe a partially written body
+   std::string fileName = bodyFileName(key);
+   char suffix[64];
+   snprintf(suffix, sizeof(suffix), ".%d.%p.tmp", static_cast<int>(getpid()), static_cast<void *>(comp));
+   std::string tempFileName = fileName + suffix;
+
+   FILE *file = fopen(tempFileName.c_str(), "wb");
+   if (file == NULL)
+      return;
+
+   bool written = fwrite(&contents[0], 1, contents.size(), file) == contents.size()
+               && fwrite(&checksum, sizeof(checksum), 1, file) == 1;
+   written = (fclose(file) == 0) && written;
+
+   if (!written || rename(tempFileName.c_str(), fileName.c_str()) != 0)
+      remove(tempFileName.c_str());
+   }
@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef JITBUILDER_PERSISTENTCODECACHE_INCL
+#define JITBUILDER_PERSISTENTCODECACHE_INCL
+
+#include <stdint.h>
+#include <string>
+#include "runtime/CompiledBodyCache.hpp"
+
+namespace TR { class Compilation; }
+
+namespace JitBuilder
+{
+
+/**
+ * @brief Stores compiled JitBuilder methods in a directory so later runs can
+ *        reuse them instead of compiling again.
+ *
+ * A body is keyed by a hash of the IL the MethodBuilder generated, the JIT
+ * option string and the processor description, so a body is only reused when
+ * the builder, the compiler configuration and the machine all match. Each body
+ * is kept in its own file named after the key, together with the static
+ * relocations for the function addresses it calls. Those relocations are
+ * resolved against the functions defined by the requesting MethodBuilder when
+ * the body is installed into the code cache. The file ends with a checksum of
+ * its contents, and a body that fails the checksum or any bounds check is
+ * compiled again instead of being installed.
+ */
+class PersistentCodeCache : public TR::CompiledBodyCache
+   {
+public:
+   PersistentCodeCache(const char *directory, const char *options);
+
+   virtual bool computeKey(TR::Compilation *comp, uint64_t &key);
+   virtual uint8_t *load(TR::Compilation *comp, uint64_t key);
+   virtual void store(TR::Compilation *comp, uint64_t key);
+
+private:
+   std::string bodyFileName(uint64_t key);
+
+   std::string _directory;
+   std::string _options;
+   };
+
+} // namespace JitBuilder
+
+#endif // JITBUILDER_PERSISTENTCODECACHE_INCL
@@ -37,10 +37,13 @@ const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
 const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
 const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
 const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
+/* exclusive pauses in which the last collection started was a scavenge (for a Concurrent Scavenge, its first or final increment) */
+const char* XPATH_GET_ALL_SCAVENGE_PAUSE_TIME = "/verbosegc/exclusive-end[preceding-sibling::gc-start[1][@type='scavenge']]";
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
 
 double getAvg(std::vector<double> v);
+double getPercentile(std::vector<double> &sorted, double percentile);
 void analyze(char* fileName, OMRPortLibrary portLibrary);
 
 int main(void)
@@ -102,6 +105,17 @@ getAvg(std::vector<double> v)
 	return avg;
 }
 
+double
+getPercentile(std::vector<double> &sorted, double percentile)
+{
+	/* nearest rank */
+	size_t rank = (size_t)((percentile / 100.0) * sorted.size() + 0.5);
+	if (0 < rank) {
+		rank -= 1;
+	}
+	return sorted[std::min(rank, sorted.size() - 1)];
+}
+
 void
 analyze(char* fileName, OMRPortLibrary portLibrary)
 {
@@ -109,11 +123,13 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	std::vector<double> sweep_values;
 	std::vector<double> expand_values;
 	std::vector<double> gcduration_values;
+	std::vector<double> scavengepause_values;
 
 	pugi::xpath_node_set markTimes;
 	pugi::xpath_node_set sweepTimes;
 	pugi::xpath_node_set expandTimes;
 	pugi::xpath_node_set gcTimes;
+	pugi::xpath_node_set scavengePauseTimes;
 
 	double maxMark = 0;
 	double minMark = 0;
@@ -170,6 +186,13 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	    gcduration_values.push_back(value);
 	}
 
+	scavengePauseTimes = doc.select_nodes(XPATH_GET_ALL_SCAVENGE_PAUSE_TIME);
+	for (pugi::xpath_node_set::const_iterator it = scavengePauseTimes.begin(); it != scavengePauseTimes.end(); ++it) {
+	    pugi::xpath_node node = *it;
+	    double value = node.node().attribute("durationms").as_double();
+	    scavengepause_values.push_back(value);
+	}
+
 	if (!mark_values.empty()) {
 		maxMark = *std::max_element(mark_values.begin(), mark_values.end());
 		minMark = *std::min_element(mark_values.begin(), mark_values.end());
@@ -204,4 +227,15 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 
 	omrtty_printf("Average : %f        %f        %f        %f\n\n",
 								avgMark, avgSweep, avgExpand, avgGCDuration);
+
+	/* Nursery pauses are compared by their distribution (e.g. scavenger_pause_stw.xml against scavenger_pause_concurrent.xml) */
+	if (!scavengepause_values.empty()) {
+		std::sort(scavengepause_values.begin(), scavengepause_values.end());
+		omrtty_printf("Scavenge pauses (ms), count %zu\n", scavengepause_values.size());
+		omrtty_printf("            Min            P50            P90            P99            Max            Average\n");
+		omrtty_printf("-----------------------------------------------------------------------------------------------\n");
+		omrtty_printf("          %f       %f       %f       %f       %f       %f\n\n",
+								scavengepause_values.front(), getPercentile(scavengepause_values, 50), getPercentile(scavengepause_values, 90),
+								getPercentile(scavengepause_values, 99), scavengepause_values.back(), getAvg(scavengepause_values));
+	}
 }
@@ -89,6 +89,10 @@ omrvmem_commit_memory(struct OMRPortLibrary *portLibrary, void *address, uintptr
  * vmemAdviseOSonFree is set, based on -XX:+DisclaimVirtualMemory and -XX:-DisclaimVirtualMemory command line options.
  * If vmemAdviseOSonFree is not set, then no memory will be disclaimed.
  *
+ * If OMRPORT_VMEM_MEMORY_MODE_DECOMMIT_LAZILY is set in the mode of the identifier passed to this call, platforms that
+ * support it may leave the pages mapped until the OS is under memory pressure, so the contents of decommitted memory
+ * are undefined until it is written again. The flag can be set on a copy of the identifier to make a single decommit lazy.
+ *
  * @param[in] portLibrary The port library.
  * @param[in] address The starting address of the memory to be decommitted. Must be page aligned.
  * @param[in] byteAmount The number of bytes to be decommitted. Must be an exact multiple of page size.
@@ -55,6 +55,10 @@
 #if !defined(MADV_HUGEPAGE)
 #define MADV_HUGEPAGE 14
 #endif /* MADV_HUGEPAGE */
+/* MADV_FREE is only defined in <sys/mman.h> from glibc 2.24, and only supported by kernels from 4.5 */
+#if !defined(MADV_FREE)
+#define MADV_FREE 8
+#endif /* MADV_FREE */
 
 #if !defined(MFD_HUGETLB)
 #define MFD_HUGETLB 0x4
@@ -686,7 +690,16 @@ omrvmem_decommit_memory(struct OMRPortLibrary *portLibrary, void *address, uintp
 
 			if (byteAmount > 0) {
 				if (identifier->allocator == OMRPORT_VMEM_RESERVE_USED_MMAP) {
-					result = (intptr_t)madvise((void *)address, (size_t) byteAmount, MADV_DONTNEED);
+					if (0 != (identifier->mode & OMRPORT_VMEM_MEMORY_MODE_DECOMMIT_LAZILY)) {
+						/* let the kernel reclaim the pages when it is under memory pressure, rather than unmapping them now */
+						result = (intptr_t)madvise((void *)address, (size_t) byteAmount, MADV_FREE);
+						if ((0 != result) && (EINVAL == errno)) {
+							/* the kernel predates MADV_FREE */
+							result = (intptr_t)madvise((void *)address, (size_t) byteAmount, MADV_DONTNEED);
+						}
+					} else {
+						result = (intptr_t)madvise((void *)address, (size_t) byteAmount, MADV_DONTNEED);
+					}
 				} else if (identifier->allocator == OMRPORT_VMEM_RESERVE_USED_MMAP_SHM) {
 					/* If heap is created using shared memory with mmap, we must set advice to MADV_REMOVE, because
 					* pages might not be immediately freed in a successful madvise used with MADV_DONTNEED in